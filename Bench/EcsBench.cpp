@@ -0,0 +1,167 @@
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "Ecs/Query.hpp"
+#include "Renderer/DrawCollector.hpp"
+
+namespace {
+    using namespace Pulsar;
+
+    struct Position {
+        float x, y, z;
+    };
+
+    struct Velocity {
+        float x, y, z;
+    };
+
+    struct Health {
+        float value;
+    };
+
+    constexpr float s_DeltaTime = 1.0F / 60.0F;
+
+    // Half the entities carry an extra component so iteration spans two archetypes.
+    void Populate(Ecs::World &world, const size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            const auto value = static_cast<float>(i);
+
+            if (i % 2 == 0) {
+                world.CreateEntity(Position{value, 0.0F, 0.0F}, Velocity{1.0F, 2.0F, 3.0F});
+            } else {
+                world.CreateEntity(Position{value, 0.0F, 0.0F}, Velocity{1.0F, 2.0F, 3.0F}, Health{100.0F});
+            }
+        }
+    }
+
+    void BM_EcsForEach(benchmark::State &state) {
+        Ecs::World world;
+        Populate(world, static_cast<size_t>(state.range(0)));
+
+        Ecs::Query<Position, const Velocity> query;
+
+        for (auto _ : state) {
+            query.ForEach(world, [](Ecs::Entity, Position &position, const Velocity &velocity) {
+                position.x += velocity.x * s_DeltaTime;
+                position.y += velocity.y * s_DeltaTime;
+                position.z += velocity.z * s_DeltaTime;
+            });
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_EcsForEachChunk(benchmark::State &state) {
+        Ecs::World world;
+        Populate(world, static_cast<size_t>(state.range(0)));
+
+        Ecs::Query<Position, const Velocity> query;
+
+        for (auto _ : state) {
+            query.ForEachChunk(world, [](const Ecs::ChunkView<Position, const Velocity> &chunk) {
+                const std::span<Position>       positions  = chunk.Get<Position>();
+                const std::span<const Velocity> velocities = chunk.Get<const Velocity>();
+
+                for (uint32_t i = 0; i < chunk.GetCount(); i++) {
+                    positions[i].x += velocities[i].x * s_DeltaTime;
+                    positions[i].y += velocities[i].y * s_DeltaTime;
+                    positions[i].z += velocities[i].z * s_DeltaTime;
+                }
+            });
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_EcsParallelForEachChunk(benchmark::State &state) {
+        Ecs::World world;
+        Populate(world, static_cast<size_t>(state.range(0)));
+
+        Ecs::Query<Position, const Velocity> query;
+        Threading::JobSystem                 jobSystem = Threading::JobSystem::Create();
+
+        for (auto _ : state) {
+            query.ParallelForEachChunk(world, jobSystem, [](const Ecs::ChunkView<Position, const Velocity> &chunk) {
+                const std::span<Position>       positions  = chunk.Get<Position>();
+                const std::span<const Velocity> velocities = chunk.Get<const Velocity>();
+
+                for (uint32_t i = 0; i < chunk.GetCount(); i++) {
+                    positions[i].x += velocities[i].x * s_DeltaTime;
+                    positions[i].y += velocities[i].y * s_DeltaTime;
+                    positions[i].z += velocities[i].z * s_DeltaTime;
+                }
+            });
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // Baseline: type-erased components owned per object, the layout the ECS replaces.
+    void BM_TypeErasedForEach(benchmark::State &state) {
+        const auto count = static_cast<size_t>(state.range(0));
+
+        std::vector<std::unique_ptr<std::array<std::any, 2>>> objects;
+        objects.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            objects.push_back(std::make_unique<std::array<std::any, 2>>(std::array<std::any, 2>{
+                Position{static_cast<float>(i), 0.0F, 0.0F}, Velocity{1.0F, 2.0F, 3.0F}
+            }));
+        }
+
+        std::shuffle(objects.begin(), objects.end(), std::mt19937(static_cast<uint32_t>(count)));
+
+        for (auto _ : state) {
+            for (const auto &object : objects) {
+                auto &      position = std::any_cast<Position &>((*object)[0]);
+                const auto &velocity = std::any_cast<const Velocity &>((*object)[1]);
+
+                position.x += velocity.x * s_DeltaTime;
+                position.y += velocity.y * s_DeltaTime;
+                position.z += velocity.z * s_DeltaTime;
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_EcsDrawCollect(benchmark::State &state) {
+        const auto   count = static_cast<size_t>(state.range(0));
+        std::mt19937 random(static_cast<uint32_t>(count));
+
+        std::uniform_real_distribution position(-100.0F, 100.0F);
+
+        Ecs::World world;
+        for (size_t i = 0; i < count; i++) {
+            world.CreateEntity(Renderer::WorldTransform{
+                                   Math::Translate({position(random), position(random), position(random)})
+                               },
+                               Renderer::MeshRenderer{
+                                   static_cast<uint32_t>(random() % 4), static_cast<uint32_t>(random() % 16),
+                                   static_cast<uint32_t>(random() % 256)
+                               });
+        }
+
+        const std::vector<Renderer::MeshRange> meshes(256, {0, 360, 0});
+
+        Renderer::DrawCollector collector;
+        Renderer::DrawList      drawList;
+
+        for (auto _ : state) {
+            drawList.Clear();
+            collector.Collect(world, {Math::Mat4::Identity(), 0.1F, 200.0F}, drawList);
+            drawList.Build(meshes);
+
+            benchmark::DoNotOptimize(drawList.GetCommands().data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+BENCHMARK(BM_EcsForEach)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_EcsForEachChunk)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_EcsParallelForEachChunk)->RangeMultiplier(10)->Range(10'000, 1'000'000)
+    ->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(BM_TypeErasedForEach)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_EcsDrawCollect)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,70 @@
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "FileIo/File.hpp"
+
+namespace {
+    using namespace Pulsar;
+
+    // Written once per size and left in the page cache, so the benchmarks measure the read path rather than
+    // the disk.
+    class TempFile {
+    public:
+        explicit TempFile(const int64_t size)
+            : m_Path((std::filesystem::temp_directory_path() / ("PulsarBench-" + std::to_string(size) + ".bin"))
+                  .string()) {
+            std::mt19937 random(static_cast<uint32_t>(size));
+            std::string  contents(static_cast<size_t>(size), '\0');
+
+            for (char &value : contents) {
+                value = static_cast<char>(random());
+            }
+
+            std::ofstream(m_Path, std::ios::binary).write(contents.data(), static_cast<std::streamsize>(size));
+        }
+
+        ~TempFile() {
+            std::error_code errorCode;
+            std::filesystem::remove(m_Path, errorCode);
+        }
+
+        TempFile(const TempFile &other) = delete;
+
+        TempFile &operator=(const TempFile &other) = delete;
+
+        [[nodiscard]] const std::string &GetPath() const {
+            return m_Path;
+        }
+
+    private:
+        std::string m_Path;
+    };
+
+    void BM_ReadFile(benchmark::State &state) {
+        const TempFile file(state.range(0));
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(FileIo::ReadFile(file.GetPath()));
+        }
+
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_ReadFileBytes(benchmark::State &state) {
+        const TempFile file(state.range(0));
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(FileIo::ReadFileBytes(file.GetPath()));
+        }
+
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+}
+
+BENCHMARK(BM_ReadFile)->Arg(64 * 1024)->Arg(4 * 1024 * 1024)->Arg(64 * 1024 * 1024)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ReadFileBytes)->Arg(64 * 1024)->Arg(4 * 1024 * 1024)->Arg(64 * 1024 * 1024)
+                           ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,66 @@
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include "Threading/JobSystem.hpp"
+
+namespace {
+    using namespace Pulsar;
+
+    float Work(const uint32_t i) {
+        return std::sqrt(static_cast<float>(i)) * std::sin(static_cast<float>(i));
+    }
+
+    void BM_JobScheduleWait(benchmark::State &state) {
+        Threading::JobSystem jobSystem = Threading::JobSystem::Create();
+
+        for (auto _ : state) {
+            Threading::JobCounter counter;
+
+            for (int64_t i = 0; i < state.range(0); i++) {
+                jobSystem.Schedule([] {}, &counter);
+            }
+
+            jobSystem.Wait(counter);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_SerialFor(benchmark::State &state) {
+        const auto         count = static_cast<uint32_t>(state.range(0));
+        std::vector<float> values(count);
+
+        for (auto _ : state) {
+            for (uint32_t i = 0; i < count; i++) {
+                values[i] = Work(i);
+            }
+
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_ParallelFor(benchmark::State &state) {
+        const auto           count     = static_cast<uint32_t>(state.range(0));
+        std::vector<float>   values(count);
+        Threading::JobSystem jobSystem = Threading::JobSystem::Create();
+
+        for (auto _ : state) {
+            jobSystem.ParallelFor(count, [&values](const uint32_t begin, const uint32_t end) {
+                for (uint32_t i = begin; i < end; i++) {
+                    values[i] = Work(i);
+                }
+            });
+
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+BENCHMARK(BM_JobScheduleWait)->Arg(1024)->Arg(16384)->UseRealTime();
+BENCHMARK(BM_SerialFor)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_ParallelFor)->Arg(1 << 16)->Arg(1 << 20)->UseRealTime();
@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+
+#include "Logging/Log.hpp"
+
+namespace {
+    using namespace Pulsar;
+
+    // The caller's side of a typical message: integers, a float and a short string copied into the thread's
+    // buffer. Drops are counted rather than hidden, since a full buffer makes a call cheaper.
+    void BM_LogMessage(benchmark::State &state) {
+        Logging::ClearSinks();
+        Logging::AddSink([](const Logging::LogEntry &) {});
+        Logging::SetMinSeverity(Logging::Category::Renderer, Logging::Severity::Trace);
+
+        const std::string name     = "SponzaAtrium";
+        const uint64_t    dropped  = Logging::GetDroppedCount();
+        uint32_t          drawCall = 0;
+
+        for (auto _ : state) {
+            Logging::Info(Logging::Category::Renderer, "Draw {} of {} took {} ms", drawCall++, name, 0.25f);
+        }
+
+        Logging::Flush();
+        state.counters["dropped"] = static_cast<double>(Logging::GetDroppedCount() - dropped);
+
+        Logging::ClearSinks();
+    }
+
+    void BM_LogFiltered(benchmark::State &state) {
+        Logging::SetMinSeverity(Logging::Category::Renderer, Logging::Severity::Warning);
+
+        uint32_t drawCall = 0;
+
+        for (auto _ : state) {
+            Logging::Info(Logging::Category::Renderer, "Draw {} took {} ms", drawCall++, 0.25f);
+        }
+
+        benchmark::DoNotOptimize(drawCall);
+        Logging::SetMinSeverity(Logging::Category::Renderer, Logging::Severity::Trace);
+    }
+}
+
+BENCHMARK(BM_LogMessage);
+BENCHMARK(BM_LogFiltered);
@@ -0,0 +1,79 @@
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Glfw/Window.hpp"
+#include "Vulkan/Common.hpp"
+
+namespace {
+    // Flags given on the command line come after these, so they override them.
+    constexpr const char *s_DefaultArguments[] = {
+        "--benchmark_out=PulsarBench.json",
+        "--benchmark_out_format=json",
+        "--benchmark_repetitions=5",
+        "--benchmark_report_aggregates_only=true",
+        "--benchmark_enable_random_interleaving=true",
+        "--benchmark_min_warmup_time=0.1"
+    };
+
+    bool IsHeadlessRequested(const int argc, char **argv) {
+        const char *environment = std::getenv("PULSAR_BENCH_HEADLESS");
+
+        if (environment != nullptr && std::strcmp(environment, "0") != 0) {
+            return true;
+        }
+
+        for (int i = 1; i < argc; i++) {
+            if (std::strcmp(argv[i], "--headless") == 0) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
+
+// Usage: PulsarBench [--headless] [benchmark flags]
+// --headless (or PULSAR_BENCH_HEADLESS=1) runs the Vulkan benchmarks without a display, e.g. on lavapipe in CI.
+// Results are written to PulsarBench.json unless --benchmark_out says otherwise.
+int main(int argc, char **argv) {
+    using namespace Pulsar;
+
+    const bool headless = IsHeadlessRequested(argc, argv);
+
+    std::vector<char *> arguments = {argv[0]};
+    for (const char *argument : s_DefaultArguments) {
+        arguments.push_back(const_cast<char *>(argument));
+    }
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--headless") != 0) {
+            arguments.push_back(argv[i]);
+        }
+    }
+
+    if (headless) {
+        Glfw::Window::UseNullPlatform();
+    }
+
+    const Version version = Vulkan::g_EngineVersion;
+    benchmark::AddCustomContext("pulsar_version", std::to_string(version.major) + '.' +
+                                                  std::to_string(version.minor) + '.' +
+                                                  std::to_string(version.hotfix));
+    benchmark::AddCustomContext("pulsar_headless", headless ? "true" : "false");
+
+    int argumentCount = static_cast<int>(arguments.size());
+    benchmark::Initialize(&argumentCount, arguments.data());
+
+    if (benchmark::ReportUnrecognizedArguments(argumentCount, arguments.data())) {
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return 0;
+}
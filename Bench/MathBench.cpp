@@ -0,0 +1,124 @@
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "Math/Batch.hpp"
+#include "Math/Quaternion.hpp"
+
+namespace {
+    using namespace Pulsar;
+
+    struct Points {
+        std::vector<float> x;
+        std::vector<float> y;
+        std::vector<float> z;
+
+        explicit Points(const size_t count) : x(count), y(count), z(count) {}
+
+        Math::Vec3Span GetSpan() { return {x, y, z}; }
+    };
+
+    Points MakePoints(const size_t count, const float low, const float high) {
+        std::mt19937                          random(static_cast<uint32_t>(count));
+        std::uniform_real_distribution<float> distribution(low, high);
+
+        Points points(count);
+        for (size_t i = 0; i < count; i++) {
+            points.x[i] = distribution(random);
+            points.y[i] = distribution(random);
+            points.z[i] = distribution(random);
+        }
+
+        return points;
+    }
+
+    std::vector<Math::Mat4> MakeTransforms(const size_t count) {
+        std::mt19937                          random(static_cast<uint32_t>(count));
+        std::uniform_real_distribution<float> distribution(-10.0F, 10.0F);
+
+        std::vector<Math::Mat4> transforms(count);
+        for (Math::Mat4 &transform : transforms) {
+            const Math::Quat rotation = Math::Quat::FromAxisAngle(
+                {distribution(random), distribution(random), distribution(random)}, distribution(random));
+            transform = Math::ComposeTransform({distribution(random), distribution(random), distribution(random)},
+                                               rotation, Math::Vec3(1.0F));
+        }
+
+        return transforms;
+    }
+
+    Math::FrustumPlanes MakeFrustum() {
+        const Math::Mat4 viewProjection = Math::Perspective(1.2F, 16.0F / 9.0F, 0.1F, 100.0F) *
+                                          Math::LookAt({0.0F, 0.0F, 0.0F}, {0.0F, 0.0F, -1.0F}, {0.0F, 1.0F, 0.0F});
+        const Math::Mat4 rows = Math::Transpose(viewProjection);
+
+        Math::FrustumPlanes planes = {
+            rows[3] + rows[0], rows[3] - rows[0], rows[3] + rows[1], rows[3] - rows[1], rows[2], rows[3] - rows[2]
+        };
+
+        for (Math::Vec4 &plane : planes) {
+            plane = plane / Math::Length(plane.Xyz());
+        }
+
+        return planes;
+    }
+
+    template<auto Kernel>
+    void BM_TransformPoints(benchmark::State &state) {
+        const auto       count  = static_cast<size_t>(state.range(0));
+        Points           points = MakePoints(count, -100.0F, 100.0F);
+        Points           result(count);
+        const Math::Mat4 matrix = MakeTransforms(1)[0];
+
+        for (auto _ : state) {
+            Kernel(matrix, points.GetSpan(), result.GetSpan());
+            benchmark::DoNotOptimize(result.x.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template<auto Kernel>
+    void BM_ComposeMatrices(benchmark::State &state) {
+        const auto                    count  = static_cast<size_t>(state.range(0));
+        const std::vector<Math::Mat4> left   = MakeTransforms(count);
+        const std::vector<Math::Mat4> right  = MakeTransforms(count + 1);
+        std::vector<Math::Mat4>       result(count);
+
+        for (auto _ : state) {
+            Kernel(left, std::span(right).first(count), result);
+            benchmark::DoNotOptimize(result.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template<auto Kernel>
+    void BM_TestAabbs(benchmark::State &state) {
+        const auto                count   = static_cast<size_t>(state.range(0));
+        Points                    centers = MakePoints(count, -100.0F, 100.0F);
+        Points                    extents = MakePoints(count, 0.5F, 2.0F);
+        std::vector<uint8_t>      visible(count);
+        const Math::FrustumPlanes planes = MakeFrustum();
+
+        for (auto _ : state) {
+            Kernel(planes, centers.GetSpan(), extents.GetSpan(), visible);
+            benchmark::DoNotOptimize(visible.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+BENCHMARK(BM_TransformPoints<Math::TransformPointsScalar>)->Name("BM_TransformPointsScalar")
+    ->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TransformPoints<Math::TransformPoints>)->Name("BM_TransformPointsSimd")
+    ->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ComposeMatrices<Math::ComposeMatricesScalar>)->Name("BM_ComposeMatricesScalar")
+    ->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ComposeMatrices<Math::ComposeMatrices>)->Name("BM_ComposeMatricesSimd")
+    ->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TestAabbs<Math::TestAabbsScalar>)->Name("BM_TestAabbsScalar")
+    ->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TestAabbs<Math::TestAabbs>)->Name("BM_TestAabbsSimd")
+    ->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
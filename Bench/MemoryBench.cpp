@@ -0,0 +1,133 @@
+#include <benchmark/benchmark.h>
+
+#include "Ecs/CommandBuffer.hpp"
+#include "Memory/FrameArenas.hpp"
+#include "Memory/Scratch.hpp"
+
+namespace {
+    using namespace Pulsar;
+
+    struct TransientDraw {
+        uint64_t key;
+        uint32_t object;
+        uint32_t mesh;
+    };
+
+    // Counts what the baseline costs in heap allocations.
+    class CountingResource final : public std::pmr::memory_resource {
+    public:
+        uint64_t allocations = 0;
+
+    private:
+        void *do_allocate(const size_t bytes, const size_t alignment) override {
+            allocations++;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void *pointer, const size_t bytes, const size_t alignment) override {
+            std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+            return this == &other;
+        }
+    };
+
+    void FillFrame(std::pmr::memory_resource *resource, const uint32_t count) {
+        std::pmr::vector<TransientDraw>    draws(resource);
+        std::pmr::vector<std::pmr::string> names(resource);
+
+        for (uint32_t i = 0; i < count; i++) {
+            draws.push_back({static_cast<uint64_t>(i) * 2654435761u, i, i % 64});
+
+            if (i % 64 == 0) {
+                names.emplace_back("transient render target name");
+            }
+        }
+
+        benchmark::DoNotOptimize(draws.data());
+        benchmark::DoNotOptimize(names.data());
+    }
+
+    void BM_FrameDataHeap(benchmark::State &state) {
+        CountingResource resource;
+
+        for (auto _ : state) {
+            FillFrame(&resource, static_cast<uint32_t>(state.range(0)));
+        }
+
+        state.counters["heapAllocs"] = benchmark::Counter(static_cast<double>(resource.allocations),
+                                                          benchmark::Counter::kAvgIterations);
+    }
+
+    void BM_FrameDataArena(benchmark::State &state) {
+        Memory::FrameArenas arenas = Memory::FrameArenas::Create(64 * 1024);
+        uint32_t            frame  = 0;
+
+        // Warm-up frames let the arenas grow to the workload before measuring.
+        for (uint32_t i = 0; i < arenas.GetFrameCount() * 2; i++) {
+            arenas.BeginFrame(frame++ % arenas.GetFrameCount());
+            FillFrame(arenas.GetResource(), static_cast<uint32_t>(state.range(0)));
+        }
+
+        const uint64_t heapBefore = arenas.GetStats().heapAllocations;
+
+        for (auto _ : state) {
+            arenas.BeginFrame(frame++ % arenas.GetFrameCount());
+            FillFrame(arenas.GetResource(), static_cast<uint32_t>(state.range(0)));
+        }
+
+        state.counters["heapAllocs"] = benchmark::Counter(
+            static_cast<double>(arenas.GetStats().heapAllocations - heapBefore), benchmark::Counter::kAvgIterations);
+    }
+
+    void BM_ScratchArray(benchmark::State &state) {
+        const auto count = static_cast<size_t>(state.range(0));
+
+        for (auto _ : state) {
+            Memory::ScratchScope      scratch;
+            const std::span<uint32_t> indices = scratch.AllocateArray<uint32_t>(count);
+
+            for (size_t i = 0; i < count; i++) {
+                indices[i] = static_cast<uint32_t>(count - i);
+            }
+
+            benchmark::DoNotOptimize(indices.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_EcsCommandBuffer(benchmark::State &state) {
+        Ecs::World         world;
+        Ecs::CommandBuffer commands;
+
+        const auto recordAndPlay = [&world, &commands](const int64_t count) {
+            for (int64_t i = 0; i < count; i++) {
+                commands.DestroyEntity(Ecs::g_NullEntity);
+            }
+
+            commands.Playback(world);
+        };
+
+        // Both arenas grow during the first two playbacks.
+        recordAndPlay(state.range(0));
+        recordAndPlay(state.range(0));
+
+        const uint64_t heapBefore = commands.GetArenaStats().heapAllocations;
+
+        for (auto _ : state) {
+            recordAndPlay(state.range(0));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.counters["heapAllocs"] = benchmark::Counter(
+            static_cast<double>(commands.GetArenaStats().heapAllocations - heapBefore),
+            benchmark::Counter::kAvgIterations);
+    }
+}
+
+BENCHMARK(BM_FrameDataHeap)->Arg(1024)->Arg(16384);
+BENCHMARK(BM_FrameDataArena)->Arg(1024)->Arg(16384);
+BENCHMARK(BM_ScratchArray)->Arg(4096);
+BENCHMARK(BM_EcsCommandBuffer)->Arg(1024);
@@ -0,0 +1,88 @@
+#include <numeric>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "Mesh/MeshProcessing.hpp"
+#include "Mesh/Primitives.hpp"
+
+namespace {
+    using namespace Pulsar;
+
+    // Unwelds and shuffles the triangles of a sphere to mimic an unprocessed export from a DCC tool.
+    Mesh::MeshData MakeUnprocessedMesh(const uint32_t segments) {
+        const Mesh::MeshData sphere = Mesh::GenerateSphere(segments, segments / 2);
+
+        std::vector<uint32_t> triangles(sphere.indices.size() / 3);
+        std::iota(triangles.begin(), triangles.end(), 0);
+        std::shuffle(triangles.begin(), triangles.end(), std::mt19937(segments));
+
+        Mesh::MeshData mesh;
+        mesh.vertices.reserve(sphere.indices.size());
+        mesh.indices.reserve(sphere.indices.size());
+
+        for (const uint32_t triangle : triangles) {
+            for (uint32_t corner = 0; corner < 3; corner++) {
+                mesh.indices.push_back(static_cast<uint32_t>(mesh.vertices.size()));
+                mesh.vertices.push_back(sphere.vertices[sphere.indices[triangle * 3 + corner]]);
+            }
+        }
+
+        return mesh;
+    }
+
+    void SetCounters(benchmark::State &state, const Mesh::MeshStatistics &statistics, const size_t vertexCount) {
+        state.counters["ACMR"]           = statistics.averageCacheMissRatio;
+        state.counters["ATVR"]           = statistics.averageTransformedPerVertex;
+        state.counters["Overfetch"]      = statistics.overfetch;
+        state.counters["Overdraw"]       = statistics.overdraw;
+        state.counters["VertexBytes"]    = static_cast<double>(statistics.vertexBytes);
+        state.counters["IndexBytes"]     = static_cast<double>(statistics.indexBytes);
+        state.counters["BytesPerVertex"] = vertexCount == 0
+                                               ? 0.0
+                                               : static_cast<double>(statistics.vertexBytes + statistics.indexBytes) /
+                                               static_cast<double>(vertexCount);
+    }
+
+    void BM_MeshUnprocessed(benchmark::State &state) {
+        const Mesh::MeshData mesh = MakeUnprocessedMesh(static_cast<uint32_t>(state.range(0)));
+
+        Mesh::MeshStatistics statistics;
+        for (auto _ : state) {
+            statistics = Mesh::AnalyzeMesh(mesh);
+            benchmark::DoNotOptimize(statistics);
+        }
+
+        SetCounters(state, statistics, mesh.vertices.size());
+    }
+
+    void BM_MeshOptimize(benchmark::State &state) {
+        const Mesh::MeshData source = MakeUnprocessedMesh(static_cast<uint32_t>(state.range(0)));
+
+        Mesh::MeshData mesh;
+        for (auto _ : state) {
+            mesh = source;
+            Mesh::OptimizeMesh(mesh);
+            benchmark::DoNotOptimize(mesh.indices.data());
+        }
+
+        SetCounters(state, Mesh::AnalyzeMesh(mesh), mesh.vertices.size());
+    }
+
+    void BM_MeshOptimizeQuantize(benchmark::State &state) {
+        Mesh::MeshData mesh = MakeUnprocessedMesh(static_cast<uint32_t>(state.range(0)));
+        Mesh::OptimizeMesh(mesh);
+
+        Mesh::QuantizedMesh quantized;
+        for (auto _ : state) {
+            quantized = Mesh::QuantizeMesh(mesh);
+            benchmark::DoNotOptimize(quantized.vertices.data());
+        }
+
+        SetCounters(state, Mesh::AnalyzeMesh(quantized), quantized.vertices.size());
+    }
+}
+
+BENCHMARK(BM_MeshUnprocessed)->Arg(128)->Arg(512)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MeshOptimize)->Arg(128)->Arg(512)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MeshOptimizeQuantize)->Arg(128)->Arg(512)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,142 @@
+#include <numbers>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "Math/Frustum.hpp"
+#include "Renderer/DrawList.hpp"
+#include "Renderer/RadixSort.hpp"
+
+namespace {
+    using namespace Pulsar;
+
+    constexpr uint32_t s_PipelineCount      = 4;
+    constexpr uint32_t s_DescriptorSetCount = 16;
+    constexpr uint32_t s_MeshCount          = 256;
+
+    std::vector<Renderer::MeshRange> MakeMeshRanges() {
+        std::vector<Renderer::MeshRange> meshes(s_MeshCount);
+
+        for (uint32_t i = 0; i < s_MeshCount; i++) {
+            meshes[i] = {i * 360, 360, static_cast<int32_t>(i * 128)};
+        }
+
+        return meshes;
+    }
+
+    std::vector<Renderer::DrawPacket> MakePackets(const size_t count) {
+        std::mt19937 random(static_cast<uint32_t>(count));
+
+        std::vector<Renderer::DrawPacket> packets(count);
+        for (size_t i = 0; i < count; i++) {
+            packets[i] = {
+                Renderer::MakeDrawKey(random() % s_PipelineCount, random() % s_DescriptorSetCount,
+                                      random() % s_MeshCount, random()),
+                static_cast<uint32_t>(i)
+            };
+        }
+
+        return packets;
+    }
+
+    void BM_RadixSort(benchmark::State &state) {
+        const std::vector<Renderer::DrawPacket> source = MakePackets(static_cast<size_t>(state.range(0)));
+
+        std::vector<Renderer::DrawPacket> packets;
+        std::vector<Renderer::DrawPacket> scratch;
+
+        for (auto _ : state) {
+            state.PauseTiming();
+            packets = source;
+            state.ResumeTiming();
+
+            Renderer::RadixSort(packets, scratch);
+            benchmark::DoNotOptimize(packets.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_StdSort(benchmark::State &state) {
+        const std::vector<Renderer::DrawPacket> source = MakePackets(static_cast<size_t>(state.range(0)));
+
+        std::vector<Renderer::DrawPacket> packets;
+
+        for (auto _ : state) {
+            state.PauseTiming();
+            packets = source;
+            state.ResumeTiming();
+
+            std::sort(packets.begin(), packets.end(), [](const auto &left, const auto &right) {
+                return left.key < right.key;
+            });
+            benchmark::DoNotOptimize(packets.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // Full per-frame CPU cost: submit every object, sort, merge into instanced indirect commands.
+    void BM_DrawListBuild(benchmark::State &state) {
+        const std::vector<Renderer::DrawPacket> packets = MakePackets(static_cast<size_t>(state.range(0)));
+        const std::vector<Renderer::MeshRange>  meshes  = MakeMeshRanges();
+
+        Renderer::DrawList drawList;
+        drawList.Reserve(packets.size());
+
+        for (auto _ : state) {
+            drawList.Clear();
+
+            for (const Renderer::DrawPacket &packet : packets) {
+                drawList.Submit(packet);
+            }
+
+            drawList.Build(meshes);
+            benchmark::DoNotOptimize(drawList.GetCommands().data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.counters["Commands"] = static_cast<double>(drawList.GetCommands().size());
+        state.counters["Batches"]  = static_cast<double>(drawList.GetBatches().size());
+    }
+
+    // The per-object work GpuCulling moves off the CPU: a sphere-frustum test and a survivor list per frame.
+    void BM_CpuFrustumCull(benchmark::State &state) {
+        const auto   count = static_cast<size_t>(state.range(0));
+        std::mt19937 random(static_cast<uint32_t>(count));
+
+        std::uniform_real_distribution position(-100.0F, 100.0F);
+        std::vector<std::array<float, 4>> spheres(count);
+        for (std::array<float, 4> &sphere : spheres) {
+            sphere = {position(random), position(random), position(random), 1.0F};
+        }
+
+        // Camera at the origin looking down -z with a 90 degree field of view, near 0.1 and far 100.
+        const Math::FrustumPlanes planes =
+            Math::ExtractFrustum(Math::Perspective(std::numbers::pi_v<float> * 0.5F, 1.0F, 0.1F, 100.0F));
+
+        std::vector<uint32_t> visible;
+        visible.reserve(count);
+
+        for (auto _ : state) {
+            visible.clear();
+
+            for (size_t i = 0; i < count; i++) {
+                const std::array<float, 4> &sphere = spheres[i];
+                if (Math::IsSphereVisible(planes, {sphere[0], sphere[1], sphere[2]}, sphere[3])) {
+                    visible.push_back(static_cast<uint32_t>(i));
+                }
+            }
+
+            benchmark::DoNotOptimize(visible.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.counters["Visible"] = static_cast<double>(visible.size());
+    }
+}
+
+BENCHMARK(BM_RadixSort)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_StdSort)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DrawListBuild)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CpuFrustumCull)->RangeMultiplier(10)->Range(10'000, 1'000'000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,291 @@
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <variant>
+
+#include <benchmark/benchmark.h>
+
+#include "FileIo/File.hpp"
+#include "Scene/Scene.hpp"
+#include "Scene/SceneWriter.hpp"
+
+namespace {
+    using namespace Pulsar;
+
+    // Minimal JSON document model and parser, standing in for a text scene format as the baseline. It handles
+    // exactly what WriteJson emits: objects, arrays, strings without escapes and numbers.
+    struct JsonValue {
+        using Array  = std::vector<JsonValue>;
+        using Object = std::vector<std::pair<std::string, JsonValue>>;
+
+        std::variant<double, std::string, Array, Object> value;
+
+        [[nodiscard]] const JsonValue &operator[](const std::string_view key) const {
+            for (const auto &[name, member] : std::get<Object>(value)) {
+                if (name == key) {
+                    return member;
+                }
+            }
+
+            throw std::runtime_error("Failed to read JSON: Missing member");
+        }
+
+        [[nodiscard]] const Array &AsArray() const { return std::get<Array>(value); }
+        [[nodiscard]] double       AsNumber() const { return std::get<double>(value); }
+    };
+
+    class JsonParser {
+    public:
+        explicit JsonParser(const std::string_view text) : m_Text(text) {}
+
+        JsonValue Parse() {
+            SkipWhitespace();
+
+            switch (m_Text[m_Position]) {
+            case '{': {
+                JsonValue::Object object;
+                m_Position++;
+
+                while (Next() != '}') {
+                    std::string key = ParseString();
+                    Expect(':');
+                    object.emplace_back(std::move(key), Parse());
+                    SkipComma();
+                }
+
+                m_Position++;
+                return {std::move(object)};
+            }
+            case '[': {
+                JsonValue::Array array;
+                m_Position++;
+
+                while (Next() != ']') {
+                    array.push_back(Parse());
+                    SkipComma();
+                }
+
+                m_Position++;
+                return {std::move(array)};
+            }
+            case '"':
+                return {ParseString()};
+            default: {
+                double     number = 0.0;
+                const auto result = std::from_chars(m_Text.data() + m_Position, m_Text.data() + m_Text.size(),
+                                                    number);
+                m_Position = result.ptr - m_Text.data();
+                return {number};
+            }
+            }
+        }
+
+    private:
+        std::string_view m_Text;
+        size_t           m_Position = 0;
+
+        void SkipWhitespace() {
+            while (m_Position < m_Text.size() && std::isspace(static_cast<unsigned char>(m_Text[m_Position]))) {
+                m_Position++;
+            }
+        }
+
+        char Next() {
+            SkipWhitespace();
+            return m_Text[m_Position];
+        }
+
+        void Expect(const char c) {
+            if (Next() != c) {
+                throw std::runtime_error("Failed to read JSON: Unexpected character");
+            }
+
+            m_Position++;
+        }
+
+        void SkipComma() {
+            if (Next() == ',') {
+                m_Position++;
+            }
+        }
+
+        std::string ParseString() {
+            Expect('"');
+
+            const size_t end = m_Text.find('"', m_Position);
+            std::string  result(m_Text.substr(m_Position, end - m_Position));
+            m_Position = end + 1;
+
+            return result;
+        }
+    };
+
+    Math::Mat4 MakeTransform(const uint32_t index) {
+        Math::Mat4 transform = Math::Mat4::Identity();
+        transform[3]         = Math::Vec4(static_cast<float>(index), 1.5F, -2.25F, 1.0F);
+
+        return transform;
+    }
+
+    // One root per 16 nodes with the rest parented to it; every other node draws.
+    Scene::SceneWriter MakeScene(const uint32_t count) {
+        auto     writer = Scene::SceneWriter::Create();
+        uint32_t root   = Scene::g_SceneNoParent;
+
+        for (uint32_t i = 0; i < count; i++) {
+            const uint32_t node = writer.AddNode("Node" + std::to_string(i), MakeTransform(i),
+                                                 i % 16 == 0 ? Scene::g_SceneNoParent : root);
+            if (i % 16 == 0) {
+                root = node;
+            }
+
+            if (i % 2 == 0) {
+                writer.SetMeshRenderer(node, {i % 4, i % 8, i});
+            }
+        }
+
+        return writer;
+    }
+
+    void WriteJson(const std::string &path, const uint32_t count) {
+        std::string json = "{\"nodes\":[";
+        uint32_t    root = Scene::g_SceneNoParent;
+
+        const auto appendNumber = [&json](const auto value) {
+            std::array<char, 32> buffer{};
+            const auto           result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+            json.append(buffer.data(), result.ptr);
+        };
+
+        for (uint32_t i = 0; i < count; i++) {
+            if (i % 16 == 0) {
+                root = i;
+            }
+
+            json += i == 0 ? "\n{\"name\":\"Node" : ",\n{\"name\":\"Node";
+            json += std::to_string(i) + "\",\"parent\":";
+            appendNumber(i % 16 == 0 ? -1 : static_cast<int64_t>(root));
+            json += ",\"transform\":[";
+
+            std::array<float, 16> values{};
+            const Math::Mat4      transform = MakeTransform(i);
+            std::memcpy(values.data(), &transform, sizeof(values));
+
+            for (size_t j = 0; j < values.size(); j++) {
+                if (j != 0) {
+                    json += ',';
+                }
+
+                appendNumber(values[j]);
+            }
+
+            json += ']';
+
+            if (i % 2 == 0) {
+                json += ",\"meshRenderer\":{\"pipeline\":";
+                appendNumber(i % 4);
+                json += ",\"descriptorSet\":";
+                appendNumber(i % 8);
+                json += ",\"mesh\":";
+                appendNumber(i);
+                json += '}';
+            }
+
+            json += '}';
+        }
+
+        json += "\n]}";
+        std::ofstream(path, std::ios::binary).write(json.data(), static_cast<std::streamsize>(json.size()));
+    }
+
+    // Written once per size and left in the page cache, so the benchmarks compare loading rather than the disk.
+    class SceneFiles {
+    public:
+        explicit SceneFiles(const uint32_t count) {
+            const std::filesystem::path directory = std::filesystem::temp_directory_path();
+            const std::string           name      = "PulsarBench-Scene-" + std::to_string(count);
+
+            m_BinaryPath = (directory / (name + ".pscene")).string();
+            m_JsonPath   = (directory / (name + ".json")).string();
+
+            MakeScene(count).Write(m_BinaryPath);
+            WriteJson(m_JsonPath, count);
+        }
+
+        ~SceneFiles() {
+            std::error_code errorCode;
+            std::filesystem::remove(m_BinaryPath, errorCode);
+            std::filesystem::remove(m_JsonPath, errorCode);
+        }
+
+        SceneFiles(const SceneFiles &other) = delete;
+
+        SceneFiles &operator=(const SceneFiles &other) = delete;
+
+        [[nodiscard]] const std::string &GetBinaryPath() const { return m_BinaryPath; }
+        [[nodiscard]] const std::string &GetJsonPath() const { return m_JsonPath; }
+
+    private:
+        std::string m_BinaryPath;
+        std::string m_JsonPath;
+    };
+
+    void BM_SceneLoadBinary(benchmark::State &state) {
+        const SceneFiles files(static_cast<uint32_t>(state.range(0)));
+
+        for (auto _ : state) {
+            Ecs::World         world;
+            const Scene::Scene scene = Scene::Scene::Open(files.GetBinaryPath());
+
+            benchmark::DoNotOptimize(scene.Instantiate(world));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_SceneLoadJson(benchmark::State &state) {
+        const SceneFiles files(static_cast<uint32_t>(state.range(0)));
+
+        for (auto _ : state) {
+            Ecs::World                world;
+            std::vector<Ecs::Entity> entities;
+
+            const std::string text = FileIo::ReadFile(files.GetJsonPath());
+            const JsonValue   root = JsonParser(text).Parse();
+
+            for (const JsonValue &node : root["nodes"].AsArray()) {
+                const JsonValue::Array &values = node["transform"].AsArray();
+
+                Renderer::WorldTransform transform;
+                for (size_t i = 0; i < 16; i++) {
+                    transform.matrix[i / 4][i % 4] = static_cast<float>(values[i].AsNumber());
+                }
+
+                const auto &members = std::get<JsonValue::Object>(node.value);
+                const bool  hasMesh = std::any_of(members.begin(), members.end(), [](const auto &member) {
+                    return member.first == "meshRenderer";
+                });
+
+                if (hasMesh) {
+                    const JsonValue &meshRenderer = node["meshRenderer"];
+
+                    entities.push_back(world.CreateEntity(transform, Renderer::MeshRenderer{
+                        static_cast<uint32_t>(meshRenderer["pipeline"].AsNumber()),
+                        static_cast<uint32_t>(meshRenderer["descriptorSet"].AsNumber()),
+                        static_cast<uint32_t>(meshRenderer["mesh"].AsNumber())
+                    }));
+                } else {
+                    entities.push_back(world.CreateEntity(transform));
+                }
+            }
+
+            benchmark::DoNotOptimize(entities);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+BENCHMARK(BM_SceneLoadBinary)->Arg(1'000)->Arg(10'000)->Arg(100'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SceneLoadJson)->Arg(1'000)->Arg(10'000)->Arg(100'000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,71 @@
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "Vulkan/Shader.hpp"
+
+namespace {
+    using namespace Pulsar;
+
+    // A valid shader for the stage whose body is statementCount dependent arithmetic statements, so compile
+    // time scales with source size rather than with what the optimizer can fold away.
+    std::string MakeShaderSource(const Vulkan::ShaderType type, const int64_t statementCount) {
+        std::string source = "#version 450\n";
+
+        switch (type) {
+            case Vulkan::ShaderType::Vertex:
+                source += "layout(location = 0) in vec4 inPosition;\n"
+                        "layout(location = 0) out vec4 outValue;\n";
+                break;
+            case Vulkan::ShaderType::Fragment:
+                source += "layout(location = 0) in vec4 inValue;\n"
+                        "layout(location = 0) out vec4 outColor;\n";
+                break;
+            case Vulkan::ShaderType::Compute:
+                source += "layout(local_size_x = 64) in;\n"
+                        "layout(std430, binding = 0) buffer Values { vec4 values[]; };\n";
+                break;
+        }
+
+        source += "void main() {\n";
+
+        switch (type) {
+            case Vulkan::ShaderType::Vertex: source += "    vec4 value = inPosition;\n";
+                break;
+            case Vulkan::ShaderType::Fragment: source += "    vec4 value = inValue;\n";
+                break;
+            case Vulkan::ShaderType::Compute: source += "    vec4 value = values[gl_GlobalInvocationID.x];\n";
+                break;
+        }
+
+        for (int64_t i = 0; i < statementCount; i++) {
+            const std::string constant = std::to_string(i % 7 + 1) + ".0";
+            source += "    value = sin(value * " + constant + ") + cos(value.yzwx) * " + constant + ";\n";
+        }
+
+        switch (type) {
+            case Vulkan::ShaderType::Vertex: source += "    gl_Position = value;\n    outValue = value;\n";
+                break;
+            case Vulkan::ShaderType::Fragment: source += "    outColor = value;\n";
+                break;
+            case Vulkan::ShaderType::Compute: source += "    values[gl_GlobalInvocationID.x] = value;\n";
+                break;
+        }
+
+        return source + "}\n";
+    }
+
+    void BM_CompileShader(benchmark::State &state) {
+        const auto        type   = static_cast<Vulkan::ShaderType>(state.range(0));
+        const std::string source = MakeShaderSource(type, state.range(1));
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Vulkan::CompileShader(type, source));
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(source.size()));
+    }
+}
+
+BENCHMARK(BM_CompileShader)->ArgsProduct({{0, 1, 2}, {16, 256}})->ArgNames({"stage", "statements"})
+                           ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,165 @@
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "Spatial/Bvh.hpp"
+
+namespace {
+    using namespace Pulsar;
+
+    // Small boxes scattered through a cube whose side grows with the count, so density stays constant.
+    std::vector<Spatial::Aabb> MakeBoxes(const size_t count, const uint32_t seed = 1) {
+        const float side = std::cbrt(static_cast<float>(count)) * 4.0F;
+
+        std::mt19937                          random(seed);
+        std::uniform_real_distribution<float> position(0.0F, side);
+        std::uniform_real_distribution<float> size(0.1F, 1.0F);
+
+        std::vector<Spatial::Aabb> boxes(count);
+        for (Spatial::Aabb &box : boxes) {
+            box.min = {position(random), position(random), position(random)};
+            box.max = box.min + Math::Vec3(size(random), size(random), size(random));
+        }
+
+        return boxes;
+    }
+
+    // An axis-aligned view volume covering about a tenth of the scene along each axis.
+    Math::FrustumPlanes MakeFrustum(const Spatial::Aabb &scene, const Math::Vec3 &center) {
+        const Math::Vec3 half = (scene.max - scene.min) * 0.05F;
+
+        return {
+            Math::Vec4(1.0F, 0.0F, 0.0F, half.x - center.x), Math::Vec4(-1.0F, 0.0F, 0.0F, half.x + center.x),
+            Math::Vec4(0.0F, 1.0F, 0.0F, half.y - center.y), Math::Vec4(0.0F, -1.0F, 0.0F, half.y + center.y),
+            Math::Vec4(0.0F, 0.0F, 1.0F, half.z - center.z), Math::Vec4(0.0F, 0.0F, -1.0F, half.z + center.z)
+        };
+    }
+
+    void BM_BvhBuild(benchmark::State &state) {
+        const std::vector<Spatial::Aabb> boxes     = MakeBoxes(static_cast<size_t>(state.range(0)));
+        Threading::JobSystem             jobSystem = Threading::JobSystem::Create();
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Spatial::Bvh::Build(boxes, {}, state.range(1) != 0 ? &jobSystem : nullptr));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_BvhRefit(benchmark::State &state) {
+        std::vector<Spatial::Aabb> boxes     = MakeBoxes(static_cast<size_t>(state.range(0)));
+        Threading::JobSystem       jobSystem = Threading::JobSystem::Create();
+        Spatial::Bvh               bvh       = Spatial::Bvh::Build(boxes, {}, &jobSystem);
+
+        for (auto _ : state) {
+            for (Spatial::Aabb &box : boxes) {
+                box.min.x += 0.01F;
+                box.max.x += 0.01F;
+            }
+
+            bvh.Refit(boxes, &jobSystem);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_BvhQueryFrustum(benchmark::State &state) {
+        const std::vector<Spatial::Aabb> boxes     = MakeBoxes(static_cast<size_t>(state.range(0)));
+        Threading::JobSystem             jobSystem = Threading::JobSystem::Create();
+        const Spatial::Bvh               bvh       = Spatial::Bvh::Build(boxes, {}, &jobSystem);
+        const Math::FrustumPlanes        planes    = MakeFrustum(bvh.GetBounds(), bvh.GetBounds().GetCenter());
+
+        std::vector<uint32_t> visible;
+        for (auto _ : state) {
+            visible.clear();
+            bvh.QueryFrustum(planes, visible);
+            benchmark::DoNotOptimize(visible.data());
+        }
+
+        state.counters["visible"] = static_cast<double>(visible.size());
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // The brute-force baseline the BVH replaces: every box against the frustum with the batched SIMD kernel.
+    void BM_BruteForceFrustum(benchmark::State &state) {
+        const auto                       count = static_cast<size_t>(state.range(0));
+        const std::vector<Spatial::Aabb> boxes = MakeBoxes(count);
+
+        std::vector<float> centers[3];
+        std::vector<float> extents[3];
+        Spatial::Aabb      scene;
+
+        for (size_t axis = 0; axis < 3; axis++) {
+            centers[axis].resize(count);
+            extents[axis].resize(count);
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            scene.Extend(boxes[i]);
+
+            for (size_t axis = 0; axis < 3; axis++) {
+                centers[axis][i] = (boxes[i].min[axis] + boxes[i].max[axis]) * 0.5F;
+                extents[axis][i] = (boxes[i].max[axis] - boxes[i].min[axis]) * 0.5F;
+            }
+        }
+
+        const Math::FrustumPlanes planes = MakeFrustum(scene, scene.GetCenter());
+        std::vector<uint8_t>      visible(count);
+
+        for (auto _ : state) {
+            Math::TestAabbs(planes, {centers[0], centers[1], centers[2]}, {extents[0], extents[1], extents[2]},
+                            visible);
+            benchmark::DoNotOptimize(visible.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void BM_BvhQueryAabb(benchmark::State &state) {
+        const std::vector<Spatial::Aabb> boxes     = MakeBoxes(static_cast<size_t>(state.range(0)));
+        Threading::JobSystem             jobSystem = Threading::JobSystem::Create();
+        const Spatial::Bvh               bvh       = Spatial::Bvh::Build(boxes, {}, &jobSystem);
+
+        std::mt19937                          random(2);
+        std::uniform_real_distribution<float> position(0.0F, bvh.GetBounds().max.x);
+        std::vector<uint32_t>                 overlapping;
+
+        for (auto _ : state) {
+            const Math::Vec3 corner = {position(random), position(random), position(random)};
+
+            overlapping.clear();
+            bvh.QueryAabb({corner, corner + Math::Vec3(4.0F)}, overlapping);
+            benchmark::DoNotOptimize(overlapping.data());
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void BM_BvhRaycast(benchmark::State &state) {
+        const std::vector<Spatial::Aabb> boxes     = MakeBoxes(static_cast<size_t>(state.range(0)));
+        Threading::JobSystem             jobSystem = Threading::JobSystem::Create();
+        const Spatial::Bvh               bvh       = Spatial::Bvh::Build(boxes, {}, &jobSystem);
+        const Spatial::Aabb              scene     = bvh.GetBounds();
+
+        std::mt19937                          random(3);
+        std::uniform_real_distribution<float> direction(-1.0F, 1.0F);
+
+        for (auto _ : state) {
+            const Spatial::Ray ray = {scene.GetCenter(), {direction(random), direction(random), direction(random)}};
+            benchmark::DoNotOptimize(bvh.Raycast(ray));
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+BENCHMARK(BM_BvhBuild)
+    ->ArgsProduct({{100'000, 1'000'000, 10'000'000}, {0, 1}})
+    ->ArgNames({"count", "parallel"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK(BM_BvhRefit)->Arg(100'000)->Arg(1'000'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_BvhQueryFrustum)->Arg(100'000)->Arg(1'000'000)->Arg(10'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BruteForceFrustum)->Arg(100'000)->Arg(1'000'000)->Arg(10'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BvhQueryAabb)->Arg(100'000)->Arg(1'000'000)->Arg(10'000'000);
+BENCHMARK(BM_BvhRaycast)->Arg(100'000)->Arg(1'000'000)->Arg(10'000'000);
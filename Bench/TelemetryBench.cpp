@@ -0,0 +1,50 @@
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include "Telemetry/FrameStats.hpp"
+
+namespace {
+    using namespace Pulsar;
+
+    // A frame's worth of telemetry: begin, three timed sections, a late GPU value and end.
+    void BM_FrameStatsFrame(benchmark::State &state) {
+        Telemetry::FrameStatsConfig config;
+        config.enabled = state.range(0) != 0;
+
+        Telemetry::FrameStats stats = Telemetry::FrameStats::Create(config);
+
+        for (auto _ : state) {
+            const uint64_t frame = stats.BeginFrame();
+
+            {
+                const Telemetry::FrameStats::ScopedTimer timer = stats.Measure(Telemetry::FrameMetric::AcquireWait);
+            }
+            {
+                const Telemetry::FrameStats::ScopedTimer timer = stats.Measure(Telemetry::FrameMetric::Submit);
+            }
+            {
+                const Telemetry::FrameStats::ScopedTimer timer = stats.Measure(Telemetry::FrameMetric::Present);
+            }
+
+            stats.Record(frame > 2 ? frame - 2 : 0, Telemetry::FrameMetric::Gpu, std::chrono::microseconds(500));
+            stats.EndFrame();
+        }
+    }
+
+    void BM_HistogramPercentile(benchmark::State &state) {
+        std::mt19937_64      random(1);
+        Telemetry::Histogram histogram;
+
+        for (int i = 0; i < 4096; i++) {
+            histogram.Record(random() % 50'000'000);
+        }
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(histogram.GetPercentile(99.9));
+        }
+    }
+}
+
+BENCHMARK(BM_FrameStatsFrame)->Arg(0)->Arg(1)->ArgName("enabled");
+BENCHMARK(BM_HistogramPercentile);
@@ -0,0 +1,143 @@
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+#include "Texture/BlockCompression.hpp"
+#include "Texture/Image.hpp"
+#include "Texture/MipChain.hpp"
+
+namespace {
+    using namespace Pulsar;
+
+    Texture::Image MakeNoiseImage(const uint32_t size) {
+        std::mt19937 random(size);
+
+        Texture::Image image;
+        image.width  = size;
+        image.height = size;
+        image.pixels.resize(static_cast<size_t>(size) * size * 4);
+
+        for (uint8_t &value : image.pixels) {
+            value = static_cast<uint8_t>(random());
+        }
+
+        return image;
+    }
+
+    std::vector<std::byte> EncodePng(const Texture::Image &image) {
+        std::vector<std::byte> encoded;
+
+        stbi_write_png_to_func([](void *context, void *data, const int size) {
+            auto *      output = static_cast<std::vector<std::byte> *>(context);
+            const auto *bytes  = static_cast<const std::byte *>(data);
+            output->insert(output->end(), bytes, bytes + size);
+        }, &encoded, static_cast<int>(image.width), static_cast<int>(image.height), 4, image.pixels.data(),
+                               static_cast<int>(image.width * 4));
+
+        return encoded;
+    }
+
+    void BM_DecodePng(benchmark::State &state) {
+        const auto                   size    = static_cast<uint32_t>(state.range(0));
+        const std::vector<std::byte> encoded = EncodePng(MakeNoiseImage(size));
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Texture::DecodeImage(encoded));
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size) * size * 4);
+    }
+
+    void BM_DownsampleScalar(benchmark::State &state) {
+        const Texture::Image image = MakeNoiseImage(static_cast<uint32_t>(state.range(0)));
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Texture::DownsampleScalar(image, Texture::TextureFormat::Rgba8Unorm));
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(image.pixels.size()));
+    }
+
+    void BM_DownsampleSimd(benchmark::State &state) {
+        const Texture::Image image = MakeNoiseImage(static_cast<uint32_t>(state.range(0)));
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Texture::Downsample(image, Texture::TextureFormat::Rgba8Unorm));
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(image.pixels.size()));
+    }
+
+    void BM_DownsampleSrgb(benchmark::State &state) {
+        const Texture::Image image = MakeNoiseImage(static_cast<uint32_t>(state.range(0)));
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Texture::Downsample(image, Texture::TextureFormat::Rgba8Srgb));
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(image.pixels.size()));
+    }
+
+    void BM_MipChainParallel(benchmark::State &state) {
+        const Texture::Image image     = MakeNoiseImage(static_cast<uint32_t>(state.range(0)));
+        Threading::JobSystem jobSystem = Threading::JobSystem::Create();
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Texture::GenerateMipChain(image, Texture::TextureFormat::Rgba8Unorm,
+                                                               &jobSystem));
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(image.pixels.size()));
+    }
+
+    // range(1) is the CompressionQuality.
+    void BenchmarkCompress(benchmark::State &state, const Texture::TextureFormat format) {
+        const Texture::Image image   = MakeNoiseImage(static_cast<uint32_t>(state.range(0)));
+        const auto           quality = static_cast<Texture::CompressionQuality>(state.range(1));
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Texture::CompressImage(image, format, quality));
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(image.pixels.size()));
+    }
+
+    void BM_CompressBc1(benchmark::State &state) {
+        BenchmarkCompress(state, Texture::TextureFormat::Bc1Unorm);
+    }
+
+    void BM_CompressBc4(benchmark::State &state) {
+        BenchmarkCompress(state, Texture::TextureFormat::Bc4Unorm);
+    }
+
+    void BM_CompressBc7(benchmark::State &state) {
+        BenchmarkCompress(state, Texture::TextureFormat::Bc7Unorm);
+    }
+
+    void BM_CompressMipChainBc7Parallel(benchmark::State &state) {
+        const Texture::Image              image     = MakeNoiseImage(static_cast<uint32_t>(state.range(0)));
+        Threading::JobSystem              jobSystem = Threading::JobSystem::Create();
+        const std::vector<Texture::Image> levels    = Texture::GenerateMipChain(image, Texture::TextureFormat::Bc7Unorm,
+                                                                                &jobSystem);
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Texture::CompressMipChain(levels, Texture::TextureFormat::Bc7Unorm,
+                                                               Texture::CompressionQuality::Balanced, &jobSystem));
+        }
+
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(image.pixels.size()));
+    }
+}
+
+BENCHMARK(BM_DecodePng)->Arg(256)->Arg(1024)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DownsampleScalar)->Arg(1024)->Arg(4096)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DownsampleSimd)->Arg(1024)->Arg(4096)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DownsampleSrgb)->Arg(1024)->Arg(4096)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_MipChainParallel)->Arg(1024)->Arg(4096)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_CompressBc1)->ArgsProduct({{1024}, {0, 1, 2}})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CompressBc4)->ArgsProduct({{1024}, {0, 1, 2}})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CompressBc7)->ArgsProduct({{1024}, {0, 1, 2}})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CompressMipChainBc7Parallel)->Arg(1024)->Unit(benchmark::kMillisecond)->UseRealTime();
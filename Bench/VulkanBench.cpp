@@ -0,0 +1,332 @@
+#include <array>
+#include <memory>
+#include <set>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "Renderer/ViewportSet.hpp"
+#include "Vulkan/Buffer.hpp"
+#include "Vulkan/DescriptorAllocator.hpp"
+#include "Vulkan/Device.hpp"
+#include "Vulkan/Instance.hpp"
+#include "Vulkan/Pipeline.hpp"
+#include "Vulkan/Surface.hpp"
+#include "Vulkan/SwapChain.hpp"
+#include "Vulkan/UniformRing.hpp"
+
+namespace {
+    using namespace Pulsar;
+
+    constexpr auto s_VertShader = R"(
+#version 450
+
+layout(location = 0) out vec3 fragColor;
+
+void main() {
+    vec2 position = vec2((gl_VertexIndex << 1) & 2, gl_VertexIndex & 2);
+    gl_Position = vec4(position * 2.0 - 1.0, 0.0, 1.0);
+    fragColor = vec3(position, 1.0);
+}
+)";
+
+    constexpr auto s_FragShader = R"(
+#version 450
+
+layout(location = 0) in vec3 fragColor;
+
+layout(location = 0) out vec4 outColor;
+
+void main() {
+    outColor = vec4(fragColor, 1.0);
+}
+)";
+
+    // Created on first use and shared by every benchmark. The swap chain is not part of it, since a surface can
+    // only have one and the swap chain benchmarks create their own.
+    struct VulkanContext {
+        Glfw::Window     window;
+        Vulkan::Instance instance;
+        Vulkan::Surface  surface;
+        Vulkan::Device   device;
+
+        VulkanContext()
+            : window(Glfw::Window::Create({.title = "PulsarBench", .width = 1280, .height = 720})),
+              instance(Vulkan::Instance::Create({"PulsarBench"})),
+              surface(Vulkan::Surface::Create(instance, window)),
+              device(Vulkan::Device::Create(instance, surface)) {
+        }
+    };
+
+    // Skips the benchmark instead of aborting the run when there is no display or no Vulkan device.
+    VulkanContext *GetContext(benchmark::State &state) {
+        static std::unique_ptr<VulkanContext> s_Context;
+        static std::string                    s_Error;
+
+        if (s_Context == nullptr && s_Error.empty()) {
+            try {
+                s_Context = std::make_unique<VulkanContext>();
+            } catch (const std::exception &exception) {
+                s_Error = std::string(exception.what()) + " (try --headless)";
+            }
+        }
+
+        if (s_Context == nullptr) {
+            state.SkipWithError(s_Error.c_str());
+        }
+
+        return s_Context.get();
+    }
+
+    void BM_InstanceCreate(benchmark::State &state) {
+        if (GetContext(state) == nullptr) {
+            return;
+        }
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Vulkan::Instance::Create({"PulsarBench"}));
+        }
+    }
+
+    void BM_DeviceCreate(benchmark::State &state) {
+        VulkanContext *context = GetContext(state);
+        if (context == nullptr) {
+            return;
+        }
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Vulkan::Device::Create(context->instance, context->surface));
+        }
+    }
+
+    void BM_SwapChainCreate(benchmark::State &state) {
+        VulkanContext *context = GetContext(state);
+        if (context == nullptr) {
+            return;
+        }
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Vulkan::SwapChain::Create(context->surface, context->device, context->window));
+        }
+    }
+
+    // Includes GLSL to SPIR-V compilation, as Pipeline::Create does.
+    void BM_PipelineCreate(benchmark::State &state) {
+        VulkanContext *context = GetContext(state);
+        if (context == nullptr) {
+            return;
+        }
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Vulkan::Pipeline::Create(context->device, s_VertShader, s_FragShader));
+        }
+    }
+
+    // Builds every pipeline needed to draw with 3 cull modes x depth on/off x 2 topologies x fill/line: 24
+    // baked permutations, or as few as one when the device can make those groups dynamic.
+    void BM_PipelinePermutations(benchmark::State &state) {
+        VulkanContext *context = GetContext(state);
+        if (context == nullptr) {
+            return;
+        }
+
+        Vulkan::PipelineConfig base;
+        if (state.range(0) != 0) {
+            base.dynamicState = {true, true, true, true, false, false, true, false};
+        }
+
+        const Vulkan::PipelineDynamicState dynamic = Vulkan::Pipeline::Create(
+            context->device, s_VertShader, s_FragShader, base).GetDynamicState();
+
+        std::vector<Vulkan::PipelineConfig> permutations;
+        std::set<std::array<uint32_t, 4>>   baked;
+
+        for (const VkCullModeFlags cullMode : {VK_CULL_MODE_NONE, VK_CULL_MODE_BACK_BIT, VK_CULL_MODE_FRONT_BIT}) {
+            for (const bool depthTest : {false, true}) {
+                for (const VkPrimitiveTopology topology : {
+                         VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP
+                     }) {
+                    for (const VkPolygonMode polygonMode : {VK_POLYGON_MODE_FILL, VK_POLYGON_MODE_LINE}) {
+                        const std::array<uint32_t, 4> key = {
+                            dynamic.cullMode ? 0 : cullMode,
+                            dynamic.depth ? 0 : static_cast<uint32_t>(depthTest),
+                            dynamic.topology ? 0 : static_cast<uint32_t>(topology),
+                            dynamic.polygonMode ? 0 : static_cast<uint32_t>(polygonMode)
+                        };
+
+                        if (!baked.insert(key).second) {
+                            continue;
+                        }
+
+                        Vulkan::PipelineConfig config = base;
+                        config.cullMode    = cullMode;
+                        config.depthTest   = depthTest;
+                        config.topology    = topology;
+                        config.polygonMode = polygonMode;
+                        permutations.push_back(config);
+                    }
+                }
+            }
+        }
+
+        for (auto _ : state) {
+            for (const Vulkan::PipelineConfig &config : permutations) {
+                benchmark::DoNotOptimize(Vulkan::Pipeline::Create(context->device, s_VertShader, s_FragShader,
+                                                                  config));
+            }
+        }
+
+        state.counters["pipelines"] = static_cast<double>(permutations.size());
+    }
+
+    // A frame's worth of descriptor sets: 1024 Get calls spread over range(0) distinct uniform buffer offsets,
+    // so everything past the first call per offset is answered from the cache.
+    void BM_DescriptorFrame(benchmark::State &state) {
+        VulkanContext *context = GetContext(state);
+        if (context == nullptr) {
+            return;
+        }
+
+        constexpr uint32_t s_Calls  = 1024;
+        constexpr uint32_t s_Stride = 256;
+
+        const auto distinct = static_cast<uint32_t>(state.range(0));
+
+        VkDescriptorSetLayoutBinding binding{};
+        binding.binding         = 0;
+        binding.descriptorType  = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        binding.descriptorCount = 1;
+        binding.stageFlags      = VK_SHADER_STAGE_VERTEX_BIT;
+
+        VkDescriptorSetLayoutCreateInfo layoutInfo{};
+        layoutInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        layoutInfo.bindingCount = 1;
+        layoutInfo.pBindings    = &binding;
+
+        VkDescriptorSetLayout layout;
+        if (vkCreateDescriptorSetLayout(context->device.GetVkLogicalDevice(), &layoutInfo, nullptr, &layout) !=
+            VK_SUCCESS) {
+            state.SkipWithError("Failed to create descriptor set layout");
+            return;
+        }
+
+        {
+            const Vulkan::Buffer uniforms = Vulkan::Buffer::Create(
+                context->device, static_cast<VkDeviceSize>(distinct) * s_Stride, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+            Vulkan::DescriptorAllocator allocator = Vulkan::DescriptorAllocator::Create(context->device);
+            uint32_t                    frame     = 0;
+
+            for (auto _ : state) {
+                allocator.BeginFrame(frame);
+                frame = (frame + 1) % 2;
+
+                for (uint32_t i = 0; i < s_Calls; i++) {
+                    const Vulkan::DescriptorWrite write = Vulkan::DescriptorWrite::Buffer(
+                        0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, uniforms.GetVkBuffer(),
+                        static_cast<VkDeviceSize>(i % distinct) * s_Stride, s_Stride);
+
+                    benchmark::DoNotOptimize(allocator.Get(layout, std::span(&write, 1)));
+                }
+            }
+
+            const Vulkan::DescriptorAllocatorStatistics statistics = allocator.GetStatistics();
+            state.counters["pools"]  = statistics.pools;
+            state.counters["reused"] = static_cast<double>(statistics.reused) /
+                                       static_cast<double>(statistics.reused + statistics.allocated);
+        }
+
+        vkDestroyDescriptorSetLayout(context->device.GetVkLogicalDevice(), layout, nullptr);
+    }
+
+    // Per-draw constants for range(0) draws: one 64-byte transform pushed per draw, then a single flush.
+    void BM_UniformRingFrame(benchmark::State &state) {
+        VulkanContext *context = GetContext(state);
+        if (context == nullptr) {
+            return;
+        }
+
+        struct Transform {
+            std::array<float, 16> matrix;
+        };
+
+        const auto draws = static_cast<uint32_t>(state.range(0));
+
+        Vulkan::UniformRing ring  = Vulkan::UniformRing::Create(context->device, 256ULL * draws);
+        Transform           value = {};
+        uint32_t            frame = 0;
+
+        for (auto _ : state) {
+            ring.BeginFrame(frame);
+            frame = (frame + 1) % 2;
+
+            for (uint32_t i = 0; i < draws; i++) {
+                value.matrix[12] = static_cast<float>(i);
+                benchmark::DoNotOptimize(ring.Push(value));
+            }
+
+            ring.Flush();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * draws);
+        state.counters["coherent"] = ring.IsCoherent() ? 1 : 0;
+    }
+
+    // One full frame through ViewportSet: fence wait, acquire, record, submit and present. The recorded work is
+    // a single layout transition, so this is the fixed per-frame cost of the renderer.
+    void BM_FrameSubmitPresent(benchmark::State &state) {
+        VulkanContext *context = GetContext(state);
+        if (context == nullptr) {
+            return;
+        }
+
+        Threading::JobSystem  jobSystem = Threading::JobSystem::Create();
+        Vulkan::SwapChain     swapChain = Vulkan::SwapChain::Create(context->surface, context->device,
+                                                                    context->window);
+        Renderer::ViewportSet viewports = Renderer::ViewportSet::Create(
+            context->device, jobSystem, static_cast<uint32_t>(state.range(0)));
+        viewports.Add(context->window, swapChain);
+
+        const auto record = [](const VkCommandBuffer commandBuffer, uint32_t, const Vulkan::SwapChain &target) {
+            VkImageMemoryBarrier barrier{};
+            barrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.dstAccessMask       = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+            barrier.oldLayout           = VK_IMAGE_LAYOUT_UNDEFINED;
+            barrier.newLayout           = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image               = target.GetVkImages()[target.GetImageIndex()];
+            barrier.subresourceRange    = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                 VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, 0, 0, nullptr, 0, nullptr, 1,
+                                 &barrier);
+        };
+
+        uint64_t presented = 0;
+
+        for (auto _ : state) {
+            Glfw::PollEvents();
+            presented += viewports.Render(record).presented;
+
+            if (!viewports.GetStaleViewports().empty()) {
+                state.SkipWithError("Swap chain went out of date");
+                break;
+            }
+        }
+
+        state.counters["presented"] = benchmark::Counter(static_cast<double>(presented),
+                                                         benchmark::Counter::kIsRate);
+    }
+}
+
+BENCHMARK(BM_InstanceCreate)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DeviceCreate)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SwapChainCreate)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PipelineCreate)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PipelinePermutations)->Arg(0)->Arg(1)->ArgName("dynamic")->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DescriptorFrame)->Arg(1)->Arg(64)->Arg(1024)->ArgName("distinct")->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_UniformRingFrame)->Arg(1024)->Arg(16384)->ArgName("draws")->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FrameSubmitPresent)->Arg(1)->Arg(2)->Arg(3)->ArgName("framesInFlight")->Unit(benchmark::kMicrosecond)
+                                ->UseRealTime();
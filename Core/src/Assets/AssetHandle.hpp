@@ -0,0 +1,182 @@
+#ifndef PULSAR_ASSETHANDLE_HPP
+#define PULSAR_ASSETHANDLE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+
+namespace Pulsar::Vulkan {
+    class Device;
+}
+
+namespace Pulsar::Assets {
+    enum class AssetState : uint8_t {
+        Queued,
+        Loading,
+        AwaitingUpload,
+        Ready,
+        Failed,
+        Cancelled
+    };
+
+    enum class StreamPriority : uint8_t {
+        Low,
+        Normal,
+        High,
+        Critical
+    };
+
+    template<typename T>
+    struct AssetLoader {
+        std::function<T(std::span<const std::byte>)> decode;
+        std::function<uint64_t(const T &)>            uploadSize;
+        std::function<void(Vulkan::Device &, T &)>    upload;
+    };
+
+    namespace Detail {
+        class AssetSlotBase {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            explicit AssetSlotBase(std::string path) : m_Path(std::move(path)), m_RequestTime(Clock::now()) {
+            }
+
+            virtual ~AssetSlotBase() = default;
+
+            AssetSlotBase(const AssetSlotBase &other) = delete;
+            AssetSlotBase &operator=(const AssetSlotBase &other) = delete;
+
+            virtual void     Decode(std::span<const std::byte> data) = 0;
+            virtual uint64_t GetUploadSize() const = 0;
+            virtual void     Upload(Vulkan::Device &device) = 0;
+
+            [[nodiscard]] const std::string &GetPath() const {
+                return m_Path;
+            }
+
+            [[nodiscard]] AssetState GetState() const {
+                return m_State.load(std::memory_order_acquire);
+            }
+
+            void SetState(const AssetState state) {
+                m_State.store(state, std::memory_order_release);
+            }
+
+            void Cancel() {
+                m_CancelRequested.store(true, std::memory_order_release);
+            }
+
+            [[nodiscard]] bool IsCancelRequested() const {
+                return m_CancelRequested.load(std::memory_order_acquire);
+            }
+
+            [[nodiscard]] Clock::time_point GetRequestTime() const {
+                return m_RequestTime;
+            }
+
+            void SetError(std::string error) {
+                m_Error = std::move(error);
+            }
+
+            [[nodiscard]] const std::string &GetError() const {
+                return m_Error;
+            }
+
+        private:
+            std::string             m_Path;
+            std::atomic<AssetState> m_State           = AssetState::Queued;
+            std::atomic<bool>       m_CancelRequested = false;
+            Clock::time_point       m_RequestTime;
+            std::string             m_Error;
+        };
+
+        template<typename T>
+        class AssetSlot final : public AssetSlotBase {
+        public:
+            AssetSlot(std::string path, T placeholder, AssetLoader<T> loader)
+                : AssetSlotBase(std::move(path)), m_Value(std::move(placeholder)), m_Loader(std::move(loader)) {
+            }
+
+            void Decode(std::span<const std::byte> data) override {
+                m_Decoded = m_Loader.decode(data);
+            }
+
+            uint64_t GetUploadSize() const override {
+                if (!m_Decoded.has_value() || !m_Loader.uploadSize) {
+                    return 0;
+                }
+
+                return m_Loader.uploadSize(*m_Decoded);
+            }
+
+            void Upload(Vulkan::Device &device) override {
+                if (m_Loader.upload) {
+                    m_Loader.upload(device, *m_Decoded);
+                }
+
+                m_Value = std::move(*m_Decoded);
+                m_Decoded.reset();
+            }
+
+            [[nodiscard]] const T &GetValue() const {
+                return m_Value;
+            }
+
+        private:
+            T                m_Value;
+            std::optional<T> m_Decoded;
+            AssetLoader<T>   m_Loader;
+        };
+    }
+
+    // Ref-counted reference to a streamed asset. Until the asset is uploaded, Get() returns
+    // the placeholder it was requested with. Dropping the last handle cancels a pending load.
+    //
+    // The value is swapped in by AssetStreamer::Update without synchronization, so Get() may only be called
+    // from the thread that runs Update. Other threads must see IsReady() return true first; the value never
+    // changes after that.
+    template<typename T>
+    class AssetHandle {
+    public:
+        AssetHandle() = default;
+
+        explicit AssetHandle(std::shared_ptr<Detail::AssetSlot<T>> slot) : m_Slot(std::move(slot)) {
+        }
+
+        [[nodiscard]] const T &Get() const {
+            return m_Slot->GetValue();
+        }
+
+        [[nodiscard]] AssetState GetState() const {
+            return m_Slot != nullptr ? m_Slot->GetState() : AssetState::Cancelled;
+        }
+
+        [[nodiscard]] bool IsReady() const {
+            return GetState() == AssetState::Ready;
+        }
+
+        [[nodiscard]] bool IsValid() const {
+            return m_Slot != nullptr;
+        }
+
+        [[nodiscard]] const std::string &GetError() const {
+            return m_Slot->GetError();
+        }
+
+        void Cancel() const {
+            if (m_Slot != nullptr) {
+                m_Slot->Cancel();
+            }
+        }
+
+    private:
+        std::shared_ptr<Detail::AssetSlot<T>> m_Slot;
+    };
+}
+
+#endif //PULSAR_ASSETHANDLE_HPP
@@ -0,0 +1,185 @@
+#include "AssetStreamer.hpp"
+
+#include "FileIo/MappedFile.hpp"
+
+namespace Pulsar::Assets {
+    AssetStreamer::State::~State() {
+        {
+            std::lock_guard lock(mutex);
+            stopping = true;
+        }
+
+        jobSystem->Wait(loads);
+    }
+
+    AssetStreamer AssetStreamer::Create(Vulkan::Device &device, Threading::JobSystem &jobSystem,
+                                        const StreamerConfig &config) {
+        AssetStreamer streamer;
+        streamer.m_State = std::make_unique<State>();
+
+        streamer.m_State->device             = &device;
+        streamer.m_State->jobSystem          = &jobSystem;
+        streamer.m_State->uploadBudgetBytes  = config.uploadBudgetBytes;
+        streamer.m_State->maxConcurrentLoads = std::max(config.maxConcurrentLoads, 1u);
+
+        return streamer;
+    }
+
+    void AssetStreamer::Update() {
+        State &state = *m_State;
+
+        uint64_t spent = 0;
+
+        while (true) {
+            std::shared_ptr<Detail::AssetSlotBase> slot;
+            bool                                   orphaned;
+
+            {
+                std::lock_guard lock(state.mutex);
+
+                if (state.uploads.empty()) {
+                    break;
+                }
+
+                // The queue holds the only reference once every handle is gone, so nobody could see the upload.
+                orphaned = state.uploads.front().use_count() == 1;
+
+                // Always let one upload through so assets larger than the budget still make progress.
+                const uint64_t size = orphaned ? 0 : state.uploads.front()->GetUploadSize();
+                if (spent != 0 && spent + size > state.uploadBudgetBytes) {
+                    break;
+                }
+
+                slot = std::move(state.uploads.front());
+                state.uploads.pop_front();
+                spent += size;
+            }
+
+            if (orphaned || slot->IsCancelRequested()) {
+                RecordFinished(state, *slot, AssetState::Cancelled);
+                continue;
+            }
+
+            try {
+                slot->Upload(*state.device);
+                RecordFinished(state, *slot, AssetState::Ready);
+            } catch (const std::exception &exception) {
+                slot->SetError(exception.what());
+                RecordFinished(state, *slot, AssetState::Failed);
+            }
+        }
+
+        std::lock_guard lock(state.mutex);
+        state.metrics.uploadedLastFrame = spent;
+    }
+
+    void AssetStreamer::SetUploadBudget(const uint64_t bytes) {
+        std::lock_guard lock(m_State->mutex);
+        m_State->uploadBudgetBytes = bytes;
+    }
+
+    StreamerMetrics AssetStreamer::GetMetrics() const {
+        std::lock_guard lock(m_State->mutex);
+
+        StreamerMetrics metrics = m_State->metrics;
+        metrics.queueDepth      = static_cast<uint32_t>(m_State->requests.size());
+        metrics.awaitingUpload  = static_cast<uint32_t>(m_State->uploads.size());
+
+        return metrics;
+    }
+
+    void AssetStreamer::Enqueue(const std::shared_ptr<Detail::AssetSlotBase> &slot, const StreamPriority priority) {
+        State &state = *m_State;
+
+        bool startLoad = false;
+
+        {
+            std::lock_guard lock(state.mutex);
+            state.requests.push({priority, state.nextSequence++, slot});
+
+            startLoad = state.activeLoads < state.maxConcurrentLoads;
+            if (startLoad) {
+                state.activeLoads++;
+            }
+        }
+
+        if (startLoad) {
+            state.jobSystem->Schedule([&state] { ProcessRequests(state); }, &state.loads);
+        }
+    }
+
+    void AssetStreamer::ProcessRequests(State &state) {
+        // Each load job keeps taking whichever request is most urgent until the queue runs dry,
+        // so scheduling order never overrides request priorities.
+        while (true) {
+            std::shared_ptr<Detail::AssetSlotBase> slot;
+
+            {
+                std::lock_guard lock(state.mutex);
+
+                if (state.stopping || state.requests.empty()) {
+                    state.activeLoads--;
+                    return;
+                }
+
+                slot = state.requests.top().slot.lock();
+                state.requests.pop();
+
+                // Every handle was dropped before the request was picked up.
+                if (slot == nullptr) {
+                    state.metrics.cancelled++;
+                    continue;
+                }
+            }
+
+            ProcessRequest(state, std::move(slot));
+        }
+    }
+
+    void AssetStreamer::ProcessRequest(State &state, std::shared_ptr<Detail::AssetSlotBase> slot) {
+        if (slot->IsCancelRequested()) {
+            RecordFinished(state, *slot, AssetState::Cancelled);
+            return;
+        }
+
+        slot->SetState(AssetState::Loading);
+
+        try {
+            const FileIo::MappedFile file = FileIo::MappedFile::Open(slot->GetPath());
+            slot->Decode(file.GetData());
+        } catch (const std::exception &exception) {
+            slot->SetError(exception.what());
+            RecordFinished(state, *slot, AssetState::Failed);
+            return;
+        }
+
+        slot->SetState(AssetState::AwaitingUpload);
+
+        std::lock_guard lock(state.mutex);
+        state.uploads.push_back(std::move(slot));
+    }
+
+    void AssetStreamer::RecordFinished(State &state, Detail::AssetSlotBase &slot, const AssetState result) {
+        const double latencyMs = std::chrono::duration<double, std::milli>(
+            Detail::AssetSlotBase::Clock::now() - slot.GetRequestTime()).count();
+
+        slot.SetState(result);
+
+        std::lock_guard lock(state.mutex);
+
+        switch (result) {
+        case AssetState::Ready:
+            state.metrics.completed++;
+            state.totalLatencyMs += latencyMs;
+            state.metrics.averageLatencyMs = state.totalLatencyMs / static_cast<double>(state.metrics.completed);
+            state.metrics.maxLatencyMs     = std::max(state.metrics.maxLatencyMs, latencyMs);
+            break;
+        case AssetState::Failed:
+            state.metrics.failed++;
+            break;
+        default:
+            state.metrics.cancelled++;
+            break;
+        }
+    }
+}
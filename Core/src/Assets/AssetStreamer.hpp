@@ -0,0 +1,102 @@
+#ifndef PULSAR_ASSETSTREAMER_HPP
+#define PULSAR_ASSETSTREAMER_HPP
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <vector>
+
+#include "AssetHandle.hpp"
+#include "Threading/JobSystem.hpp"
+
+namespace Pulsar::Assets {
+    struct StreamerConfig {
+        // Upper bound on jobs blocked in file I/O at once, so loads never occupy every worker.
+        uint32_t maxConcurrentLoads = 2;
+        uint64_t uploadBudgetBytes  = 8ull * 1024 * 1024;
+    };
+
+    struct StreamerMetrics {
+        uint32_t queueDepth        = 0;
+        uint32_t awaitingUpload    = 0;
+        uint64_t completed         = 0;
+        uint64_t failed            = 0;
+        uint64_t cancelled         = 0;
+        uint64_t uploadedLastFrame = 0;
+        double   averageLatencyMs  = 0.0;
+        double   maxLatencyMs      = 0.0;
+    };
+
+    class AssetStreamer {
+    public:
+        // The job system must outlive the streamer.
+        static AssetStreamer Create(Vulkan::Device &device, Threading::JobSystem &jobSystem,
+                                    const StreamerConfig &config = {});
+
+        template<typename T>
+        AssetHandle<T> Load(const std::string &path, T placeholder, AssetLoader<T> loader,
+                            const StreamPriority priority = StreamPriority::Normal) {
+            auto slot = std::make_shared<Detail::AssetSlot<T>>(path, std::move(placeholder), std::move(loader));
+            Enqueue(slot, priority);
+
+            return AssetHandle<T>(std::move(slot));
+        }
+
+        // Runs queued GPU uploads on the calling thread until the frame's budget is spent.
+        // Call once per frame from the thread that owns the device.
+        void Update();
+
+        void SetUploadBudget(uint64_t bytes);
+
+        [[nodiscard]] StreamerMetrics GetMetrics() const;
+
+    private:
+        struct Request {
+            StreamPriority                        priority;
+            uint64_t                              sequence;
+            std::weak_ptr<Detail::AssetSlotBase> slot;
+
+            bool operator<(const Request &other) const {
+                if (priority != other.priority) {
+                    return priority < other.priority;
+                }
+
+                return sequence > other.sequence;
+            }
+        };
+
+        struct State {
+            Vulkan::Device *      device             = nullptr;
+            Threading::JobSystem *jobSystem          = nullptr;
+            uint64_t              uploadBudgetBytes  = 0;
+            uint32_t              maxConcurrentLoads = 0;
+            uint32_t              activeLoads        = 0;
+            bool                  stopping           = false;
+
+            mutable std::mutex                                 mutex;
+            std::priority_queue<Request>                       requests;
+            std::deque<std::shared_ptr<Detail::AssetSlotBase>> uploads;
+            uint64_t                                           nextSequence = 0;
+            StreamerMetrics                                    metrics;
+            double                                             totalLatencyMs = 0.0;
+
+            // Tracks running load jobs; the destructor waits on it before the state goes away.
+            Threading::JobCounter loads;
+
+            ~State();
+        };
+
+        std::unique_ptr<State> m_State;
+
+        AssetStreamer() = default;
+
+        void Enqueue(const std::shared_ptr<Detail::AssetSlotBase> &slot, StreamPriority priority);
+
+        static void ProcessRequests(State &state);
+        static void ProcessRequest(State &state, std::shared_ptr<Detail::AssetSlotBase> slot);
+        static void RecordFinished(State &state, Detail::AssetSlotBase &slot, AssetState result);
+    };
+}
+
+#endif //PULSAR_ASSETSTREAMER_HPP
@@ -0,0 +1,181 @@
+#include "Archetype.hpp"
+
+namespace Pulsar::Ecs {
+    static constexpr std::align_val_t s_ChunkAlignment{64};
+
+    static size_t AlignUp(const size_t value, const size_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    Archetype::Archetype(const ComponentMask &mask) : m_Mask(mask) {
+        m_ColumnLookup.fill(-1);
+
+        size_t entityBytes = sizeof(Entity);
+        for (ComponentId id = 0; id < g_MaxComponents; id++) {
+            if (!mask.test(id)) {
+                continue;
+            }
+
+            const ComponentInfo &info = GetComponentInfo(id);
+
+            m_ColumnLookup[id] = static_cast<int16_t>(m_Columns.size());
+            m_ComponentIds.push_back(id);
+            m_Columns.push_back({0, info.size, info.alignment, info.relocate, info.destroy});
+
+            entityBytes += info.size;
+        }
+
+        // Start from the unpadded estimate and shrink until the aligned layout fits. Components too large for
+        // a single chunk get a chunk of one entity.
+        m_ChunkCapacity = std::max<uint32_t>(1, static_cast<uint32_t>(g_ChunkSize / entityBytes));
+        while (m_ChunkCapacity > 1 && ComputeLayout(m_ChunkCapacity) > g_ChunkSize) {
+            m_ChunkCapacity--;
+        }
+
+        m_ChunkBytes = std::max(g_ChunkSize, ComputeLayout(m_ChunkCapacity));
+    }
+
+    Archetype::~Archetype() {
+        for (uint32_t row = 0; row < m_EntityCount; row++) {
+            for (int column = 0; column < static_cast<int>(m_Columns.size()); column++) {
+                m_Columns[column].destroy(GetComponentAt(row, column));
+            }
+        }
+
+        for (std::byte *chunk : m_Chunks) {
+            ::operator delete(chunk, s_ChunkAlignment);
+        }
+    }
+
+    uint32_t Archetype::Allocate(const Entity entity) {
+        if (m_EntityCount == m_Chunks.size() * m_ChunkCapacity) {
+            m_Chunks.push_back(static_cast<std::byte *>(::operator new(m_ChunkBytes, s_ChunkAlignment)));
+        }
+
+        const uint32_t row = m_EntityCount++;
+        GetEntities(row / m_ChunkCapacity)[row % m_ChunkCapacity] = entity;
+
+        return row;
+    }
+
+    Entity Archetype::Erase(const uint32_t row, const bool destroyComponents) {
+        const uint32_t last  = m_EntityCount - 1;
+        Entity         moved = g_NullEntity;
+
+        for (int column = 0; column < static_cast<int>(m_Columns.size()); column++) {
+            if (destroyComponents) {
+                m_Columns[column].destroy(GetComponentAt(row, column));
+            }
+
+            if (row != last) {
+                m_Columns[column].relocate(GetComponentAt(row, column), GetComponentAt(last, column));
+            }
+        }
+
+        if (row != last) {
+            moved = GetEntities(last / m_ChunkCapacity)[last % m_ChunkCapacity];
+            GetEntities(row / m_ChunkCapacity)[row % m_ChunkCapacity] = moved;
+        }
+
+        m_EntityCount--;
+
+        // Keep one spare chunk so an entity bouncing across a chunk boundary does not reallocate every time.
+        while (m_Chunks.size() > GetChunkCount() + 1) {
+            ::operator delete(m_Chunks.back(), s_ChunkAlignment);
+            m_Chunks.pop_back();
+        }
+
+        return moved;
+    }
+
+    Entity Archetype::MoveRow(const uint32_t row, Archetype &target, const uint32_t targetRow) {
+        for (int column = 0; column < static_cast<int>(m_Columns.size()); column++) {
+            const int targetColumn = target.GetColumnIndex(m_ComponentIds[column]);
+
+            if (targetColumn >= 0) {
+                m_Columns[column].relocate(target.GetComponentAt(targetRow, targetColumn),
+                                           GetComponentAt(row, column));
+            } else {
+                m_Columns[column].destroy(GetComponentAt(row, column));
+            }
+        }
+
+        return Erase(row, false);
+    }
+
+    int Archetype::GetColumnIndex(const ComponentId id) const {
+        return m_ColumnLookup[id];
+    }
+
+    void *Archetype::GetComponent(const uint32_t row, const ComponentId id) const {
+        const int column = GetColumnIndex(id);
+        return column < 0 ? nullptr : GetComponentAt(row, column);
+    }
+
+    void *Archetype::GetComponentAt(const uint32_t row, const int column) const {
+        return GetColumn(row / m_ChunkCapacity, column) + static_cast<size_t>(row % m_ChunkCapacity) *
+               m_Columns[column].size;
+    }
+
+    std::byte *Archetype::GetColumn(const uint32_t chunk, const int column) const {
+        return m_Chunks[chunk] + m_Columns[column].offset;
+    }
+
+    Entity *Archetype::GetEntities(const uint32_t chunk) const {
+        return reinterpret_cast<Entity *>(m_Chunks[chunk]);
+    }
+
+    uint32_t Archetype::GetChunkEntityCount(const uint32_t chunk) const {
+        return std::min(m_ChunkCapacity, m_EntityCount - chunk * m_ChunkCapacity);
+    }
+
+    const ComponentMask &Archetype::GetMask() const {
+        return m_Mask;
+    }
+
+    std::span<const ComponentId> Archetype::GetComponentIds() const {
+        return m_ComponentIds;
+    }
+
+    uint32_t Archetype::GetEntityCount() const {
+        return m_EntityCount;
+    }
+
+    uint32_t Archetype::GetChunkCount() const {
+        return (m_EntityCount + m_ChunkCapacity - 1) / m_ChunkCapacity;
+    }
+
+    uint32_t Archetype::GetChunkCapacity() const {
+        return m_ChunkCapacity;
+    }
+
+    Archetype *Archetype::GetAddEdge(const ComponentId id) const {
+        const auto iterator = m_AddEdges.find(id);
+        return iterator == m_AddEdges.end() ? nullptr : iterator->second;
+    }
+
+    Archetype *Archetype::GetRemoveEdge(const ComponentId id) const {
+        const auto iterator = m_RemoveEdges.find(id);
+        return iterator == m_RemoveEdges.end() ? nullptr : iterator->second;
+    }
+
+    void Archetype::SetAddEdge(const ComponentId id, Archetype *archetype) {
+        m_AddEdges[id] = archetype;
+    }
+
+    void Archetype::SetRemoveEdge(const ComponentId id, Archetype *archetype) {
+        m_RemoveEdges[id] = archetype;
+    }
+
+    size_t Archetype::ComputeLayout(const uint32_t capacity) {
+        size_t offset = sizeof(Entity) * capacity;
+
+        for (Column &column : m_Columns) {
+            offset        = AlignUp(offset, column.alignment);
+            column.offset = offset;
+            offset += column.size * capacity;
+        }
+
+        return offset;
+    }
+}
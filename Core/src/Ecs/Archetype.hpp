@@ -0,0 +1,82 @@
+#ifndef PULSAR_ARCHETYPE_HPP
+#define PULSAR_ARCHETYPE_HPP
+
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "Component.hpp"
+#include "Entity.hpp"
+
+namespace Pulsar::Ecs {
+    constexpr size_t g_ChunkSize = 16 * 1024;
+
+    // Stores every entity with exactly one set of component types. Entities live in fixed-size chunks, each
+    // holding one tightly packed array per component (structure of arrays) plus the owning entities. Rows are
+    // dense: every chunk except the last is full, and removal swaps the last row into the hole.
+    class Archetype {
+    public:
+        explicit Archetype(const ComponentMask &mask);
+        ~Archetype();
+
+        Archetype(const Archetype &other) = delete;
+        Archetype &operator=(const Archetype &other) = delete;
+
+        // Returns the row of a new slot whose components are left unconstructed for the caller to fill.
+        uint32_t Allocate(Entity entity);
+
+        // Frees a row, destroying its components unless they were already relocated elsewhere. Returns the
+        // entity that was moved into the row to keep it dense, or g_NullEntity.
+        Entity Erase(uint32_t row, bool destroyComponents = true);
+
+        // Relocates the components target shares into targetRow, destroys the rest and erases row.
+        Entity MoveRow(uint32_t row, Archetype &target, uint32_t targetRow);
+
+        // Column index of a component, or -1 if this archetype does not contain it.
+        [[nodiscard]] int GetColumnIndex(ComponentId id) const;
+
+        [[nodiscard]] void *GetComponent(uint32_t row, ComponentId id) const;
+        [[nodiscard]] void *GetComponentAt(uint32_t row, int column) const;
+
+        [[nodiscard]] std::byte *GetColumn(uint32_t chunk, int column) const;
+        [[nodiscard]] Entity *   GetEntities(uint32_t chunk) const;
+        [[nodiscard]] uint32_t   GetChunkEntityCount(uint32_t chunk) const;
+
+        [[nodiscard]] const ComponentMask &        GetMask() const;
+        [[nodiscard]] std::span<const ComponentId> GetComponentIds() const;
+        [[nodiscard]] uint32_t                     GetEntityCount() const;
+        [[nodiscard]] uint32_t                     GetChunkCount() const;
+        [[nodiscard]] uint32_t                     GetChunkCapacity() const;
+
+        // Cached archetype transitions for adding or removing one component.
+        [[nodiscard]] Archetype *GetAddEdge(ComponentId id) const;
+        [[nodiscard]] Archetype *GetRemoveEdge(ComponentId id) const;
+        void                     SetAddEdge(ComponentId id, Archetype *archetype);
+        void                     SetRemoveEdge(ComponentId id, Archetype *archetype);
+
+    private:
+        struct Column {
+            size_t offset;
+            size_t size;
+            size_t alignment;
+            void (*relocate)(void *destination, void *source);
+            void (*destroy)(void *component);
+        };
+
+        ComponentMask                        m_Mask;
+        std::vector<ComponentId>             m_ComponentIds;
+        std::vector<Column>                  m_Columns;
+        std::array<int16_t, g_MaxComponents> m_ColumnLookup  = {};
+        std::vector<std::byte *>             m_Chunks;
+        size_t                               m_ChunkBytes    = 0;
+        uint32_t                             m_ChunkCapacity = 0;
+        uint32_t                             m_EntityCount   = 0;
+
+        std::unordered_map<ComponentId, Archetype *> m_AddEdges;
+        std::unordered_map<ComponentId, Archetype *> m_RemoveEdges;
+
+        [[nodiscard]] size_t ComputeLayout(uint32_t capacity);
+    };
+}
+
+#endif //PULSAR_ARCHETYPE_HPP
@@ -0,0 +1,77 @@
+#include "CommandBuffer.hpp"
+
+namespace Pulsar::Ecs {
+    CommandBuffer::~CommandBuffer() {
+        Release(m_Commands, m_Arena);
+        Release(m_PlaybackCommands, m_PlaybackArena);
+    }
+
+    CommandBuffer::CommandBuffer(CommandBuffer &&other) noexcept
+        : m_Arena(std::move(other.m_Arena)), m_PlaybackArena(std::move(other.m_PlaybackArena)),
+          m_Commands(std::exchange(other.m_Commands, {})),
+          m_PlaybackCommands(std::exchange(other.m_PlaybackCommands, {})) {
+    }
+
+    CommandBuffer &CommandBuffer::operator=(CommandBuffer &&other) noexcept {
+        if (this != &other) {
+            Release(m_Commands, m_Arena);
+            Release(m_PlaybackCommands, m_PlaybackArena);
+
+            m_Arena            = std::move(other.m_Arena);
+            m_PlaybackArena    = std::move(other.m_PlaybackArena);
+            m_Commands         = std::exchange(other.m_Commands, {});
+            m_PlaybackCommands = std::exchange(other.m_PlaybackCommands, {});
+        }
+
+        return *this;
+    }
+
+    void CommandBuffer::DestroyEntity(const Entity entity) {
+        Record([entity](World &world) {
+            if (world.IsAlive(entity)) {
+                world.DestroyEntity(entity);
+            }
+        });
+    }
+
+    void CommandBuffer::Playback(World &world) {
+        std::swap(m_Arena, m_PlaybackArena);
+        std::swap(m_Commands, m_PlaybackCommands);
+
+        try {
+            for (Command *command : m_PlaybackCommands) {
+                command->Execute(world);
+            }
+        } catch (...) {
+            Release(m_PlaybackCommands, m_PlaybackArena);
+            throw;
+        }
+
+        Release(m_PlaybackCommands, m_PlaybackArena);
+    }
+
+    bool CommandBuffer::IsEmpty() const {
+        return m_Commands.empty();
+    }
+
+    Memory::ArenaStats CommandBuffer::GetArenaStats() const {
+        Memory::ArenaStats       stats    = m_Arena.GetStats();
+        const Memory::ArenaStats playback = m_PlaybackArena.GetStats();
+
+        stats.allocations += playback.allocations;
+        stats.bytesAllocated += playback.bytesAllocated;
+        stats.heapAllocations += playback.heapAllocations;
+        stats.peakBytes = std::max(stats.peakBytes, playback.peakBytes);
+
+        return stats;
+    }
+
+    void CommandBuffer::Release(std::vector<Command *> &commands, Memory::LinearArena &arena) {
+        for (Command *command : commands) {
+            command->~Command();
+        }
+
+        commands.clear();
+        arena.Reset();
+    }
+}
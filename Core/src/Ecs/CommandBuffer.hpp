@@ -0,0 +1,92 @@
+#ifndef PULSAR_COMMANDBUFFER_HPP
+#define PULSAR_COMMANDBUFFER_HPP
+
+#include "World.hpp"
+#include "Memory/LinearArena.hpp"
+
+namespace Pulsar::Ecs {
+    // Records structural changes during iteration and applies them in order on Playback. Not thread-safe; give
+    // each parallel task its own buffer and play them back one after another. Commands live in an arena that is
+    // reset after every Playback, so a buffer reused each frame stops allocating once its arena has grown.
+    class CommandBuffer {
+    public:
+        CommandBuffer() = default;
+        ~CommandBuffer();
+
+        CommandBuffer(const CommandBuffer &other) = delete;
+        CommandBuffer(CommandBuffer &&other) noexcept;
+
+        CommandBuffer &operator=(const CommandBuffer &other) = delete;
+        CommandBuffer &operator=(CommandBuffer &&other) noexcept;
+
+        template<typename... Ts>
+        void CreateEntity(Ts &&... components) {
+            Record([... components = std::forward<Ts>(components)](World &world) mutable {
+                world.CreateEntity(std::move(components)...);
+            });
+        }
+
+        void DestroyEntity(Entity entity);
+
+        template<typename T>
+        void AddComponent(const Entity entity, T &&component) {
+            Record([entity, component = std::forward<T>(component)](World &world) mutable {
+                if (world.IsAlive(entity)) {
+                    world.AddComponent(entity, std::move(component));
+                }
+            });
+        }
+
+        template<typename T>
+        void RemoveComponent(const Entity entity) {
+            Record([entity](World &world) {
+                if (world.IsAlive(entity)) {
+                    world.RemoveComponent<T>(entity);
+                }
+            });
+        }
+
+        // Commands targeting entities that died in the meantime are skipped.
+        void Playback(World &world);
+
+        [[nodiscard]] bool               IsEmpty() const;
+        [[nodiscard]] Memory::ArenaStats GetArenaStats() const;
+
+    private:
+        struct Command {
+            virtual ~Command() = default;
+
+            virtual void Execute(World &world) = 0;
+        };
+
+        template<typename F>
+        struct CommandImpl final : Command {
+            F function;
+
+            explicit CommandImpl(F &&function) : function(std::move(function)) {}
+
+            void Execute(World &world) override { function(world); }
+        };
+
+        static constexpr size_t s_ArenaCapacity = 4096;
+
+        // Playback swaps the recording pair with the playback pair, so commands recorded while playing back land
+        // in the other arena and survive the reset.
+        Memory::LinearArena    m_Arena         = Memory::LinearArena::Create(s_ArenaCapacity);
+        Memory::LinearArena    m_PlaybackArena = Memory::LinearArena::Create(s_ArenaCapacity);
+        std::vector<Command *> m_Commands;
+        std::vector<Command *> m_PlaybackCommands;
+
+        template<typename F>
+        void Record(F &&function) {
+            using Impl = CommandImpl<std::decay_t<F>>;
+
+            void *storage = m_Arena.Allocate(sizeof(Impl), alignof(Impl));
+            m_Commands.push_back(new(storage) Impl(std::forward<F>(function)));
+        }
+
+        static void Release(std::vector<Command *> &commands, Memory::LinearArena &arena);
+    };
+}
+
+#endif //PULSAR_COMMANDBUFFER_HPP
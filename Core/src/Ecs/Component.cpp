@@ -0,0 +1,33 @@
+#include "Component.hpp"
+
+#include <mutex>
+
+namespace Pulsar::Ecs {
+    static constexpr size_t s_MaxAlignment = 64;
+
+    // A deque keeps references returned by GetComponentInfo valid while other threads register types.
+    static std::mutex                s_RegistryMutex;
+    static std::deque<ComponentInfo> s_Registry;
+
+    ComponentId RegisterComponent(const ComponentInfo &info) {
+        if (info.alignment > s_MaxAlignment) {
+            throw std::runtime_error("Failed to register component: Alignment above 64 bytes is not supported");
+        }
+
+        std::lock_guard lock(s_RegistryMutex);
+
+        if (s_Registry.size() == g_MaxComponents) {
+            throw std::runtime_error("Failed to register component: Too many component types");
+        }
+
+        s_Registry.push_back(info);
+
+        return static_cast<ComponentId>(s_Registry.size() - 1);
+    }
+
+    const ComponentInfo &GetComponentInfo(const ComponentId id) {
+        std::lock_guard lock(s_RegistryMutex);
+
+        return s_Registry.at(id);
+    }
+}
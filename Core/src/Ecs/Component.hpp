@@ -0,0 +1,65 @@
+#ifndef PULSAR_COMPONENT_HPP
+#define PULSAR_COMPONENT_HPP
+
+#include <bitset>
+#include <new>
+#include <typeindex>
+#include <type_traits>
+
+namespace Pulsar::Ecs {
+    constexpr uint32_t g_MaxComponents = 128;
+
+    using ComponentId   = uint32_t;
+    using ComponentMask = std::bitset<g_MaxComponents>;
+
+    // Type-erased operations chunks need to move and destroy components they do not know the type of.
+    struct ComponentInfo {
+        std::type_index type;
+        size_t          size;
+        size_t          alignment;
+
+        // Move-constructs into destination and destroys source.
+        void (*relocate)(void *destination, void *source);
+        void (*destroy)(void *component);
+    };
+
+    // Ids are dense and handed out in registration order, so they are only stable within one process.
+    ComponentId          RegisterComponent(const ComponentInfo &info);
+    const ComponentInfo &GetComponentInfo(ComponentId id);
+
+    template<typename T>
+    ComponentId GetComponentId() {
+        using Component = std::remove_cvref_t<T>;
+
+        // Every qualified spelling must share the id of the plain type.
+        if constexpr (!std::is_same_v<T, Component>) {
+            return GetComponentId<Component>();
+        } else {
+            static_assert(std::is_move_constructible_v<Component>, "Components must be move constructible");
+
+            static const ComponentId id = RegisterComponent({
+                typeid(Component), sizeof(Component), alignof(Component),
+                [](void *destination, void *source) {
+                    auto *component = static_cast<Component *>(source);
+                    new(destination) Component(std::move(*component));
+                    component->~Component();
+                },
+                [](void *component) {
+                    static_cast<Component *>(component)->~Component();
+                }
+            });
+
+            return id;
+        }
+    }
+
+    template<typename... Ts>
+    ComponentMask MakeComponentMask() {
+        ComponentMask mask;
+        (mask.set(GetComponentId<Ts>()), ...);
+
+        return mask;
+    }
+}
+
+#endif //PULSAR_COMPONENT_HPP
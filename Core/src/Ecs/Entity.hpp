@@ -0,0 +1,20 @@
+#ifndef PULSAR_ENTITY_HPP
+#define PULSAR_ENTITY_HPP
+
+#include <cstdint>
+
+namespace Pulsar::Ecs {
+    // The generation is bumped every time an index is reused, so stale handles fail IsAlive.
+    struct Entity {
+        uint32_t index      = ~0U;
+        uint32_t generation = 0;
+
+        [[nodiscard]] constexpr bool IsNull() const { return index == ~0U; }
+
+        constexpr bool operator==(const Entity &other) const = default;
+    };
+
+    constexpr Entity g_NullEntity = {};
+}
+
+#endif //PULSAR_ENTITY_HPP
@@ -0,0 +1,140 @@
+#ifndef PULSAR_QUERY_HPP
+#define PULSAR_QUERY_HPP
+
+#include <tuple>
+
+#include "World.hpp"
+#include "Threading/JobSystem.hpp"
+
+namespace Pulsar::Ecs {
+    // Component arrays of one chunk. T may be const-qualified for read-only access.
+    template<typename... Ts>
+    class ChunkView {
+    public:
+        ChunkView(const Entity *entities, const uint32_t count, std::tuple<Ts *...> components)
+            : m_Entities(entities), m_Count(count), m_Components(components) {
+        }
+
+        template<typename T>
+        [[nodiscard]] std::span<T> Get() const {
+            return {std::get<T *>(m_Components), m_Count};
+        }
+
+        [[nodiscard]] std::span<const Entity> GetEntities() const { return {m_Entities, m_Count}; }
+        [[nodiscard]] uint32_t                GetCount() const { return m_Count; }
+
+    private:
+        const Entity *       m_Entities;
+        uint32_t             m_Count;
+        std::tuple<Ts *...> m_Components;
+    };
+
+    // Matches every archetype containing all of Ts. Matches are cached and only archetypes created since the last
+    // call are examined, so reusing one Query across frames keeps iteration setup O(new archetypes).
+    template<typename... Ts>
+    class Query {
+    public:
+        Query() : m_Mask(MakeComponentMask<std::remove_cvref_t<Ts>...>()) {}
+
+        // function(Entity, Ts &...)
+        template<typename F>
+        void ForEach(const World &world, F &&function) {
+            ForEachChunk(world, [&function](const ChunkView<Ts...> &chunk) {
+                const std::span<const Entity> entities   = chunk.GetEntities();
+                std::tuple<Ts *...>           components = {chunk.template Get<Ts>().data()...};
+
+                for (uint32_t i = 0; i < chunk.GetCount(); i++) {
+                    function(entities[i], std::get<Ts *>(components)[i]...);
+                }
+            });
+        }
+
+        // function(const ChunkView<Ts...> &)
+        template<typename F>
+        void ForEachChunk(const World &world, F &&function) {
+            Update(world);
+
+            for (const Match &match : m_Matches) {
+                for (uint32_t chunk = 0; chunk < match.archetype->GetChunkCount(); chunk++) {
+                    function(MakeView(match, chunk));
+                }
+            }
+        }
+
+        // Splits the matching chunks across the job system and the calling thread and returns once all are
+        // processed. function runs concurrently and must only touch the chunk it is given.
+        template<typename F>
+        void ParallelForEachChunk(const World &world, Threading::JobSystem &jobSystem, F &&function) {
+            Update(world);
+
+            m_ChunkList.clear();
+            for (uint32_t match = 0; match < m_Matches.size(); match++) {
+                for (uint32_t chunk = 0; chunk < m_Matches[match].archetype->GetChunkCount(); chunk++) {
+                    m_ChunkList.emplace_back(match, chunk);
+                }
+            }
+
+            jobSystem.ParallelFor(static_cast<uint32_t>(m_ChunkList.size()), [this, &function](const uint32_t begin,
+                                                                                              const uint32_t end) {
+                for (uint32_t i = begin; i < end; i++) {
+                    function(MakeView(m_Matches[m_ChunkList[i].first], m_ChunkList[i].second));
+                }
+            });
+        }
+
+        [[nodiscard]] uint32_t Count(const World &world) {
+            Update(world);
+
+            uint32_t count = 0;
+            for (const Match &match : m_Matches) {
+                count += match.archetype->GetEntityCount();
+            }
+
+            return count;
+        }
+
+    private:
+        struct Match {
+            const Archetype *                   archetype;
+            std::array<int, sizeof...(Ts)> columns;
+        };
+
+        ComponentMask                          m_Mask;
+        std::vector<Match>                     m_Matches;
+        std::vector<std::pair<uint32_t, uint32_t>> m_ChunkList;
+        size_t                                 m_ScannedArchetypes = 0;
+        const World *                          m_World             = nullptr;
+
+        void Update(const World &world) {
+            if (m_World != &world) {
+                m_Matches.clear();
+                m_ScannedArchetypes = 0;
+                m_World             = &world;
+            }
+
+            const std::span<const std::unique_ptr<Archetype>> archetypes = world.GetArchetypes();
+
+            for (; m_ScannedArchetypes < archetypes.size(); m_ScannedArchetypes++) {
+                const Archetype &archetype = *archetypes[m_ScannedArchetypes];
+
+                if ((archetype.GetMask() & m_Mask) == m_Mask) {
+                    m_Matches.push_back({&archetype, {archetype.GetColumnIndex(GetComponentId<Ts>())...}});
+                }
+            }
+        }
+
+        ChunkView<Ts...> MakeView(const Match &match, const uint32_t chunk) const {
+            return MakeView(match, chunk, std::index_sequence_for<Ts...>());
+        }
+
+        template<size_t... Indices>
+        ChunkView<Ts...> MakeView(const Match &match, const uint32_t chunk, std::index_sequence<Indices...>) const {
+            return {
+                match.archetype->GetEntities(chunk), match.archetype->GetChunkEntityCount(chunk),
+                {reinterpret_cast<Ts *>(match.archetype->GetColumn(chunk, match.columns[Indices]))...}
+            };
+        }
+    };
+}
+
+#endif //PULSAR_QUERY_HPP
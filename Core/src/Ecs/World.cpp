@@ -0,0 +1,144 @@
+#include "World.hpp"
+
+namespace Pulsar::Ecs {
+    World::World() {
+        GetOrCreateArchetype({});
+    }
+
+    Entity World::CreateEntity() {
+        Archetype &  archetype = *m_Archetypes.front();
+        const Entity entity    = AllocateEntity();
+
+        m_Records[entity.index].archetype = &archetype;
+        m_Records[entity.index].row       = archetype.Allocate(entity);
+
+        return entity;
+    }
+
+    void World::DestroyEntity(const Entity entity) {
+        if (!IsAlive(entity)) {
+            throw std::runtime_error("Failed to destroy entity: Entity is not alive");
+        }
+
+        EntityRecord &record = m_Records[entity.index];
+
+        const Entity moved = record.archetype->Erase(record.row);
+        if (!moved.IsNull()) {
+            m_Records[moved.index].row = record.row;
+        }
+
+        record.archetype = nullptr;
+        record.generation++;
+        m_FreeIndices.push_back(entity.index);
+        m_EntityCount--;
+    }
+
+    bool World::IsAlive(const Entity entity) const {
+        return entity.index < m_Records.size() && m_Records[entity.index].generation == entity.generation &&
+               m_Records[entity.index].archetype != nullptr;
+    }
+
+    uint32_t World::GetEntityCount() const {
+        return m_EntityCount;
+    }
+
+    std::span<const std::unique_ptr<Archetype>> World::GetArchetypes() const {
+        return m_Archetypes;
+    }
+
+    Entity World::AllocateEntity() {
+        m_EntityCount++;
+
+        if (!m_FreeIndices.empty()) {
+            const uint32_t index = m_FreeIndices.back();
+            m_FreeIndices.pop_back();
+
+            return {index, m_Records[index].generation};
+        }
+
+        m_Records.emplace_back();
+        return {static_cast<uint32_t>(m_Records.size() - 1), 0};
+    }
+
+    Archetype &World::GetOrCreateArchetype(const ComponentMask &mask) {
+        if (const auto iterator = m_ArchetypeLookup.find(mask); iterator != m_ArchetypeLookup.end()) {
+            return *iterator->second;
+        }
+
+        Archetype &archetype    = *m_Archetypes.emplace_back(std::make_unique<Archetype>(mask));
+        m_ArchetypeLookup[mask] = &archetype;
+
+        return archetype;
+    }
+
+    void *World::FindComponent(const Entity entity, const ComponentId id) const {
+        if (!IsAlive(entity)) {
+            return nullptr;
+        }
+
+        const EntityRecord &record = m_Records[entity.index];
+        return record.archetype->GetComponent(record.row, id);
+    }
+
+    void *World::AddComponent(const Entity entity, const ComponentId id) {
+        if (!IsAlive(entity)) {
+            throw std::runtime_error("Failed to add component: Entity is not alive");
+        }
+
+        Archetype &source = *m_Records[entity.index].archetype;
+        Archetype *target = source.GetAddEdge(id);
+
+        if (target == nullptr) {
+            ComponentMask mask = source.GetMask();
+            mask.set(id);
+
+            target = &GetOrCreateArchetype(mask);
+            source.SetAddEdge(id, target);
+            target->SetRemoveEdge(id, &source);
+        }
+
+        MoveEntity(entity, *target);
+
+        const EntityRecord &record = m_Records[entity.index];
+        return record.archetype->GetComponent(record.row, id);
+    }
+
+    void World::RemoveComponent(const Entity entity, const ComponentId id) {
+        if (!IsAlive(entity)) {
+            throw std::runtime_error("Failed to remove component: Entity is not alive");
+        }
+
+        Archetype &source = *m_Records[entity.index].archetype;
+        if (source.GetColumnIndex(id) < 0) {
+            return;
+        }
+
+        Archetype *target = source.GetRemoveEdge(id);
+
+        if (target == nullptr) {
+            ComponentMask mask = source.GetMask();
+            mask.reset(id);
+
+            target = &GetOrCreateArchetype(mask);
+            source.SetRemoveEdge(id, target);
+            target->SetAddEdge(id, &source);
+        }
+
+        MoveEntity(entity, *target);
+    }
+
+    void World::MoveEntity(const Entity entity, Archetype &target) {
+        EntityRecord & record    = m_Records[entity.index];
+        Archetype &    source    = *record.archetype;
+        const uint32_t targetRow = target.Allocate(entity);
+
+        // Components the target gains are left for the caller to construct.
+        const Entity moved = source.MoveRow(record.row, target, targetRow);
+        if (!moved.IsNull()) {
+            m_Records[moved.index].row = record.row;
+        }
+
+        record.archetype = &target;
+        record.row       = targetRow;
+    }
+}
@@ -0,0 +1,99 @@
+#ifndef PULSAR_WORLD_HPP
+#define PULSAR_WORLD_HPP
+
+#include <memory>
+
+#include "Archetype.hpp"
+
+namespace Pulsar::Ecs {
+    // Owns all entities and their archetypes. Structural changes (creating or destroying entities, adding or
+    // removing components) move components between archetypes and invalidate component pointers, so they must
+    // not happen while a Query iterates; record them in a CommandBuffer instead.
+    class World {
+    public:
+        World();
+
+        World(const World &other) = delete;
+        World &operator=(const World &other) = delete;
+
+        Entity CreateEntity();
+
+        template<typename... Ts>
+        Entity CreateEntity(Ts &&... components) {
+            Archetype &    archetype = GetOrCreateArchetype(MakeComponentMask<std::remove_cvref_t<Ts>...>());
+            const Entity   entity    = AllocateEntity();
+            const uint32_t row       = archetype.Allocate(entity);
+
+            (new(archetype.GetComponent(row, GetComponentId<Ts>())) std::remove_cvref_t<Ts>(
+                std::forward<Ts>(components)), ...);
+
+            m_Records[entity.index].archetype = &archetype;
+            m_Records[entity.index].row       = row;
+
+            return entity;
+        }
+
+        void DestroyEntity(Entity entity);
+
+        [[nodiscard]] bool IsAlive(Entity entity) const;
+
+        // Replaces the component if the entity already has one.
+        template<typename T>
+        void AddComponent(const Entity entity, T &&component) {
+            using Component = std::remove_cvref_t<T>;
+
+            const ComponentId id = GetComponentId<Component>();
+            if (auto *existing = static_cast<Component *>(FindComponent(entity, id))) {
+                *existing = std::forward<T>(component);
+                return;
+            }
+
+            void *destination = AddComponent(entity, id);
+            new(destination) Component(std::forward<T>(component));
+        }
+
+        template<typename T>
+        void RemoveComponent(const Entity entity) {
+            RemoveComponent(entity, GetComponentId<T>());
+        }
+
+        // Returns nullptr when the entity does not have the component. Invalidated by structural changes.
+        template<typename T>
+        [[nodiscard]] T *GetComponent(const Entity entity) const {
+            return static_cast<T *>(FindComponent(entity, GetComponentId<T>()));
+        }
+
+        template<typename T>
+        [[nodiscard]] bool HasComponent(const Entity entity) const {
+            return FindComponent(entity, GetComponentId<T>()) != nullptr;
+        }
+
+        [[nodiscard]] uint32_t                                    GetEntityCount() const;
+        [[nodiscard]] std::span<const std::unique_ptr<Archetype>> GetArchetypes() const;
+
+    private:
+        struct EntityRecord {
+            Archetype *archetype  = nullptr;
+            uint32_t   row        = 0;
+            uint32_t   generation = 0;
+        };
+
+        std::vector<std::unique_ptr<Archetype>>         m_Archetypes;
+        std::unordered_map<ComponentMask, Archetype *> m_ArchetypeLookup;
+        std::vector<EntityRecord>                      m_Records;
+        std::vector<uint32_t>                          m_FreeIndices;
+        uint32_t                                       m_EntityCount = 0;
+
+        Entity     AllocateEntity();
+        Archetype &GetOrCreateArchetype(const ComponentMask &mask);
+
+        [[nodiscard]] void *FindComponent(Entity entity, ComponentId id) const;
+
+        // Moves the entity to an archetype with the component added and returns its unconstructed storage.
+        void *AddComponent(Entity entity, ComponentId id);
+        void  RemoveComponent(Entity entity, ComponentId id);
+        void  MoveEntity(Entity entity, Archetype &target);
+    };
+}
+
+#endif //PULSAR_WORLD_HPP
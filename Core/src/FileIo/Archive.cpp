@@ -0,0 +1,148 @@
+#include "Archive.hpp"
+
+#include <lz4.h>
+
+namespace Pulsar::FileIo {
+    // Written so that a huge offset cannot wrap around and pass.
+    static bool IsInRange(const uint64_t offset, const uint64_t length, const uint64_t size) {
+        return offset <= size && length <= size - offset;
+    }
+
+    Archive Archive::Open(const std::string &path) {
+        Archive archive(MappedFile::Open(path));
+
+        const std::span<const std::byte> data = archive.m_File.GetData();
+
+        if (data.size() < sizeof(ArchiveHeader)) {
+            throw std::runtime_error("Failed to open archive: File too small");
+        }
+
+        ArchiveHeader header;
+        std::memcpy(&header, data.data(), sizeof(header));
+
+        if (header.magic != g_ArchiveMagic) {
+            throw std::runtime_error("Failed to open archive: Invalid magic");
+        }
+
+        if (header.version != g_ArchiveVersion) {
+            throw std::runtime_error("Failed to open archive: Unsupported version");
+        }
+
+        const uint64_t indexSize = static_cast<uint64_t>(header.entryCount) * sizeof(ArchiveEntry);
+        if (header.indexOffset % alignof(ArchiveEntry) != 0 || !IsInRange(header.indexOffset, indexSize, data.size()) ||
+            !IsInRange(header.stringTableOffset, header.stringTableSize, data.size())) {
+            throw std::runtime_error("Failed to open archive: Corrupt index");
+        }
+
+        archive.m_Entries = {
+            reinterpret_cast<const ArchiveEntry *>(data.data() + header.indexOffset), header.entryCount
+        };
+        archive.m_StringTable = {
+            reinterpret_cast<const char *>(data.data() + header.stringTableOffset), header.stringTableSize
+        };
+
+        for (const ArchiveEntry &entry : archive.m_Entries) {
+            if (!IsInRange(entry.offset, entry.storedSize, data.size()) ||
+                !IsInRange(entry.pathOffset, entry.pathLength, header.stringTableSize)) {
+                throw std::runtime_error("Failed to open archive: Entry out of bounds");
+            }
+
+            // View hands out size bytes straight from the mapping.
+            if (entry.compression == ArchiveCompression::None && entry.size != entry.storedSize) {
+                throw std::runtime_error("Failed to open archive: Entry size mismatch");
+            }
+        }
+
+        return archive;
+    }
+
+    Archive::Archive(MappedFile file) : m_File(std::move(file)) {
+    }
+
+    const ArchiveEntry *Archive::Find(const std::string_view path) const {
+        const std::string normalized = NormalizeArchivePath(path);
+        const uint64_t    hash       = HashArchivePath(normalized);
+
+        auto it = std::lower_bound(m_Entries.begin(), m_Entries.end(), hash,
+                                   [](const ArchiveEntry &entry, const uint64_t value) {
+                                       return entry.pathHash < value;
+                                   });
+
+        for (; it != m_Entries.end() && it->pathHash == hash; ++it) {
+            if (GetEntryPath(*it) == normalized) {
+                return &*it;
+            }
+        }
+
+        return nullptr;
+    }
+
+    bool Archive::Contains(const std::string_view path) const {
+        return Find(path) != nullptr;
+    }
+
+    std::optional<std::span<const std::byte>> Archive::View(const ArchiveEntry &entry) const {
+        if (entry.compression != ArchiveCompression::None) {
+            return std::nullopt;
+        }
+
+        return m_File.GetData().subspan(entry.offset, entry.size);
+    }
+
+    std::vector<std::byte> Archive::Read(const ArchiveEntry &entry) const {
+        const std::span<const std::byte> stored = m_File.GetData().subspan(entry.offset, entry.storedSize);
+
+        switch (entry.compression) {
+        case ArchiveCompression::None:
+            return {stored.begin(), stored.end()};
+        case ArchiveCompression::Lz4: {
+            std::vector<std::byte> data(entry.size);
+
+            const int result = LZ4_decompress_safe(reinterpret_cast<const char *>(stored.data()),
+                                                   reinterpret_cast<char *>(data.data()),
+                                                   static_cast<int>(stored.size()),
+                                                   static_cast<int>(data.size()));
+
+            if (result < 0 || static_cast<uint64_t>(result) != entry.size) {
+                throw std::runtime_error("Failed to read archive entry: Corrupt LZ4 data");
+            }
+
+            return data;
+        }
+        }
+
+        throw std::runtime_error("Failed to read archive entry: Unknown compression");
+    }
+
+    std::vector<std::byte> Archive::Read(const std::string_view path) const {
+        const ArchiveEntry *entry = Find(path);
+
+        if (entry == nullptr) {
+            throw std::runtime_error("Failed to read archive entry: Not found");
+        }
+
+        return Read(*entry);
+    }
+
+    std::vector<std::vector<std::byte>> Archive::ReadMany(const std::vector<std::string> &paths,
+                                                          Threading::JobSystem &          jobSystem) const {
+        std::vector<std::vector<std::byte>> results(paths.size());
+
+        jobSystem.ParallelFor(static_cast<uint32_t>(paths.size()), [this, &paths, &results](const uint32_t begin,
+                                                                                             const uint32_t end) {
+            for (uint32_t i = begin; i < end; i++) {
+                results[i] = Read(paths[i]);
+            }
+        });
+
+        return results;
+    }
+
+    std::span<const ArchiveEntry> Archive::GetEntries() const {
+        return m_Entries;
+    }
+
+    std::string_view Archive::GetEntryPath(const ArchiveEntry &entry) const {
+        return m_StringTable.substr(entry.pathOffset, entry.pathLength);
+    }
+}
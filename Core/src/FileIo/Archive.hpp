@@ -0,0 +1,42 @@
+#ifndef PULSAR_ARCHIVE_HPP
+#define PULSAR_ARCHIVE_HPP
+
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "ArchiveFormat.hpp"
+#include "MappedFile.hpp"
+#include "Threading/JobSystem.hpp"
+
+namespace Pulsar::FileIo {
+    class Archive {
+    public:
+        static Archive Open(const std::string &path);
+
+        [[nodiscard]] const ArchiveEntry *Find(std::string_view path) const;
+        [[nodiscard]] bool                Contains(std::string_view path) const;
+
+        // Returns the entry's bytes straight from the mapping, or nothing if the entry is compressed.
+        [[nodiscard]] std::optional<std::span<const std::byte>> View(const ArchiveEntry &entry) const;
+
+        [[nodiscard]] std::vector<std::byte> Read(const ArchiveEntry &entry) const;
+        [[nodiscard]] std::vector<std::byte> Read(std::string_view path) const;
+
+        [[nodiscard]] std::vector<std::vector<std::byte>> ReadMany(const std::vector<std::string> &paths,
+                                                                   Threading::JobSystem &          jobSystem) const;
+
+        [[nodiscard]] std::span<const ArchiveEntry> GetEntries() const;
+        [[nodiscard]] std::string_view              GetEntryPath(const ArchiveEntry &entry) const;
+
+    private:
+        MappedFile                    m_File;
+        std::span<const ArchiveEntry> m_Entries;
+        std::string_view              m_StringTable;
+
+        explicit Archive(MappedFile file);
+    };
+}
+
+#endif //PULSAR_ARCHIVE_HPP
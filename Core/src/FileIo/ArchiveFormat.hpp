@@ -0,0 +1,75 @@
+#ifndef PULSAR_ARCHIVEFORMAT_HPP
+#define PULSAR_ARCHIVEFORMAT_HPP
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Pulsar::FileIo {
+    // On-disk layout of a .pak archive:
+    //   ArchiveHeader | entry data (each entry 16-byte aligned) | ArchiveEntry[entryCount] | path strings
+    // Entries are sorted by path hash so lookups are a binary search over the mapped index.
+
+    constexpr std::array<char, 4> g_ArchiveMagic     = {'P', 'S', 'P', 'K'};
+    constexpr uint32_t            g_ArchiveVersion   = 1;
+    constexpr uint64_t            g_ArchiveAlignment = 16;
+
+    enum class ArchiveCompression : uint32_t {
+        None,
+        Lz4
+    };
+
+    struct ArchiveHeader {
+        std::array<char, 4> magic;
+        uint32_t            version;
+        uint32_t            entryCount;
+        uint32_t            reserved;
+        uint64_t            indexOffset;
+        uint64_t            stringTableOffset;
+        uint64_t            stringTableSize;
+    };
+
+    struct ArchiveEntry {
+        uint64_t           pathHash;
+        uint64_t           offset;
+        uint64_t           size;
+        uint64_t           storedSize;
+        uint32_t           pathOffset;
+        uint32_t           pathLength;
+        ArchiveCompression compression;
+        uint32_t           reserved;
+    };
+
+    static_assert(sizeof(ArchiveHeader) == 40);
+    static_assert(sizeof(ArchiveEntry) == 48);
+
+    // Archive paths use forward slashes and no leading "./" or "/".
+    inline std::string NormalizeArchivePath(std::string_view path) {
+        std::string normalized(path);
+        std::replace(normalized.begin(), normalized.end(), '\\', '/');
+
+        while (normalized.starts_with("./")) {
+            normalized.erase(0, 2);
+        }
+
+        while (normalized.starts_with('/')) {
+            normalized.erase(0, 1);
+        }
+
+        return normalized;
+    }
+
+    constexpr uint64_t HashArchivePath(const std::string_view path) {
+        uint64_t hash = 14695981039346656037ull;
+
+        for (const char character : path) {
+            hash ^= static_cast<uint8_t>(character);
+            hash *= 1099511628211ull;
+        }
+
+        return hash;
+    }
+}
+
+#endif //PULSAR_ARCHIVEFORMAT_HPP
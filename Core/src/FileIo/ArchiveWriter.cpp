@@ -0,0 +1,148 @@
+#include "ArchiveWriter.hpp"
+
+#include <fstream>
+
+#include <lz4hc.h>
+
+#include "File.hpp"
+
+namespace Pulsar::FileIo {
+    ArchiveWriter ArchiveWriter::Create(const ArchiveWriterConfig &config) {
+        ArchiveWriter writer;
+        writer.m_Config = config;
+
+        return writer;
+    }
+
+    void ArchiveWriter::Add(const std::string_view path, const std::span<const std::byte> data) {
+        PendingEntry entry;
+        entry.path        = NormalizeArchivePath(path);
+        entry.size        = data.size();
+        entry.compression = ArchiveCompression::None;
+
+        if (m_Config.compress && !data.empty() && data.size() <= LZ4_MAX_INPUT_SIZE) {
+            std::vector<std::byte> compressed(LZ4_compressBound(static_cast<int>(data.size())));
+
+            const int compressedSize = LZ4_compress_HC(reinterpret_cast<const char *>(data.data()),
+                                                       reinterpret_cast<char *>(compressed.data()),
+                                                       static_cast<int>(data.size()),
+                                                       static_cast<int>(compressed.size()),
+                                                       LZ4HC_CLEVEL_DEFAULT);
+
+            if (compressedSize > 0 &&
+                static_cast<float>(compressedSize) < static_cast<float>(data.size()) * m_Config.minCompressionRatio) {
+                compressed.resize(compressedSize);
+
+                entry.compression = ArchiveCompression::Lz4;
+                entry.stored      = std::move(compressed);
+            }
+        }
+
+        if (entry.compression == ArchiveCompression::None) {
+            entry.stored.assign(data.begin(), data.end());
+        }
+
+        m_Entries.push_back(std::move(entry));
+    }
+
+    void ArchiveWriter::AddDirectory(const std::filesystem::path &directory) {
+        std::vector<std::filesystem::path> files;
+
+        for (const auto &directoryEntry : std::filesystem::recursive_directory_iterator(directory)) {
+            if (directoryEntry.is_regular_file()) {
+                files.push_back(directoryEntry.path());
+            }
+        }
+
+        // Keep the archive layout independent of directory iteration order.
+        std::sort(files.begin(), files.end());
+
+        for (const auto &file : files) {
+            const std::vector<std::byte> data = ReadFileBytes(file.string());
+            Add(std::filesystem::relative(file, directory).generic_string(), data);
+        }
+    }
+
+    void ArchiveWriter::Write(const std::string &path) const {
+        std::vector<const PendingEntry *> sorted;
+        sorted.reserve(m_Entries.size());
+
+        for (const PendingEntry &entry : m_Entries) {
+            sorted.push_back(&entry);
+        }
+
+        std::sort(sorted.begin(), sorted.end(), [](const PendingEntry *a, const PendingEntry *b) {
+            const uint64_t hashA = HashArchivePath(a->path);
+            const uint64_t hashB = HashArchivePath(b->path);
+
+            return hashA != hashB ? hashA < hashB : a->path < b->path;
+        });
+
+        for (size_t i = 1; i < sorted.size(); i++) {
+            if (sorted[i - 1]->path == sorted[i]->path) {
+                throw std::runtime_error("Failed to write archive: Duplicate entry " + sorted[i]->path);
+            }
+        }
+
+        const auto alignUp = [](const uint64_t value) {
+            return (value + g_ArchiveAlignment - 1) & ~(g_ArchiveAlignment - 1);
+        };
+
+        std::vector<ArchiveEntry> index;
+        std::string               stringTable;
+        uint64_t                  offset = alignUp(sizeof(ArchiveHeader));
+
+        for (const PendingEntry *pending : sorted) {
+            ArchiveEntry entry{};
+            entry.pathHash    = HashArchivePath(pending->path);
+            entry.offset      = offset;
+            entry.size        = pending->size;
+            entry.storedSize  = pending->stored.size();
+            entry.pathOffset  = static_cast<uint32_t>(stringTable.size());
+            entry.pathLength  = static_cast<uint32_t>(pending->path.size());
+            entry.compression = pending->compression;
+
+            index.push_back(entry);
+            stringTable += pending->path;
+
+            offset = alignUp(offset + entry.storedSize);
+        }
+
+        ArchiveHeader header{};
+        header.magic             = g_ArchiveMagic;
+        header.version           = g_ArchiveVersion;
+        header.entryCount        = static_cast<uint32_t>(index.size());
+        header.indexOffset       = offset;
+        header.stringTableOffset = offset + index.size() * sizeof(ArchiveEntry);
+        header.stringTableSize   = stringTable.size();
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to write archive: Could not open output file");
+        }
+
+        const auto pad = [&file](const uint64_t from, const uint64_t to) {
+            constexpr std::array<char, g_ArchiveAlignment> zeros{};
+            file.write(zeros.data(), static_cast<std::streamsize>(to - from));
+        };
+
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        pad(sizeof(header), alignUp(sizeof(header)));
+
+        for (size_t i = 0; i < sorted.size(); i++) {
+            const std::vector<std::byte> &stored = sorted[i]->stored;
+
+            file.write(reinterpret_cast<const char *>(stored.data()), static_cast<std::streamsize>(stored.size()));
+            pad(index[i].offset + stored.size(), alignUp(index[i].offset + stored.size()));
+        }
+
+        file.write(reinterpret_cast<const char *>(index.data()),
+                   static_cast<std::streamsize>(index.size() * sizeof(ArchiveEntry)));
+        file.write(stringTable.data(), static_cast<std::streamsize>(stringTable.size()));
+
+        if (!file) {
+            throw std::runtime_error("Failed to write archive: Write error");
+        }
+    }
+}
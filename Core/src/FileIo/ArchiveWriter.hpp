@@ -0,0 +1,42 @@
+#ifndef PULSAR_ARCHIVEWRITER_HPP
+#define PULSAR_ARCHIVEWRITER_HPP
+
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "ArchiveFormat.hpp"
+
+namespace Pulsar::FileIo {
+    struct ArchiveWriterConfig {
+        bool  compress = true;
+        // Entries that do not shrink below this fraction of their size are stored raw.
+        float minCompressionRatio = 0.9F;
+    };
+
+    class ArchiveWriter {
+    public:
+        static ArchiveWriter Create(const ArchiveWriterConfig &config = {});
+
+        void Add(std::string_view path, std::span<const std::byte> data);
+        void AddDirectory(const std::filesystem::path &directory);
+
+        void Write(const std::string &path) const;
+
+    private:
+        struct PendingEntry {
+            std::string            path;
+            uint64_t               size;
+            ArchiveCompression     compression;
+            std::vector<std::byte> stored;
+        };
+
+        ArchiveWriterConfig       m_Config;
+        std::vector<PendingEntry> m_Entries;
+
+        ArchiveWriter() = default;
+    };
+}
+
+#endif //PULSAR_ARCHIVEWRITER_HPP
@@ -0,0 +1,20 @@
+#include "AsyncReader.hpp"
+
+#include "File.hpp"
+
+namespace Pulsar::FileIo {
+    AsyncReader AsyncReader::Create(Threading::JobSystem &jobSystem) {
+        return AsyncReader(jobSystem);
+    }
+
+    std::future<std::vector<std::byte>> AsyncReader::Read(const std::string &path) {
+        return m_JobSystem->Submit([path] { return ReadFileBytes(path); });
+    }
+
+    std::future<MappedFile> AsyncReader::Map(const std::string &path) {
+        return m_JobSystem->Submit([path] { return MappedFile::Open(path); });
+    }
+
+    AsyncReader::AsyncReader(Threading::JobSystem &jobSystem) : m_JobSystem(&jobSystem) {
+    }
+}
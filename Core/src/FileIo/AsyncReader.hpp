@@ -0,0 +1,28 @@
+#ifndef PULSAR_ASYNCREADER_HPP
+#define PULSAR_ASYNCREADER_HPP
+
+#include <cstddef>
+#include <future>
+#include <string>
+#include <vector>
+
+#include "MappedFile.hpp"
+#include "Threading/JobSystem.hpp"
+
+namespace Pulsar::FileIo {
+    // Reads on the job system's workers. The job system must outlive the reader and every returned future.
+    class AsyncReader {
+    public:
+        static AsyncReader Create(Threading::JobSystem &jobSystem);
+
+        [[nodiscard]] std::future<std::vector<std::byte>> Read(const std::string &path);
+        [[nodiscard]] std::future<MappedFile>             Map(const std::string &path);
+
+    private:
+        Threading::JobSystem *m_JobSystem = nullptr;
+
+        explicit AsyncReader(Threading::JobSystem &jobSystem);
+    };
+}
+
+#endif //PULSAR_ASYNCREADER_HPP
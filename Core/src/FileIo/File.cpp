@@ -1,25 +1,39 @@
 #include "File.hpp"
 
+#include <filesystem>
 #include <fstream>
 #include <stdexcept>
 #include <string>
 
 namespace Pulsar::FileIo {
-    std::string ReadFile(const std::string &path) {
-        std::ifstream file(path);
+    template<typename Container>
+    static Container ReadWhole(const std::string &path) {
+        std::ifstream file(path, std::ios::binary);
 
         if (!file.is_open()) {
             throw std::runtime_error("Failed to open file.");
         }
 
-        std::string data;
-        std::string buffer;
-        while (std::getline(file, buffer)) {
-            data += buffer;
+        std::error_code errorCode;
+        const uintmax_t size = std::filesystem::file_size(path, errorCode);
+
+        if (errorCode) {
+            throw std::runtime_error("Failed to read file: Could not query file size");
         }
 
-        file.close();
+        Container data(size, {});
+        if (!file.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(size))) {
+            throw std::runtime_error("Failed to read file: Unexpected end of file");
+        }
 
         return data;
     }
-}
\ No newline at end of file
+
+    std::string ReadFile(const std::string &path) {
+        return ReadWhole<std::string>(path);
+    }
+
+    std::vector<std::byte> ReadFileBytes(const std::string &path) {
+        return ReadWhole<std::vector<std::byte>>(path);
+    }
+}
@@ -1,10 +1,14 @@
 #ifndef PULSAR_FILE_HPP
 #define PULSAR_FILE_HPP
 
+#include <cstddef>
 #include <string>
+#include <vector>
 
 namespace Pulsar::FileIo {
     std::string ReadFile(const std::string &path);
+
+    std::vector<std::byte> ReadFileBytes(const std::string &path);
 }
 
-#endif //PULSAR_FILE_HPP
\ No newline at end of file
+#endif //PULSAR_FILE_HPP
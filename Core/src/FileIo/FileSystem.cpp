@@ -0,0 +1,88 @@
+#include "FileSystem.hpp"
+
+namespace Pulsar::FileIo {
+    FileData FileData::FromBytes(std::vector<std::byte> bytes) {
+        FileData data;
+        data.m_Storage = std::move(bytes);
+
+        return data;
+    }
+
+    FileData FileData::FromMapping(MappedFile file) {
+        FileData data;
+        data.m_Storage = std::move(file);
+
+        return data;
+    }
+
+    FileData FileData::FromView(const std::span<const std::byte> view) {
+        FileData data;
+        data.m_Storage = view;
+
+        return data;
+    }
+
+    std::span<const std::byte> FileData::GetData() const {
+        if (const auto *bytes = std::get_if<std::vector<std::byte>>(&m_Storage)) {
+            return *bytes;
+        }
+
+        if (const auto *file = std::get_if<MappedFile>(&m_Storage)) {
+            return file->GetData();
+        }
+
+        return std::get<std::span<const std::byte>>(m_Storage);
+    }
+
+    LooseFileSystem::LooseFileSystem(std::filesystem::path root) : m_Root(std::move(root)) {
+    }
+
+    bool LooseFileSystem::Exists(const std::string &path) const {
+        return std::filesystem::is_regular_file(m_Root / path);
+    }
+
+    FileData LooseFileSystem::Open(const std::string &path) const {
+        return FileData::FromMapping(MappedFile::Open((m_Root / path).string()));
+    }
+
+    ArchiveFileSystem::ArchiveFileSystem(Archive archive) : m_Archive(std::move(archive)) {
+    }
+
+    bool ArchiveFileSystem::Exists(const std::string &path) const {
+        return m_Archive.Contains(path);
+    }
+
+    FileData ArchiveFileSystem::Open(const std::string &path) const {
+        const ArchiveEntry *entry = m_Archive.Find(path);
+
+        if (entry == nullptr) {
+            throw std::runtime_error("Failed to open file: Not found in archive");
+        }
+
+        if (const auto view = m_Archive.View(*entry)) {
+            return FileData::FromView(*view);
+        }
+
+        return FileData::FromBytes(m_Archive.Read(*entry));
+    }
+
+    void VirtualFileSystem::Mount(std::unique_ptr<FileSystem> fileSystem) {
+        m_Mounts.push_back(std::move(fileSystem));
+    }
+
+    bool VirtualFileSystem::Exists(const std::string &path) const {
+        return std::any_of(m_Mounts.rbegin(), m_Mounts.rend(), [&path](const auto &mount) {
+            return mount->Exists(path);
+        });
+    }
+
+    FileData VirtualFileSystem::Open(const std::string &path) const {
+        for (auto it = m_Mounts.rbegin(); it != m_Mounts.rend(); ++it) {
+            if ((*it)->Exists(path)) {
+                return (*it)->Open(path);
+            }
+        }
+
+        throw std::runtime_error("Failed to open file: " + path + " not found in any mount");
+    }
+}
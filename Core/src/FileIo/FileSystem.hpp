@@ -0,0 +1,73 @@
+#ifndef PULSAR_FILESYSTEM_HPP
+#define PULSAR_FILESYSTEM_HPP
+
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "Archive.hpp"
+#include "MappedFile.hpp"
+
+namespace Pulsar::FileIo {
+    // Read-only file contents that either own their bytes or borrow them from a mounted archive.
+    class FileData {
+    public:
+        static FileData FromBytes(std::vector<std::byte> bytes);
+        static FileData FromMapping(MappedFile file);
+        static FileData FromView(std::span<const std::byte> view);
+
+        [[nodiscard]] std::span<const std::byte> GetData() const;
+
+    private:
+        std::variant<std::span<const std::byte>, std::vector<std::byte>, MappedFile> m_Storage;
+
+        FileData() = default;
+    };
+
+    class FileSystem {
+    public:
+        virtual ~FileSystem() = default;
+
+        [[nodiscard]] virtual bool     Exists(const std::string &path) const = 0;
+        [[nodiscard]] virtual FileData Open(const std::string &path) const = 0;
+    };
+
+    class LooseFileSystem final : public FileSystem {
+    public:
+        explicit LooseFileSystem(std::filesystem::path root);
+
+        [[nodiscard]] bool     Exists(const std::string &path) const override;
+        [[nodiscard]] FileData Open(const std::string &path) const override;
+
+    private:
+        std::filesystem::path m_Root;
+    };
+
+    class ArchiveFileSystem final : public FileSystem {
+    public:
+        explicit ArchiveFileSystem(Archive archive);
+
+        [[nodiscard]] bool     Exists(const std::string &path) const override;
+        [[nodiscard]] FileData Open(const std::string &path) const override;
+
+    private:
+        Archive m_Archive;
+    };
+
+    // Later mounts take precedence, so a pack can be overridden by loose files mounted after it.
+    class VirtualFileSystem {
+    public:
+        void Mount(std::unique_ptr<FileSystem> fileSystem);
+
+        [[nodiscard]] bool     Exists(const std::string &path) const;
+        [[nodiscard]] FileData Open(const std::string &path) const;
+
+    private:
+        std::vector<std::unique_ptr<FileSystem>> m_Mounts;
+    };
+}
+
+#endif //PULSAR_FILESYSTEM_HPP
@@ -0,0 +1,175 @@
+#include "MappedFile.hpp"
+
+#include <filesystem>
+#include <stdexcept>
+
+#include "File.hpp"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Pulsar::FileIo {
+    MappedFile MappedFile::Open(const std::string &path) {
+        if (!std::filesystem::is_regular_file(path)) {
+            throw std::runtime_error("Failed to open file.");
+        }
+
+        MappedFile file;
+
+        if (!file.TryMap(path)) {
+            file.m_Fallback = ReadFileBytes(path);
+            file.m_Data     = file.m_Fallback.data();
+            file.m_Size     = file.m_Fallback.size();
+        }
+
+        return file;
+    }
+
+    MappedFile::~MappedFile() {
+        Unmap();
+    }
+
+    MappedFile::MappedFile(MappedFile &&other) noexcept {
+        *this = std::move(other);
+    }
+
+    MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+        if (this == &other) {
+            return *this;
+        }
+
+        Unmap();
+
+        m_IsMapped = other.m_IsMapped;
+        m_Size     = other.m_Size;
+        m_Fallback = std::move(other.m_Fallback);
+        m_Data     = m_IsMapped ? other.m_Data : m_Fallback.data();
+
+#ifdef _WIN32
+        m_FileHandle          = other.m_FileHandle;
+        m_MappingHandle       = other.m_MappingHandle;
+        other.m_FileHandle    = nullptr;
+        other.m_MappingHandle = nullptr;
+#endif
+
+        other.m_Data     = nullptr;
+        other.m_Size     = 0;
+        other.m_IsMapped = false;
+
+        return *this;
+    }
+
+    std::span<const std::byte> MappedFile::GetData() const {
+        return {m_Data, m_Size};
+    }
+
+    size_t MappedFile::GetSize() const {
+        return m_Size;
+    }
+
+    bool MappedFile::IsMapped() const {
+        return m_IsMapped;
+    }
+
+#ifdef _WIN32
+    bool MappedFile::TryMap(const std::string &path) {
+        HANDLE fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+
+        LARGE_INTEGER size;
+        if (GetFileSizeEx(fileHandle, &size) == 0 || size.QuadPart == 0) {
+            CloseHandle(fileHandle);
+            return false;
+        }
+
+        HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle == nullptr) {
+            CloseHandle(fileHandle);
+            return false;
+        }
+
+        const void *view = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+        if (view == nullptr) {
+            CloseHandle(mappingHandle);
+            CloseHandle(fileHandle);
+            return false;
+        }
+
+        m_FileHandle    = fileHandle;
+        m_MappingHandle = mappingHandle;
+        m_Data          = static_cast<const std::byte *>(view);
+        m_Size          = static_cast<size_t>(size.QuadPart);
+        m_IsMapped      = true;
+
+        return true;
+    }
+
+    void MappedFile::Unmap() {
+        if (m_IsMapped) {
+            UnmapViewOfFile(m_Data);
+            CloseHandle(m_MappingHandle);
+            CloseHandle(m_FileHandle);
+        }
+
+        m_FileHandle    = nullptr;
+        m_MappingHandle = nullptr;
+        m_Data          = nullptr;
+        m_Size          = 0;
+        m_IsMapped      = false;
+        m_Fallback.clear();
+    }
+#else
+    bool MappedFile::TryMap(const std::string &path) {
+        const int fileDescriptor = open(path.c_str(), O_RDONLY);
+        if (fileDescriptor < 0) {
+            return false;
+        }
+
+        struct stat fileStat{};
+        if (fstat(fileDescriptor, &fileStat) != 0 || fileStat.st_size <= 0) {
+            close(fileDescriptor);
+            return false;
+        }
+
+        const auto size = static_cast<size_t>(fileStat.st_size);
+        void *     view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+        // The mapping keeps its own reference to the file.
+        close(fileDescriptor);
+
+        if (view == MAP_FAILED) {
+            return false;
+        }
+
+        madvise(view, size, MADV_WILLNEED);
+
+        m_Data     = static_cast<const std::byte *>(view);
+        m_Size     = size;
+        m_IsMapped = true;
+
+        return true;
+    }
+
+    void MappedFile::Unmap() {
+        if (m_IsMapped) {
+            munmap(const_cast<std::byte *>(m_Data), m_Size);
+        }
+
+        m_Data     = nullptr;
+        m_Size     = 0;
+        m_IsMapped = false;
+        m_Fallback.clear();
+    }
+#endif
+}
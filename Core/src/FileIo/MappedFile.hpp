@@ -0,0 +1,46 @@
+#ifndef PULSAR_MAPPEDFILE_HPP
+#define PULSAR_MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Pulsar::FileIo {
+    // Read-only view of a whole file. Uses a memory mapping where the OS allows it and
+    // falls back to a single read into an owned buffer otherwise.
+    class MappedFile {
+    public:
+        static MappedFile Open(const std::string &path);
+
+        ~MappedFile();
+
+        MappedFile(const MappedFile &other) = delete;
+        MappedFile(MappedFile &&other) noexcept;
+
+        MappedFile &operator=(const MappedFile &other) = delete;
+        MappedFile &operator=(MappedFile &&other) noexcept;
+
+        [[nodiscard]] std::span<const std::byte> GetData() const;
+        [[nodiscard]] size_t                     GetSize() const;
+        [[nodiscard]] bool                       IsMapped() const;
+
+    private:
+        const std::byte *      m_Data     = nullptr;
+        size_t                 m_Size     = 0;
+        bool                   m_IsMapped = false;
+        std::vector<std::byte> m_Fallback;
+
+#ifdef _WIN32
+        void *m_FileHandle    = nullptr;
+        void *m_MappingHandle = nullptr;
+#endif
+
+        MappedFile() = default;
+
+        bool TryMap(const std::string &path);
+        void Unmap();
+    };
+}
+
+#endif //PULSAR_MAPPEDFILE_HPP
@@ -0,0 +1,34 @@
+#ifndef PULSAR_INPUT_HPP
+#define PULSAR_INPUT_HPP
+
+#include <cstdint>
+
+#include "Threading/SpmcRing.hpp"
+
+namespace Pulsar::Glfw {
+    enum class InputEventType : uint8_t {
+        Key,
+        Char,
+        MouseButton,
+        CursorMove,
+        Scroll
+    };
+
+    // code is the GLFW key, mouse button or Unicode code point; x and y carry cursor position or scroll offsets.
+    // timestamp is steady_clock nanoseconds at the time the callback ran.
+    struct InputEvent {
+        uint64_t       timestamp = 0;
+        double         x         = 0.0;
+        double         y         = 0.0;
+        int32_t        code      = 0;
+        int32_t        scancode  = 0;
+        int32_t        action    = 0;
+        int32_t        mods      = 0;
+        InputEventType type      = InputEventType::Key;
+    };
+
+    // Filled by the window's callbacks on the main thread; drained by any number of consumers.
+    using InputQueue = Threading::SpmcRing<InputEvent>;
+}
+
+#endif //PULSAR_INPUT_HPP
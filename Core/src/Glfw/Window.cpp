@@ -3,17 +3,44 @@
 #include <stdexcept>
 #include <string>
 
+#include "Threading/JobSystem.hpp"
+
 namespace Pulsar::Glfw {
     static constexpr int s_OpenGlVersionMajor = 3;
     static constexpr int s_OpenGlVersionMinor = 3;
 
+    static constexpr uint32_t s_WindowSizeShift      = 0;
+    static constexpr uint32_t s_FramebufferSizeShift = 32;
+
+    static constexpr uint8_t s_FocusedFlag   = 1 << 0;
+    static constexpr uint8_t s_MinimizedFlag = 1 << 1;
+
     void PollEvents() {
+        if (!Threading::IsMainThread()) {
+            throw std::runtime_error("Failed to poll events: Not called from the main thread");
+        }
+
         glfwPollEvents();
     }
 
+    void WaitEventsTimeout(const double timeout) {
+        if (!Threading::IsMainThread()) {
+            throw std::runtime_error("Failed to wait for events: Not called from the main thread");
+        }
+
+        glfwWaitEventsTimeout(timeout);
+    }
 
     Window Window::Create(const WindowConfig &config) {
+        if (!Threading::IsMainThread()) {
+            throw std::runtime_error("Failed to create window: Not called from the main thread");
+        }
+
         if (s_WindowCount == 0) {
+            if (s_NullPlatform) {
+                glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+            }
+
             if (glfwInit() == 0) {
                 throw std::runtime_error("Failed to create window: Could not initialize GLFW");
             }
@@ -65,6 +92,31 @@ namespace Pulsar::Glfw {
 
         window.m_GlfwWindowPtr = glfwWindowPtr;
         window.m_Config        = config;
+        window.m_State         = std::make_unique<State>(config.inputQueueCapacity);
+
+        int width             = 0;
+        int height            = 0;
+        int framebufferWidth  = 0;
+        int framebufferHeight = 0;
+        glfwGetWindowSize(glfwWindowPtr, &width, &height);
+        glfwGetFramebufferSize(glfwWindowPtr, &framebufferWidth, &framebufferHeight);
+
+        State &state = *window.m_State;
+        StoreSize(state, s_WindowSizeShift, width, height);
+        StoreSize(state, s_FramebufferSizeShift, framebufferWidth, framebufferHeight);
+        StoreFlag(state, s_FocusedFlag, glfwGetWindowAttrib(glfwWindowPtr, GLFW_FOCUSED) == GLFW_TRUE);
+        StoreFlag(state, s_MinimizedFlag, glfwGetWindowAttrib(glfwWindowPtr, GLFW_ICONIFIED) == GLFW_TRUE);
+
+        glfwSetWindowUserPointer(glfwWindowPtr, window.m_State.get());
+        glfwSetWindowSizeCallback(glfwWindowPtr, OnWindowSize);
+        glfwSetFramebufferSizeCallback(glfwWindowPtr, OnFramebufferSize);
+        glfwSetWindowFocusCallback(glfwWindowPtr, OnFocus);
+        glfwSetWindowIconifyCallback(glfwWindowPtr, OnIconify);
+        glfwSetKeyCallback(glfwWindowPtr, OnKey);
+        glfwSetCharCallback(glfwWindowPtr, OnChar);
+        glfwSetMouseButtonCallback(glfwWindowPtr, OnMouseButton);
+        glfwSetCursorPosCallback(glfwWindowPtr, OnCursorMove);
+        glfwSetScrollCallback(glfwWindowPtr, OnScroll);
 
         return window;
     }
@@ -73,24 +125,50 @@ namespace Pulsar::Glfw {
         return s_CurrentWindow;
     }
 
+    void Window::UseNullPlatform() {
+        if (s_WindowCount != 0) {
+            throw std::runtime_error("Failed to select null platform: GLFW is already initialized");
+        }
+
+        s_NullPlatform = true;
+    }
+
     Window::~Window() {
-        if (m_GlfwWindowPtr == nullptr) {
-            return;
+        Destroy();
+    }
+
+    Window::Window(Window &&other) noexcept
+        : m_GlfwWindowPtr(std::exchange(other.m_GlfwWindowPtr, nullptr)), m_Config(std::move(other.m_Config)),
+          m_State(std::move(other.m_State)) {
+        if (s_CurrentWindow == &other) {
+            s_CurrentWindow = this;
         }
+    }
 
-        s_WindowCount--;
+    Window &Window::operator=(Window &&other) noexcept {
+        if (this != &other) {
+            Destroy();
 
-        glfwDestroyWindow(m_GlfwWindowPtr);
+            m_GlfwWindowPtr = std::exchange(other.m_GlfwWindowPtr, nullptr);
+            m_Config        = std::move(other.m_Config);
+            m_State         = std::move(other.m_State);
 
-        if (s_WindowCount == 0) {
-            glfwTerminate();\
+            if (s_CurrentWindow == &other) {
+                s_CurrentWindow = this;
+            }
         }
+
+        return *this;
     }
 
     GLFWwindow *Window::GetGlfwWindowPtr() const {
         return m_GlfwWindowPtr;
     }
 
+    GraphicsApi Window::GetGraphicsApi() const {
+        return m_Config.api;
+    }
+
     void Window::SetCurrent() {
         if (m_Config.api == GraphicsApi::OpenGl) {
             glfwMakeContextCurrent(m_GlfwWindowPtr);
@@ -104,32 +182,183 @@ namespace Pulsar::Glfw {
     }
 
     uint16_t Window::GetWidth() const {
-        int width = 0;
-
-        glfwGetWindowSize(m_GlfwWindowPtr, &width, nullptr);
-        return width;
+        return GetState().width;
     }
 
     uint16_t Window::GetHeight() const {
-        int height = 0;
+        return GetState().height;
+    }
+
+    uint16_t Window::GetFramebufferWidth() const {
+        return GetState().framebufferWidth;
+    }
+
+    uint16_t Window::GetFramebufferHeight() const {
+        return GetState().framebufferHeight;
+    }
+
+    bool Window::IsFocused() const {
+        return GetState().focused;
+    }
 
-        glfwGetWindowSize(m_GlfwWindowPtr, nullptr, &height);
-        return height;
+    bool Window::IsMinimized() const {
+        return GetState().minimized;
+    }
+
+    WindowState Window::GetState() const {
+        const uint64_t sizes = m_State->sizes.load(std::memory_order_acquire);
+        const uint8_t  flags = m_State->flags.load(std::memory_order_acquire);
+
+        WindowState state;
+        state.width             = static_cast<uint16_t>(sizes >> s_WindowSizeShift);
+        state.height            = static_cast<uint16_t>(sizes >> (s_WindowSizeShift + 16));
+        state.framebufferWidth  = static_cast<uint16_t>(sizes >> s_FramebufferSizeShift);
+        state.framebufferHeight = static_cast<uint16_t>(sizes >> (s_FramebufferSizeShift + 16));
+        state.focused           = (flags & s_FocusedFlag) != 0;
+        state.minimized         = (flags & s_MinimizedFlag) != 0;
+
+        return state;
+    }
+
+    InputQueue &Window::GetInputQueue() const {
+        return m_State->inputQueue;
+    }
+
+    uint64_t Window::GetDroppedInputCount() const {
+        return m_State->droppedInputs.load(std::memory_order_relaxed);
     }
 
     std::string Window::GetTitle() const {
         return glfwGetWindowTitle(m_GlfwWindowPtr);
     }
 
-    void Window::SetWidth(const uint16_t value) const {
-        glfwSetWindowSize(m_GlfwWindowPtr, value, GetHeight());
+    void Window::SetWidth(const uint16_t value) {
+        const uint16_t height = GetHeight();
+
+        StoreSize(*m_State, s_WindowSizeShift, value, height);
+        glfwSetWindowSize(m_GlfwWindowPtr, value, height);
     }
 
-    void Window::SetHeight(const uint16_t value) const {
-        glfwSetWindowSize(m_GlfwWindowPtr, GetWidth(), value);
+    void Window::SetHeight(const uint16_t value) {
+        const uint16_t width = GetWidth();
+
+        StoreSize(*m_State, s_WindowSizeShift, width, value);
+        glfwSetWindowSize(m_GlfwWindowPtr, width, value);
     }
 
     void Window::SetTitle(const std::string &value) const {
         glfwSetWindowTitle(m_GlfwWindowPtr, value.c_str());
     }
+
+    void Window::Destroy() {
+        if (m_GlfwWindowPtr == nullptr) {
+            return;
+        }
+
+        if (s_CurrentWindow == this) {
+            s_CurrentWindow = nullptr;
+        }
+
+        s_WindowCount--;
+
+        glfwDestroyWindow(m_GlfwWindowPtr);
+        m_GlfwWindowPtr = nullptr;
+
+        if (s_WindowCount == 0) {
+            glfwTerminate();
+        }
+    }
+
+    void Window::PushInput(GLFWwindow *glfwWindowPtr, InputEvent event) {
+        auto *state = static_cast<State *>(glfwGetWindowUserPointer(glfwWindowPtr));
+
+        event.timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+
+        if (!state->inputQueue.Push(event)) {
+            state->droppedInputs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Only the main thread writes, so a plain load and store is enough to update one half or one bit.
+    void Window::StoreSize(State &state, const uint32_t shift, const int width, const int height) {
+        const uint64_t packed = static_cast<uint64_t>(static_cast<uint16_t>(width)) |
+                                static_cast<uint64_t>(static_cast<uint16_t>(height)) << 16;
+
+        uint64_t sizes = state.sizes.load(std::memory_order_relaxed);
+        sizes          = (sizes & ~(uint64_t{0xFFFFFFFF} << shift)) | packed << shift;
+        state.sizes.store(sizes, std::memory_order_release);
+    }
+
+    void Window::StoreFlag(State &state, const uint8_t flag, const bool value) {
+        const uint8_t flags = state.flags.load(std::memory_order_relaxed);
+        state.flags.store(static_cast<uint8_t>(value ? flags | flag : flags & ~flag), std::memory_order_release);
+    }
+
+    void Window::OnWindowSize(GLFWwindow *glfwWindowPtr, const int width, const int height) {
+        StoreSize(*static_cast<State *>(glfwGetWindowUserPointer(glfwWindowPtr)), s_WindowSizeShift, width, height);
+    }
+
+    void Window::OnFramebufferSize(GLFWwindow *glfwWindowPtr, const int width, const int height) {
+        StoreSize(*static_cast<State *>(glfwGetWindowUserPointer(glfwWindowPtr)), s_FramebufferSizeShift, width,
+                  height);
+    }
+
+    void Window::OnFocus(GLFWwindow *glfwWindowPtr, const int focused) {
+        StoreFlag(*static_cast<State *>(glfwGetWindowUserPointer(glfwWindowPtr)), s_FocusedFlag,
+                  focused == GLFW_TRUE);
+    }
+
+    void Window::OnIconify(GLFWwindow *glfwWindowPtr, const int iconified) {
+        StoreFlag(*static_cast<State *>(glfwGetWindowUserPointer(glfwWindowPtr)), s_MinimizedFlag,
+                  iconified == GLFW_TRUE);
+    }
+
+    void Window::OnKey(GLFWwindow *glfwWindowPtr, const int key, const int scancode, const int action,
+                       const int mods) {
+        InputEvent event;
+        event.type     = InputEventType::Key;
+        event.code     = key;
+        event.scancode = scancode;
+        event.action   = action;
+        event.mods     = mods;
+
+        PushInput(glfwWindowPtr, event);
+    }
+
+    void Window::OnChar(GLFWwindow *glfwWindowPtr, const unsigned int codepoint) {
+        InputEvent event;
+        event.type = InputEventType::Char;
+        event.code = static_cast<int32_t>(codepoint);
+
+        PushInput(glfwWindowPtr, event);
+    }
+
+    void Window::OnMouseButton(GLFWwindow *glfwWindowPtr, const int button, const int action, const int mods) {
+        InputEvent event;
+        event.type   = InputEventType::MouseButton;
+        event.code   = button;
+        event.action = action;
+        event.mods   = mods;
+
+        PushInput(glfwWindowPtr, event);
+    }
+
+    void Window::OnCursorMove(GLFWwindow *glfwWindowPtr, const double x, const double y) {
+        InputEvent event;
+        event.type = InputEventType::CursorMove;
+        event.x    = x;
+        event.y    = y;
+
+        PushInput(glfwWindowPtr, event);
+    }
+
+    void Window::OnScroll(GLFWwindow *glfwWindowPtr, const double x, const double y) {
+        InputEvent event;
+        event.type = InputEventType::Scroll;
+        event.x    = x;
+        event.y    = y;
+
+        PushInput(glfwWindowPtr, event);
+    }
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <GLFW/glfw3.h>
 
 #include "GraphicsApi.hpp"
+#include "Input.hpp"
 
 namespace Pulsar::Glfw {
     struct WindowConfig {
@@ -14,28 +15,53 @@ namespace Pulsar::Glfw {
         uint16_t    width  = 800;
         uint16_t    height = 600;
         GraphicsApi api    = GraphicsApi::Vulkan;
+
+        uint32_t inputQueueCapacity = 1024;
+    };
+
+    // Kept up to date by GLFW callbacks, so reading it never calls into GLFW. Window::GetState returns a copy
+    // that any thread may take; the four sizes always come from the same callback.
+    struct WindowState {
+        uint16_t width             = 0;
+        uint16_t height            = 0;
+        uint16_t framebufferWidth  = 0;
+        uint16_t framebufferHeight = 0;
+        bool     focused           = false;
+        bool     minimized         = false;
     };
 
+    // GLFW is main-thread only; the functions below and Window::Create throw when called from anywhere else.
+    // Jobs that need them go through JobSystem::ScheduleOnMainThread.
     void PollEvents();
 
+    // Sleeps until an event arrives or timeout seconds pass. Use instead of PollEvents while the window is
+    // minimized or in the background.
+    void WaitEventsTimeout(double timeout);
+
     class Window {
     public:
         static Window Create(const WindowConfig &config = {});
 
         static Window *GetCurrent();
 
+        // Selects GLFW's null platform for every window created afterwards: nothing is shown and Vulkan surfaces
+        // use VK_EXT_headless_surface, so the renderer runs without a display. Call before the first Create.
+        static void UseNullPlatform();
+
         ~Window();
 
         Window(const Window &other) = delete;
 
-        Window(Window &&other) noexcept = default;
+        Window(Window &&other) noexcept;
 
         Window &operator=(const Window &other) = delete;
 
-        Window &operator=(Window &&other) noexcept = default;
+        Window &operator=(Window &&other) noexcept;
 
         GLFWwindow *GetGlfwWindowPtr() const;
 
+        GraphicsApi GetGraphicsApi() const;
+
         void SetCurrent();
 
         bool ShouldClose() const;
@@ -44,22 +70,69 @@ namespace Pulsar::Glfw {
 
         uint16_t GetHeight() const;
 
+        uint16_t GetFramebufferWidth() const;
+
+        uint16_t GetFramebufferHeight() const;
+
+        bool IsFocused() const;
+
+        bool IsMinimized() const;
+
+        WindowState GetState() const;
+
+        // Events are pushed during PollEvents/WaitEventsTimeout; events that arrive while the queue is full are
+        // dropped and counted.
+        InputQueue &GetInputQueue() const;
+
+        uint64_t GetDroppedInputCount() const;
+
         std::string GetTitle() const;
 
-        void SetWidth(uint16_t value) const;
+        void SetWidth(uint16_t value);
 
-        void SetHeight(uint16_t value) const;
+        void SetHeight(uint16_t value);
 
         void SetTitle(const std::string &value) const;
 
     private:
         inline static unsigned int s_WindowCount   = 0;
         inline static Window *     s_CurrentWindow = nullptr;
+        inline static bool         s_NullPlatform  = false;
+
+        // Heap-allocated so the GLFW user pointer stays valid when the window is moved.
+        // The cached WindowState is written on the main thread only and published through two atomics: the
+        // sizes packed 16 bits each, and the flags.
+        struct State {
+            std::atomic<uint64_t> sizes = 0;
+            std::atomic<uint8_t>  flags = 0;
+            InputQueue            inputQueue;
+            std::atomic<uint64_t> droppedInputs = 0;
+
+            explicit State(const size_t inputQueueCapacity) : inputQueue(inputQueueCapacity) {}
+        };
 
-        GLFWwindow * m_GlfwWindowPtr = nullptr;
-        WindowConfig m_Config        = {};
+        GLFWwindow *           m_GlfwWindowPtr = nullptr;
+        WindowConfig           m_Config        = {};
+        std::unique_ptr<State> m_State;
 
         Window() = default;
+
+        void Destroy();
+
+        static void PushInput(GLFWwindow *glfwWindowPtr, InputEvent event);
+
+        static void StoreSize(State &state, uint32_t shift, int width, int height);
+        static void StoreFlag(State &state, uint8_t flag, bool value);
+
+        static void OnWindowSize(GLFWwindow *glfwWindowPtr, int width, int height);
+        static void OnFramebufferSize(GLFWwindow *glfwWindowPtr, int width, int height);
+        static void OnFocus(GLFWwindow *glfwWindowPtr, int focused);
+        static void OnIconify(GLFWwindow *glfwWindowPtr, int iconified);
+        static void OnKey(GLFWwindow *glfwWindowPtr, int key, int scancode, int action, int mods);
+        static void OnChar(GLFWwindow *glfwWindowPtr, unsigned int codepoint);
+        static void OnMouseButton(GLFWwindow *glfwWindowPtr, int button, int action, int mods);
+        static void OnCursorMove(GLFWwindow *glfwWindowPtr, double x, double y);
+        static void OnScroll(GLFWwindow *glfwWindowPtr, double x, double y);
     };
 }
 
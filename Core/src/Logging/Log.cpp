@@ -0,0 +1,434 @@
+#include "Log.hpp"
+
+#include <charconv>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "LogBuffer.hpp"
+
+namespace Pulsar::Logging {
+    static constexpr std::array<const char *, 6> s_SeverityNames = {
+        "Trace", "Debug", "Info", "Warning", "Error", "Off"
+    };
+
+    static constexpr std::array<const char *, g_CategoryCount> s_CategoryNames = {
+        "Core", "Vulkan", "Validation", "OpenGl", "Renderer", "Assets", "FileIo"
+    };
+
+    static constexpr size_t s_ThreadBufferSize = 64 * 1024;
+
+    static constexpr std::chrono::milliseconds s_DrainInterval(5);
+
+    // Outside the logger so threads that log during static destruction still have something to count into.
+    static std::atomic<uint64_t> s_Dropped  = 0;
+    static std::atomic<bool>     s_Shutdown = false;
+
+    // Set on the logging thread, which must never wait for its own buffer to drain.
+    static thread_local bool t_IsLoggingThread = false;
+
+    const char *GetSeverityName(const Severity severity) {
+        return s_SeverityNames[static_cast<size_t>(severity)];
+    }
+
+    const char *GetCategoryName(const Category category) {
+        return s_CategoryNames[static_cast<size_t>(category)];
+    }
+
+    struct ThreadBuffer {
+        explicit ThreadBuffer(const uint32_t thread) : buffer(s_ThreadBufferSize), thread(thread) {}
+
+        LogBuffer         buffer;
+        uint32_t          thread;
+        std::atomic<bool> retired = false;
+    };
+
+    // Owns the logging thread. Threads register a buffer on their first message; the logging thread drains
+    // every buffer each pass, orders the pass by timestamp, formats and hands the entries to the sinks.
+    class Logger {
+    public:
+        static Logger &Get() {
+            static Logger logger;
+            return logger;
+        }
+
+        Logger(const Logger &other) = delete;
+
+        Logger &operator=(const Logger &other) = delete;
+
+        ~Logger() {
+            {
+                std::lock_guard lock(m_Mutex);
+                m_Stop = true;
+            }
+
+            m_Wake.notify_all();
+            m_Thread.join();
+
+            s_Shutdown.store(true, std::memory_order_release);
+        }
+
+        std::shared_ptr<ThreadBuffer> Register() {
+            std::lock_guard lock(m_Mutex);
+
+            auto buffer = std::make_shared<ThreadBuffer>(m_NextThread++);
+            m_Buffers.push_back(buffer);
+
+            return buffer;
+        }
+
+        void AddSink(const SinkFunction &sink) {
+            std::lock_guard lock(m_SinkMutex);
+            m_Sinks.push_back(sink);
+        }
+
+        void ClearSinks() {
+            std::lock_guard lock(m_SinkMutex);
+            m_Sinks.clear();
+        }
+
+        void Flush() {
+            std::unique_lock lock(m_Mutex);
+            const uint64_t   target = ++m_FlushRequested;
+
+            m_Wake.notify_all();
+            m_Flushed.wait(lock, [&] { return m_FlushCompleted >= target; });
+        }
+
+    private:
+        struct Pending {
+            uint64_t timestamp;
+            Severity severity;
+            Category category;
+            uint32_t thread;
+            size_t   offset;
+            size_t   length;
+        };
+
+        std::mutex                                 m_Mutex;
+        std::condition_variable                    m_Wake;
+        std::condition_variable                    m_Flushed;
+        std::vector<std::shared_ptr<ThreadBuffer>> m_Buffers;
+        uint32_t                                   m_NextThread     = 1;
+        uint64_t                                   m_FlushRequested = 0;
+        uint64_t                                   m_FlushCompleted = 0;
+        bool                                       m_Stop           = false;
+
+        std::mutex                m_SinkMutex;
+        std::vector<SinkFunction> m_Sinks;
+
+        // Logging thread only.
+        std::vector<std::shared_ptr<ThreadBuffer>> m_Snapshot;
+        std::vector<Pending>                       m_Pending;
+        std::string                                m_Text;
+        uint64_t                                   m_ReportedDrops = 0;
+
+        std::thread m_Thread;
+
+        Logger() : m_Thread([this] { Run(); }) {}
+
+        void Run() {
+            t_IsLoggingThread = true;
+
+            while (true) {
+                uint64_t target;
+                bool     stop;
+
+                {
+                    std::unique_lock lock(m_Mutex);
+                    m_Wake.wait_for(lock, s_DrainInterval, [&] {
+                        return m_Stop || m_FlushRequested != m_FlushCompleted;
+                    });
+
+                    target = m_FlushRequested;
+                    stop   = m_Stop;
+                    m_Snapshot.assign(m_Buffers.begin(), m_Buffers.end());
+                }
+
+                Drain();
+
+                {
+                    std::lock_guard lock(m_Mutex);
+                    m_FlushCompleted = target;
+
+                    std::erase_if(m_Buffers, [](const std::shared_ptr<ThreadBuffer> &buffer) {
+                        return buffer->retired.load(std::memory_order_acquire) && buffer->buffer.IsEmpty();
+                    });
+                }
+
+                m_Flushed.notify_all();
+
+                if (stop) {
+                    return;
+                }
+            }
+        }
+
+        void Drain() {
+            m_Pending.clear();
+            m_Text.clear();
+
+            for (const std::shared_ptr<ThreadBuffer> &buffer : m_Snapshot) {
+                while (const std::byte *record = buffer->buffer.Peek()) {
+                    Detail::RecordHeader header;
+                    std::memcpy(&header, record, sizeof(header));
+
+                    const size_t offset = m_Text.size();
+                    Format(header, record + sizeof(header), m_Text);
+
+                    m_Pending.push_back({
+                        header.timestamp, header.severity, header.category, buffer->thread, offset,
+                        m_Text.size() - offset
+                    });
+
+                    buffer->buffer.Pop(header.size);
+                }
+            }
+            m_Snapshot.clear();
+
+            const uint64_t dropped = s_Dropped.load(std::memory_order_relaxed);
+            if (dropped != m_ReportedDrops) {
+                const size_t offset = m_Text.size();
+                m_Text += "Dropped ";
+                AppendInteger(m_Text, dropped - m_ReportedDrops);
+                m_Text += " log messages";
+
+                m_Pending.push_back({
+                    Detail::GetTimestamp(), Severity::Warning, Category::Core, 0, offset, m_Text.size() - offset
+                });
+                m_ReportedDrops = dropped;
+            }
+
+            if (m_Pending.empty()) {
+                return;
+            }
+
+            std::stable_sort(m_Pending.begin(), m_Pending.end(), [](const Pending &a, const Pending &b) {
+                return a.timestamp < b.timestamp;
+            });
+
+            std::lock_guard lock(m_SinkMutex);
+
+            for (const Pending &pending : m_Pending) {
+                LogEntry entry;
+                entry.timestamp = pending.timestamp;
+                entry.severity  = pending.severity;
+                entry.category  = pending.category;
+                entry.thread    = pending.thread;
+                entry.message   = std::string_view(m_Text).substr(pending.offset, pending.length);
+
+                if (m_Sinks.empty()) {
+                    WriteConsole(entry);
+                } else {
+                    for (const SinkFunction &sink : m_Sinks) {
+                        sink(entry);
+                    }
+                }
+            }
+
+            if (m_Sinks.empty()) {
+                std::cout.flush();
+            }
+        }
+
+        template<typename T>
+        static void AppendInteger(std::string &text, const T value, const int base = 10) {
+            char buffer[24];
+            const auto [end, error] = std::to_chars(buffer, buffer + sizeof(buffer), value, base);
+            text.append(buffer, end);
+        }
+
+        static void AppendArgument(const std::byte *&cursor, std::string &text) {
+            Detail::ArgumentType type;
+            std::memcpy(&type, cursor, sizeof(type));
+            cursor += sizeof(type);
+
+            switch (type) {
+                case Detail::ArgumentType::Bool: {
+                    bool value;
+                    std::memcpy(&value, cursor, sizeof(value));
+                    cursor += sizeof(value);
+                    text += value ? "true" : "false";
+                    break;
+                }
+                case Detail::ArgumentType::Char: {
+                    char value;
+                    std::memcpy(&value, cursor, sizeof(value));
+                    cursor += sizeof(value);
+                    text += value;
+                    break;
+                }
+                case Detail::ArgumentType::Signed: {
+                    int64_t value;
+                    std::memcpy(&value, cursor, sizeof(value));
+                    cursor += sizeof(value);
+                    AppendInteger(text, value);
+                    break;
+                }
+                case Detail::ArgumentType::Unsigned: {
+                    uint64_t value;
+                    std::memcpy(&value, cursor, sizeof(value));
+                    cursor += sizeof(value);
+                    AppendInteger(text, value);
+                    break;
+                }
+                case Detail::ArgumentType::Float: {
+                    double value;
+                    std::memcpy(&value, cursor, sizeof(value));
+                    cursor += sizeof(value);
+
+                    char       buffer[32];
+                    const auto [end, error] = std::to_chars(buffer, buffer + sizeof(buffer), value);
+                    text.append(buffer, end);
+                    break;
+                }
+                case Detail::ArgumentType::String: {
+                    uint32_t length;
+                    std::memcpy(&length, cursor, sizeof(length));
+                    cursor += sizeof(length);
+                    text.append(reinterpret_cast<const char *>(cursor), length);
+                    cursor += length;
+                    break;
+                }
+                case Detail::ArgumentType::Pointer: {
+                    uint64_t value;
+                    std::memcpy(&value, cursor, sizeof(value));
+                    cursor += sizeof(value);
+                    text += "0x";
+                    AppendInteger(text, value, 16);
+                    break;
+                }
+            }
+        }
+
+        // "{}" takes the next argument, "{{" and "}}" are literal braces. Placeholders without an argument are
+        // printed as is, and leftover arguments are ignored.
+        static void Format(const Detail::RecordHeader &header, const std::byte *arguments, std::string &text) {
+            const char *format    = header.format;
+            uint16_t    remaining = header.argumentCount;
+
+            while (*format != '\0') {
+                const char *run = format;
+                while (*format != '\0' && *format != '{' && *format != '}') {
+                    format++;
+                }
+                text.append(run, format);
+
+                if (*format == '\0') {
+                    break;
+                }
+
+                if (format[0] == '{' && format[1] == '}' && remaining > 0) {
+                    AppendArgument(arguments, text);
+                    remaining--;
+                    format += 2;
+                } else if ((format[0] == '{' && format[1] == '{') || (format[0] == '}' && format[1] == '}')) {
+                    text += format[0];
+                    format += 2;
+                } else {
+                    text += *format++;
+                }
+            }
+        }
+
+        static void WriteConsole(const LogEntry &entry) {
+            std::ostream &stream = entry.severity >= Severity::Warning ? std::cerr : std::cout;
+            stream << (entry.category == Category::Validation ? "[VK] " : "[PS] ");
+
+            if (entry.severity >= Severity::Warning) {
+                stream << GetSeverityName(entry.severity) << ": ";
+            }
+
+            stream << entry.message << '\n';
+        }
+    };
+
+    // Retires the thread's buffer when the thread exits; the logging thread frees it once drained.
+    struct ThreadHandle {
+        std::shared_ptr<ThreadBuffer> buffer;
+
+        ~ThreadHandle() {
+            if (buffer != nullptr) {
+                buffer->retired.store(true, std::memory_order_release);
+            }
+        }
+    };
+
+    static thread_local ThreadHandle t_Handle;
+
+    void AddSink(const SinkFunction &sink) {
+        Logger::Get().AddSink(sink);
+    }
+
+    void ClearSinks() {
+        Logger::Get().ClearSinks();
+    }
+
+    void SetMinSeverity(const Severity severity) {
+        for (std::atomic<uint8_t> &minimum : Detail::g_RuntimeMinSeverity) {
+            minimum.store(static_cast<uint8_t>(severity), std::memory_order_relaxed);
+        }
+    }
+
+    void SetMinSeverity(const Category category, const Severity severity) {
+        Detail::g_RuntimeMinSeverity[static_cast<size_t>(category)].store(static_cast<uint8_t>(severity),
+                                                                          std::memory_order_relaxed);
+    }
+
+    Severity GetMinSeverity(const Category category) {
+        return static_cast<Severity>(
+            Detail::g_RuntimeMinSeverity[static_cast<size_t>(category)].load(std::memory_order_relaxed));
+    }
+
+    void Flush() {
+        if (t_IsLoggingThread || s_Shutdown.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        Logger::Get().Flush();
+    }
+
+    uint64_t GetDroppedCount() {
+        return s_Dropped.load(std::memory_order_relaxed);
+    }
+
+    std::byte *Detail::Reserve(const uint32_t size, const bool wait) {
+        if (size > s_ThreadBufferSize / 4) {
+            s_Dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        if (t_Handle.buffer == nullptr) {
+            if (s_Shutdown.load(std::memory_order_acquire)) {
+                s_Dropped.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            t_Handle.buffer = Logger::Get().Register();
+        }
+
+        std::byte *record = t_Handle.buffer->buffer.Reserve(size);
+
+        while (record == nullptr && wait && !t_IsLoggingThread && !s_Shutdown.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+            record = t_Handle.buffer->buffer.Reserve(size);
+        }
+
+        if (record == nullptr) {
+            s_Dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        return record;
+    }
+
+    void Detail::Commit() {
+        t_Handle.buffer->buffer.Commit();
+    }
+
+    uint64_t Detail::GetTimestamp() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
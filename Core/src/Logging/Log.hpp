@@ -0,0 +1,232 @@
+#ifndef PULSAR_LOG_HPP
+#define PULSAR_LOG_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Messages below this severity compile to nothing. 0 = Trace ... 4 = Error, 5 = everything off.
+#ifndef PULSAR_LOG_MIN_SEVERITY
+#ifdef NDEBUG
+#define PULSAR_LOG_MIN_SEVERITY 2
+#else
+#define PULSAR_LOG_MIN_SEVERITY 0
+#endif
+#endif
+
+namespace Pulsar::Logging {
+    enum class Severity : uint8_t {
+        Trace,
+        Debug,
+        Info,
+        Warning,
+        Error,
+        Off
+    };
+
+    enum class Category : uint8_t {
+        Core,
+        Vulkan,
+        Validation,
+        OpenGl,
+        Renderer,
+        Assets,
+        FileIo
+    };
+
+    constexpr size_t   g_CategoryCount          = 7;
+    constexpr Severity g_CompileTimeMinSeverity = static_cast<Severity>(PULSAR_LOG_MIN_SEVERITY);
+
+    const char *GetSeverityName(Severity severity);
+    const char *GetCategoryName(Category category);
+
+    // Handed to sinks on the logging thread; message is only valid during the call.
+    struct LogEntry {
+        uint64_t         timestamp = 0; // steady_clock nanoseconds
+        Severity         severity  = Severity::Info;
+        Category         category  = Category::Core;
+        uint32_t         thread    = 0; // registration order, not the OS thread id
+        std::string_view message;
+    };
+
+    using SinkFunction = std::function<void(const LogEntry &entry)>;
+
+    // Sinks run on the logging thread only. Without any sink added, entries go to the console.
+    void AddSink(const SinkFunction &sink);
+    void ClearSinks();
+
+    void     SetMinSeverity(Severity severity);
+    void     SetMinSeverity(Category category, Severity severity);
+    Severity GetMinSeverity(Category category);
+
+    // Blocks until everything logged before the call has reached the sinks. Does nothing when called from a sink.
+    void Flush();
+
+    // Messages lost because a thread's buffer was full or a message did not fit. Warnings and errors are only
+    // lost when they do not fit, or when a sink logs them while the logging thread's own buffer is full.
+    uint64_t GetDroppedCount();
+
+    namespace Detail {
+        // Validation starts at Info so verbose layer chatter is opt-in.
+        inline std::array<std::atomic<uint8_t>, g_CategoryCount> g_RuntimeMinSeverity = {
+            0, 0, 2, 0, 0, 0, 0
+        };
+
+        constexpr uint32_t s_MaxStringLength = 4096;
+
+        enum class ArgumentType : uint8_t {
+            Bool,
+            Char,
+            Signed,
+            Unsigned,
+            Float,
+            String,
+            Pointer
+        };
+
+        struct RecordHeader {
+            uint32_t    size          = 0; // Header and arguments, padded to 8 bytes.
+            Severity    severity      = Severity::Info;
+            Category    category      = Category::Core;
+            uint16_t    argumentCount = 0;
+            uint64_t    timestamp     = 0;
+            const char *format        = nullptr;
+        };
+
+        // Space in the calling thread's buffer. When it is full, returns nullptr, or with wait set yields until
+        // the logging thread makes room. Every non-null Reserve must be followed by Commit.
+        std::byte *Reserve(uint32_t size, bool wait);
+        void       Commit();
+
+        uint64_t GetTimestamp();
+
+        template<typename T>
+        constexpr bool IsString = std::is_convertible_v<const T &, std::string_view>;
+
+        template<typename T>
+        size_t GetEncodedSize(const T &value) {
+            if constexpr (IsString<T>) {
+                return 1 + sizeof(uint32_t) + std::min<size_t>(std::string_view(value).size(), s_MaxStringLength);
+            } else if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, char>) {
+                return 2;
+            } else {
+                return 1 + 8;
+            }
+        }
+
+        template<typename T>
+        void Put(std::byte *&cursor, const T &value) {
+            std::memcpy(cursor, &value, sizeof(T));
+            cursor += sizeof(T);
+        }
+
+        template<typename T>
+        void Encode(std::byte *&cursor, const T &value) {
+            if constexpr (IsString<T>) {
+                const std::string_view string = value;
+                const auto             length = static_cast<uint32_t>(std::min<size_t>(string.size(),
+                                                                             s_MaxStringLength));
+                Put(cursor, ArgumentType::String);
+                Put(cursor, length);
+                std::memcpy(cursor, string.data(), length);
+                cursor += length;
+            } else if constexpr (std::is_same_v<T, bool>) {
+                Put(cursor, ArgumentType::Bool);
+                Put(cursor, value);
+            } else if constexpr (std::is_same_v<T, char>) {
+                Put(cursor, ArgumentType::Char);
+                Put(cursor, value);
+            } else if constexpr (std::is_enum_v<T>) {
+                Encode(cursor, static_cast<std::underlying_type_t<T>>(value));
+            } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+                Put(cursor, ArgumentType::Signed);
+                Put(cursor, static_cast<int64_t>(value));
+            } else if constexpr (std::is_integral_v<T>) {
+                Put(cursor, ArgumentType::Unsigned);
+                Put(cursor, static_cast<uint64_t>(value));
+            } else if constexpr (std::is_floating_point_v<T>) {
+                Put(cursor, ArgumentType::Float);
+                Put(cursor, static_cast<double>(value));
+            } else if constexpr (std::is_pointer_v<T>) {
+                Put(cursor, ArgumentType::Pointer);
+                Put(cursor, reinterpret_cast<uint64_t>(value));
+            } else {
+                static_assert(std::is_pointer_v<T>, "Unsupported log argument type");
+            }
+        }
+    }
+
+    [[nodiscard]] inline bool IsEnabled(const Category category, const Severity severity) {
+        return static_cast<uint8_t>(severity) >= Detail::g_RuntimeMinSeverity[static_cast<size_t>(category)].load(
+                   std::memory_order_relaxed);
+    }
+
+    // format must outlive the program (a string literal): only the pointer is stored, and "{}" placeholders are
+    // filled in on the logging thread. Arguments may be integers, floats, bools, chars, enums, pointers and
+    // anything convertible to std::string_view, which is copied (up to 4 KiB).
+    template<Severity S, typename... Args>
+    void Write(const Category category, const char *format, const Args &... args) {
+        if constexpr (S >= g_CompileTimeMinSeverity && S != Severity::Off) {
+            if (!IsEnabled(category, S)) {
+                return;
+            }
+
+            const size_t payload = (size_t{0} + ... + Detail::GetEncodedSize(args));
+            const size_t size    = (sizeof(Detail::RecordHeader) + payload + 7) & ~size_t{7};
+
+            // Warnings and errors are worth stalling for; anything less is dropped when the buffer is full.
+            std::byte *record = Detail::Reserve(static_cast<uint32_t>(std::min<size_t>(size, UINT32_MAX)),
+                                                S >= Severity::Warning);
+            if (record == nullptr) {
+                return;
+            }
+
+            Detail::RecordHeader header;
+            header.size          = static_cast<uint32_t>(size);
+            header.severity      = S;
+            header.category      = category;
+            header.argumentCount = sizeof...(Args);
+            header.timestamp     = Detail::GetTimestamp();
+            header.format        = format;
+            std::memcpy(record, &header, sizeof(header));
+
+            std::byte *cursor = record + sizeof(header);
+            (Detail::Encode(cursor, args), ...);
+
+            Detail::Commit();
+        }
+    }
+
+    template<typename... Args>
+    void Trace(const Category category, const char *format, const Args &... args) {
+        Write<Severity::Trace>(category, format, args...);
+    }
+
+    template<typename... Args>
+    void Debug(const Category category, const char *format, const Args &... args) {
+        Write<Severity::Debug>(category, format, args...);
+    }
+
+    template<typename... Args>
+    void Info(const Category category, const char *format, const Args &... args) {
+        Write<Severity::Info>(category, format, args...);
+    }
+
+    template<typename... Args>
+    void Warning(const Category category, const char *format, const Args &... args) {
+        Write<Severity::Warning>(category, format, args...);
+    }
+
+    template<typename... Args>
+    void Error(const Category category, const char *format, const Args &... args) {
+        Write<Severity::Error>(category, format, args...);
+    }
+}
+
+#endif //PULSAR_LOG_HPP
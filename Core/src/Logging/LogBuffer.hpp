@@ -0,0 +1,103 @@
+#ifndef PULSAR_LOGBUFFER_HPP
+#define PULSAR_LOGBUFFER_HPP
+
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <memory>
+
+namespace Pulsar::Logging {
+    // Single-producer/single-consumer ring of variable-sized records. Every record starts with its size as a
+    // uint32_t and is a multiple of 8 bytes; a record that would cross the end of the ring is placed at the start
+    // instead, behind a zero size that tells the consumer to wrap. Reserve never blocks: it fails when the
+    // consumer has not caught up.
+    class LogBuffer {
+    public:
+        explicit LogBuffer(const size_t capacity)
+            : m_Mask(std::bit_ceil(std::max<size_t>(capacity, 64)) - 1),
+              m_Data(std::make_unique<uint64_t[]>((m_Mask + 1) / sizeof(uint64_t))) {}
+
+        LogBuffer(const LogBuffer &other) = delete;
+
+        LogBuffer &operator=(const LogBuffer &other) = delete;
+
+        // Producer only. size must be a multiple of 8; records larger than a quarter of the ring are refused.
+        std::byte *Reserve(const uint32_t size) {
+            const size_t capacity = m_Mask + 1;
+
+            if (size == 0 || size > capacity / 4) {
+                return nullptr;
+            }
+
+            const uint64_t tail     = m_Tail.load(std::memory_order_relaxed);
+            const size_t   position = tail & m_Mask;
+            const size_t   padding  = position + size > capacity ? capacity - position : 0;
+            const size_t   needed   = padding + size;
+
+            if (capacity - (tail - m_CachedHead) < needed) {
+                m_CachedHead = m_Head.load(std::memory_order_acquire);
+
+                if (capacity - (tail - m_CachedHead) < needed) {
+                    return nullptr;
+                }
+            }
+
+            if (padding != 0) {
+                constexpr uint32_t wrap = 0;
+                std::memcpy(GetBytes() + position, &wrap, sizeof(wrap));
+            }
+
+            m_Reserved = tail + needed;
+            return GetBytes() + ((tail + padding) & m_Mask);
+        }
+
+        // Producer only. Publishes the last reserved record.
+        void Commit() {
+            m_Tail.store(m_Reserved, std::memory_order_release);
+        }
+
+        // Consumer only. The next record, or nullptr when the ring is empty.
+        const std::byte *Peek() {
+            uint64_t head = m_Head.load(std::memory_order_relaxed);
+
+            if (head == m_Tail.load(std::memory_order_acquire)) {
+                return nullptr;
+            }
+
+            uint32_t size;
+            std::memcpy(&size, GetBytes() + (head & m_Mask), sizeof(size));
+
+            if (size == 0) {
+                head += m_Mask + 1 - (head & m_Mask);
+                m_Head.store(head, std::memory_order_release);
+            }
+
+            return GetBytes() + (head & m_Mask);
+        }
+
+        // Consumer only. Releases the record returned by Peek.
+        void Pop(const uint32_t size) {
+            m_Head.store(m_Head.load(std::memory_order_relaxed) + size, std::memory_order_release);
+        }
+
+        [[nodiscard]] bool IsEmpty() const {
+            return m_Head.load(std::memory_order_acquire) == m_Tail.load(std::memory_order_acquire);
+        }
+
+    private:
+        size_t                      m_Mask;
+        std::unique_ptr<uint64_t[]> m_Data;
+
+        alignas(64) std::atomic<uint64_t> m_Head = 0;
+
+        alignas(64) std::atomic<uint64_t> m_Tail = 0;
+        uint64_t                          m_CachedHead = 0;
+        uint64_t                          m_Reserved   = 0;
+
+        [[nodiscard]] std::byte *GetBytes() const {
+            return reinterpret_cast<std::byte *>(m_Data.get());
+        }
+    };
+}
+
+#endif //PULSAR_LOGBUFFER_HPP
@@ -0,0 +1,199 @@
+#include "Batch.hpp"
+
+namespace Pulsar::Math {
+    static void TransformPointsRange(const Mat4 &matrix, const ConstVec3Span &points, const Vec3Span &result,
+                                     const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            const float x = points.x[i];
+            const float y = points.y[i];
+            const float z = points.z[i];
+
+            result.x[i] = matrix[0].x * x + matrix[1].x * y + matrix[2].x * z + matrix[3].x;
+            result.y[i] = matrix[0].y * x + matrix[1].y * y + matrix[2].y * z + matrix[3].y;
+            result.z[i] = matrix[0].z * x + matrix[1].z * y + matrix[2].z * z + matrix[3].z;
+        }
+    }
+
+    void TransformPoints(const Mat4 &matrix, const ConstVec3Span points, const Vec3Span result) {
+        const size_t count = points.x.size();
+        size_t       i     = 0;
+
+#if defined(PULSAR_MATH_AVX2)
+        Simd::Float8 m[12];
+        for (size_t column = 0; column < 4; column++) {
+            for (size_t row = 0; row < 3; row++) {
+                m[column * 3 + row] = Simd::Splat8(matrix[column][row]);
+            }
+        }
+
+        for (; i + 8 <= count; i += 8) {
+            const Simd::Float8 x = Simd::Load8(&points.x[i]);
+            const Simd::Float8 y = Simd::Load8(&points.y[i]);
+            const Simd::Float8 z = Simd::Load8(&points.z[i]);
+
+            Simd::Store8(&result.x[i], Simd::MulAdd(m[0], x, Simd::MulAdd(m[3], y, Simd::MulAdd(m[6], z, m[9]))));
+            Simd::Store8(&result.y[i], Simd::MulAdd(m[1], x, Simd::MulAdd(m[4], y, Simd::MulAdd(m[7], z, m[10]))));
+            Simd::Store8(&result.z[i], Simd::MulAdd(m[2], x, Simd::MulAdd(m[5], y, Simd::MulAdd(m[8], z, m[11]))));
+        }
+#elif defined(PULSAR_MATH_SIMD)
+        Simd::Float4 m[12];
+        for (size_t column = 0; column < 4; column++) {
+            for (size_t row = 0; row < 3; row++) {
+                m[column * 3 + row] = Simd::Splat(matrix[column][row]);
+            }
+        }
+
+        for (; i + 4 <= count; i += 4) {
+            const Simd::Float4 x = Simd::Load(&points.x[i]);
+            const Simd::Float4 y = Simd::Load(&points.y[i]);
+            const Simd::Float4 z = Simd::Load(&points.z[i]);
+
+            Simd::Store(&result.x[i], Simd::MulAdd(m[0], x, Simd::MulAdd(m[3], y, Simd::MulAdd(m[6], z, m[9]))));
+            Simd::Store(&result.y[i], Simd::MulAdd(m[1], x, Simd::MulAdd(m[4], y, Simd::MulAdd(m[7], z, m[10]))));
+            Simd::Store(&result.z[i], Simd::MulAdd(m[2], x, Simd::MulAdd(m[5], y, Simd::MulAdd(m[8], z, m[11]))));
+        }
+#endif
+
+        TransformPointsRange(matrix, points, result, i, count);
+    }
+
+    void TransformPointsScalar(const Mat4 &matrix, const ConstVec3Span points, const Vec3Span result) {
+        TransformPointsRange(matrix, points, result, 0, points.x.size());
+    }
+
+    void ComposeMatrices(const std::span<const Mat4> left, const std::span<const Mat4> right,
+                         const std::span<Mat4> result) {
+        for (size_t i = 0; i < result.size(); i++) {
+#if defined(PULSAR_MATH_AVX2)
+            // Two result columns per iteration: each lane half multiplies the same left column by a different
+            // right column, so a broadcast of the left column and an in-lane shuffle of the right pair suffice.
+            const Mat4 &l = left[i];
+            const Mat4 &r = right[i];
+
+            const __m256 l0 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(&l[0].x));
+            const __m256 l1 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(&l[1].x));
+            const __m256 l2 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(&l[2].x));
+            const __m256 l3 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(&l[3].x));
+
+            for (size_t column = 0; column < 4; column += 2) {
+                const __m256 pair = _mm256_loadu_ps(&r[column].x);
+
+                __m256 sum = _mm256_mul_ps(l0, _mm256_permute_ps(pair, 0x00));
+                sum        = Simd::MulAdd(l1, _mm256_permute_ps(pair, 0x55), sum);
+                sum        = Simd::MulAdd(l2, _mm256_permute_ps(pair, 0xAA), sum);
+                sum        = Simd::MulAdd(l3, _mm256_permute_ps(pair, 0xFF), sum);
+
+                _mm256_storeu_ps(&result[i][column].x, sum);
+            }
+#else
+            result[i] = left[i] * right[i];
+#endif
+        }
+    }
+
+    void ComposeMatricesScalar(const std::span<const Mat4> left, const std::span<const Mat4> right,
+                               const std::span<Mat4> result) {
+        for (size_t i = 0; i < result.size(); i++) {
+            const Mat4 &l = left[i];
+            const Mat4 &r = right[i];
+            Mat4        product;
+
+            for (size_t column = 0; column < 4; column++) {
+                for (size_t row = 0; row < 4; row++) {
+                    product[column][row] = l[0][row] * r[column].x + l[1][row] * r[column].y +
+                                           l[2][row] * r[column].z + l[3][row] * r[column].w;
+                }
+            }
+
+            result[i] = product;
+        }
+    }
+
+    static void TestAabbsRange(const FrustumPlanes &planes, const ConstVec3Span &centers,
+                               const ConstVec3Span &extents, const std::span<uint8_t> visible, const size_t begin,
+                               const size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            bool inside = true;
+
+            for (const Vec4 &plane : planes) {
+                const float distance = plane.x * centers.x[i] + plane.y * centers.y[i] + plane.z * centers.z[i] +
+                                       plane.w;
+                const float radius = std::abs(plane.x) * extents.x[i] + std::abs(plane.y) * extents.y[i] +
+                                     std::abs(plane.z) * extents.z[i];
+
+                inside = inside && distance + radius >= 0.0F;
+            }
+
+            visible[i] = inside ? 1 : 0;
+        }
+    }
+
+    void TestAabbs(const FrustumPlanes &planes, const ConstVec3Span centers, const ConstVec3Span extents,
+                   const std::span<uint8_t> visible) {
+        const size_t count = centers.x.size();
+        size_t       i     = 0;
+
+#if defined(PULSAR_MATH_AVX2)
+        const Simd::Float8 zero = _mm256_setzero_ps();
+
+        for (; i + 8 <= count; i += 8) {
+            const Simd::Float8 cx = Simd::Load8(&centers.x[i]);
+            const Simd::Float8 cy = Simd::Load8(&centers.y[i]);
+            const Simd::Float8 cz = Simd::Load8(&centers.z[i]);
+            const Simd::Float8 ex = Simd::Load8(&extents.x[i]);
+            const Simd::Float8 ey = Simd::Load8(&extents.y[i]);
+            const Simd::Float8 ez = Simd::Load8(&extents.z[i]);
+
+            int mask = 0xFF;
+            for (const Vec4 &plane : planes) {
+                Simd::Float8 distance = Simd::MulAdd(Simd::Splat8(plane.x), cx, Simd::Splat8(plane.w));
+                distance              = Simd::MulAdd(Simd::Splat8(plane.y), cy, distance);
+                distance              = Simd::MulAdd(Simd::Splat8(plane.z), cz, distance);
+                distance              = Simd::MulAdd(Simd::Splat8(std::abs(plane.x)), ex, distance);
+                distance              = Simd::MulAdd(Simd::Splat8(std::abs(plane.y)), ey, distance);
+                distance              = Simd::MulAdd(Simd::Splat8(std::abs(plane.z)), ez, distance);
+
+                mask &= Simd::GreaterEqualMask(distance, zero);
+            }
+
+            for (size_t lane = 0; lane < 8; lane++) {
+                visible[i + lane] = static_cast<uint8_t>((mask >> lane) & 1);
+            }
+        }
+#elif defined(PULSAR_MATH_SIMD)
+        const Simd::Float4 zero = Simd::Splat(0.0F);
+
+        for (; i + 4 <= count; i += 4) {
+            const Simd::Float4 cx = Simd::Load(&centers.x[i]);
+            const Simd::Float4 cy = Simd::Load(&centers.y[i]);
+            const Simd::Float4 cz = Simd::Load(&centers.z[i]);
+            const Simd::Float4 ex = Simd::Load(&extents.x[i]);
+            const Simd::Float4 ey = Simd::Load(&extents.y[i]);
+            const Simd::Float4 ez = Simd::Load(&extents.z[i]);
+
+            int mask = 0xF;
+            for (const Vec4 &plane : planes) {
+                Simd::Float4 distance = Simd::MulAdd(Simd::Splat(plane.x), cx, Simd::Splat(plane.w));
+                distance              = Simd::MulAdd(Simd::Splat(plane.y), cy, distance);
+                distance              = Simd::MulAdd(Simd::Splat(plane.z), cz, distance);
+                distance              = Simd::MulAdd(Simd::Splat(std::abs(plane.x)), ex, distance);
+                distance              = Simd::MulAdd(Simd::Splat(std::abs(plane.y)), ey, distance);
+                distance              = Simd::MulAdd(Simd::Splat(std::abs(plane.z)), ez, distance);
+
+                mask &= Simd::GreaterEqualMask(distance, zero);
+            }
+
+            for (size_t lane = 0; lane < 4; lane++) {
+                visible[i + lane] = static_cast<uint8_t>((mask >> lane) & 1);
+            }
+        }
+#endif
+
+        TestAabbsRange(planes, centers, extents, visible, i, count);
+    }
+
+    void TestAabbsScalar(const FrustumPlanes &planes, const ConstVec3Span centers, const ConstVec3Span extents,
+                         const std::span<uint8_t> visible) {
+        TestAabbsRange(planes, centers, extents, visible, 0, centers.x.size());
+    }
+}
@@ -0,0 +1,44 @@
+#ifndef PULSAR_BATCH_HPP
+#define PULSAR_BATCH_HPP
+
+#include <cstdint>
+#include <span>
+
+#include "Frustum.hpp"
+
+namespace Pulsar::Math {
+    // Structure-of-arrays views so the kernels can load eight (AVX2) or four (SSE2/NEON) components of the same
+    // axis at once. All spans of a view must have the same length.
+    struct Vec3Span {
+        std::span<float> x;
+        std::span<float> y;
+        std::span<float> z;
+    };
+
+    struct ConstVec3Span {
+        std::span<const float> x;
+        std::span<const float> y;
+        std::span<const float> z;
+
+        ConstVec3Span() = default;
+        ConstVec3Span(const std::span<const float> x, const std::span<const float> y, const std::span<const float> z)
+            : x(x), y(y), z(z) {}
+        ConstVec3Span(const Vec3Span &other) : x(other.x), y(other.y), z(other.z) {}
+    };
+
+    // result = matrix * (point, 1), ignoring the projective row. result may alias points.
+    void TransformPoints(const Mat4 &matrix, ConstVec3Span points, Vec3Span result);
+    void TransformPointsScalar(const Mat4 &matrix, ConstVec3Span points, Vec3Span result);
+
+    // result[i] = left[i] * right[i]
+    void ComposeMatrices(std::span<const Mat4> left, std::span<const Mat4> right, std::span<Mat4> result);
+    void ComposeMatricesScalar(std::span<const Mat4> left, std::span<const Mat4> right, std::span<Mat4> result);
+
+    // Writes 1 for boxes intersecting or inside the frustum and 0 for boxes fully outside one of its planes.
+    void TestAabbs(const FrustumPlanes &planes, ConstVec3Span centers, ConstVec3Span extents,
+                   std::span<uint8_t> visible);
+    void TestAabbsScalar(const FrustumPlanes &planes, ConstVec3Span centers, ConstVec3Span extents,
+                         std::span<uint8_t> visible);
+}
+
+#endif //PULSAR_BATCH_HPP
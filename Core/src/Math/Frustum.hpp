@@ -0,0 +1,40 @@
+#ifndef PULSAR_MATH_FRUSTUM_HPP
+#define PULSAR_MATH_FRUSTUM_HPP
+
+#include <array>
+#include <cmath>
+
+#include "Matrix.hpp"
+
+namespace Pulsar::Math {
+    // Planes are (normal, distance) with normals pointing inwards, in the space the matrix transforms from.
+    // Order: left, right, bottom, top, near, far.
+    using FrustumPlanes = std::array<Vec4, 6>;
+
+    // Gribb-Hartmann extraction for Vulkan clip space (depth in [0, 1]).
+    inline FrustumPlanes ExtractFrustum(const Mat4 &viewProjection) {
+        const Mat4 rows = Transpose(viewProjection);
+
+        FrustumPlanes planes = {
+            rows[3] + rows[0], rows[3] - rows[0], rows[3] + rows[1], rows[3] - rows[1], rows[2], rows[3] - rows[2]
+        };
+
+        for (Vec4 &plane : planes) {
+            plane = plane * (1.0F / std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z));
+        }
+
+        return planes;
+    }
+
+    inline bool IsSphereVisible(const FrustumPlanes &planes, const Vec3 &center, const float radius) {
+        for (const Vec4 &plane : planes) {
+            if (plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+#endif //PULSAR_MATH_FRUSTUM_HPP
@@ -0,0 +1,147 @@
+#ifndef PULSAR_MATRIX_HPP
+#define PULSAR_MATRIX_HPP
+
+#include <array>
+
+#include "Vector.hpp"
+
+namespace Pulsar::Math {
+    // Column-major like GLSL, so a Mat4 can be copied straight into a std140/std430 mat4.
+    struct alignas(16) Mat4 {
+        std::array<Vec4, 4> columns = {};
+
+        constexpr Vec4 &      operator[](const size_t column) { return columns[column]; }
+        constexpr const Vec4 &operator[](const size_t column) const { return columns[column]; }
+
+        constexpr bool operator==(const Mat4 &other) const = default;
+
+        static constexpr Mat4 Identity() {
+            return {{Vec4(1.0F, 0.0F, 0.0F, 0.0F), Vec4(0.0F, 1.0F, 0.0F, 0.0F), Vec4(0.0F, 0.0F, 1.0F, 0.0F),
+                     Vec4(0.0F, 0.0F, 0.0F, 1.0F)}};
+        }
+    };
+
+    static_assert(sizeof(Mat4) == 64 && alignof(Mat4) == 16);
+
+    constexpr Vec4 operator*(const Mat4 &matrix, const Vec4 &vector) {
+#if defined(PULSAR_MATH_SIMD)
+        if (!std::is_constant_evaluated()) {
+            const Simd::Float4 v = vector.Load();
+
+            Simd::Float4 result = Simd::Mul(matrix[0].Load(), Simd::SplatLane<0>(v));
+            result              = Simd::MulAdd(matrix[1].Load(), Simd::SplatLane<1>(v), result);
+            result              = Simd::MulAdd(matrix[2].Load(), Simd::SplatLane<2>(v), result);
+            result              = Simd::MulAdd(matrix[3].Load(), Simd::SplatLane<3>(v), result);
+
+            return Vec4::From(result);
+        }
+#endif
+        return matrix[0] * vector.x + matrix[1] * vector.y + matrix[2] * vector.z + matrix[3] * vector.w;
+    }
+
+    constexpr Mat4 operator*(const Mat4 &left, const Mat4 &right) {
+        return {{left * right[0], left * right[1], left * right[2], left * right[3]}};
+    }
+
+    constexpr Mat4 Transpose(const Mat4 &matrix) {
+        Mat4 result;
+        for (size_t column = 0; column < 4; column++) {
+            for (size_t row = 0; row < 4; row++) {
+                result[column][row] = matrix[row][column];
+            }
+        }
+
+        return result;
+    }
+
+    // General inverse by cofactor expansion; the result is undefined for singular matrices.
+    constexpr Mat4 Inverse(const Mat4 &m) {
+        const float a2323 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+        const float a1323 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
+        const float a1223 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
+        const float a0323 = m[0][2] * m[3][3] - m[3][2] * m[0][3];
+        const float a0223 = m[0][2] * m[2][3] - m[2][2] * m[0][3];
+        const float a0123 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+        const float a2313 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+        const float a1313 = m[1][1] * m[3][3] - m[3][1] * m[1][3];
+        const float a1213 = m[1][1] * m[2][3] - m[2][1] * m[1][3];
+        const float a2312 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+        const float a1312 = m[1][1] * m[3][2] - m[3][1] * m[1][2];
+        const float a1212 = m[1][1] * m[2][2] - m[2][1] * m[1][2];
+        const float a0313 = m[0][1] * m[3][3] - m[3][1] * m[0][3];
+        const float a0213 = m[0][1] * m[2][3] - m[2][1] * m[0][3];
+        const float a0312 = m[0][1] * m[3][2] - m[3][1] * m[0][2];
+        const float a0212 = m[0][1] * m[2][2] - m[2][1] * m[0][2];
+        const float a0113 = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+        const float a0112 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+
+        const float determinant = m[0][0] * (m[1][1] * a2323 - m[2][1] * a1323 + m[3][1] * a1223) -
+                                  m[1][0] * (m[0][1] * a2323 - m[2][1] * a0323 + m[3][1] * a0223) +
+                                  m[2][0] * (m[0][1] * a1323 - m[1][1] * a0323 + m[3][1] * a0123) -
+                                  m[3][0] * (m[0][1] * a1223 - m[1][1] * a0223 + m[2][1] * a0123);
+        const float f = 1.0F / determinant;
+
+        Mat4 result;
+        result[0][0] = f * (m[1][1] * a2323 - m[2][1] * a1323 + m[3][1] * a1223);
+        result[1][0] = f * -(m[1][0] * a2323 - m[2][0] * a1323 + m[3][0] * a1223);
+        result[2][0] = f * (m[1][0] * a2313 - m[2][0] * a1313 + m[3][0] * a1213);
+        result[3][0] = f * -(m[1][0] * a2312 - m[2][0] * a1312 + m[3][0] * a1212);
+        result[0][1] = f * -(m[0][1] * a2323 - m[2][1] * a0323 + m[3][1] * a0223);
+        result[1][1] = f * (m[0][0] * a2323 - m[2][0] * a0323 + m[3][0] * a0223);
+        result[2][1] = f * -(m[0][0] * a2313 - m[2][0] * a0313 + m[3][0] * a0213);
+        result[3][1] = f * (m[0][0] * a2312 - m[2][0] * a0312 + m[3][0] * a0212);
+        result[0][2] = f * (m[0][1] * a1323 - m[1][1] * a0323 + m[3][1] * a0123);
+        result[1][2] = f * -(m[0][0] * a1323 - m[1][0] * a0323 + m[3][0] * a0123);
+        result[2][2] = f * (m[0][0] * a1313 - m[1][0] * a0313 + m[3][0] * a0113);
+        result[3][2] = f * -(m[0][0] * a1312 - m[1][0] * a0312 + m[3][0] * a0112);
+        result[0][3] = f * -(m[0][1] * a1223 - m[1][1] * a0223 + m[2][1] * a0123);
+        result[1][3] = f * (m[0][0] * a1223 - m[1][0] * a0223 + m[2][0] * a0123);
+        result[2][3] = f * -(m[0][0] * a1213 - m[1][0] * a0213 + m[2][0] * a0113);
+        result[3][3] = f * (m[0][0] * a1212 - m[1][0] * a0212 + m[2][0] * a0112);
+
+        return result;
+    }
+
+    constexpr Mat4 Translate(const Vec3 &translation) {
+        Mat4 result = Mat4::Identity();
+        result[3]   = Vec4(translation, 1.0F);
+
+        return result;
+    }
+
+    constexpr Mat4 Scale(const Vec3 &scale) {
+        Mat4 result  = Mat4::Identity();
+        result[0][0] = scale.x;
+        result[1][1] = scale.y;
+        result[2][2] = scale.z;
+
+        return result;
+    }
+
+    // Right-handed view space looking down -z.
+    inline Mat4 LookAt(const Vec3 &eye, const Vec3 &target, const Vec3 &up) {
+        const Vec3 forward = Normalize(target - eye);
+        const Vec3 right   = Normalize(Cross(forward, up));
+        const Vec3 trueUp  = Cross(right, forward);
+
+        return {{Vec4(right.x, trueUp.x, -forward.x, 0.0F), Vec4(right.y, trueUp.y, -forward.y, 0.0F),
+                 Vec4(right.z, trueUp.z, -forward.z, 0.0F),
+                 Vec4(-Dot(right, eye), -Dot(trueUp, eye), Dot(forward, eye), 1.0F)}};
+    }
+
+    // Vulkan clip space: depth in [0, 1] and y flipped so +y points up on screen.
+    inline Mat4 Perspective(const float fovY, const float aspect, const float nearPlane, const float farPlane) {
+        const float focal = 1.0F / std::tan(fovY * 0.5F);
+
+        Mat4 result;
+        result[0][0] = focal / aspect;
+        result[1][1] = -focal;
+        result[2][2] = farPlane / (nearPlane - farPlane);
+        result[2][3] = -1.0F;
+        result[3][2] = nearPlane * farPlane / (nearPlane - farPlane);
+
+        return result;
+    }
+}
+
+#endif //PULSAR_MATRIX_HPP
@@ -0,0 +1,103 @@
+#ifndef PULSAR_QUATERNION_HPP
+#define PULSAR_QUATERNION_HPP
+
+#include "Matrix.hpp"
+
+namespace Pulsar::Math {
+    // Unit quaternions for rotations, stored (x, y, z, w) with w the scalar part.
+    struct alignas(16) Quat {
+        float x = 0.0F;
+        float y = 0.0F;
+        float z = 0.0F;
+        float w = 1.0F;
+
+        constexpr Quat() = default;
+        constexpr Quat(const float x, const float y, const float z, const float w) : x(x), y(y), z(z), w(w) {}
+        constexpr explicit Quat(const Vec4 &xyzw) : x(xyzw.x), y(xyzw.y), z(xyzw.z), w(xyzw.w) {}
+
+        [[nodiscard]] constexpr Vec4 ToVec4() const { return {x, y, z, w}; }
+
+        constexpr bool operator==(const Quat &other) const = default;
+
+        static Quat FromAxisAngle(const Vec3 &axis, const float angle) {
+            const Vec3 normalized = Normalize(axis) * std::sin(angle * 0.5F);
+            return {normalized.x, normalized.y, normalized.z, std::cos(angle * 0.5F)};
+        }
+    };
+
+    static_assert(sizeof(Quat) == 16 && alignof(Quat) == 16);
+
+    // Hamilton product written as four scaled, permuted copies of b so it runs on the Vec4 SIMD path.
+    constexpr Quat operator*(const Quat &a, const Quat &b) {
+        const Vec4 result = Vec4(a.w) * Vec4(b.x, b.y, b.z, b.w) +
+                            Vec4(a.x) * Vec4(b.w, -b.z, b.y, -b.x) +
+                            Vec4(a.y) * Vec4(b.z, b.w, -b.x, -b.y) +
+                            Vec4(a.z) * Vec4(-b.y, b.x, b.w, -b.z);
+
+        return Quat(result);
+    }
+
+    constexpr Quat Conjugate(const Quat &quat) {
+        return {-quat.x, -quat.y, -quat.z, quat.w};
+    }
+
+    constexpr float Dot(const Quat &a, const Quat &b) {
+        return Dot(a.ToVec4(), b.ToVec4());
+    }
+
+    inline Quat Normalize(const Quat &quat) {
+        return Quat(Normalize(quat.ToVec4()));
+    }
+
+    constexpr Vec3 Rotate(const Quat &quat, const Vec3 &vector) {
+        const Vec3 axis(quat.x, quat.y, quat.z);
+        const Vec3 t = 2.0F * Cross(axis, vector);
+
+        return vector + quat.w * t + Cross(axis, t);
+    }
+
+    constexpr Mat4 ToMat4(const Quat &q) {
+        const float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+        const float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+        const float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+        return {{Vec4(1.0F - 2.0F * (yy + zz), 2.0F * (xy + wz), 2.0F * (xz - wy), 0.0F),
+                 Vec4(2.0F * (xy - wz), 1.0F - 2.0F * (xx + zz), 2.0F * (yz + wx), 0.0F),
+                 Vec4(2.0F * (xz + wy), 2.0F * (yz - wx), 1.0F - 2.0F * (xx + yy), 0.0F),
+                 Vec4(0.0F, 0.0F, 0.0F, 1.0F)}};
+    }
+
+    // Translation * rotation * scale.
+    constexpr Mat4 ComposeTransform(const Vec3 &translation, const Quat &rotation, const Vec3 &scale) {
+        Mat4 result = ToMat4(rotation);
+        result[0]   = result[0] * scale.x;
+        result[1]   = result[1] * scale.y;
+        result[2]   = result[2] * scale.z;
+        result[3]   = Vec4(translation, 1.0F);
+
+        return result;
+    }
+
+    // Shortest-path spherical interpolation, falling back to normalized lerp for nearly parallel inputs.
+    inline Quat Slerp(const Quat &a, const Quat &b, const float t) {
+        float      cosine = Dot(a, b);
+        const Vec4 from   = a.ToVec4();
+        Vec4       to     = b.ToVec4();
+
+        if (cosine < 0.0F) {
+            cosine = -cosine;
+            to     = -to;
+        }
+
+        if (cosine > 0.9995F) {
+            return Quat(Normalize(Lerp(from, to, t)));
+        }
+
+        const float angle = std::acos(cosine);
+        const float sine  = std::sin(angle);
+
+        return Quat((from * std::sin((1.0F - t) * angle) + to * std::sin(t * angle)) / sine);
+    }
+}
+
+#endif //PULSAR_QUATERNION_HPP
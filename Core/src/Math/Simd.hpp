@@ -0,0 +1,113 @@
+#ifndef PULSAR_SIMD_HPP
+#define PULSAR_SIMD_HPP
+
+// Instruction set selection happens at compile time: AVX2 (PULSAR_ENABLE_AVX2) widens the batch kernels to eight
+// lanes, SSE2 or NEON back the four-wide types, and anything else falls back to scalar code.
+#if defined(__AVX2__)
+#define PULSAR_MATH_AVX2 1
+#include <immintrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define PULSAR_MATH_SSE 1
+#define PULSAR_MATH_SIMD 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define PULSAR_MATH_NEON 1
+#define PULSAR_MATH_SIMD 1
+#include <arm_neon.h>
+#endif
+
+namespace Pulsar::Math::Simd {
+#if defined(PULSAR_MATH_SSE)
+    using Float4 = __m128;
+
+    inline Float4 Load(const float *source) { return _mm_loadu_ps(source); }
+    inline void   Store(float *destination, const Float4 value) { _mm_storeu_ps(destination, value); }
+    inline Float4 Splat(const float value) { return _mm_set1_ps(value); }
+
+    inline Float4 Add(const Float4 a, const Float4 b) { return _mm_add_ps(a, b); }
+    inline Float4 Sub(const Float4 a, const Float4 b) { return _mm_sub_ps(a, b); }
+    inline Float4 Mul(const Float4 a, const Float4 b) { return _mm_mul_ps(a, b); }
+    inline Float4 Div(const Float4 a, const Float4 b) { return _mm_div_ps(a, b); }
+    inline Float4 Min(const Float4 a, const Float4 b) { return _mm_min_ps(a, b); }
+    inline Float4 Max(const Float4 a, const Float4 b) { return _mm_max_ps(a, b); }
+    inline Float4 Abs(const Float4 a) { return _mm_andnot_ps(_mm_set1_ps(-0.0F), a); }
+
+    // a * b + c
+    inline Float4 MulAdd(const Float4 a, const Float4 b, const Float4 c) {
+#if defined(__FMA__)
+        return _mm_fmadd_ps(a, b, c);
+#else
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+    }
+
+    // Bit i is set when lane i of a is >= b.
+    inline int GreaterEqualMask(const Float4 a, const Float4 b) { return _mm_movemask_ps(_mm_cmpge_ps(a, b)); }
+
+    // All bits of a lane are set where a < b; Select takes those lanes from a and the rest from b.
+    inline Float4 Less(const Float4 a, const Float4 b) { return _mm_cmplt_ps(a, b); }
+    inline Float4 Select(const Float4 mask, const Float4 a, const Float4 b) {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+
+    template<int Lane>
+    Float4 SplatLane(const Float4 value) {
+        return _mm_shuffle_ps(value, value, _MM_SHUFFLE(Lane, Lane, Lane, Lane));
+    }
+#elif defined(PULSAR_MATH_NEON)
+    using Float4 = float32x4_t;
+
+    inline Float4 Load(const float *source) { return vld1q_f32(source); }
+    inline void   Store(float *destination, const Float4 value) { vst1q_f32(destination, value); }
+    inline Float4 Splat(const float value) { return vdupq_n_f32(value); }
+
+    inline Float4 Add(const Float4 a, const Float4 b) { return vaddq_f32(a, b); }
+    inline Float4 Sub(const Float4 a, const Float4 b) { return vsubq_f32(a, b); }
+    inline Float4 Mul(const Float4 a, const Float4 b) { return vmulq_f32(a, b); }
+    inline Float4 Div(const Float4 a, const Float4 b) { return vdivq_f32(a, b); }
+    inline Float4 Min(const Float4 a, const Float4 b) { return vminq_f32(a, b); }
+    inline Float4 Max(const Float4 a, const Float4 b) { return vmaxq_f32(a, b); }
+    inline Float4 Abs(const Float4 a) { return vabsq_f32(a); }
+
+    inline Float4 MulAdd(const Float4 a, const Float4 b, const Float4 c) { return vfmaq_f32(c, a, b); }
+
+    inline int GreaterEqualMask(const Float4 a, const Float4 b) {
+        const uint32x4_t weights = {1, 2, 4, 8};
+        return static_cast<int>(vaddvq_u32(vandq_u32(vcgeq_f32(a, b), weights)));
+    }
+
+    inline Float4 Less(const Float4 a, const Float4 b) { return vreinterpretq_f32_u32(vcltq_f32(a, b)); }
+    inline Float4 Select(const Float4 mask, const Float4 a, const Float4 b) {
+        return vbslq_f32(vreinterpretq_u32_f32(mask), a, b);
+    }
+
+    template<int Lane>
+    Float4 SplatLane(const Float4 value) {
+        return vdupq_laneq_f32(value, Lane);
+    }
+#endif
+
+#if defined(PULSAR_MATH_AVX2)
+    using Float8 = __m256;
+
+    inline Float8 Load8(const float *source) { return _mm256_loadu_ps(source); }
+    inline void   Store8(float *destination, const Float8 value) { _mm256_storeu_ps(destination, value); }
+    inline Float8 Splat8(const float value) { return _mm256_set1_ps(value); }
+
+    inline Float8 MulAdd(const Float8 a, const Float8 b, const Float8 c) {
+#if defined(__FMA__)
+        return _mm256_fmadd_ps(a, b, c);
+#else
+        return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+    }
+
+    inline int GreaterEqualMask(const Float8 a, const Float8 b) {
+        return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GE_OQ));
+    }
+#endif
+}
+
+#endif //PULSAR_SIMD_HPP
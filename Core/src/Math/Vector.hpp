@@ -0,0 +1,204 @@
+#ifndef PULSAR_VECTOR_HPP
+#define PULSAR_VECTOR_HPP
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "Simd.hpp"
+
+namespace Pulsar::Math {
+    // Layouts match GLSL std140/std430: Vec2 is 8-byte aligned and Vec4 16-byte aligned. Vec3 is 12 bytes with
+    // 4-byte alignment so a trailing scalar packs into its last slot as it does in GLSL, but a Vec3 member must
+    // itself start on a 16-byte offset to line up with the shader. Arrays of Vec3 never match: GLSL strides vec3
+    // array elements by 16 bytes, so use Vec4 (or a vec4 in the shader) for buffer arrays.
+    struct alignas(8) Vec2 {
+        float x = 0.0F;
+        float y = 0.0F;
+
+        constexpr Vec2() = default;
+        constexpr Vec2(const float x, const float y) : x(x), y(y) {}
+        constexpr explicit Vec2(const float value) : x(value), y(value) {}
+
+        constexpr float &      operator[](const size_t index) { return index == 0 ? x : y; }
+        constexpr const float &operator[](const size_t index) const { return index == 0 ? x : y; }
+
+        constexpr bool operator==(const Vec2 &other) const = default;
+    };
+
+    struct Vec3 {
+        float x = 0.0F;
+        float y = 0.0F;
+        float z = 0.0F;
+
+        constexpr Vec3() = default;
+        constexpr Vec3(const float x, const float y, const float z) : x(x), y(y), z(z) {}
+        constexpr explicit Vec3(const float value) : x(value), y(value), z(value) {}
+
+        constexpr float &operator[](const size_t index) {
+            return index == 0 ? x : index == 1 ? y : z;
+        }
+
+        constexpr const float &operator[](const size_t index) const {
+            return index == 0 ? x : index == 1 ? y : z;
+        }
+
+        constexpr bool operator==(const Vec3 &other) const = default;
+    };
+
+    struct alignas(16) Vec4 {
+        float x = 0.0F;
+        float y = 0.0F;
+        float z = 0.0F;
+        float w = 0.0F;
+
+        constexpr Vec4() = default;
+        constexpr Vec4(const float x, const float y, const float z, const float w) : x(x), y(y), z(z), w(w) {}
+        constexpr Vec4(const Vec3 &xyz, const float w) : x(xyz.x), y(xyz.y), z(xyz.z), w(w) {}
+        constexpr explicit Vec4(const float value) : x(value), y(value), z(value), w(value) {}
+
+        constexpr float &operator[](const size_t index) {
+            return index == 0 ? x : index == 1 ? y : index == 2 ? z : w;
+        }
+
+        constexpr const float &operator[](const size_t index) const {
+            return index == 0 ? x : index == 1 ? y : index == 2 ? z : w;
+        }
+
+        [[nodiscard]] constexpr Vec3 Xyz() const { return {x, y, z}; }
+
+        constexpr bool operator==(const Vec4 &other) const = default;
+
+#if defined(PULSAR_MATH_SIMD)
+        [[nodiscard]] Simd::Float4 Load() const { return Simd::Load(&x); }
+        static Vec4 From(const Simd::Float4 value) { return std::bit_cast<Vec4>(value); }
+#endif
+    };
+
+    static_assert(sizeof(Vec2) == 8 && alignof(Vec2) == 8);
+    static_assert(sizeof(Vec3) == 12);
+    static_assert(sizeof(Vec4) == 16 && alignof(Vec4) == 16);
+
+    // Vec2
+
+    constexpr Vec2 operator+(const Vec2 &a, const Vec2 &b) { return {a.x + b.x, a.y + b.y}; }
+    constexpr Vec2 operator-(const Vec2 &a, const Vec2 &b) { return {a.x - b.x, a.y - b.y}; }
+    constexpr Vec2 operator*(const Vec2 &a, const Vec2 &b) { return {a.x * b.x, a.y * b.y}; }
+    constexpr Vec2 operator/(const Vec2 &a, const Vec2 &b) { return {a.x / b.x, a.y / b.y}; }
+    constexpr Vec2 operator*(const Vec2 &a, const float b) { return {a.x * b, a.y * b}; }
+    constexpr Vec2 operator*(const float a, const Vec2 &b) { return b * a; }
+    constexpr Vec2 operator/(const Vec2 &a, const float b) { return {a.x / b, a.y / b}; }
+    constexpr Vec2 operator-(const Vec2 &a) { return {-a.x, -a.y}; }
+
+    constexpr float Dot(const Vec2 &a, const Vec2 &b) { return a.x * b.x + a.y * b.y; }
+
+    // Vec3
+
+    constexpr Vec3 operator+(const Vec3 &a, const Vec3 &b) { return {a.x + b.x, a.y + b.y, a.z + b.z}; }
+    constexpr Vec3 operator-(const Vec3 &a, const Vec3 &b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+    constexpr Vec3 operator*(const Vec3 &a, const Vec3 &b) { return {a.x * b.x, a.y * b.y, a.z * b.z}; }
+    constexpr Vec3 operator/(const Vec3 &a, const Vec3 &b) { return {a.x / b.x, a.y / b.y, a.z / b.z}; }
+    constexpr Vec3 operator*(const Vec3 &a, const float b) { return {a.x * b, a.y * b, a.z * b}; }
+    constexpr Vec3 operator*(const float a, const Vec3 &b) { return b * a; }
+    constexpr Vec3 operator/(const Vec3 &a, const float b) { return {a.x / b, a.y / b, a.z / b}; }
+    constexpr Vec3 operator-(const Vec3 &a) { return {-a.x, -a.y, -a.z}; }
+
+    constexpr float Dot(const Vec3 &a, const Vec3 &b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+    constexpr Vec3 Cross(const Vec3 &a, const Vec3 &b) {
+        return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+    }
+
+    // Vec4
+
+    constexpr Vec4 operator+(const Vec4 &a, const Vec4 &b) {
+#if defined(PULSAR_MATH_SIMD)
+        if (!std::is_constant_evaluated()) {
+            return Vec4::From(Simd::Add(a.Load(), b.Load()));
+        }
+#endif
+        return {a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w};
+    }
+
+    constexpr Vec4 operator-(const Vec4 &a, const Vec4 &b) {
+#if defined(PULSAR_MATH_SIMD)
+        if (!std::is_constant_evaluated()) {
+            return Vec4::From(Simd::Sub(a.Load(), b.Load()));
+        }
+#endif
+        return {a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w};
+    }
+
+    constexpr Vec4 operator*(const Vec4 &a, const Vec4 &b) {
+#if defined(PULSAR_MATH_SIMD)
+        if (!std::is_constant_evaluated()) {
+            return Vec4::From(Simd::Mul(a.Load(), b.Load()));
+        }
+#endif
+        return {a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w};
+    }
+
+    constexpr Vec4 operator/(const Vec4 &a, const Vec4 &b) {
+#if defined(PULSAR_MATH_SIMD)
+        if (!std::is_constant_evaluated()) {
+            return Vec4::From(Simd::Div(a.Load(), b.Load()));
+        }
+#endif
+        return {a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w};
+    }
+
+    constexpr Vec4 operator*(const Vec4 &a, const float b) { return a * Vec4(b); }
+    constexpr Vec4 operator*(const float a, const Vec4 &b) { return Vec4(a) * b; }
+    constexpr Vec4 operator/(const Vec4 &a, const float b) { return a / Vec4(b); }
+    constexpr Vec4 operator-(const Vec4 &a) { return Vec4(0.0F) - a; }
+
+    constexpr float Dot(const Vec4 &a, const Vec4 &b) {
+        const Vec4 product = a * b;
+        return (product.x + product.y) + (product.z + product.w);
+    }
+
+    constexpr Vec4 Min(const Vec4 &a, const Vec4 &b) {
+#if defined(PULSAR_MATH_SIMD)
+        if (!std::is_constant_evaluated()) {
+            return Vec4::From(Simd::Min(a.Load(), b.Load()));
+        }
+#endif
+        return {a.x < b.x ? a.x : b.x, a.y < b.y ? a.y : b.y, a.z < b.z ? a.z : b.z, a.w < b.w ? a.w : b.w};
+    }
+
+    constexpr Vec4 Max(const Vec4 &a, const Vec4 &b) {
+#if defined(PULSAR_MATH_SIMD)
+        if (!std::is_constant_evaluated()) {
+            return Vec4::From(Simd::Max(a.Load(), b.Load()));
+        }
+#endif
+        return {a.x > b.x ? a.x : b.x, a.y > b.y ? a.y : b.y, a.z > b.z ? a.z : b.z, a.w > b.w ? a.w : b.w};
+    }
+
+    // Common
+
+    // Keeps the generic helpers below from matching unrelated types found through ADL.
+    template<typename T>
+    concept Vector = std::is_same_v<T, Vec2> || std::is_same_v<T, Vec3> || std::is_same_v<T, Vec4>;
+
+    template<Vector V>
+    constexpr V &operator+=(V &a, const V &b) { return a = a + b; }
+
+    template<Vector V>
+    constexpr V &operator-=(V &a, const V &b) { return a = a - b; }
+
+    template<Vector V>
+    constexpr V &operator*=(V &a, const float b) { return a = a * b; }
+
+    template<Vector V>
+    constexpr V Lerp(const V &a, const V &b, const float t) { return a + (b - a) * t; }
+
+    template<Vector V>
+    float Length(const V &vector) { return std::sqrt(Dot(vector, vector)); }
+
+    template<Vector V>
+    V Normalize(const V &vector) { return vector * (1.0F / Length(vector)); }
+}
+
+#endif //PULSAR_VECTOR_HPP
@@ -0,0 +1,53 @@
+#include "FrameArenas.hpp"
+
+namespace Pulsar::Memory {
+    FrameArenas FrameArenas::Create(const size_t capacityPerFrame, const uint32_t framesInFlight) {
+        if (framesInFlight == 0) {
+            throw std::runtime_error("Failed to create frame arenas: Frame count is zero");
+        }
+
+        FrameArenas arenas;
+        arenas.m_Frames.reserve(framesInFlight);
+
+        for (uint32_t i = 0; i < framesInFlight; i++) {
+            arenas.m_Frames.push_back(std::make_unique<Frame>(LinearArena::Create(capacityPerFrame)));
+        }
+
+        return arenas;
+    }
+
+    LinearArena &FrameArenas::BeginFrame(const uint32_t frameIndex) {
+        m_Current = frameIndex;
+
+        LinearArena &arena = m_Frames.at(frameIndex)->arena;
+        arena.Reset();
+
+        return arena;
+    }
+
+    LinearArena &FrameArenas::GetCurrent() {
+        return m_Frames[m_Current]->arena;
+    }
+
+    std::pmr::memory_resource *FrameArenas::GetResource() {
+        return &m_Frames[m_Current]->resource;
+    }
+
+    uint32_t FrameArenas::GetFrameCount() const {
+        return static_cast<uint32_t>(m_Frames.size());
+    }
+
+    ArenaStats FrameArenas::GetStats() const {
+        ArenaStats total;
+
+        for (const auto &frame : m_Frames) {
+            const ArenaStats stats = frame->arena.GetStats();
+            total.allocations += stats.allocations;
+            total.bytesAllocated += stats.bytesAllocated;
+            total.heapAllocations += stats.heapAllocations;
+            total.peakBytes = std::max(total.peakBytes, stats.peakBytes);
+        }
+
+        return total;
+    }
+}
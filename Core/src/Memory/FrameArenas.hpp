@@ -0,0 +1,40 @@
+#ifndef PULSAR_FRAMEARENAS_HPP
+#define PULSAR_FRAMEARENAS_HPP
+
+#include "LinearArena.hpp"
+
+namespace Pulsar::Memory {
+    // One arena per frame in flight for data that lives until the GPU is done with the frame: draw lists, upload
+    // staging, transient strings. Everything allocated during a frame is released at once the next time that
+    // frame index comes around.
+    class FrameArenas {
+    public:
+        static FrameArenas Create(size_t capacityPerFrame, uint32_t framesInFlight = 2);
+
+        // Resets the arena for frameIndex and makes it current. Call after waiting on the fence of the
+        // submission that last used frameIndex, like DrawSubmitter::Record.
+        LinearArena &BeginFrame(uint32_t frameIndex);
+
+        [[nodiscard]] LinearArena &               GetCurrent();
+        [[nodiscard]] std::pmr::memory_resource *GetResource();
+        [[nodiscard]] uint32_t                    GetFrameCount() const;
+
+        // Summed over all frames.
+        [[nodiscard]] ArenaStats GetStats() const;
+
+    private:
+        struct Frame {
+            LinearArena   arena;
+            ArenaResource resource;
+
+            explicit Frame(LinearArena &&arena) : arena(std::move(arena)), resource(this->arena) {}
+        };
+
+        std::vector<std::unique_ptr<Frame>> m_Frames;
+        uint32_t                            m_Current = 0;
+
+        FrameArenas() = default;
+    };
+}
+
+#endif //PULSAR_FRAMEARENAS_HPP
@@ -0,0 +1,156 @@
+#include "LinearArena.hpp"
+
+#include <bit>
+#include <new>
+
+namespace Pulsar::Memory {
+    static constexpr size_t s_BlockAlignment = 64;
+
+    static std::byte *AllocateBlock(const size_t capacity) {
+        return static_cast<std::byte *>(::operator new(capacity, std::align_val_t(s_BlockAlignment)));
+    }
+
+    LinearArena LinearArena::Create(const size_t capacity) {
+        LinearArena arena;
+        arena.m_Capacity = std::max<size_t>(capacity, s_BlockAlignment);
+        arena.m_Block    = AllocateBlock(arena.m_Capacity);
+        arena.m_Stats.heapAllocations++;
+
+        return arena;
+    }
+
+    LinearArena::~LinearArena() {
+        Destroy();
+    }
+
+    LinearArena::LinearArena(LinearArena &&other) noexcept
+        : m_Block(std::exchange(other.m_Block, nullptr)), m_Capacity(std::exchange(other.m_Capacity, 0)),
+          m_Offset(std::exchange(other.m_Offset, 0)), m_OverflowBytes(std::exchange(other.m_OverflowBytes, 0)),
+          m_CycleBytes(std::exchange(other.m_CycleBytes, 0)),
+          m_Overflows(std::move(other.m_Overflows)), m_Stats(std::exchange(other.m_Stats, {})) {
+    }
+
+    LinearArena &LinearArena::operator=(LinearArena &&other) noexcept {
+        if (this != &other) {
+            Destroy();
+
+            m_Block         = std::exchange(other.m_Block, nullptr);
+            m_Capacity      = std::exchange(other.m_Capacity, 0);
+            m_Offset        = std::exchange(other.m_Offset, 0);
+            m_OverflowBytes = std::exchange(other.m_OverflowBytes, 0);
+            m_CycleBytes    = std::exchange(other.m_CycleBytes, 0);
+            m_Overflows     = std::move(other.m_Overflows);
+            m_Stats         = std::exchange(other.m_Stats, {});
+        }
+
+        return *this;
+    }
+
+    void *LinearArena::Allocate(const size_t size, const size_t alignment) {
+        if (!std::has_single_bit(alignment)) {
+            throw std::runtime_error("Failed to allocate from arena: Alignment is not a power of two");
+        }
+
+        m_Stats.allocations++;
+        m_Stats.bytesAllocated += size;
+
+        const auto   base   = reinterpret_cast<uintptr_t>(m_Block);
+        const size_t offset = ((base + m_Offset + alignment - 1) & ~(alignment - 1)) - base;
+
+        void *data = nullptr;
+
+        if (m_Block != nullptr && offset + size <= m_Capacity) {
+            m_Offset = offset + size;
+            data     = m_Block + offset;
+        } else {
+            const size_t heapAlignment = std::max(alignment, alignof(std::max_align_t));
+            data                       = ::operator new(size, std::align_val_t(heapAlignment));
+
+            // Count the padding the block would have needed too, so the next Reset sizes it properly.
+            m_Overflows.push_back({data, size + alignment, heapAlignment});
+            m_OverflowBytes += size + alignment;
+            m_Stats.heapAllocations++;
+        }
+
+        m_CycleBytes      = std::max(m_CycleBytes, m_Offset + m_OverflowBytes);
+        m_Stats.peakBytes = std::max(m_Stats.peakBytes, m_CycleBytes);
+
+        return data;
+    }
+
+    LinearArena::Marker LinearArena::GetMarker() const {
+        return {m_Offset, m_Overflows.size()};
+    }
+
+    void LinearArena::Rewind(const Marker &marker) {
+        if (marker.offset == 0 && marker.overflowCount == 0) {
+            Reset();
+            return;
+        }
+
+        ReleaseOverflows(marker.overflowCount);
+        m_Offset = std::min(m_Offset, marker.offset);
+    }
+
+    void LinearArena::Reset() {
+        const bool overflowed = !m_Overflows.empty();
+
+        ReleaseOverflows(0);
+        m_Offset = 0;
+
+        if (overflowed && m_CycleBytes > m_Capacity) {
+            ::operator delete(m_Block, std::align_val_t(s_BlockAlignment));
+
+            m_Capacity = std::bit_ceil(m_CycleBytes);
+            m_Block    = AllocateBlock(m_Capacity);
+            m_Stats.heapAllocations++;
+        }
+
+        m_CycleBytes = 0;
+    }
+
+    size_t LinearArena::GetUsed() const {
+        return m_Offset;
+    }
+
+    size_t LinearArena::GetCapacity() const {
+        return m_Capacity;
+    }
+
+    ArenaStats LinearArena::GetStats() const {
+        return m_Stats;
+    }
+
+    void LinearArena::ReleaseOverflows(const size_t keep) {
+        while (m_Overflows.size() > keep) {
+            const Overflow &overflow = m_Overflows.back();
+            ::operator delete(overflow.data, std::align_val_t(overflow.alignment));
+            m_OverflowBytes -= overflow.footprint;
+            m_Overflows.pop_back();
+        }
+    }
+
+    void LinearArena::Destroy() {
+        ReleaseOverflows(0);
+
+        if (m_Block != nullptr) {
+            ::operator delete(m_Block, std::align_val_t(s_BlockAlignment));
+            m_Block = nullptr;
+        }
+    }
+
+    LinearArena &ArenaResource::GetArena() const {
+        return *m_Arena;
+    }
+
+    void *ArenaResource::do_allocate(const size_t bytes, const size_t alignment) {
+        return m_Arena->Allocate(bytes, alignment);
+    }
+
+    void ArenaResource::do_deallocate(void *, size_t, size_t) {
+    }
+
+    bool ArenaResource::do_is_equal(const std::pmr::memory_resource &other) const noexcept {
+        return this == &other;
+    }
+}
@@ -0,0 +1,102 @@
+#ifndef PULSAR_LINEARARENA_HPP
+#define PULSAR_LINEARARENA_HPP
+
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace Pulsar::Memory {
+    // Cumulative counters; diff two snapshots to see what a frame cost.
+    struct ArenaStats {
+        uint64_t allocations     = 0;
+        uint64_t bytesAllocated  = 0;
+        uint64_t heapAllocations = 0;
+        size_t   peakBytes       = 0;
+    };
+
+    // Bump allocator over one heap block. Individual allocations are never freed; Reset or Rewind release them
+    // all at once without running destructors. Requests that do not fit fall back to the heap until the next
+    // Reset, which then grows the block to the peak it saw, so a steady workload stops touching the heap after
+    // its first cycle.
+    class LinearArena {
+    public:
+        struct Marker {
+            size_t offset        = 0;
+            size_t overflowCount = 0;
+        };
+
+        static LinearArena Create(size_t capacity);
+
+        ~LinearArena();
+
+        LinearArena(const LinearArena &other) = delete;
+        LinearArena(LinearArena &&other) noexcept;
+
+        LinearArena &operator=(const LinearArena &other) = delete;
+        LinearArena &operator=(LinearArena &&other) noexcept;
+
+        [[nodiscard]] void *Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+        // Value-initialized storage for count objects that need no destructor.
+        template<typename T>
+        [[nodiscard]] std::span<T> AllocateArray(const size_t count) {
+            static_assert(std::is_trivially_destructible_v<T>);
+
+            T *data = static_cast<T *>(Allocate(count * sizeof(T), alignof(T)));
+            for (size_t i = 0; i < count; i++) {
+                new(data + i) T();
+            }
+
+            return {data, count};
+        }
+
+        [[nodiscard]] Marker GetMarker() const;
+
+        // Releases everything allocated after marker was taken. Rewinding to an empty marker is a Reset.
+        void Rewind(const Marker &marker);
+        void Reset();
+
+        [[nodiscard]] size_t     GetUsed() const;
+        [[nodiscard]] size_t     GetCapacity() const;
+        [[nodiscard]] ArenaStats GetStats() const;
+
+    private:
+        struct Overflow {
+            void * data;
+            size_t footprint;
+            size_t alignment;
+        };
+
+        std::byte *           m_Block         = nullptr;
+        size_t                m_Capacity      = 0;
+        size_t                m_Offset        = 0;
+        size_t                m_OverflowBytes = 0;
+        size_t                m_CycleBytes    = 0;
+        std::vector<Overflow> m_Overflows;
+        ArenaStats            m_Stats;
+
+        LinearArena() = default;
+
+        void ReleaseOverflows(size_t keep);
+        void Destroy();
+    };
+
+    // std::pmr adapter so standard containers can draw from an arena. Deallocation is a no-op.
+    class ArenaResource final : public std::pmr::memory_resource {
+    public:
+        explicit ArenaResource(LinearArena &arena) : m_Arena(&arena) {}
+
+        [[nodiscard]] LinearArena &GetArena() const;
+
+    private:
+        LinearArena *m_Arena;
+
+        void *do_allocate(size_t bytes, size_t alignment) override;
+        void  do_deallocate(void *pointer, size_t bytes, size_t alignment) override;
+        bool  do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+    };
+}
+
+#endif //PULSAR_LINEARARENA_HPP
@@ -0,0 +1,26 @@
+#include "Scratch.hpp"
+
+namespace Pulsar::Memory {
+    static constexpr size_t s_ScratchCapacity = 1024 * 1024;
+
+    LinearArena &GetScratchArena() {
+        thread_local LinearArena arena = LinearArena::Create(s_ScratchCapacity);
+        return arena;
+    }
+
+    ScratchScope::ScratchScope()
+        : m_Arena(&GetScratchArena()), m_Marker(m_Arena->GetMarker()), m_Resource(*m_Arena) {
+    }
+
+    ScratchScope::~ScratchScope() {
+        m_Arena->Rewind(m_Marker);
+    }
+
+    void *ScratchScope::Allocate(const size_t size, const size_t alignment) {
+        return m_Arena->Allocate(size, alignment);
+    }
+
+    std::pmr::memory_resource *ScratchScope::GetResource() {
+        return &m_Resource;
+    }
+}
@@ -0,0 +1,39 @@
+#ifndef PULSAR_SCRATCH_HPP
+#define PULSAR_SCRATCH_HPP
+
+#include "LinearArena.hpp"
+
+namespace Pulsar::Memory {
+    // Every thread gets its own arena, created on first use, for temporaries that do not outlive a call.
+    [[nodiscard]] LinearArena &GetScratchArena();
+
+    // Marks the calling thread's scratch arena and rewinds it on destruction. Scopes nest like a stack: while an
+    // inner scope is alive, allocate only through it.
+    class ScratchScope {
+    public:
+        ScratchScope();
+        ~ScratchScope();
+
+        ScratchScope(const ScratchScope &other) = delete;
+        ScratchScope(ScratchScope &&other)      = delete;
+
+        ScratchScope &operator=(const ScratchScope &other) = delete;
+        ScratchScope &operator=(ScratchScope &&other)      = delete;
+
+        [[nodiscard]] void *Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+        template<typename T>
+        [[nodiscard]] std::span<T> AllocateArray(const size_t count) {
+            return m_Arena->AllocateArray<T>(count);
+        }
+
+        [[nodiscard]] std::pmr::memory_resource *GetResource();
+
+    private:
+        LinearArena *       m_Arena;
+        LinearArena::Marker m_Marker;
+        ArenaResource       m_Resource;
+    };
+}
+
+#endif //PULSAR_SCRATCH_HPP
@@ -0,0 +1,79 @@
+#include "GpuMesh.hpp"
+
+namespace Pulsar::Mesh {
+    GpuMesh GpuMesh::Create(Vulkan::Device &device, const QuantizedMesh &mesh) {
+        const bool narrowIndices = mesh.vertices.size() <= std::numeric_limits<uint16_t>::max();
+
+        std::vector<uint16_t> narrowed;
+        if (narrowIndices) {
+            narrowed.assign(mesh.indices.begin(), mesh.indices.end());
+        }
+
+        const std::span<const std::byte> indexData = narrowIndices
+                                                         ? std::as_bytes(std::span(narrowed))
+                                                         : std::as_bytes(std::span(mesh.indices));
+
+        GpuMesh gpuMesh(
+            Vulkan::Buffer::CreateDeviceLocal(device, std::as_bytes(std::span(mesh.vertices)),
+                                              VK_BUFFER_USAGE_VERTEX_BUFFER_BIT),
+            Vulkan::Buffer::CreateDeviceLocal(device, indexData, VK_BUFFER_USAGE_INDEX_BUFFER_BIT)
+        );
+
+        gpuMesh.m_IndexType  = narrowIndices ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+        gpuMesh.m_IndexCount = static_cast<uint32_t>(mesh.indices.size());
+        gpuMesh.m_Bounds     = {
+            {mesh.boundsCenter[0], mesh.boundsCenter[1], mesh.boundsCenter[2], 0.0F},
+            {mesh.boundsExtent[0], mesh.boundsExtent[1], mesh.boundsExtent[2], 0.0F}
+        };
+
+        return gpuMesh;
+    }
+
+    Vulkan::VertexLayout GpuMesh::GetVertexLayout() {
+        Vulkan::VertexLayout layout;
+        layout.stride     = sizeof(PackedVertex);
+        layout.attributes = {
+            {0, VK_FORMAT_R16G16B16A16_SNORM, offsetof(PackedVertex, position)},
+            {1, VK_FORMAT_R16G16_SNORM, offsetof(PackedVertex, normal)},
+            {2, VK_FORMAT_R16G16_SFLOAT, offsetof(PackedVertex, uv)}
+        };
+
+        return layout;
+    }
+
+    void GpuMesh::Bind(const VkCommandBuffer commandBuffer) const {
+        const VkBuffer     vertexBuffer = m_VertexBuffer.GetVkBuffer();
+        const VkDeviceSize offset       = 0;
+
+        vkCmdBindVertexBuffers(commandBuffer, 0, 1, &vertexBuffer, &offset);
+        vkCmdBindIndexBuffer(commandBuffer, m_IndexBuffer.GetVkBuffer(), 0, m_IndexType);
+    }
+
+    void GpuMesh::Draw(const VkCommandBuffer commandBuffer, const uint32_t instanceCount) const {
+        vkCmdDrawIndexed(commandBuffer, m_IndexCount, instanceCount, 0, 0, 0);
+    }
+
+    const Vulkan::Buffer &GpuMesh::GetVertexBuffer() const {
+        return m_VertexBuffer;
+    }
+
+    const Vulkan::Buffer &GpuMesh::GetIndexBuffer() const {
+        return m_IndexBuffer;
+    }
+
+    VkIndexType GpuMesh::GetIndexType() const {
+        return m_IndexType;
+    }
+
+    uint32_t GpuMesh::GetIndexCount() const {
+        return m_IndexCount;
+    }
+
+    const MeshBounds &GpuMesh::GetBounds() const {
+        return m_Bounds;
+    }
+
+    GpuMesh::GpuMesh(Vulkan::Buffer &&vertexBuffer, Vulkan::Buffer &&indexBuffer)
+        : m_VertexBuffer(std::move(vertexBuffer)), m_IndexBuffer(std::move(indexBuffer)) {
+    }
+}
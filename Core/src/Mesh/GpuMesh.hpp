@@ -0,0 +1,41 @@
+#ifndef PULSAR_GPUMESH_HPP
+#define PULSAR_GPUMESH_HPP
+
+#include "MeshData.hpp"
+#include "Vulkan/Buffer.hpp"
+#include "Vulkan/VertexLayout.hpp"
+
+namespace Pulsar::Mesh {
+    // Push-constant block the vertex shader needs to dequantize PackedVertex::position.
+    struct MeshBounds {
+        std::array<float, 4> center;
+        std::array<float, 4> extent;
+    };
+
+    class GpuMesh {
+    public:
+        static GpuMesh Create(Vulkan::Device &device, const QuantizedMesh &mesh);
+
+        [[nodiscard]] static Vulkan::VertexLayout GetVertexLayout();
+
+        void Bind(VkCommandBuffer commandBuffer) const;
+        void Draw(VkCommandBuffer commandBuffer, uint32_t instanceCount = 1) const;
+
+        [[nodiscard]] const Vulkan::Buffer &GetVertexBuffer() const;
+        [[nodiscard]] const Vulkan::Buffer &GetIndexBuffer() const;
+        [[nodiscard]] VkIndexType           GetIndexType() const;
+        [[nodiscard]] uint32_t              GetIndexCount() const;
+        [[nodiscard]] const MeshBounds &    GetBounds() const;
+
+    private:
+        Vulkan::Buffer m_VertexBuffer;
+        Vulkan::Buffer m_IndexBuffer;
+        VkIndexType    m_IndexType  = VK_INDEX_TYPE_UINT32;
+        uint32_t       m_IndexCount = 0;
+        MeshBounds     m_Bounds{};
+
+        GpuMesh(Vulkan::Buffer &&vertexBuffer, Vulkan::Buffer &&indexBuffer);
+    };
+}
+
+#endif //PULSAR_GPUMESH_HPP
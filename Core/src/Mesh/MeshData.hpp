@@ -0,0 +1,40 @@
+#ifndef PULSAR_MESHDATA_HPP
+#define PULSAR_MESHDATA_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Pulsar::Mesh {
+    struct Vertex {
+        std::array<float, 3> position;
+        std::array<float, 3> normal;
+        std::array<float, 2> uv;
+    };
+
+    struct MeshData {
+        std::vector<Vertex>   vertices;
+        std::vector<uint32_t> indices;
+    };
+
+    // 16 bytes per vertex instead of 32. Positions are snorm16 relative to the mesh bounds,
+    // normals are octahedral-encoded snorm16 and UVs are half floats.
+    struct PackedVertex {
+        std::array<int16_t, 4>  position;
+        std::array<int16_t, 2>  normal;
+        std::array<uint16_t, 2> uv;
+    };
+
+    static_assert(sizeof(PackedVertex) == 16);
+
+    struct QuantizedMesh {
+        std::vector<PackedVertex> vertices;
+        std::vector<uint32_t>     indices;
+
+        // position = packed.xyz * boundsExtent + boundsCenter
+        std::array<float, 3> boundsCenter = {};
+        std::array<float, 3> boundsExtent = {};
+    };
+}
+
+#endif //PULSAR_MESHDATA_HPP
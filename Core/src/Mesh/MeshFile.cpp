@@ -0,0 +1,74 @@
+#include "MeshFile.hpp"
+
+#include <fstream>
+
+#include "FileIo/MappedFile.hpp"
+#include "MeshFormat.hpp"
+
+namespace Pulsar::Mesh {
+    QuantizedMesh ReadMeshFile(const std::string &path) {
+        const FileIo::MappedFile         file = FileIo::MappedFile::Open(path);
+        const std::span<const std::byte> data = file.GetData();
+
+        if (data.size() < sizeof(MeshHeader)) {
+            throw std::runtime_error("Failed to read mesh: File too small");
+        }
+
+        MeshHeader header{};
+        std::memcpy(&header, data.data(), sizeof(MeshHeader));
+
+        if (header.magic != g_MeshMagic) {
+            throw std::runtime_error("Failed to read mesh: Invalid magic");
+        }
+
+        if (header.version != g_MeshVersion) {
+            throw std::runtime_error("Failed to read mesh: Unsupported version");
+        }
+
+        const uint64_t vertexBytes = static_cast<uint64_t>(header.vertexCount) * sizeof(PackedVertex);
+        const uint64_t indexBytes  = static_cast<uint64_t>(header.indexCount) * sizeof(uint32_t);
+
+        if (sizeof(MeshHeader) + vertexBytes + indexBytes > data.size()) {
+            throw std::runtime_error("Failed to read mesh: Corrupt header");
+        }
+
+        QuantizedMesh mesh;
+        mesh.boundsCenter = header.boundsCenter;
+        mesh.boundsExtent = header.boundsExtent;
+        mesh.vertices.resize(header.vertexCount);
+        mesh.indices.resize(header.indexCount);
+
+        std::memcpy(mesh.vertices.data(), data.data() + sizeof(MeshHeader), vertexBytes);
+        std::memcpy(mesh.indices.data(), data.data() + sizeof(MeshHeader) + vertexBytes, indexBytes);
+
+        for (const uint32_t index : mesh.indices) {
+            if (index >= header.vertexCount) {
+                throw std::runtime_error("Failed to read mesh: Index out of bounds");
+            }
+        }
+
+        return mesh;
+    }
+
+    void WriteMeshFile(const std::string &path, const QuantizedMesh &mesh) {
+        MeshHeader header{};
+        header.magic        = g_MeshMagic;
+        header.version      = g_MeshVersion;
+        header.vertexCount  = static_cast<uint32_t>(mesh.vertices.size());
+        header.indexCount   = static_cast<uint32_t>(mesh.indices.size());
+        header.boundsCenter = mesh.boundsCenter;
+        header.boundsExtent = mesh.boundsExtent;
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char *>(mesh.vertices.data()),
+                   static_cast<std::streamsize>(mesh.vertices.size() * sizeof(PackedVertex)));
+        file.write(reinterpret_cast<const char *>(mesh.indices.data()),
+                   static_cast<std::streamsize>(mesh.indices.size() * sizeof(uint32_t)));
+
+        if (!file) {
+            throw std::runtime_error("Failed to write mesh: Write error");
+        }
+    }
+}
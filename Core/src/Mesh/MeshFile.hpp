@@ -0,0 +1,14 @@
+#ifndef PULSAR_MESHFILE_HPP
+#define PULSAR_MESHFILE_HPP
+
+#include <string>
+
+#include "MeshData.hpp"
+
+namespace Pulsar::Mesh {
+    [[nodiscard]] QuantizedMesh ReadMeshFile(const std::string &path);
+
+    void WriteMeshFile(const std::string &path, const QuantizedMesh &mesh);
+}
+
+#endif //PULSAR_MESHFILE_HPP
@@ -0,0 +1,27 @@
+#ifndef PULSAR_MESHFORMAT_HPP
+#define PULSAR_MESHFORMAT_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace Pulsar::Mesh {
+    // Layout of a .pmesh file:
+    //   MeshHeader | PackedVertex[vertexCount] | uint32_t[indexCount]
+    // The mesh is stored already optimized and quantized, so loading is a straight copy into GPU buffers.
+
+    constexpr std::array<char, 4> g_MeshMagic   = {'P', 'M', 'S', 'H'};
+    constexpr uint32_t            g_MeshVersion = 1;
+
+    struct MeshHeader {
+        std::array<char, 4>  magic;
+        uint32_t             version;
+        uint32_t             vertexCount;
+        uint32_t             indexCount;
+        std::array<float, 3> boundsCenter;
+        std::array<float, 3> boundsExtent;
+    };
+
+    static_assert(sizeof(MeshHeader) == 40);
+}
+
+#endif //PULSAR_MESHFORMAT_HPP
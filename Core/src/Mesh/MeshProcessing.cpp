@@ -0,0 +1,173 @@
+#include "MeshProcessing.hpp"
+
+#include <cmath>
+
+#include <meshoptimizer.h>
+
+namespace Pulsar::Mesh {
+    // Typical post-transform cache parameters for current desktop GPUs.
+    static constexpr uint32_t s_CacheSize      = 16;
+    static constexpr uint32_t s_WarpSize       = 64;
+    static constexpr uint32_t s_PrimitiveGroup = 128;
+
+    void OptimizeMesh(MeshData &mesh, const float overdrawThreshold) {
+        if (mesh.indices.empty()) {
+            return;
+        }
+
+        std::vector<uint32_t> remap(mesh.indices.size());
+        const size_t          vertexCount = meshopt_generateVertexRemap(remap.data(), mesh.indices.data(),
+                                                                        mesh.indices.size(), mesh.vertices.data(),
+                                                                        mesh.vertices.size(), sizeof(Vertex));
+
+        std::vector<Vertex> vertices(vertexCount);
+        meshopt_remapVertexBuffer(vertices.data(), mesh.vertices.data(), mesh.vertices.size(), sizeof(Vertex),
+                                  remap.data());
+        meshopt_remapIndexBuffer(mesh.indices.data(), mesh.indices.data(), mesh.indices.size(), remap.data());
+
+        meshopt_optimizeVertexCache(mesh.indices.data(), mesh.indices.data(), mesh.indices.size(), vertexCount);
+
+        meshopt_optimizeOverdraw(mesh.indices.data(), mesh.indices.data(), mesh.indices.size(),
+                                 vertices[0].position.data(), vertexCount, sizeof(Vertex), overdrawThreshold);
+
+        mesh.vertices.resize(vertexCount);
+        const size_t usedCount = meshopt_optimizeVertexFetch(mesh.vertices.data(), mesh.indices.data(),
+                                                             mesh.indices.size(), vertices.data(), vertexCount,
+                                                             sizeof(Vertex));
+        mesh.vertices.resize(usedCount);
+    }
+
+    QuantizedMesh QuantizeMesh(const MeshData &mesh) {
+        QuantizedMesh quantized;
+        quantized.indices = mesh.indices;
+
+        if (mesh.vertices.empty()) {
+            return quantized;
+        }
+
+        std::array<float, 3> minimum = mesh.vertices[0].position;
+        std::array<float, 3> maximum = mesh.vertices[0].position;
+
+        for (const Vertex &vertex : mesh.vertices) {
+            for (int axis = 0; axis < 3; axis++) {
+                minimum[axis] = std::min(minimum[axis], vertex.position[axis]);
+                maximum[axis] = std::max(maximum[axis], vertex.position[axis]);
+            }
+        }
+
+        for (int axis = 0; axis < 3; axis++) {
+            quantized.boundsCenter[axis] = (minimum[axis] + maximum[axis]) * 0.5F;
+            quantized.boundsExtent[axis] = std::max((maximum[axis] - minimum[axis]) * 0.5F, 1e-6F);
+        }
+
+        quantized.vertices.reserve(mesh.vertices.size());
+
+        for (const Vertex &vertex : mesh.vertices) {
+            PackedVertex packed{};
+
+            for (int axis = 0; axis < 3; axis++) {
+                const float normalized = (vertex.position[axis] - quantized.boundsCenter[axis]) /
+                    quantized.boundsExtent[axis];
+                packed.position[axis] = static_cast<int16_t>(meshopt_quantizeSnorm(normalized, 16));
+            }
+
+            packed.normal = EncodeOctahedral(vertex.normal);
+            packed.uv     = {meshopt_quantizeHalf(vertex.uv[0]), meshopt_quantizeHalf(vertex.uv[1])};
+
+            quantized.vertices.push_back(packed);
+        }
+
+        return quantized;
+    }
+
+    std::array<int16_t, 2> EncodeOctahedral(const std::array<float, 3> &normal) {
+        const float length = std::abs(normal[0]) + std::abs(normal[1]) + std::abs(normal[2]);
+        if (length == 0.0F) {
+            return {0, 0};
+        }
+
+        float x = normal[0] / length;
+        float y = normal[1] / length;
+
+        if (normal[2] < 0.0F) {
+            const float foldedX = (1.0F - std::abs(y)) * (x >= 0.0F ? 1.0F : -1.0F);
+            const float foldedY = (1.0F - std::abs(x)) * (y >= 0.0F ? 1.0F : -1.0F);
+
+            x = foldedX;
+            y = foldedY;
+        }
+
+        return {
+            static_cast<int16_t>(meshopt_quantizeSnorm(x, 16)),
+            static_cast<int16_t>(meshopt_quantizeSnorm(y, 16))
+        };
+    }
+
+    std::array<float, 3> DecodeOctahedral(const std::array<int16_t, 2> &encoded) {
+        float x = std::max(static_cast<float>(encoded[0]) / 32767.0F, -1.0F);
+        float y = std::max(static_cast<float>(encoded[1]) / 32767.0F, -1.0F);
+        float z = 1.0F - std::abs(x) - std::abs(y);
+
+        const float fold = std::max(-z, 0.0F);
+        x += x >= 0.0F ? -fold : fold;
+        y += y >= 0.0F ? -fold : fold;
+
+        const float length = std::sqrt(x * x + y * y + z * z);
+
+        return {x / length, y / length, z / length};
+    }
+
+    static MeshStatistics Analyze(const std::vector<uint32_t> &indices, const std::vector<float> &positions,
+                                  const size_t vertexCount, const size_t vertexSize, const size_t indexSize) {
+        MeshStatistics statistics;
+        statistics.vertexBytes = vertexCount * vertexSize;
+        statistics.indexBytes  = indices.size() * indexSize;
+
+        if (indices.empty()) {
+            return statistics;
+        }
+
+        const meshopt_VertexCacheStatistics cache = meshopt_analyzeVertexCache(
+            indices.data(), indices.size(), vertexCount, s_CacheSize, s_WarpSize, s_PrimitiveGroup);
+        const meshopt_VertexFetchStatistics fetch = meshopt_analyzeVertexFetch(
+            indices.data(), indices.size(), vertexCount, vertexSize);
+        const meshopt_OverdrawStatistics overdraw = meshopt_analyzeOverdraw(
+            indices.data(), indices.size(), positions.data(), vertexCount, sizeof(float) * 3);
+
+        statistics.averageCacheMissRatio       = cache.acmr;
+        statistics.averageTransformedPerVertex = cache.atvr;
+        statistics.overfetch                   = fetch.overfetch;
+        statistics.overdraw                    = overdraw.overdraw;
+
+        return statistics;
+    }
+
+    MeshStatistics AnalyzeMesh(const MeshData &mesh) {
+        std::vector<float> positions;
+        positions.reserve(mesh.vertices.size() * 3);
+
+        for (const Vertex &vertex : mesh.vertices) {
+            positions.insert(positions.end(), vertex.position.begin(), vertex.position.end());
+        }
+
+        return Analyze(mesh.indices, positions, mesh.vertices.size(), sizeof(Vertex), sizeof(uint32_t));
+    }
+
+    MeshStatistics AnalyzeMesh(const QuantizedMesh &mesh) {
+        std::vector<float> positions;
+        positions.reserve(mesh.vertices.size() * 3);
+
+        for (const PackedVertex &vertex : mesh.vertices) {
+            for (int axis = 0; axis < 3; axis++) {
+                positions.push_back(static_cast<float>(vertex.position[axis]) / 32767.0F * mesh.boundsExtent[axis] +
+                    mesh.boundsCenter[axis]);
+            }
+        }
+
+        const size_t indexSize = mesh.vertices.size() <= std::numeric_limits<uint16_t>::max()
+                                     ? sizeof(uint16_t)
+                                     : sizeof(uint32_t);
+
+        return Analyze(mesh.indices, positions, mesh.vertices.size(), sizeof(PackedVertex), indexSize);
+    }
+}
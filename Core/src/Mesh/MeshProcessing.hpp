@@ -0,0 +1,28 @@
+#ifndef PULSAR_MESHPROCESSING_HPP
+#define PULSAR_MESHPROCESSING_HPP
+
+#include "MeshData.hpp"
+
+namespace Pulsar::Mesh {
+    struct MeshStatistics {
+        float    averageCacheMissRatio       = 0.0F;
+        float    averageTransformedPerVertex = 0.0F;
+        float    overdraw                    = 0.0F;
+        float    overfetch                   = 0.0F;
+        uint64_t vertexBytes                 = 0;
+        uint64_t indexBytes                  = 0;
+    };
+
+    // Welds duplicate vertices, then reorders for the post-transform cache, overdraw and vertex fetch, in that order.
+    void OptimizeMesh(MeshData &mesh, float overdrawThreshold = 1.05F);
+
+    [[nodiscard]] QuantizedMesh QuantizeMesh(const MeshData &mesh);
+
+    [[nodiscard]] std::array<int16_t, 2> EncodeOctahedral(const std::array<float, 3> &normal);
+    [[nodiscard]] std::array<float, 3>   DecodeOctahedral(const std::array<int16_t, 2> &encoded);
+
+    [[nodiscard]] MeshStatistics AnalyzeMesh(const MeshData &mesh);
+    [[nodiscard]] MeshStatistics AnalyzeMesh(const QuantizedMesh &mesh);
+}
+
+#endif //PULSAR_MESHPROCESSING_HPP
@@ -0,0 +1,105 @@
+#include "ObjParser.hpp"
+
+#include <charconv>
+
+namespace Pulsar::Mesh {
+    static std::string_view NextToken(std::string_view &line) {
+        const size_t start = line.find_first_not_of(" \t\r");
+        if (start == std::string_view::npos) {
+            line = {};
+            return {};
+        }
+
+        const size_t     end   = line.find_first_of(" \t\r", start);
+        std::string_view token = line.substr(start, end - start);
+        line = end == std::string_view::npos ? std::string_view{} : line.substr(end);
+
+        return token;
+    }
+
+    static float ParseFloat(const std::string_view token) {
+        float value = 0.0F;
+        std::from_chars(token.data(), token.data() + token.size(), value);
+        return value;
+    }
+
+    // OBJ indices are 1-based and may be negative (relative to the end of the list).
+    static size_t ResolveIndex(const std::string_view token, const size_t count) {
+        long index = 0;
+        const auto [end, error] = std::from_chars(token.data(), token.data() + token.size(), index);
+
+        if (error != std::errc() || index == 0) {
+            throw std::runtime_error("Failed to parse OBJ: Invalid index");
+        }
+
+        const long resolved = index > 0 ? index - 1 : static_cast<long>(count) + index;
+        if (resolved < 0 || static_cast<size_t>(resolved) >= count) {
+            throw std::runtime_error("Failed to parse OBJ: Index out of range");
+        }
+
+        return static_cast<size_t>(resolved);
+    }
+
+    MeshData ParseObj(std::string_view source) {
+        std::vector<std::array<float, 3>> positions;
+        std::vector<std::array<float, 3>> normals;
+        std::vector<std::array<float, 2>> uvs;
+
+        MeshData mesh;
+        std::vector<Vertex> face;
+
+        while (!source.empty()) {
+            const size_t     lineEnd = source.find('\n');
+            std::string_view line    = source.substr(0, lineEnd);
+            source = lineEnd == std::string_view::npos ? std::string_view{} : source.substr(lineEnd + 1);
+
+            const std::string_view keyword = NextToken(line);
+
+            if (keyword == "v") {
+                positions.push_back({ParseFloat(NextToken(line)), ParseFloat(NextToken(line)),
+                                     ParseFloat(NextToken(line))});
+            } else if (keyword == "vn") {
+                normals.push_back({ParseFloat(NextToken(line)), ParseFloat(NextToken(line)),
+                                   ParseFloat(NextToken(line))});
+            } else if (keyword == "vt") {
+                uvs.push_back({ParseFloat(NextToken(line)), ParseFloat(NextToken(line))});
+            } else if (keyword == "f") {
+                face.clear();
+
+                for (std::string_view corner = NextToken(line); !corner.empty(); corner = NextToken(line)) {
+                    Vertex vertex{};
+
+                    const size_t firstSlash = corner.find('/');
+                    vertex.position = positions[ResolveIndex(corner.substr(0, firstSlash), positions.size())];
+
+                    if (firstSlash != std::string_view::npos) {
+                        const std::string_view rest        = corner.substr(firstSlash + 1);
+                        const size_t           secondSlash = rest.find('/');
+                        const std::string_view uv          = rest.substr(0, secondSlash);
+
+                        if (!uv.empty()) {
+                            vertex.uv = uvs[ResolveIndex(uv, uvs.size())];
+                        }
+
+                        if (secondSlash != std::string_view::npos) {
+                            vertex.normal = normals[ResolveIndex(rest.substr(secondSlash + 1), normals.size())];
+                        }
+                    }
+
+                    face.push_back(vertex);
+                }
+
+                for (size_t i = 2; i < face.size(); i++) {
+                    const auto base = static_cast<uint32_t>(mesh.vertices.size());
+
+                    mesh.vertices.push_back(face[0]);
+                    mesh.vertices.push_back(face[i - 1]);
+                    mesh.vertices.push_back(face[i]);
+                    mesh.indices.insert(mesh.indices.end(), {base, base + 1, base + 2});
+                }
+            }
+        }
+
+        return mesh;
+    }
+}
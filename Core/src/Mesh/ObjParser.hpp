@@ -0,0 +1,13 @@
+#ifndef PULSAR_OBJPARSER_HPP
+#define PULSAR_OBJPARSER_HPP
+
+#include <string_view>
+
+#include "MeshData.hpp"
+
+namespace Pulsar::Mesh {
+    // Emits one vertex per face corner and fan-triangulates polygons. Run OptimizeMesh afterwards to weld.
+    [[nodiscard]] MeshData ParseObj(std::string_view source);
+}
+
+#endif //PULSAR_OBJPARSER_HPP
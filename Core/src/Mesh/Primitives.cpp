@@ -0,0 +1,45 @@
+#include "Primitives.hpp"
+
+#include <cmath>
+#include <numbers>
+
+namespace Pulsar::Mesh {
+    MeshData GenerateSphere(const uint32_t segments, const uint32_t rings, const float radius) {
+        if (segments < 3 || rings < 2) {
+            throw std::runtime_error("Failed to generate sphere: Too few segments or rings");
+        }
+
+        MeshData mesh;
+        mesh.vertices.reserve(static_cast<size_t>(segments + 1) * (rings + 1));
+        mesh.indices.reserve(static_cast<size_t>(segments) * rings * 6);
+
+        for (uint32_t ring = 0; ring <= rings; ring++) {
+            const float v     = static_cast<float>(ring) / static_cast<float>(rings);
+            const float theta = v * std::numbers::pi_v<float>;
+
+            for (uint32_t segment = 0; segment <= segments; segment++) {
+                const float u   = static_cast<float>(segment) / static_cast<float>(segments);
+                const float phi = u * 2.0F * std::numbers::pi_v<float>;
+
+                const std::array normal = {
+                    std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi)
+                };
+
+                mesh.vertices.push_back({
+                    {normal[0] * radius, normal[1] * radius, normal[2] * radius}, normal, {u, v}
+                });
+            }
+        }
+
+        for (uint32_t ring = 0; ring < rings; ring++) {
+            for (uint32_t segment = 0; segment < segments; segment++) {
+                const uint32_t current = ring * (segments + 1) + segment;
+                const uint32_t next    = current + segments + 1;
+
+                mesh.indices.insert(mesh.indices.end(), {current, current + 1, next, current + 1, next + 1, next});
+            }
+        }
+
+        return mesh;
+    }
+}
@@ -0,0 +1,10 @@
+#ifndef PULSAR_PRIMITIVES_HPP
+#define PULSAR_PRIMITIVES_HPP
+
+#include "MeshData.hpp"
+
+namespace Pulsar::Mesh {
+    [[nodiscard]] MeshData GenerateSphere(uint32_t segments, uint32_t rings, float radius = 1.0F);
+}
+
+#endif //PULSAR_PRIMITIVES_HPP
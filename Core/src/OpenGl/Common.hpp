@@ -0,0 +1,38 @@
+#ifndef PULSAR_GL_COMMON_HPP
+#define PULSAR_GL_COMMON_HPP
+
+#include <glad/glad.h>
+
+// Tokens from GL 4.x that a 3.3 core GLAD header does not define.
+#ifndef GL_DRAW_INDIRECT_BUFFER
+#define GL_DRAW_INDIRECT_BUFFER 0x8F3F
+#endif
+
+#ifndef GL_MAP_PERSISTENT_BIT
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#endif
+
+#ifndef GL_MAP_COHERENT_BIT
+#define GL_MAP_COHERENT_BIT 0x0080
+#endif
+
+#ifndef GL_DYNAMIC_STORAGE_BIT
+#define GL_DYNAMIC_STORAGE_BIT 0x0100
+#endif
+
+#ifndef GL_CLIENT_STORAGE_BIT
+#define GL_CLIENT_STORAGE_BIT 0x0200
+#endif
+
+namespace Pulsar::OpenGl {
+    // Matches VkDrawIndexedIndirectCommand, so DrawList commands can be uploaded as they are.
+    struct DrawElementsIndirectCommand {
+        GLuint count;
+        GLuint instanceCount;
+        GLuint firstIndex;
+        GLint  baseVertex;
+        GLuint baseInstance;
+    };
+}
+
+#endif //PULSAR_GL_COMMON_HPP
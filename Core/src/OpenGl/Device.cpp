@@ -0,0 +1,107 @@
+#include "Device.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "Logging/Log.hpp"
+
+namespace Pulsar::OpenGl {
+    static bool IsVersionAtLeast(const DeviceCapabilities &capabilities, const int major, const int minor) {
+        return capabilities.versionMajor > major ||
+               (capabilities.versionMajor == major && capabilities.versionMinor >= minor);
+    }
+
+    Device Device::Create(Glfw::Window &window) {
+        if (window.GetGraphicsApi() != GraphicsApi::OpenGl) {
+            throw std::runtime_error("Failed to create OpenGL device: Window has no OpenGL context");
+        }
+
+        Device device;
+        device.m_Window = &window;
+        device.MakeCurrent();
+        device.QueryCapabilities();
+        device.LoadFunctions();
+
+        Logging::Info(Logging::Category::OpenGl, "OpenGL {}.{} on {}", device.m_Capabilities.versionMajor,
+                      device.m_Capabilities.versionMinor, device.m_Renderer);
+
+        return device;
+    }
+
+    void Device::MakeCurrent() const {
+        m_Window->SetCurrent();
+    }
+
+    bool Device::IsExtensionSupported(const std::string_view name) const {
+        return std::ranges::find(m_Extensions, name) != m_Extensions.end();
+    }
+
+    const DeviceCapabilities &Device::GetCapabilities() const {
+        return m_Capabilities;
+    }
+
+    const DeviceFunctions &Device::GetFunctions() const {
+        return m_Functions;
+    }
+
+    StateCache &Device::GetStateCache() {
+        return m_StateCache;
+    }
+
+    const std::string &Device::GetRenderer() const {
+        return m_Renderer;
+    }
+
+    void Device::QueryCapabilities() {
+        glGetIntegerv(GL_MAJOR_VERSION, &m_Capabilities.versionMajor);
+        glGetIntegerv(GL_MINOR_VERSION, &m_Capabilities.versionMinor);
+
+        if (const auto *renderer = reinterpret_cast<const char *>(glGetString(GL_RENDERER)); renderer != nullptr) {
+            m_Renderer = renderer;
+        }
+
+        GLint extensionCount = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+
+        m_Extensions.reserve(extensionCount);
+        for (GLint i = 0; i < extensionCount; i++) {
+            m_Extensions.emplace_back(reinterpret_cast<const char *>(glGetStringi(GL_EXTENSIONS, i)));
+        }
+
+        m_Capabilities.bufferStorage = IsVersionAtLeast(m_Capabilities, 4, 4) ||
+                                       IsExtensionSupported("GL_ARB_buffer_storage");
+        m_Capabilities.baseInstance = IsVersionAtLeast(m_Capabilities, 4, 2) ||
+                                      IsExtensionSupported("GL_ARB_base_instance");
+
+        // firstInstance in an indirect command is only honored with base instance support.
+        m_Capabilities.multiDrawIndirect = m_Capabilities.baseInstance &&
+                                           (IsVersionAtLeast(m_Capabilities, 4, 3) ||
+                                            IsExtensionSupported("GL_ARB_multi_draw_indirect"));
+    }
+
+    void Device::LoadFunctions() {
+        const auto load = [](const char *name) {
+            return glfwGetProcAddress(name);
+        };
+
+        if (m_Capabilities.bufferStorage) {
+            m_Functions.bufferStorage = reinterpret_cast<DeviceFunctions::BufferStorageFunction>(
+                load("glBufferStorage"));
+            m_Capabilities.bufferStorage = m_Functions.bufferStorage != nullptr;
+        }
+
+        if (m_Capabilities.baseInstance) {
+            m_Functions.drawElementsInstancedBaseVertexBaseInstance = reinterpret_cast<
+                DeviceFunctions::DrawElementsInstancedBaseVertexBaseInstanceFunction>(
+                load("glDrawElementsInstancedBaseVertexBaseInstance"));
+            m_Capabilities.baseInstance = m_Functions.drawElementsInstancedBaseVertexBaseInstance != nullptr;
+        }
+
+        if (m_Capabilities.multiDrawIndirect) {
+            m_Functions.multiDrawElementsIndirect = reinterpret_cast<
+                DeviceFunctions::MultiDrawElementsIndirectFunction>(load("glMultiDrawElementsIndirect"));
+            m_Capabilities.multiDrawIndirect = m_Capabilities.baseInstance &&
+                                               m_Functions.multiDrawElementsIndirect != nullptr;
+        }
+    }
+}
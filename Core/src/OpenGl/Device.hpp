@@ -0,0 +1,77 @@
+#ifndef PULSAR_GL_DEVICE_HPP
+#define PULSAR_GL_DEVICE_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Common.hpp"
+#include "StateCache.hpp"
+#include "Glfw/Window.hpp"
+
+namespace Pulsar::OpenGl {
+    struct DeviceCapabilities {
+        int versionMajor = 0;
+        int versionMinor = 0;
+
+        bool bufferStorage     = false; // GL 4.4 or ARB_buffer_storage
+        bool baseInstance      = false; // GL 4.2 or ARB_base_instance
+        bool multiDrawIndirect = false; // GL 4.3 or ARB_multi_draw_indirect
+    };
+
+    // Entry points newer than the 3.3 core profile GLAD loads. Null unless the matching capability is set.
+    struct DeviceFunctions {
+        using BufferStorageFunction = void (APIENTRYP)(GLenum target, GLsizeiptr size, const void *data,
+                                                       GLbitfield flags);
+        using MultiDrawElementsIndirectFunction = void (APIENTRYP)(GLenum mode, GLenum type, const void *indirect,
+                                                                   GLsizei drawCount, GLsizei stride);
+        using DrawElementsInstancedBaseVertexBaseInstanceFunction = void (APIENTRYP)(
+            GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instanceCount, GLint baseVertex,
+            GLuint baseInstance);
+
+        BufferStorageFunction                               bufferStorage             = nullptr;
+        MultiDrawElementsIndirectFunction                   multiDrawElementsIndirect = nullptr;
+        DrawElementsInstancedBaseVertexBaseInstanceFunction drawElementsInstancedBaseVertexBaseInstance = nullptr;
+    };
+
+    // Wraps the context of an OpenGL window. GL calls are only valid on the thread that owns the context, which
+    // for GLFW windows is the main thread.
+    class Device {
+    public:
+        static Device Create(Glfw::Window &window);
+
+        Device(const Device &other) = delete;
+
+        Device(Device &&other) noexcept = default;
+
+        Device &operator=(const Device &other) = delete;
+
+        Device &operator=(Device &&other) noexcept = default;
+
+        ~Device() = default;
+
+        void MakeCurrent() const;
+
+        [[nodiscard]] bool IsExtensionSupported(std::string_view name) const;
+
+        [[nodiscard]] const DeviceCapabilities &GetCapabilities() const;
+        [[nodiscard]] const DeviceFunctions &   GetFunctions() const;
+        [[nodiscard]] StateCache &              GetStateCache();
+        [[nodiscard]] const std::string &       GetRenderer() const;
+
+    private:
+        Glfw::Window *           m_Window = nullptr;
+        DeviceCapabilities       m_Capabilities;
+        DeviceFunctions          m_Functions;
+        StateCache               m_StateCache;
+        std::vector<std::string> m_Extensions;
+        std::string              m_Renderer;
+
+        Device() = default;
+
+        void QueryCapabilities();
+        void LoadFunctions();
+    };
+}
+
+#endif //PULSAR_GL_DEVICE_HPP
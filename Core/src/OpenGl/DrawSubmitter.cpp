@@ -0,0 +1,128 @@
+#include "DrawSubmitter.hpp"
+
+namespace Pulsar::OpenGl {
+    static_assert(sizeof(DrawElementsIndirectCommand) == sizeof(VkDrawIndexedIndirectCommand));
+
+    static const void *ToPointer(const GLintptr offset) {
+        return reinterpret_cast<const void *>(offset);
+    }
+
+    DrawSubmitter DrawSubmitter::Create(Device &device, const GLsizeiptr streamSize, const uint32_t framesInFlight) {
+        DrawSubmitter submitter;
+        submitter.m_Device = &device;
+        submitter.m_Stream = StreamBuffer::Create(device, streamSize, framesInFlight);
+
+        return submitter;
+    }
+
+    void DrawSubmitter::BeginFrame() {
+        m_Stream->BeginFrame();
+    }
+
+    Renderer::SubmitStatistics DrawSubmitter::Record(const Renderer::DrawList &drawList, const MeshPool &meshPool,
+                                                     const std::span<const GLuint> programs,
+                                                     const BindFunction &bindResources) {
+        const std::span<const VkDrawIndexedIndirectCommand> commands  = drawList.GetCommands();
+        const std::span<const Renderer::InstanceData>       instances = drawList.GetInstances();
+
+        Renderer::SubmitStatistics statistics;
+        statistics.batches   = static_cast<uint32_t>(drawList.GetBatches().size());
+        statistics.commands  = static_cast<uint32_t>(commands.size());
+        statistics.instances = static_cast<uint32_t>(instances.size());
+
+        if (commands.empty()) {
+            return statistics;
+        }
+
+        // Checked up front so a bad draw list fails before anything is streamed or drawn.
+        for (const Renderer::DrawBatch &batch : drawList.GetBatches()) {
+            if (batch.pipeline >= programs.size()) {
+                throw std::runtime_error("Failed to record draws: Pipeline index out of range");
+            }
+        }
+
+        const DeviceCapabilities &capabilities = m_Device->GetCapabilities();
+        const DeviceFunctions &   functions    = m_Device->GetFunctions();
+        StateCache &              stateCache   = m_Device->GetStateCache();
+
+        const StreamAllocation instanceMemory = m_Stream->Allocate(static_cast<GLsizeiptr>(instances.size_bytes()));
+        std::memcpy(instanceMemory.data, instances.data(), instances.size_bytes());
+
+        StreamAllocation commandMemory;
+        if (capabilities.multiDrawIndirect) {
+            commandMemory = m_Stream->Allocate(static_cast<GLsizeiptr>(commands.size_bytes()));
+            std::memcpy(commandMemory.data, commands.data(), commands.size_bytes());
+        }
+
+        m_Stream->Flush();
+
+        meshPool.Bind();
+
+        // With base instance support the attribute points at the start and firstInstance selects the element.
+        BindInstances(instanceMemory.offset);
+
+        if (capabilities.multiDrawIndirect) {
+            stateCache.BindBuffer(GL_DRAW_INDIRECT_BUFFER, m_Stream->GetGlBuffer());
+        }
+
+        uint32_t boundPipeline      = ~0U;
+        uint32_t boundDescriptorSet = ~0U;
+
+        for (const Renderer::DrawBatch &batch : drawList.GetBatches()) {
+            if (batch.pipeline != boundPipeline) {
+                stateCache.UseProgram(programs[batch.pipeline]);
+                boundPipeline = batch.pipeline;
+            }
+
+            if (batch.descriptorSet != boundDescriptorSet && bindResources) {
+                bindResources(batch.descriptorSet);
+                boundDescriptorSet = batch.descriptorSet;
+            }
+
+            if (capabilities.multiDrawIndirect) {
+                functions.multiDrawElementsIndirect(
+                    GL_TRIANGLES, GL_UNSIGNED_INT,
+                    ToPointer(commandMemory.offset + batch.firstCommand * sizeof(DrawElementsIndirectCommand)),
+                    static_cast<GLsizei>(batch.commandCount), sizeof(DrawElementsIndirectCommand));
+                statistics.indirectCalls++;
+                continue;
+            }
+
+            for (uint32_t i = batch.firstCommand; i < batch.firstCommand + batch.commandCount; i++) {
+                const VkDrawIndexedIndirectCommand &command = commands[i];
+                const void *                        indices = ToPointer(command.firstIndex * sizeof(uint32_t));
+
+                if (capabilities.baseInstance) {
+                    functions.drawElementsInstancedBaseVertexBaseInstance(
+                        GL_TRIANGLES, static_cast<GLsizei>(command.indexCount), GL_UNSIGNED_INT, indices,
+                        static_cast<GLsizei>(command.instanceCount), command.vertexOffset, command.firstInstance);
+                } else {
+                    BindInstances(instanceMemory.offset + command.firstInstance * sizeof(Renderer::InstanceData));
+                    glDrawElementsInstancedBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(command.indexCount),
+                                                      GL_UNSIGNED_INT, indices,
+                                                      static_cast<GLsizei>(command.instanceCount),
+                                                      command.vertexOffset);
+                }
+            }
+        }
+
+        return statistics;
+    }
+
+    void DrawSubmitter::EndFrame() {
+        m_Stream->EndFrame();
+    }
+
+    const StreamBuffer &DrawSubmitter::GetStreamBuffer() const {
+        return *m_Stream;
+    }
+
+    void DrawSubmitter::BindInstances(const GLintptr offset) const {
+        m_Device->GetStateCache().BindBuffer(GL_ARRAY_BUFFER, m_Stream->GetGlBuffer());
+
+        glEnableVertexAttribArray(s_InstanceLocation);
+        glVertexAttribIPointer(s_InstanceLocation, 2, GL_UNSIGNED_INT, sizeof(Renderer::InstanceData),
+                               ToPointer(offset));
+        glVertexAttribDivisor(s_InstanceLocation, 1);
+    }
+}
@@ -0,0 +1,44 @@
+#ifndef PULSAR_GL_DRAWSUBMITTER_HPP
+#define PULSAR_GL_DRAWSUBMITTER_HPP
+
+#include <functional>
+
+#include "MeshPool.hpp"
+#include "StreamBuffer.hpp"
+
+namespace Pulsar::OpenGl {
+    // OpenGL counterpart of Renderer::DrawSubmitter. Streams a built DrawList's commands and instance data
+    // through a persistently mapped StreamBuffer and draws each batch with one glMultiDrawElementsIndirect.
+    // Without multi-draw-indirect it falls back to base-instance draws, and on plain 3.3 to re-pointing the
+    // instance attribute per command. Instance data is a uvec2 at location 3.
+    class DrawSubmitter {
+    public:
+        static constexpr GLuint s_InstanceLocation = 3;
+
+        // Called whenever a batch switches descriptor set, so the caller can bind textures and uniform buffers.
+        using BindFunction = std::function<void(uint32_t descriptorSet)>;
+
+        static DrawSubmitter Create(Device &device, GLsizeiptr streamSize = 4 * 1024 * 1024,
+                                    uint32_t framesInFlight = 3);
+
+        void BeginFrame();
+
+        Renderer::SubmitStatistics Record(const Renderer::DrawList &drawList, const MeshPool &meshPool,
+                                          std::span<const GLuint> programs, const BindFunction &bindResources = {});
+
+        // Fences the frame's stream region; call after the frame's last Record.
+        void EndFrame();
+
+        [[nodiscard]] const StreamBuffer &GetStreamBuffer() const;
+
+    private:
+        Device *                    m_Device = nullptr;
+        std::optional<StreamBuffer> m_Stream;
+
+        DrawSubmitter() = default;
+
+        void BindInstances(GLintptr offset) const;
+    };
+}
+
+#endif //PULSAR_GL_DRAWSUBMITTER_HPP
@@ -0,0 +1,194 @@
+#include "MeshPool.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+#include "Mesh/GpuMesh.hpp"
+
+namespace Pulsar::OpenGl {
+    struct AttributeFormat {
+        GLint     size       = 0;
+        GLenum    type       = 0;
+        GLboolean normalized = GL_FALSE;
+    };
+
+    static AttributeFormat GetAttributeFormat(const VkFormat format) {
+        switch (format) {
+            case VK_FORMAT_R16G16B16A16_SNORM: return {4, GL_SHORT, GL_TRUE};
+            case VK_FORMAT_R16G16_SNORM: return {2, GL_SHORT, GL_TRUE};
+            case VK_FORMAT_R16G16_SFLOAT: return {2, GL_HALF_FLOAT, GL_FALSE};
+            case VK_FORMAT_R32G32B32_SFLOAT: return {3, GL_FLOAT, GL_FALSE};
+            case VK_FORMAT_R32G32_SFLOAT: return {2, GL_FLOAT, GL_FALSE};
+            default: throw std::runtime_error("Failed to create mesh pool: Unsupported vertex format");
+        }
+    }
+
+    MeshPool MeshPool::Create(Device &device, const uint32_t vertexCapacity, const uint32_t indexCapacity,
+                              const uint32_t meshCapacity) {
+        if (meshCapacity > 1U << Renderer::g_DrawKeyMeshBits) {
+            throw std::runtime_error("Failed to create mesh pool: Mesh capacity exceeds draw key range");
+        }
+
+        StateCache &stateCache = device.GetStateCache();
+
+        MeshPool pool;
+        pool.m_Device         = &device;
+        pool.m_VertexCapacity = vertexCapacity;
+        pool.m_IndexCapacity  = indexCapacity;
+        pool.m_MeshCapacity   = meshCapacity;
+        pool.m_Ranges.reserve(meshCapacity);
+
+        glGenVertexArrays(1, &pool.m_VertexArray);
+        glGenBuffers(1, &pool.m_VertexBuffer);
+        glGenBuffers(1, &pool.m_IndexBuffer);
+        glGenBuffers(1, &pool.m_BoundsBuffer);
+        glGenTextures(1, &pool.m_BoundsTexture);
+
+        stateCache.BindVertexArray(pool.m_VertexArray);
+
+        stateCache.BindBuffer(GL_ARRAY_BUFFER, pool.m_VertexBuffer);
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCapacity) * sizeof(Mesh::PackedVertex), nullptr,
+                     GL_STATIC_DRAW);
+
+        stateCache.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, pool.m_IndexBuffer);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indexCapacity) * sizeof(uint32_t), nullptr,
+                     GL_STATIC_DRAW);
+
+        const Vulkan::VertexLayout layout = Mesh::GpuMesh::GetVertexLayout();
+
+        for (const Vulkan::VertexAttribute &attribute : layout.attributes) {
+            const AttributeFormat format = GetAttributeFormat(attribute.format);
+
+            glEnableVertexAttribArray(attribute.location);
+            glVertexAttribPointer(attribute.location, format.size, format.type, format.normalized,
+                                  static_cast<GLsizei>(layout.stride),
+                                  reinterpret_cast<const void *>(static_cast<uintptr_t>(attribute.offset)));
+        }
+
+        stateCache.BindBuffer(GL_COPY_WRITE_BUFFER, pool.m_BoundsBuffer);
+        glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(meshCapacity) * sizeof(Mesh::MeshBounds),
+                     nullptr, GL_STATIC_DRAW);
+
+        glBindTexture(GL_TEXTURE_BUFFER, pool.m_BoundsTexture);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, pool.m_BoundsBuffer);
+        glBindTexture(GL_TEXTURE_BUFFER, 0);
+
+        return pool;
+    }
+
+    MeshPool::~MeshPool() {
+        Destroy();
+    }
+
+    MeshPool::MeshPool(MeshPool &&other) noexcept
+        : m_Device(other.m_Device),
+          m_VertexArray(std::exchange(other.m_VertexArray, 0)),
+          m_VertexBuffer(std::exchange(other.m_VertexBuffer, 0)),
+          m_IndexBuffer(std::exchange(other.m_IndexBuffer, 0)),
+          m_BoundsBuffer(std::exchange(other.m_BoundsBuffer, 0)),
+          m_BoundsTexture(std::exchange(other.m_BoundsTexture, 0)),
+          m_VertexCapacity(std::exchange(other.m_VertexCapacity, 0)),
+          m_IndexCapacity(std::exchange(other.m_IndexCapacity, 0)),
+          m_MeshCapacity(std::exchange(other.m_MeshCapacity, 0)),
+          m_Ranges(std::move(other.m_Ranges)),
+          m_VertexCount(std::exchange(other.m_VertexCount, 0)),
+          m_IndexCount(std::exchange(other.m_IndexCount, 0)) {
+    }
+
+    MeshPool &MeshPool::operator=(MeshPool &&other) noexcept {
+        if (this != &other) {
+            Destroy();
+
+            m_Device         = other.m_Device;
+            m_VertexArray    = std::exchange(other.m_VertexArray, 0);
+            m_VertexBuffer   = std::exchange(other.m_VertexBuffer, 0);
+            m_IndexBuffer    = std::exchange(other.m_IndexBuffer, 0);
+            m_BoundsBuffer   = std::exchange(other.m_BoundsBuffer, 0);
+            m_BoundsTexture  = std::exchange(other.m_BoundsTexture, 0);
+            m_VertexCapacity = std::exchange(other.m_VertexCapacity, 0);
+            m_IndexCapacity  = std::exchange(other.m_IndexCapacity, 0);
+            m_MeshCapacity   = std::exchange(other.m_MeshCapacity, 0);
+            m_Ranges         = std::move(other.m_Ranges);
+            m_VertexCount    = std::exchange(other.m_VertexCount, 0);
+            m_IndexCount     = std::exchange(other.m_IndexCount, 0);
+        }
+
+        return *this;
+    }
+
+    uint32_t MeshPool::Add(const Mesh::QuantizedMesh &mesh) {
+        if (m_VertexCount + mesh.vertices.size() > m_VertexCapacity ||
+            m_IndexCount + mesh.indices.size() > m_IndexCapacity || m_Ranges.size() >= m_MeshCapacity) {
+            throw std::runtime_error("Failed to add mesh: Mesh pool is full");
+        }
+
+        const Mesh::MeshBounds bounds = {
+            {mesh.boundsCenter[0], mesh.boundsCenter[1], mesh.boundsCenter[2], 0.0F},
+            {mesh.boundsExtent[0], mesh.boundsExtent[1], mesh.boundsExtent[2], 0.0F}
+        };
+
+        // Uploading through COPY_WRITE leaves the vertex array's element binding alone.
+        StateCache &stateCache = m_Device->GetStateCache();
+
+        stateCache.BindBuffer(GL_COPY_WRITE_BUFFER, m_VertexBuffer);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(m_VertexCount) * sizeof(Mesh::PackedVertex),
+                        static_cast<GLsizeiptr>(std::span(mesh.vertices).size_bytes()), mesh.vertices.data());
+
+        stateCache.BindBuffer(GL_COPY_WRITE_BUFFER, m_IndexBuffer);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(m_IndexCount) * sizeof(uint32_t),
+                        static_cast<GLsizeiptr>(std::span(mesh.indices).size_bytes()), mesh.indices.data());
+
+        stateCache.BindBuffer(GL_COPY_WRITE_BUFFER, m_BoundsBuffer);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(m_Ranges.size() * sizeof(Mesh::MeshBounds)),
+                        sizeof(Mesh::MeshBounds), &bounds);
+
+        m_Ranges.push_back({
+            m_IndexCount, static_cast<uint32_t>(mesh.indices.size()), static_cast<int32_t>(m_VertexCount)
+        });
+
+        m_VertexCount += static_cast<uint32_t>(mesh.vertices.size());
+        m_IndexCount += static_cast<uint32_t>(mesh.indices.size());
+
+        return static_cast<uint32_t>(m_Ranges.size() - 1);
+    }
+
+    void MeshPool::Bind() const {
+        m_Device->GetStateCache().BindVertexArray(m_VertexArray);
+    }
+
+    std::span<const Renderer::MeshRange> MeshPool::GetRanges() const {
+        return m_Ranges;
+    }
+
+    GLuint MeshPool::GetVertexArray() const {
+        return m_VertexArray;
+    }
+
+    GLuint MeshPool::GetBoundsTexture() const {
+        return m_BoundsTexture;
+    }
+
+    uint32_t MeshPool::GetMeshCount() const {
+        return static_cast<uint32_t>(m_Ranges.size());
+    }
+
+    void MeshPool::Destroy() {
+        if (m_VertexArray == 0) {
+            return;
+        }
+
+        StateCache &stateCache = m_Device->GetStateCache();
+        stateCache.ForgetVertexArray(m_VertexArray);
+        stateCache.ForgetBuffer(m_VertexBuffer);
+        stateCache.ForgetBuffer(m_IndexBuffer);
+        stateCache.ForgetBuffer(m_BoundsBuffer);
+
+        const std::array buffers = {m_VertexBuffer, m_IndexBuffer, m_BoundsBuffer};
+
+        glDeleteTextures(1, &m_BoundsTexture);
+        glDeleteBuffers(static_cast<GLsizei>(buffers.size()), buffers.data());
+        glDeleteVertexArrays(1, &m_VertexArray);
+
+        m_VertexArray = 0;
+    }
+}
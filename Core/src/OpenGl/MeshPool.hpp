@@ -0,0 +1,57 @@
+#ifndef PULSAR_GL_MESHPOOL_HPP
+#define PULSAR_GL_MESHPOOL_HPP
+
+#include "Device.hpp"
+#include "Mesh/MeshData.hpp"
+#include "Renderer/DrawList.hpp"
+
+namespace Pulsar::OpenGl {
+    // OpenGL counterpart of Renderer::MeshPool. One vertex array holds the shared vertex and index buffers with
+    // the GpuMesh vertex layout; the instance attribute is pointed at the stream buffer by the DrawSubmitter.
+    // Bounds live in an RGBA32F buffer texture: texelFetch(bounds, mesh * 2) is the center, + 1 the extent.
+    class MeshPool {
+    public:
+        static MeshPool Create(Device &device, uint32_t vertexCapacity, uint32_t indexCapacity,
+                               uint32_t meshCapacity);
+
+        ~MeshPool();
+
+        MeshPool(const MeshPool &other) = delete;
+
+        MeshPool(MeshPool &&other) noexcept;
+
+        MeshPool &operator=(const MeshPool &other) = delete;
+
+        MeshPool &operator=(MeshPool &&other) noexcept;
+
+        // Returns the mesh index used in draw keys.
+        uint32_t Add(const Mesh::QuantizedMesh &mesh);
+
+        void Bind() const;
+
+        [[nodiscard]] std::span<const Renderer::MeshRange> GetRanges() const;
+        [[nodiscard]] GLuint                               GetVertexArray() const;
+        [[nodiscard]] GLuint                               GetBoundsTexture() const;
+        [[nodiscard]] uint32_t                             GetMeshCount() const;
+
+    private:
+        Device *                         m_Device         = nullptr;
+        GLuint                           m_VertexArray    = 0;
+        GLuint                           m_VertexBuffer   = 0;
+        GLuint                           m_IndexBuffer    = 0;
+        GLuint                           m_BoundsBuffer   = 0;
+        GLuint                           m_BoundsTexture  = 0;
+        uint32_t                         m_VertexCapacity = 0;
+        uint32_t                         m_IndexCapacity  = 0;
+        uint32_t                         m_MeshCapacity   = 0;
+        std::vector<Renderer::MeshRange> m_Ranges;
+        uint32_t                         m_VertexCount = 0;
+        uint32_t                         m_IndexCount  = 0;
+
+        MeshPool() = default;
+
+        void Destroy();
+    };
+}
+
+#endif //PULSAR_GL_MESHPOOL_HPP
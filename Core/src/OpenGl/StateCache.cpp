@@ -0,0 +1,120 @@
+#include "StateCache.hpp"
+
+#include <algorithm>
+
+namespace Pulsar::OpenGl {
+    void StateCache::UseProgram(const GLuint program) {
+        if (Update(m_Program, program)) {
+            glUseProgram(program);
+        }
+    }
+
+    void StateCache::BindVertexArray(const GLuint vertexArray) {
+        if (Update(m_VertexArray, vertexArray)) {
+            glBindVertexArray(vertexArray);
+        }
+    }
+
+    void StateCache::BindBuffer(const GLenum target, const GLuint buffer) {
+        const int slot = GetBufferSlot(target);
+
+        if (slot < 0) {
+            m_Stats.calls++;
+            glBindBuffer(target, buffer);
+            return;
+        }
+
+        if (Update(m_Buffers[slot], buffer)) {
+            glBindBuffer(target, buffer);
+        }
+    }
+
+    void StateCache::SetEnabled(const GLenum capability, const bool enabled) {
+        const int slot = GetCapabilitySlot(capability);
+
+        if (slot >= 0 && !Update(m_Enabled[slot], enabled ? 1 : 0)) {
+            return;
+        }
+
+        if (slot < 0) {
+            m_Stats.calls++;
+        }
+
+        if (enabled) {
+            glEnable(capability);
+        } else {
+            glDisable(capability);
+        }
+    }
+
+    void StateCache::SetViewport(const GLint x, const GLint y, const GLsizei width, const GLsizei height) {
+        const std::array<GLint, 4> viewport = {x, y, width, height};
+
+        if (viewport == m_Viewport) {
+            m_Stats.skipped++;
+            return;
+        }
+
+        m_Stats.calls++;
+        m_Viewport = viewport;
+        glViewport(x, y, width, height);
+    }
+
+    void StateCache::Invalidate() {
+        m_Program     = s_Unknown;
+        m_VertexArray = s_Unknown;
+        m_Buffers     = MakeUnknown<BufferSlotCount>();
+        m_Enabled     = MakeUnknown<CapabilitySlotCount>();
+        m_Viewport    = {-1, -1, -1, -1};
+    }
+
+    void StateCache::ForgetBuffer(const GLuint buffer) {
+        std::ranges::replace(m_Buffers, buffer, s_Unknown);
+    }
+
+    void StateCache::ForgetVertexArray(const GLuint vertexArray) {
+        if (m_VertexArray == vertexArray) {
+            m_VertexArray = s_Unknown;
+        }
+    }
+
+    const StateCacheStats &StateCache::GetStats() const {
+        return m_Stats;
+    }
+
+    void StateCache::ResetStats() {
+        m_Stats = {};
+    }
+
+    int StateCache::GetBufferSlot(const GLenum target) {
+        switch (target) {
+            case GL_ARRAY_BUFFER: return ArrayBufferSlot;
+            case GL_DRAW_INDIRECT_BUFFER: return DrawIndirectBufferSlot;
+            case GL_UNIFORM_BUFFER: return UniformBufferSlot;
+            case GL_COPY_READ_BUFFER: return CopyReadBufferSlot;
+            case GL_COPY_WRITE_BUFFER: return CopyWriteBufferSlot;
+            default: return -1;
+        }
+    }
+
+    int StateCache::GetCapabilitySlot(const GLenum capability) {
+        switch (capability) {
+            case GL_DEPTH_TEST: return DepthTestSlot;
+            case GL_CULL_FACE: return CullFaceSlot;
+            case GL_BLEND: return BlendSlot;
+            case GL_SCISSOR_TEST: return ScissorTestSlot;
+            default: return -1;
+        }
+    }
+
+    bool StateCache::Update(GLuint &cached, const GLuint value) {
+        if (cached == value) {
+            m_Stats.skipped++;
+            return false;
+        }
+
+        m_Stats.calls++;
+        cached = value;
+        return true;
+    }
+}
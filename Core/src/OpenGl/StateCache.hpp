@@ -0,0 +1,78 @@
+#ifndef PULSAR_GL_STATECACHE_HPP
+#define PULSAR_GL_STATECACHE_HPP
+
+#include <array>
+#include <cstdint>
+
+#include "Common.hpp"
+
+namespace Pulsar::OpenGl {
+    struct StateCacheStats {
+        uint64_t calls   = 0;
+        uint64_t skipped = 0;
+    };
+
+    // Shadows the bindings the renderer changes most and drops calls that would not change anything.
+    // Anything that touches GL state behind its back must call Invalidate afterwards.
+    class StateCache {
+    public:
+        void UseProgram(GLuint program);
+        void BindVertexArray(GLuint vertexArray);
+
+        // GL_ELEMENT_ARRAY_BUFFER is vertex array state and always passes through.
+        void BindBuffer(GLenum target, GLuint buffer);
+
+        void SetEnabled(GLenum capability, bool enabled);
+        void SetViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+
+        void Invalidate();
+
+        // GL unbinds deleted objects and may hand their names out again, so owners call these before deleting.
+        void ForgetBuffer(GLuint buffer);
+        void ForgetVertexArray(GLuint vertexArray);
+
+        [[nodiscard]] const StateCacheStats &GetStats() const;
+        void                                 ResetStats();
+
+    private:
+        static constexpr GLuint s_Unknown = ~0U;
+
+        enum BufferSlot : uint8_t {
+            ArrayBufferSlot,
+            DrawIndirectBufferSlot,
+            UniformBufferSlot,
+            CopyReadBufferSlot,
+            CopyWriteBufferSlot,
+            BufferSlotCount
+        };
+
+        enum CapabilitySlot : uint8_t {
+            DepthTestSlot,
+            CullFaceSlot,
+            BlendSlot,
+            ScissorTestSlot,
+            CapabilitySlotCount
+        };
+
+        GLuint                                   m_Program     = s_Unknown;
+        GLuint                                   m_VertexArray = s_Unknown;
+        std::array<GLuint, BufferSlotCount>      m_Buffers     = MakeUnknown<BufferSlotCount>();
+        std::array<GLuint, CapabilitySlotCount>  m_Enabled     = MakeUnknown<CapabilitySlotCount>();
+        std::array<GLint, 4>                     m_Viewport    = {-1, -1, -1, -1};
+        StateCacheStats                          m_Stats;
+
+        template<size_t Count>
+        static constexpr std::array<GLuint, Count> MakeUnknown() {
+            std::array<GLuint, Count> values{};
+            values.fill(s_Unknown);
+            return values;
+        }
+
+        static int GetBufferSlot(GLenum target);
+        static int GetCapabilitySlot(GLenum capability);
+
+        bool Update(GLuint &cached, GLuint value);
+    };
+}
+
+#endif //PULSAR_GL_STATECACHE_HPP
@@ -0,0 +1,200 @@
+#include "StreamBuffer.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+namespace Pulsar::OpenGl {
+    static constexpr GLsizeiptr s_RegionAlignment = 256;
+    static constexpr GLuint64   s_FenceTimeout    = 1'000'000'000;
+
+    StreamBuffer StreamBuffer::Create(Device &device, const GLsizeiptr frameSize, const uint32_t framesInFlight) {
+        if (frameSize <= 0 || framesInFlight == 0) {
+            throw std::runtime_error("Failed to create stream buffer: Size and frame count must be non-zero");
+        }
+
+        StreamBuffer buffer;
+        buffer.m_Device    = &device;
+        buffer.m_FrameSize = (frameSize + s_RegionAlignment - 1) / s_RegionAlignment * s_RegionAlignment;
+        buffer.m_Fences.resize(framesInFlight, nullptr);
+        buffer.m_Frame = framesInFlight - 1;
+
+        glGenBuffers(1, &buffer.m_Buffer);
+        device.GetStateCache().BindBuffer(GL_COPY_WRITE_BUFFER, buffer.m_Buffer);
+
+        if (device.GetCapabilities().bufferStorage) {
+            const GLsizeiptr size  = buffer.m_FrameSize * framesInFlight;
+            const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+            device.GetFunctions().bufferStorage(GL_COPY_WRITE_BUFFER, size, nullptr, flags);
+            buffer.m_Mapped = static_cast<std::byte *>(glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, size, flags));
+
+            if (buffer.m_Mapped == nullptr) {
+                throw std::runtime_error("Failed to create stream buffer: Could not map buffer persistently");
+            }
+        } else {
+            // Only one region is needed; orphaning gives the driver a fresh allocation every frame.
+            glBufferData(GL_COPY_WRITE_BUFFER, buffer.m_FrameSize, nullptr, GL_STREAM_DRAW);
+            buffer.m_Staging.resize(buffer.m_FrameSize);
+        }
+
+        return buffer;
+    }
+
+    StreamBuffer::~StreamBuffer() {
+        Destroy();
+    }
+
+    StreamBuffer::StreamBuffer(StreamBuffer &&other) noexcept
+        : m_Device(other.m_Device),
+          m_Buffer(std::exchange(other.m_Buffer, 0)),
+          m_FrameSize(std::exchange(other.m_FrameSize, 0)),
+          m_Mapped(std::exchange(other.m_Mapped, nullptr)),
+          m_Staging(std::move(other.m_Staging)),
+          m_Fences(std::move(other.m_Fences)),
+          m_Frame(std::exchange(other.m_Frame, 0)),
+          m_Head(std::exchange(other.m_Head, 0)),
+          m_FlushedHead(std::exchange(other.m_FlushedHead, 0)),
+          m_StallCount(std::exchange(other.m_StallCount, 0)) {
+    }
+
+    StreamBuffer &StreamBuffer::operator=(StreamBuffer &&other) noexcept {
+        if (this != &other) {
+            Destroy();
+
+            m_Device      = other.m_Device;
+            m_Buffer      = std::exchange(other.m_Buffer, 0);
+            m_FrameSize   = std::exchange(other.m_FrameSize, 0);
+            m_Mapped      = std::exchange(other.m_Mapped, nullptr);
+            m_Staging     = std::move(other.m_Staging);
+            m_Fences      = std::move(other.m_Fences);
+            m_Frame       = std::exchange(other.m_Frame, 0);
+            m_Head        = std::exchange(other.m_Head, 0);
+            m_FlushedHead = std::exchange(other.m_FlushedHead, 0);
+            m_StallCount  = std::exchange(other.m_StallCount, 0);
+        }
+
+        return *this;
+    }
+
+    void StreamBuffer::BeginFrame() {
+        m_Frame       = (m_Frame + 1) % static_cast<uint32_t>(m_Fences.size());
+        m_Head        = 0;
+        m_FlushedHead = 0;
+
+        if (m_Mapped != nullptr) {
+            WaitForRegion(m_Frame);
+            return;
+        }
+
+        m_Device->GetStateCache().BindBuffer(GL_COPY_WRITE_BUFFER, m_Buffer);
+        glBufferData(GL_COPY_WRITE_BUFFER, m_FrameSize, nullptr, GL_STREAM_DRAW);
+    }
+
+    StreamAllocation StreamBuffer::Allocate(const GLsizeiptr size, const GLsizeiptr alignment) {
+        const GLsizeiptr offset = (m_Head + alignment - 1) / alignment * alignment;
+
+        if (offset + size > m_FrameSize) {
+            throw std::runtime_error("Failed to allocate stream memory: Frame region is full");
+        }
+
+        m_Head = offset + size;
+
+        if (m_Mapped != nullptr) {
+            const GLsizeiptr regionOffset = static_cast<GLsizeiptr>(m_Frame) * m_FrameSize + offset;
+            return {m_Mapped + regionOffset, regionOffset};
+        }
+
+        return {m_Staging.data() + offset, offset};
+    }
+
+    void StreamBuffer::Flush() {
+        // Coherent persistent mappings need no flush; the fence in EndFrame orders the writes.
+        if (m_Mapped != nullptr || m_FlushedHead == m_Head) {
+            return;
+        }
+
+        m_Device->GetStateCache().BindBuffer(GL_COPY_WRITE_BUFFER, m_Buffer);
+        glBufferSubData(GL_COPY_WRITE_BUFFER, m_FlushedHead, m_Head - m_FlushedHead,
+                        m_Staging.data() + m_FlushedHead);
+        m_FlushedHead = m_Head;
+    }
+
+    void StreamBuffer::EndFrame() {
+        if (m_Mapped == nullptr) {
+            Flush();
+            return;
+        }
+
+        // A second EndFrame for the same region, e.g. after a failed Record is retried, replaces its fence.
+        GLsync &fence = m_Fences[m_Frame];
+        if (fence != nullptr) {
+            glDeleteSync(fence);
+        }
+
+        fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    GLuint StreamBuffer::GetGlBuffer() const {
+        return m_Buffer;
+    }
+
+    GLsizeiptr StreamBuffer::GetFrameSize() const {
+        return m_FrameSize;
+    }
+
+    bool StreamBuffer::IsPersistent() const {
+        return m_Mapped != nullptr;
+    }
+
+    uint64_t StreamBuffer::GetStallCount() const {
+        return m_StallCount;
+    }
+
+    void StreamBuffer::Destroy() {
+        if (m_Buffer == 0) {
+            return;
+        }
+
+        for (GLsync &fence : m_Fences) {
+            if (fence != nullptr) {
+                glDeleteSync(std::exchange(fence, nullptr));
+            }
+        }
+
+        StateCache &stateCache = m_Device->GetStateCache();
+
+        if (m_Mapped != nullptr) {
+            stateCache.BindBuffer(GL_COPY_WRITE_BUFFER, m_Buffer);
+            glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+            m_Mapped = nullptr;
+        }
+
+        stateCache.ForgetBuffer(m_Buffer);
+        glDeleteBuffers(1, &m_Buffer);
+        m_Buffer = 0;
+    }
+
+    void StreamBuffer::WaitForRegion(const uint32_t frame) {
+        GLsync &fence = m_Fences[frame];
+
+        if (fence == nullptr) {
+            return;
+        }
+
+        GLenum result = glClientWaitSync(fence, 0, 0);
+
+        if (result == GL_TIMEOUT_EXPIRED) {
+            m_StallCount++;
+
+            do {
+                result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, s_FenceTimeout);
+            } while (result == GL_TIMEOUT_EXPIRED);
+        }
+
+        glDeleteSync(std::exchange(fence, nullptr));
+
+        if (result == GL_WAIT_FAILED) {
+            throw std::runtime_error("Failed to wait for stream buffer: Fence wait failed");
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#ifndef PULSAR_GL_STREAMBUFFER_HPP
+#define PULSAR_GL_STREAMBUFFER_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include "Device.hpp"
+
+namespace Pulsar::OpenGl {
+    struct StreamAllocation {
+        std::byte *data   = nullptr;
+        GLintptr   offset = 0;
+    };
+
+    // Ring of framesInFlight regions for per-frame data. With buffer storage the buffer is mapped persistently
+    // and coherently once, and each region is guarded by a fence that BeginFrame waits on before reusing it.
+    // Without it, writes go to a staging copy that Flush uploads into an orphaned buffer.
+    class StreamBuffer {
+    public:
+        static StreamBuffer Create(Device &device, GLsizeiptr frameSize, uint32_t framesInFlight = 3);
+
+        ~StreamBuffer();
+
+        StreamBuffer(const StreamBuffer &other) = delete;
+
+        StreamBuffer(StreamBuffer &&other) noexcept;
+
+        StreamBuffer &operator=(const StreamBuffer &other) = delete;
+
+        StreamBuffer &operator=(StreamBuffer &&other) noexcept;
+
+        void BeginFrame();
+
+        // Offsets are relative to the start of the buffer, so they can be passed straight to GL as pointers.
+        StreamAllocation Allocate(GLsizeiptr size, GLsizeiptr alignment = 16);
+
+        // Makes everything allocated so far visible to GL. Must be called before the draws that read it.
+        void Flush();
+
+        void EndFrame();
+
+        [[nodiscard]] GLuint     GetGlBuffer() const;
+        [[nodiscard]] GLsizeiptr GetFrameSize() const;
+        [[nodiscard]] bool       IsPersistent() const;
+
+        // Number of times BeginFrame had to block because the GPU still read the region.
+        [[nodiscard]] uint64_t GetStallCount() const;
+
+    private:
+        Device *               m_Device       = nullptr;
+        GLuint                 m_Buffer       = 0;
+        GLsizeiptr             m_FrameSize    = 0;
+        std::byte *            m_Mapped       = nullptr;
+        std::vector<std::byte> m_Staging;
+        std::vector<GLsync>    m_Fences;
+        uint32_t               m_Frame        = 0;
+        GLsizeiptr             m_Head         = 0;
+        GLsizeiptr             m_FlushedHead  = 0;
+        uint64_t               m_StallCount   = 0;
+
+        StreamBuffer() = default;
+
+        void Destroy();
+
+        void WaitForRegion(uint32_t frame);
+    };
+}
+
+#endif //PULSAR_GL_STREAMBUFFER_HPP
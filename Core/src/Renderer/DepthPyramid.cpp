@@ -0,0 +1,300 @@
+#include "DepthPyramid.hpp"
+
+namespace Pulsar::Renderer {
+    static constexpr uint32_t s_GroupSize = 8;
+
+    static constexpr auto s_ReduceShader = R"(
+#version 450
+
+layout(local_size_x = 8, local_size_y = 8) in;
+
+layout(binding = 0) uniform sampler2D source;
+layout(binding = 1, r32f) uniform writeonly image2D destination;
+
+layout(push_constant) uniform Sizes {
+    uvec2 sourceSize;
+    uvec2 destinationSize;
+} sizes;
+
+void main() {
+    uvec2 position = gl_GlobalInvocationID.xy;
+    if (any(greaterThanEqual(position, sizes.destinationSize))) {
+        return;
+    }
+
+    // Every level is at least half the size of its source, so the footprint is never more than 3x3 texels.
+    uvec2 begin = position * sizes.sourceSize / sizes.destinationSize;
+    uvec2 end   = min(((position + 1u) * sizes.sourceSize + sizes.destinationSize - 1u) / sizes.destinationSize,
+                      sizes.sourceSize);
+
+    float depth = 0.0;
+    for (uint y = begin.y; y < end.y; y++) {
+        for (uint x = begin.x; x < end.x; x++) {
+            depth = max(depth, texelFetch(source, ivec2(x, y), 0).r);
+        }
+    }
+
+    imageStore(destination, ivec2(position), vec4(depth));
+}
+)";
+
+    struct ReduceSizes {
+        std::array<uint32_t, 2> sourceSize;
+        std::array<uint32_t, 2> destinationSize;
+    };
+
+    static uint32_t PreviousPowerOfTwo(const uint32_t value) {
+        uint32_t result = 1;
+        while (result * 2 <= value) {
+            result *= 2;
+        }
+
+        return result;
+    }
+
+    DepthPyramid DepthPyramid::Create(Vulkan::Device &device, const VkImageView depthView,
+                                      const VkExtent2D depthExtent) {
+        const VkExtent2D extent = {PreviousPowerOfTwo(depthExtent.width), PreviousPowerOfTwo(depthExtent.height)};
+
+        uint32_t levelCount = 1;
+        while (std::max(extent.width, extent.height) >> levelCount != 0) {
+            levelCount++;
+        }
+
+        Vulkan::ImageConfig imageConfig;
+        imageConfig.extent    = extent;
+        imageConfig.format    = VK_FORMAT_R32_SFLOAT;
+        imageConfig.mipLevels = levelCount;
+        imageConfig.usage     = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_STORAGE_BIT;
+        imageConfig.mipViews  = true;
+
+        std::array<VkDescriptorSetLayoutBinding, 2> bindings{};
+        bindings[0] = {0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr};
+        bindings[1] = {1, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr};
+
+        VkDescriptorSetLayoutCreateInfo setLayoutInfo{};
+        setLayoutInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        setLayoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+        setLayoutInfo.pBindings    = bindings.data();
+
+        VkDescriptorSetLayout setLayout;
+        if (vkCreateDescriptorSetLayout(device.GetVkLogicalDevice(), &setLayoutInfo, nullptr, &setLayout) !=
+            VK_SUCCESS) {
+            throw std::runtime_error("Failed to create depth pyramid: Could not create descriptor set layout");
+        }
+
+        Vulkan::ComputePipelineConfig pipelineConfig;
+        pipelineConfig.descriptorSetLayouts = {setLayout};
+        pipelineConfig.pushConstantRanges   = {{VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(ReduceSizes)}};
+
+        std::optional<DepthPyramid> created;
+        try {
+            created.emplace(DepthPyramid(Vulkan::Image::Create(device, imageConfig),
+                                         Vulkan::Pipeline::CreateCompute(device, s_ReduceShader, pipelineConfig)));
+        } catch (...) {
+            vkDestroyDescriptorSetLayout(device.GetVkLogicalDevice(), setLayout, nullptr);
+            throw;
+        }
+
+        DepthPyramid pyramid = std::move(*created);
+        pyramid.m_Device      = &device;
+        pyramid.m_SetLayout   = setLayout;
+        pyramid.m_DepthExtent = depthExtent;
+
+        VkSamplerCreateInfo samplerInfo{};
+        samplerInfo.sType        = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+        samplerInfo.magFilter    = VK_FILTER_NEAREST;
+        samplerInfo.minFilter    = VK_FILTER_NEAREST;
+        samplerInfo.mipmapMode   = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+        samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        samplerInfo.maxLod       = static_cast<float>(levelCount);
+
+        if (vkCreateSampler(device.GetVkLogicalDevice(), &samplerInfo, nullptr, &pyramid.m_Sampler) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create depth pyramid: Could not create sampler");
+        }
+
+        const std::array<VkDescriptorPoolSize, 2> poolSizes = {
+            VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, levelCount},
+            VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, levelCount}
+        };
+
+        VkDescriptorPoolCreateInfo poolInfo{};
+        poolInfo.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolInfo.maxSets       = levelCount;
+        poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+        poolInfo.pPoolSizes    = poolSizes.data();
+
+        if (vkCreateDescriptorPool(device.GetVkLogicalDevice(), &poolInfo, nullptr, &pyramid.m_DescriptorPool) !=
+            VK_SUCCESS) {
+            throw std::runtime_error("Failed to create depth pyramid: Could not create descriptor pool");
+        }
+
+        const std::vector<VkDescriptorSetLayout> setLayouts(levelCount, setLayout);
+
+        VkDescriptorSetAllocateInfo allocateInfo{};
+        allocateInfo.sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocateInfo.descriptorPool     = pyramid.m_DescriptorPool;
+        allocateInfo.descriptorSetCount = levelCount;
+        allocateInfo.pSetLayouts        = setLayouts.data();
+
+        pyramid.m_DescriptorSets.resize(levelCount);
+        if (vkAllocateDescriptorSets(device.GetVkLogicalDevice(), &allocateInfo, pyramid.m_DescriptorSets.data()) !=
+            VK_SUCCESS) {
+            throw std::runtime_error("Failed to create depth pyramid: Could not allocate descriptor sets");
+        }
+
+        for (uint32_t level = 0; level < levelCount; level++) {
+            const VkDescriptorImageInfo sourceInfo = {
+                pyramid.m_Sampler,
+                level == 0 ? depthView : pyramid.m_Image.GetVkMipView(level - 1),
+                level == 0 ? VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_GENERAL
+            };
+            const VkDescriptorImageInfo destinationInfo = {
+                nullptr, pyramid.m_Image.GetVkMipView(level), VK_IMAGE_LAYOUT_GENERAL
+            };
+
+            std::array<VkWriteDescriptorSet, 2> writes{};
+            writes[0].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writes[0].dstSet          = pyramid.m_DescriptorSets[level];
+            writes[0].dstBinding      = 0;
+            writes[0].descriptorCount = 1;
+            writes[0].descriptorType  = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            writes[0].pImageInfo      = &sourceInfo;
+
+            writes[1].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writes[1].dstSet          = pyramid.m_DescriptorSets[level];
+            writes[1].dstBinding      = 1;
+            writes[1].descriptorCount = 1;
+            writes[1].descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+            writes[1].pImageInfo      = &destinationInfo;
+
+            vkUpdateDescriptorSets(device.GetVkLogicalDevice(), static_cast<uint32_t>(writes.size()), writes.data(), 0,
+                                   nullptr);
+        }
+
+        return pyramid;
+    }
+
+    DepthPyramid::~DepthPyramid() {
+        Destroy();
+    }
+
+    DepthPyramid::DepthPyramid(DepthPyramid &&other) noexcept
+        : m_Image(std::move(other.m_Image)),
+          m_ReducePipeline(std::move(other.m_ReducePipeline)),
+          m_SetLayout(std::exchange(other.m_SetLayout, nullptr)),
+          m_DescriptorPool(std::exchange(other.m_DescriptorPool, nullptr)),
+          m_Sampler(std::exchange(other.m_Sampler, nullptr)),
+          m_DescriptorSets(std::move(other.m_DescriptorSets)),
+          m_DepthExtent(other.m_DepthExtent),
+          m_Device(std::exchange(other.m_Device, nullptr)) {
+    }
+
+    DepthPyramid &DepthPyramid::operator=(DepthPyramid &&other) noexcept {
+        if (this != &other) {
+            Destroy();
+
+            m_Image          = std::move(other.m_Image);
+            m_ReducePipeline = std::move(other.m_ReducePipeline);
+            m_SetLayout      = std::exchange(other.m_SetLayout, nullptr);
+            m_DescriptorPool = std::exchange(other.m_DescriptorPool, nullptr);
+            m_Sampler        = std::exchange(other.m_Sampler, nullptr);
+            m_DescriptorSets = std::move(other.m_DescriptorSets);
+            m_DepthExtent    = other.m_DepthExtent;
+            m_Device         = std::exchange(other.m_Device, nullptr);
+        }
+
+        return *this;
+    }
+
+    void DepthPyramid::Build(const VkCommandBuffer commandBuffer) const {
+        const uint32_t levelCount = m_Image.GetMipLevels();
+
+        VkImageMemoryBarrier barrier{};
+        barrier.sType                       = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.srcAccessMask               = VK_ACCESS_SHADER_READ_BIT;
+        barrier.dstAccessMask               = VK_ACCESS_SHADER_WRITE_BIT;
+        barrier.oldLayout                   = VK_IMAGE_LAYOUT_UNDEFINED;
+        barrier.newLayout                   = VK_IMAGE_LAYOUT_GENERAL;
+        barrier.srcQueueFamilyIndex         = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex         = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image                       = m_Image.GetVkImage();
+        barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.levelCount = levelCount;
+        barrier.subresourceRange.layerCount = 1;
+
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+        m_ReducePipeline.Bind(commandBuffer);
+
+        for (uint32_t level = 0; level < levelCount; level++) {
+            const VkExtent2D source      = level == 0 ? m_DepthExtent : m_Image.GetMipExtent(level - 1);
+            const VkExtent2D destination = m_Image.GetMipExtent(level);
+
+            const ReduceSizes sizes = {{source.width, source.height}, {destination.width, destination.height}};
+
+            vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+                                    m_ReducePipeline.GetVkPipelineLayout(), 0, 1, &m_DescriptorSets[level], 0,
+                                    nullptr);
+            vkCmdPushConstants(commandBuffer, m_ReducePipeline.GetVkPipelineLayout(), VK_SHADER_STAGE_COMPUTE_BIT, 0,
+                               sizeof(sizes), &sizes);
+            vkCmdDispatch(commandBuffer, (destination.width + s_GroupSize - 1) / s_GroupSize,
+                          (destination.height + s_GroupSize - 1) / s_GroupSize, 1);
+
+            barrier.srcAccessMask                 = VK_ACCESS_SHADER_WRITE_BIT;
+            barrier.dstAccessMask                 = VK_ACCESS_SHADER_READ_BIT;
+            barrier.oldLayout                     = VK_IMAGE_LAYOUT_GENERAL;
+            barrier.subresourceRange.baseMipLevel = level;
+            barrier.subresourceRange.levelCount   = 1;
+
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                 VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+        }
+    }
+
+    VkImageView DepthPyramid::GetVkImageView() const {
+        return m_Image.GetVkImageView();
+    }
+
+    VkSampler DepthPyramid::GetVkSampler() const {
+        return m_Sampler;
+    }
+
+    VkExtent2D DepthPyramid::GetExtent() const {
+        return m_Image.GetExtent();
+    }
+
+    uint32_t DepthPyramid::GetLevelCount() const {
+        return m_Image.GetMipLevels();
+    }
+
+    DepthPyramid::DepthPyramid(Vulkan::Image &&image, Vulkan::Pipeline &&reducePipeline)
+        : m_Image(std::move(image)), m_ReducePipeline(std::move(reducePipeline)) {
+    }
+
+    void DepthPyramid::Destroy() {
+        if (m_Device == nullptr) {
+            return;
+        }
+
+        if (m_DescriptorPool != nullptr) {
+            vkDestroyDescriptorPool(m_Device->GetVkLogicalDevice(), m_DescriptorPool, nullptr);
+            m_DescriptorPool = nullptr;
+        }
+
+        if (m_Sampler != nullptr) {
+            vkDestroySampler(m_Device->GetVkLogicalDevice(), m_Sampler, nullptr);
+            m_Sampler = nullptr;
+        }
+
+        if (m_SetLayout != nullptr) {
+            vkDestroyDescriptorSetLayout(m_Device->GetVkLogicalDevice(), m_SetLayout, nullptr);
+            m_SetLayout = nullptr;
+        }
+
+        m_DescriptorSets.clear();
+    }
+}
@@ -0,0 +1,46 @@
+#ifndef PULSAR_DEPTHPYRAMID_HPP
+#define PULSAR_DEPTHPYRAMID_HPP
+
+#include "Vulkan/Image.hpp"
+#include "Vulkan/Pipeline.hpp"
+
+namespace Pulsar::Renderer {
+    // Hierarchical depth (Hi-Z) buffer: level 0 is the depth buffer reduced to the next lower power of two, and
+    // every texel stores the farthest depth of its footprint so a single fetch gives a conservative occluder depth.
+    // The whole pyramid stays in VK_IMAGE_LAYOUT_GENERAL.
+    class DepthPyramid {
+    public:
+        // depthView must be in VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL whenever Build is executed.
+        static DepthPyramid Create(Vulkan::Device &device, VkImageView depthView, VkExtent2D depthExtent);
+        ~DepthPyramid();
+
+        DepthPyramid(const DepthPyramid &other) = delete;
+        DepthPyramid(DepthPyramid &&other) noexcept;
+
+        DepthPyramid &operator=(const DepthPyramid &other) = delete;
+        DepthPyramid &operator=(DepthPyramid &&other) noexcept;
+
+        void Build(VkCommandBuffer commandBuffer) const;
+
+        [[nodiscard]] VkImageView GetVkImageView() const;
+        [[nodiscard]] VkSampler   GetVkSampler() const;
+        [[nodiscard]] VkExtent2D  GetExtent() const;
+        [[nodiscard]] uint32_t    GetLevelCount() const;
+
+    private:
+        Vulkan::Image                m_Image;
+        Vulkan::Pipeline             m_ReducePipeline;
+        VkDescriptorSetLayout        m_SetLayout      = nullptr;
+        VkDescriptorPool             m_DescriptorPool = nullptr;
+        VkSampler                    m_Sampler        = nullptr;
+        std::vector<VkDescriptorSet> m_DescriptorSets;
+        VkExtent2D                   m_DepthExtent    = {};
+        Vulkan::Device *             m_Device         = nullptr;
+
+        DepthPyramid(Vulkan::Image &&image, Vulkan::Pipeline &&reducePipeline);
+
+        void Destroy();
+    };
+}
+
+#endif //PULSAR_DEPTHPYRAMID_HPP
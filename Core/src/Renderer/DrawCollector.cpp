@@ -0,0 +1,33 @@
+#include "DrawCollector.hpp"
+
+namespace Pulsar::Renderer {
+    void DrawCollector::Collect(const Ecs::World &world, const CollectView &view, DrawList &drawList) {
+        m_ObjectTransforms.clear();
+        m_ObjectTransforms.reserve(m_Query.Count(world));
+        drawList.Reserve(m_ObjectTransforms.capacity());
+
+        // Only the depth row of the view matrix is needed to sort by view-space distance.
+        const Math::Vec4 depthRow(-view.view[0].z, -view.view[1].z, -view.view[2].z, -view.view[3].z);
+
+        m_Query.ForEachChunk(world, [&](const Ecs::ChunkView<const WorldTransform, const MeshRenderer> &chunk) {
+            const std::span<const WorldTransform> transforms = chunk.Get<const WorldTransform>();
+            const std::span<const MeshRenderer>   renderers  = chunk.Get<const MeshRenderer>();
+
+            for (uint32_t i = 0; i < chunk.GetCount(); i++) {
+                const Math::Mat4 &  matrix   = transforms[i].matrix;
+                const MeshRenderer &renderer = renderers[i];
+
+                const float    depth       = Math::Dot(depthRow, matrix[3]);
+                const uint32_t objectIndex = static_cast<uint32_t>(m_ObjectTransforms.size());
+
+                m_ObjectTransforms.push_back(matrix);
+                drawList.Submit(renderer.pipeline, renderer.descriptorSet, renderer.mesh,
+                                QuantizeDepth(depth, view.nearPlane, view.farPlane), objectIndex);
+            }
+        });
+    }
+
+    std::span<const Math::Mat4> DrawCollector::GetObjectTransforms() const {
+        return m_ObjectTransforms;
+    }
+}
@@ -0,0 +1,29 @@
+#ifndef PULSAR_DRAWCOLLECTOR_HPP
+#define PULSAR_DRAWCOLLECTOR_HPP
+
+#include "DrawList.hpp"
+#include "RenderComponents.hpp"
+#include "Ecs/Query.hpp"
+
+namespace Pulsar::Renderer {
+    struct CollectView {
+        Math::Mat4 view      = Math::Mat4::Identity();
+        float      nearPlane = 0.1F;
+        float      farPlane  = 1000.0F;
+    };
+
+    // Walks every entity with a WorldTransform and a MeshRenderer, submitting one packet per entity. The packet's
+    // object index points into GetObjectTransforms, which is meant to be uploaded as the per-object buffer.
+    class DrawCollector {
+    public:
+        void Collect(const Ecs::World &world, const CollectView &view, DrawList &drawList);
+
+        [[nodiscard]] std::span<const Math::Mat4> GetObjectTransforms() const;
+
+    private:
+        Ecs::Query<const WorldTransform, const MeshRenderer> m_Query;
+        std::vector<Math::Mat4>                              m_ObjectTransforms;
+    };
+}
+
+#endif //PULSAR_DRAWCOLLECTOR_HPP
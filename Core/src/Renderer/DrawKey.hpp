@@ -0,0 +1,62 @@
+#ifndef PULSAR_DRAWKEY_HPP
+#define PULSAR_DRAWKEY_HPP
+
+#include <algorithm>
+#include <cstdint>
+
+namespace Pulsar::Renderer {
+    // Sort key layout, most significant bits first:
+    //   pipeline (8) | descriptor set (16) | mesh (16) | depth (24)
+    // Sorting by the key minimizes state changes and places equal meshes next to each other for instancing.
+
+    constexpr uint32_t g_DrawKeyPipelineBits      = 8;
+    constexpr uint32_t g_DrawKeyDescriptorSetBits = 16;
+    constexpr uint32_t g_DrawKeyMeshBits          = 16;
+    constexpr uint32_t g_DrawKeyDepthBits         = 24;
+
+    constexpr uint32_t g_DrawKeyMeshShift          = g_DrawKeyDepthBits;
+    constexpr uint32_t g_DrawKeyDescriptorSetShift = g_DrawKeyMeshShift + g_DrawKeyMeshBits;
+    constexpr uint32_t g_DrawKeyPipelineShift      = g_DrawKeyDescriptorSetShift + g_DrawKeyDescriptorSetBits;
+
+    static_assert(g_DrawKeyPipelineShift + g_DrawKeyPipelineBits == 64);
+
+    struct DrawPacket {
+        uint64_t key;
+        uint32_t objectIndex;
+    };
+
+    // Indices are masked to their fields; DrawList::Submit rejects the ones that do not fit.
+    constexpr uint64_t MakeDrawKey(const uint32_t pipeline, const uint32_t descriptorSet, const uint32_t mesh,
+                                   const uint32_t depth) {
+        return static_cast<uint64_t>(pipeline & ((1U << g_DrawKeyPipelineBits) - 1)) << g_DrawKeyPipelineShift |
+            static_cast<uint64_t>(descriptorSet & ((1U << g_DrawKeyDescriptorSetBits) - 1)) <<
+            g_DrawKeyDescriptorSetShift |
+            static_cast<uint64_t>(mesh & ((1U << g_DrawKeyMeshBits) - 1)) << g_DrawKeyMeshShift |
+            static_cast<uint64_t>(depth & ((1U << g_DrawKeyDepthBits) - 1));
+    }
+
+    constexpr uint32_t GetKeyPipeline(const uint64_t key) {
+        return static_cast<uint32_t>(key >> g_DrawKeyPipelineShift);
+    }
+
+    constexpr uint32_t GetKeyDescriptorSet(const uint64_t key) {
+        return static_cast<uint32_t>(key >> g_DrawKeyDescriptorSetShift) & ((1U << g_DrawKeyDescriptorSetBits) - 1);
+    }
+
+    constexpr uint32_t GetKeyMesh(const uint64_t key) {
+        return static_cast<uint32_t>(key >> g_DrawKeyMeshShift) & ((1U << g_DrawKeyMeshBits) - 1);
+    }
+
+    // Maps view-space depth in [near, far] to the 24-bit depth field, front to back.
+    constexpr uint32_t QuantizeDepth(const float depth, const float near, const float far) {
+        // An empty or inverted range would divide by zero and cast the NaN.
+        if (far <= near) {
+            return 0;
+        }
+
+        const float normalized = std::clamp((depth - near) / (far - near), 0.0F, 1.0F);
+        return static_cast<uint32_t>(normalized * static_cast<float>((1U << g_DrawKeyDepthBits) - 1));
+    }
+}
+
+#endif //PULSAR_DRAWKEY_HPP
@@ -0,0 +1,93 @@
+#include "DrawList.hpp"
+
+#include "RadixSort.hpp"
+
+namespace Pulsar::Renderer {
+    void DrawList::Clear() {
+        m_Packets.clear();
+        m_Commands.clear();
+        m_Instances.clear();
+        m_Batches.clear();
+    }
+
+    void DrawList::Reserve(const size_t packetCount) {
+        m_Packets.reserve(packetCount);
+        m_Scratch.reserve(packetCount);
+        m_Instances.reserve(packetCount);
+    }
+
+    void DrawList::Submit(const DrawPacket &packet) {
+        m_Packets.push_back(packet);
+    }
+
+    void DrawList::Submit(const uint32_t pipeline, const uint32_t descriptorSet, const uint32_t mesh,
+                          const uint32_t depth, const uint32_t objectIndex) {
+        // A masked index would silently draw, and batch with, a different pipeline, set or mesh.
+        if (pipeline >= 1U << g_DrawKeyPipelineBits || descriptorSet >= 1U << g_DrawKeyDescriptorSetBits ||
+            mesh >= 1U << g_DrawKeyMeshBits || depth >= 1U << g_DrawKeyDepthBits) {
+            throw std::runtime_error("Failed to submit draw: Index exceeds draw key range");
+        }
+
+        m_Packets.push_back({MakeDrawKey(pipeline, descriptorSet, mesh, depth), objectIndex});
+    }
+
+    void DrawList::Build(const std::span<const MeshRange> meshes) {
+        m_Commands.clear();
+        m_Instances.clear();
+        m_Batches.clear();
+
+        RadixSort(m_Packets, m_Scratch);
+
+        // Everything above the depth bits identifies a unique (pipeline, descriptor set, mesh) draw.
+        constexpr uint32_t s_StateShift = g_DrawKeyMeshShift;
+        constexpr uint32_t s_BatchShift = g_DrawKeyDescriptorSetShift;
+
+        uint64_t previousState = ~0ULL;
+        uint64_t previousBatch = ~0ULL;
+
+        for (const DrawPacket &packet : m_Packets) {
+            const uint32_t mesh = GetKeyMesh(packet.key);
+            if (mesh >= meshes.size()) {
+                throw std::runtime_error("Failed to build draw list: Unknown mesh");
+            }
+
+            if (packet.key >> s_BatchShift != previousBatch) {
+                previousBatch = packet.key >> s_BatchShift;
+                m_Batches.push_back({
+                    GetKeyPipeline(packet.key), GetKeyDescriptorSet(packet.key),
+                    static_cast<uint32_t>(m_Commands.size()), 0
+                });
+            }
+
+            if (packet.key >> s_StateShift != previousState) {
+                previousState = packet.key >> s_StateShift;
+
+                const MeshRange &range = meshes[mesh];
+                m_Commands.push_back({
+                    range.indexCount, 0, range.firstIndex, range.vertexOffset,
+                    static_cast<uint32_t>(m_Instances.size())
+                });
+                m_Batches.back().commandCount++;
+            }
+
+            m_Commands.back().instanceCount++;
+            m_Instances.push_back({packet.objectIndex, mesh});
+        }
+    }
+
+    std::span<const DrawPacket> DrawList::GetPackets() const {
+        return m_Packets;
+    }
+
+    std::span<const VkDrawIndexedIndirectCommand> DrawList::GetCommands() const {
+        return m_Commands;
+    }
+
+    std::span<const InstanceData> DrawList::GetInstances() const {
+        return m_Instances;
+    }
+
+    std::span<const DrawBatch> DrawList::GetBatches() const {
+        return m_Batches;
+    }
+}
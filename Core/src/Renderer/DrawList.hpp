@@ -0,0 +1,65 @@
+#ifndef PULSAR_DRAWLIST_HPP
+#define PULSAR_DRAWLIST_HPP
+
+#include <span>
+#include <vector>
+
+#include <vulkan/vulkan_core.h>
+
+#include "DrawKey.hpp"
+
+namespace Pulsar::Renderer {
+    // Location of a mesh inside the shared MeshPool buffers.
+    struct MeshRange {
+        uint32_t firstIndex   = 0;
+        uint32_t indexCount   = 0;
+        int32_t  vertexOffset = 0;
+    };
+
+    // Per-instance vertex stream; shaders use it to look up object and mesh data in storage buffers.
+    struct InstanceData {
+        uint32_t objectIndex;
+        uint32_t meshIndex;
+    };
+
+    // A run of indirect commands that share a pipeline and descriptor set.
+    struct DrawBatch {
+        uint32_t pipeline      = 0;
+        uint32_t descriptorSet = 0;
+        uint32_t firstCommand  = 0;
+        uint32_t commandCount  = 0;
+    };
+
+    struct SubmitStatistics {
+        uint32_t batches       = 0;
+        uint32_t commands      = 0;
+        uint32_t instances     = 0;
+        uint32_t indirectCalls = 0;
+    };
+
+    class DrawList {
+    public:
+        void Clear();
+        void Reserve(size_t packetCount);
+
+        void Submit(const DrawPacket &packet);
+        void Submit(uint32_t pipeline, uint32_t descriptorSet, uint32_t mesh, uint32_t depth, uint32_t objectIndex);
+
+        // Sorts the packets and merges runs of the same mesh into one instanced indirect command.
+        void Build(std::span<const MeshRange> meshes);
+
+        [[nodiscard]] std::span<const DrawPacket>                   GetPackets() const;
+        [[nodiscard]] std::span<const VkDrawIndexedIndirectCommand> GetCommands() const;
+        [[nodiscard]] std::span<const InstanceData>                 GetInstances() const;
+        [[nodiscard]] std::span<const DrawBatch>                    GetBatches() const;
+
+    private:
+        std::vector<DrawPacket>                   m_Packets;
+        std::vector<DrawPacket>                   m_Scratch;
+        std::vector<VkDrawIndexedIndirectCommand> m_Commands;
+        std::vector<InstanceData>                 m_Instances;
+        std::vector<DrawBatch>                    m_Batches;
+    };
+}
+
+#endif //PULSAR_DRAWLIST_HPP
@@ -0,0 +1,126 @@
+#include "DrawSubmitter.hpp"
+
+namespace Pulsar::Renderer {
+    DrawSubmitter DrawSubmitter::Create(Vulkan::Device &device, const uint32_t framesInFlight) {
+        DrawSubmitter submitter;
+        submitter.m_Device = &device;
+        submitter.m_Frames.resize(framesInFlight);
+
+        return submitter;
+    }
+
+    Vulkan::VertexLayout DrawSubmitter::GetInstanceLayout(const uint32_t location) {
+        Vulkan::VertexLayout layout;
+        layout.stride     = sizeof(InstanceData);
+        layout.inputRate  = VK_VERTEX_INPUT_RATE_INSTANCE;
+        layout.attributes = {{location, VK_FORMAT_R32G32_UINT, 0}};
+
+        return layout;
+    }
+
+    SubmitStatistics DrawSubmitter::Record(const VkCommandBuffer commandBuffer, const uint32_t frameIndex,
+                                           const DrawList &drawList, const MeshPool &meshPool,
+                                           const std::span<const Vulkan::Pipeline *const> pipelines,
+                                           const std::span<const VkDescriptorSet> descriptorSets) {
+        const std::span<const VkDrawIndexedIndirectCommand> commands  = drawList.GetCommands();
+        const std::span<const InstanceData>                 instances = drawList.GetInstances();
+
+        SubmitStatistics statistics;
+        statistics.batches   = static_cast<uint32_t>(drawList.GetBatches().size());
+        statistics.commands  = static_cast<uint32_t>(commands.size());
+        statistics.instances = static_cast<uint32_t>(instances.size());
+
+        if (commands.empty()) {
+            return statistics;
+        }
+
+        // Checked up front so a bad draw list fails before anything is written or recorded.
+        for (const DrawBatch &batch : drawList.GetBatches()) {
+            if (batch.pipeline >= pipelines.size() || pipelines[batch.pipeline] == nullptr) {
+                throw std::runtime_error("Failed to record draws: Pipeline index out of range");
+            }
+
+            if (batch.descriptorSet >= descriptorSets.size()) {
+                throw std::runtime_error("Failed to record draws: Descriptor set index out of range");
+            }
+        }
+
+        FrameBuffers &frame = m_Frames.at(frameIndex);
+        Reserve(frame.indirect, commands.size_bytes(), VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT);
+        Reserve(frame.instances, instances.size_bytes(), VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+
+        frame.indirect->Write(std::as_bytes(commands));
+        frame.instances->Write(std::as_bytes(instances));
+
+        meshPool.Bind(commandBuffer);
+
+        const VkBuffer     instanceBuffer = frame.instances->GetVkBuffer();
+        const VkDeviceSize instanceOffset = 0;
+        vkCmdBindVertexBuffers(commandBuffer, 1, 1, &instanceBuffer, &instanceOffset);
+
+        const VkPhysicalDeviceFeatures &features  = m_Device->GetEnabledFeatures();
+        const bool                      multiDraw = features.multiDrawIndirect == VK_TRUE;
+
+        // Without drawIndirectFirstInstance the GPU ignores firstInstance, so fall back to direct draws.
+        const bool indirect = features.drawIndirectFirstInstance == VK_TRUE;
+
+        uint32_t boundPipeline      = ~0U;
+        uint32_t boundDescriptorSet = ~0U;
+
+        for (const DrawBatch &batch : drawList.GetBatches()) {
+            const Vulkan::Pipeline *pipeline = pipelines[batch.pipeline];
+
+            if (batch.pipeline != boundPipeline) {
+                vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline->GetVkPipeline());
+                boundPipeline      = batch.pipeline;
+                boundDescriptorSet = ~0U;
+            }
+
+            if (batch.descriptorSet != boundDescriptorSet) {
+                vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                        pipeline->GetVkPipelineLayout(), 0, 1,
+                                        &descriptorSets[batch.descriptorSet], 0, nullptr);
+                boundDescriptorSet = batch.descriptorSet;
+            }
+
+            const VkDeviceSize offset = batch.firstCommand * sizeof(VkDrawIndexedIndirectCommand);
+
+            if (indirect && multiDraw) {
+                vkCmdDrawIndexedIndirect(commandBuffer, frame.indirect->GetVkBuffer(), offset, batch.commandCount,
+                                         sizeof(VkDrawIndexedIndirectCommand));
+                statistics.indirectCalls++;
+                continue;
+            }
+
+            for (uint32_t i = batch.firstCommand; i < batch.firstCommand + batch.commandCount; i++) {
+                if (indirect) {
+                    vkCmdDrawIndexedIndirect(commandBuffer, frame.indirect->GetVkBuffer(),
+                                             i * sizeof(VkDrawIndexedIndirectCommand), 1,
+                                             sizeof(VkDrawIndexedIndirectCommand));
+                    statistics.indirectCalls++;
+                } else {
+                    const VkDrawIndexedIndirectCommand &command = commands[i];
+                    vkCmdDrawIndexed(commandBuffer, command.indexCount, command.instanceCount, command.firstIndex,
+                                     command.vertexOffset, command.firstInstance);
+                }
+            }
+        }
+
+        return statistics;
+    }
+
+    void DrawSubmitter::Reserve(std::optional<Vulkan::Buffer> &buffer, const VkDeviceSize size,
+                                const VkBufferUsageFlags usage) const {
+        if (buffer.has_value() && buffer->GetSize() >= size) {
+            return;
+        }
+
+        VkDeviceSize capacity = buffer.has_value() ? buffer->GetSize() : 64 * 1024;
+        while (capacity < size) {
+            capacity *= 2;
+        }
+
+        buffer = Vulkan::Buffer::Create(*m_Device, capacity, usage,
+                                        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    }
+}
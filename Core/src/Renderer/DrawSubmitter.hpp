@@ -0,0 +1,38 @@
+#ifndef PULSAR_DRAWSUBMITTER_HPP
+#define PULSAR_DRAWSUBMITTER_HPP
+
+#include "DrawList.hpp"
+#include "MeshPool.hpp"
+#include "Vulkan/Pipeline.hpp"
+
+namespace Pulsar::Renderer {
+    // Streams a built DrawList into per-frame host-visible indirect and instance buffers and records one
+    // vkCmdDrawIndexedIndirect per batch. Instance data is bound at vertex binding 1 (see GetInstanceLayout).
+    class DrawSubmitter {
+    public:
+        static DrawSubmitter Create(Vulkan::Device &device, uint32_t framesInFlight = 2);
+
+        [[nodiscard]] static Vulkan::VertexLayout GetInstanceLayout(uint32_t location = 3);
+
+        // The previous submission that used frameIndex must have finished executing on the GPU, as it has for
+        // ViewportSet::GetFrameIndex inside a ViewportSet record callback.
+        SubmitStatistics Record(VkCommandBuffer commandBuffer, uint32_t frameIndex, const DrawList &drawList,
+                                const MeshPool &meshPool, std::span<const Vulkan::Pipeline *const> pipelines,
+                                std::span<const VkDescriptorSet> descriptorSets);
+
+    private:
+        struct FrameBuffers {
+            std::optional<Vulkan::Buffer> indirect;
+            std::optional<Vulkan::Buffer> instances;
+        };
+
+        std::vector<FrameBuffers> m_Frames;
+        Vulkan::Device *          m_Device = nullptr;
+
+        DrawSubmitter() = default;
+
+        void Reserve(std::optional<Vulkan::Buffer> &buffer, VkDeviceSize size, VkBufferUsageFlags usage) const;
+    };
+}
+
+#endif //PULSAR_DRAWSUBMITTER_HPP
@@ -0,0 +1,478 @@
+#include "GpuCulling.hpp"
+
+namespace Pulsar::Renderer {
+    static constexpr uint32_t s_GroupSize = 64;
+
+    static constexpr uint32_t s_FlagOcclusion = 1;
+    static constexpr uint32_t s_FlagCompact   = 2;
+
+    static constexpr auto s_CullShader = R"(
+#version 450
+
+layout(local_size_x = 64) in;
+
+struct CullObject {
+    vec4 sphere;
+    uint meshIndex;
+    uint padding0;
+    uint padding1;
+    uint padding2;
+};
+
+struct MeshRange {
+    uint firstIndex;
+    uint indexCount;
+    int  vertexOffset;
+};
+
+struct DrawCommand {
+    uint indexCount;
+    uint instanceCount;
+    uint firstIndex;
+    int  vertexOffset;
+    uint firstInstance;
+};
+
+layout(binding = 0) uniform CullData {
+    mat4  view;
+    vec4  planes[6];
+    vec4  projection; // P00, P11, P22, P32
+    vec4  pyramid;    // Near plane, width, height
+    uvec4 counts;     // Object count, flags
+} cull;
+
+layout(std430, binding = 1) readonly buffer Objects {
+    CullObject objects[];
+};
+
+layout(std430, binding = 2) readonly buffer Ranges {
+    MeshRange ranges[];
+};
+
+layout(std430, binding = 3) writeonly buffer Commands {
+    DrawCommand commands[];
+};
+
+layout(std430, binding = 4) buffer Count {
+    uint drawCount;
+};
+
+layout(binding = 5) uniform sampler2D depthPyramid;
+
+const uint FLAG_OCCLUSION = 1u;
+const uint FLAG_COMPACT   = 2u;
+
+// 2D Polyhedral Bounds of a Clipped, Perspective-Projected 3D Sphere (Mara, McGuire 2013).
+// center is in a view space that looks down +z; returns false when the sphere crosses the near plane.
+bool ProjectSphere(vec3 center, float radius, out vec4 bounds) {
+    if (center.z < radius + cull.pyramid.x) {
+        return false;
+    }
+
+    vec2 cx   = -center.xz;
+    vec2 vx   = vec2(sqrt(dot(cx, cx) - radius * radius), radius);
+    vec2 minX = mat2(vx.x, vx.y, -vx.y, vx.x) * cx;
+    vec2 maxX = mat2(vx.x, -vx.y, vx.y, vx.x) * cx;
+
+    vec2 cy   = -center.yz;
+    vec2 vy   = vec2(sqrt(dot(cy, cy) - radius * radius), radius);
+    vec2 minY = mat2(vy.x, vy.y, -vy.y, vy.x) * cy;
+    vec2 maxY = mat2(vy.x, -vy.y, vy.y, vy.x) * cy;
+
+    vec4 ndc = vec4(minX.x / minX.y * cull.projection.x, minY.x / minY.y * cull.projection.y,
+                    maxX.x / maxX.y * cull.projection.x, maxY.x / maxY.y * cull.projection.y);
+
+    // The projection may flip y, so sort the corners before mapping to texture coordinates.
+    bounds = vec4(min(ndc.xy, ndc.zw), max(ndc.xy, ndc.zw)) * 0.5 + 0.5;
+    return true;
+}
+
+bool IsOccluded(vec4 sphere) {
+    vec3 center = (cull.view * vec4(sphere.xyz, 1.0)).xyz;
+    center.z    = -center.z;
+
+    vec4 bounds;
+    if (!ProjectSphere(center, sphere.w, bounds)) {
+        return false;
+    }
+
+    // At this level the footprint spans at most one texel, so its four corners cover every texel it touches.
+    vec2  size  = (bounds.zw - bounds.xy) * cull.pyramid.yz;
+    float level = ceil(log2(max(max(size.x, size.y), 1.0)));
+
+    float occluder = max(max(textureLod(depthPyramid, bounds.xy, level).r,
+                             textureLod(depthPyramid, bounds.zy, level).r),
+                         max(textureLod(depthPyramid, bounds.xw, level).r,
+                             textureLod(depthPyramid, bounds.zw, level).r));
+
+    float nearest = center.z - sphere.w;
+    float depth   = (cull.projection.w - cull.projection.z * nearest) / nearest;
+
+    return depth > occluder;
+}
+
+void main() {
+    uint index = gl_GlobalInvocationID.x;
+    if (index >= cull.counts.x) {
+        return;
+    }
+
+    CullObject object  = objects[index];
+    bool       visible = true;
+
+    for (int i = 0; i < 6; i++) {
+        visible = visible && dot(cull.planes[i].xyz, object.sphere.xyz) + cull.planes[i].w >= -object.sphere.w;
+    }
+
+    if (visible && (cull.counts.y & FLAG_OCCLUSION) != 0u) {
+        visible = !IsOccluded(object.sphere);
+    }
+
+    MeshRange   range = ranges[object.meshIndex];
+    DrawCommand command;
+    command.indexCount    = range.indexCount;
+    command.instanceCount = visible ? 1u : 0u;
+    command.firstIndex    = range.firstIndex;
+    command.vertexOffset  = range.vertexOffset;
+    command.firstInstance = index;
+
+    if ((cull.counts.y & FLAG_COMPACT) == 0u) {
+        commands[index] = command;
+    } else if (visible) {
+        commands[atomicAdd(drawCount, 1u)] = command;
+    }
+}
+)";
+
+    struct CullUniforms {
+        Math::Mat4              view;
+        Math::FrustumPlanes     planes;
+        std::array<float, 4>    projection;
+        std::array<float, 4>    pyramid;
+        std::array<uint32_t, 4> counts;
+    };
+
+    static_assert(sizeof(CullUniforms) == 208);
+
+    GpuCulling GpuCulling::Create(Vulkan::Device &device, const MeshPool &meshPool, const DepthPyramid &depthPyramid,
+                                  const uint32_t maxObjects, const uint32_t framesInFlight) {
+        const VkPhysicalDeviceFeatures &features = device.GetEnabledFeatures();
+        if (features.multiDrawIndirect != VK_TRUE || features.drawIndirectFirstInstance != VK_TRUE) {
+            throw std::runtime_error(
+                "Failed to create GPU culling: multiDrawIndirect and drawIndirectFirstInstance are required");
+        }
+
+        std::array<VkDescriptorSetLayoutBinding, 6> bindings{};
+        bindings[0] = {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr};
+        bindings[1] = {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr};
+        bindings[2] = {2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr};
+        bindings[3] = {3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr};
+        bindings[4] = {4, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr};
+        bindings[5] = {5, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr};
+
+        VkDescriptorSetLayoutCreateInfo setLayoutInfo{};
+        setLayoutInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        setLayoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+        setLayoutInfo.pBindings    = bindings.data();
+
+        VkDescriptorSetLayout setLayout;
+        if (vkCreateDescriptorSetLayout(device.GetVkLogicalDevice(), &setLayoutInfo, nullptr, &setLayout) !=
+            VK_SUCCESS) {
+            throw std::runtime_error("Failed to create GPU culling: Could not create descriptor set layout");
+        }
+
+        Vulkan::ComputePipelineConfig pipelineConfig;
+        pipelineConfig.descriptorSetLayouts = {setLayout};
+
+        constexpr VkMemoryPropertyFlags hostVisible =
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+        std::optional<GpuCulling> created;
+        try {
+            created.emplace(GpuCulling(
+                Vulkan::Pipeline::CreateCompute(device, s_CullShader, pipelineConfig),
+                Vulkan::Buffer::Create(device, static_cast<VkDeviceSize>(maxObjects) * sizeof(CullObject),
+                                       VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, hostVisible)));
+        } catch (...) {
+            vkDestroyDescriptorSetLayout(device.GetVkLogicalDevice(), setLayout, nullptr);
+            throw;
+        }
+
+        GpuCulling culling = std::move(*created);
+        culling.m_Device     = &device;
+        culling.m_SetLayout  = setLayout;
+        culling.m_MeshPool   = &meshPool;
+        culling.m_MaxObjects = maxObjects;
+
+        if (device.IsExtensionEnabled(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME)) {
+            culling.m_DrawIndirectCount = reinterpret_cast<PFN_vkCmdDrawIndexedIndirectCountKHR>(
+                device.GetProcAddress("vkCmdDrawIndexedIndirectCountKHR"));
+        }
+
+        const VkDeviceSize commandsSize = static_cast<VkDeviceSize>(maxObjects) *
+                                          sizeof(VkDrawIndexedIndirectCommand);
+
+        for (uint32_t i = 0; i < framesInFlight; i++) {
+            culling.m_Frames.push_back({
+                Vulkan::Buffer::Create(device, sizeof(CullUniforms), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, hostVisible),
+                Vulkan::Buffer::Create(device, commandsSize,
+                                       VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
+                                       VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT),
+                Vulkan::Buffer::Create(device, sizeof(uint32_t),
+                                       VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT |
+                                       VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
+            });
+        }
+
+        const std::array<VkDescriptorPoolSize, 3> poolSizes = {
+            VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, framesInFlight},
+            VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, framesInFlight * 4},
+            VkDescriptorPoolSize{VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, framesInFlight}
+        };
+
+        VkDescriptorPoolCreateInfo poolInfo{};
+        poolInfo.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolInfo.maxSets       = framesInFlight;
+        poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+        poolInfo.pPoolSizes    = poolSizes.data();
+
+        if (vkCreateDescriptorPool(device.GetVkLogicalDevice(), &poolInfo, nullptr, &culling.m_DescriptorPool) !=
+            VK_SUCCESS) {
+            throw std::runtime_error("Failed to create GPU culling: Could not create descriptor pool");
+        }
+
+        for (FrameResources &frame : culling.m_Frames) {
+            VkDescriptorSetAllocateInfo allocateInfo{};
+            allocateInfo.sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+            allocateInfo.descriptorPool     = culling.m_DescriptorPool;
+            allocateInfo.descriptorSetCount = 1;
+            allocateInfo.pSetLayouts        = &setLayout;
+
+            if (vkAllocateDescriptorSets(device.GetVkLogicalDevice(), &allocateInfo, &frame.descriptorSet) !=
+                VK_SUCCESS) {
+                throw std::runtime_error("Failed to create GPU culling: Could not allocate descriptor set");
+            }
+
+            const std::array<VkDescriptorBufferInfo, 5> bufferInfos = {
+                VkDescriptorBufferInfo{frame.uniforms.GetVkBuffer(), 0, VK_WHOLE_SIZE},
+                VkDescriptorBufferInfo{culling.m_ObjectBuffer.GetVkBuffer(), 0, VK_WHOLE_SIZE},
+                VkDescriptorBufferInfo{meshPool.GetRangeBuffer().GetVkBuffer(), 0, VK_WHOLE_SIZE},
+                VkDescriptorBufferInfo{frame.commands.GetVkBuffer(), 0, VK_WHOLE_SIZE},
+                VkDescriptorBufferInfo{frame.count.GetVkBuffer(), 0, VK_WHOLE_SIZE}
+            };
+
+            std::array<VkWriteDescriptorSet, 5> writes{};
+            for (uint32_t binding = 0; binding < writes.size(); binding++) {
+                writes[binding].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+                writes[binding].dstSet          = frame.descriptorSet;
+                writes[binding].dstBinding      = binding;
+                writes[binding].descriptorCount = 1;
+                writes[binding].descriptorType  = binding == 0
+                                                      ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER
+                                                      : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                writes[binding].pBufferInfo = &bufferInfos[binding];
+            }
+
+            vkUpdateDescriptorSets(device.GetVkLogicalDevice(), static_cast<uint32_t>(writes.size()), writes.data(), 0,
+                                   nullptr);
+        }
+
+        culling.SetDepthPyramid(depthPyramid);
+
+        return culling;
+    }
+
+    GpuCulling::~GpuCulling() {
+        Destroy();
+    }
+
+    GpuCulling::GpuCulling(GpuCulling &&other) noexcept
+        : m_Pipeline(std::move(other.m_Pipeline)),
+          m_ObjectBuffer(std::move(other.m_ObjectBuffer)),
+          m_Frames(std::move(other.m_Frames)),
+          m_SetLayout(std::exchange(other.m_SetLayout, nullptr)),
+          m_DescriptorPool(std::exchange(other.m_DescriptorPool, nullptr)),
+          m_DrawIndirectCount(other.m_DrawIndirectCount),
+          m_PyramidExtent(other.m_PyramidExtent),
+          m_ObjectCount(other.m_ObjectCount),
+          m_MaxObjects(other.m_MaxObjects),
+          m_MeshPool(other.m_MeshPool),
+          m_Device(std::exchange(other.m_Device, nullptr)) {
+    }
+
+    GpuCulling &GpuCulling::operator=(GpuCulling &&other) noexcept {
+        if (this != &other) {
+            Destroy();
+
+            m_Pipeline          = std::move(other.m_Pipeline);
+            m_ObjectBuffer      = std::move(other.m_ObjectBuffer);
+            m_Frames            = std::move(other.m_Frames);
+            m_SetLayout         = std::exchange(other.m_SetLayout, nullptr);
+            m_DescriptorPool    = std::exchange(other.m_DescriptorPool, nullptr);
+            m_DrawIndirectCount = other.m_DrawIndirectCount;
+            m_PyramidExtent     = other.m_PyramidExtent;
+            m_ObjectCount       = other.m_ObjectCount;
+            m_MaxObjects        = other.m_MaxObjects;
+            m_MeshPool          = other.m_MeshPool;
+            m_Device            = std::exchange(other.m_Device, nullptr);
+        }
+
+        return *this;
+    }
+
+    void GpuCulling::SetObjects(const std::span<const CullObject> objects, const uint32_t first) {
+        if (first + objects.size() > m_MaxObjects) {
+            throw std::runtime_error("Failed to set cull objects: Capacity exceeded");
+        }
+
+        m_ObjectBuffer.Write(std::as_bytes(objects), static_cast<VkDeviceSize>(first) * sizeof(CullObject));
+    }
+
+    void GpuCulling::SetObjectCount(const uint32_t count) {
+        if (count > m_MaxObjects) {
+            throw std::runtime_error("Failed to set cull object count: Capacity exceeded");
+        }
+
+        m_ObjectCount = count;
+    }
+
+    void GpuCulling::SetDepthPyramid(const DepthPyramid &depthPyramid) {
+        m_PyramidExtent = depthPyramid.GetExtent();
+
+        const VkDescriptorImageInfo imageInfo = {
+            depthPyramid.GetVkSampler(), depthPyramid.GetVkImageView(), VK_IMAGE_LAYOUT_GENERAL
+        };
+
+        for (const FrameResources &frame : m_Frames) {
+            VkWriteDescriptorSet write{};
+            write.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            write.dstSet          = frame.descriptorSet;
+            write.dstBinding      = 5;
+            write.descriptorCount = 1;
+            write.descriptorType  = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            write.pImageInfo      = &imageInfo;
+
+            vkUpdateDescriptorSets(m_Device->GetVkLogicalDevice(), 1, &write, 0, nullptr);
+        }
+    }
+
+    void GpuCulling::Record(const VkCommandBuffer commandBuffer, const uint32_t frameIndex, const CullView &view) {
+        FrameResources &frame = m_Frames.at(frameIndex);
+
+        uint32_t flags = 0;
+        if (view.occlusion) {
+            flags |= s_FlagOcclusion;
+        }
+        if (IsCompacting()) {
+            flags |= s_FlagCompact;
+        }
+
+        CullUniforms uniforms{};
+        uniforms.view       = view.view;
+        uniforms.planes     = Math::ExtractFrustum(view.projection * view.view);
+        uniforms.projection = {
+            view.projection[0][0], view.projection[1][1], view.projection[2][2], view.projection[3][2]
+        };
+        uniforms.pyramid    = {
+            view.nearPlane, static_cast<float>(m_PyramidExtent.width), static_cast<float>(m_PyramidExtent.height),
+            0.0F
+        };
+        uniforms.counts = {m_ObjectCount, flags, 0, 0};
+
+        frame.uniforms.Write(std::as_bytes(std::span(&uniforms, 1)));
+
+        vkCmdFillBuffer(commandBuffer, frame.count.GetVkBuffer(), 0, sizeof(uint32_t), 0);
+
+        VkBufferMemoryBarrier countBarrier{};
+        countBarrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        countBarrier.srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT;
+        countBarrier.dstAccessMask       = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+        countBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        countBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        countBarrier.buffer              = frame.count.GetVkBuffer();
+        countBarrier.size                = VK_WHOLE_SIZE;
+
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+                             0, nullptr, 1, &countBarrier, 0, nullptr);
+
+        if (m_ObjectCount != 0) {
+            m_Pipeline.Bind(commandBuffer);
+            vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_Pipeline.GetVkPipelineLayout(),
+                                    0, 1, &frame.descriptorSet, 0, nullptr);
+            vkCmdDispatch(commandBuffer, (m_ObjectCount + s_GroupSize - 1) / s_GroupSize, 1, 1);
+        }
+
+        std::array<VkBufferMemoryBarrier, 2> drawBarriers{};
+        for (VkBufferMemoryBarrier &barrier : drawBarriers) {
+            barrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+            barrier.srcAccessMask       = VK_ACCESS_SHADER_WRITE_BIT;
+            barrier.dstAccessMask       = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.size                = VK_WHOLE_SIZE;
+        }
+
+        drawBarriers[0].buffer = frame.commands.GetVkBuffer();
+        drawBarriers[1].buffer = frame.count.GetVkBuffer();
+
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT,
+                             0, 0, nullptr, static_cast<uint32_t>(drawBarriers.size()), drawBarriers.data(), 0,
+                             nullptr);
+    }
+
+    void GpuCulling::Draw(const VkCommandBuffer commandBuffer, const uint32_t frameIndex) const {
+        const FrameResources &frame = m_Frames.at(frameIndex);
+
+        if (m_ObjectCount == 0) {
+            return;
+        }
+
+        m_MeshPool->Bind(commandBuffer);
+
+        if (IsCompacting()) {
+            m_DrawIndirectCount(commandBuffer, frame.commands.GetVkBuffer(), 0, frame.count.GetVkBuffer(), 0,
+                                m_ObjectCount, sizeof(VkDrawIndexedIndirectCommand));
+        } else {
+            vkCmdDrawIndexedIndirect(commandBuffer, frame.commands.GetVkBuffer(), 0, m_ObjectCount,
+                                     sizeof(VkDrawIndexedIndirectCommand));
+        }
+    }
+
+    const Vulkan::Buffer &GpuCulling::GetObjectBuffer() const {
+        return m_ObjectBuffer;
+    }
+
+    uint32_t GpuCulling::GetObjectCount() const {
+        return m_ObjectCount;
+    }
+
+    uint32_t GpuCulling::GetMaxObjects() const {
+        return m_MaxObjects;
+    }
+
+    bool GpuCulling::IsCompacting() const {
+        return m_DrawIndirectCount != nullptr;
+    }
+
+    GpuCulling::GpuCulling(Vulkan::Pipeline &&pipeline, Vulkan::Buffer &&objectBuffer)
+        : m_Pipeline(std::move(pipeline)), m_ObjectBuffer(std::move(objectBuffer)) {
+    }
+
+    void GpuCulling::Destroy() {
+        if (m_Device == nullptr) {
+            return;
+        }
+
+        if (m_DescriptorPool != nullptr) {
+            vkDestroyDescriptorPool(m_Device->GetVkLogicalDevice(), m_DescriptorPool, nullptr);
+            m_DescriptorPool = nullptr;
+        }
+
+        if (m_SetLayout != nullptr) {
+            vkDestroyDescriptorSetLayout(m_Device->GetVkLogicalDevice(), m_SetLayout, nullptr);
+            m_SetLayout = nullptr;
+        }
+
+        m_Frames.clear();
+    }
+}
@@ -0,0 +1,89 @@
+#ifndef PULSAR_GPUCULLING_HPP
+#define PULSAR_GPUCULLING_HPP
+
+#include "DepthPyramid.hpp"
+#include "MeshPool.hpp"
+#include "Math/Frustum.hpp"
+
+namespace Pulsar::Renderer {
+    struct CullObject {
+        std::array<float, 4>    sphere    = {}; // World-space center and radius.
+        uint32_t                meshIndex = 0;
+        std::array<uint32_t, 3> padding   = {};
+    };
+
+    static_assert(sizeof(CullObject) == 32);
+
+    struct CullView {
+        Math::Mat4 view       = {};
+        Math::Mat4 projection = {};
+        float      nearPlane  = 0.1F;
+        bool       occlusion  = true;
+    };
+
+    // Frustum and Hi-Z occlusion culling in a compute shader that writes the indirect draw commands itself, so
+    // the CPU cost per frame is independent of the object count. Objects live in a persistent storage buffer;
+    // every emitted command has firstInstance set to the object index, which vertex shaders use to fetch
+    // per-object data from GetObjectBuffer through gl_InstanceIndex.
+    //
+    // With VK_KHR_draw_indirect_count the visible commands are compacted and drawn with a GPU-side count.
+    // Without it every object keeps its slot and culled ones are written with an instance count of zero.
+    class GpuCulling {
+    public:
+        static GpuCulling Create(Vulkan::Device &device, const MeshPool &meshPool, const DepthPyramid &depthPyramid,
+                                 uint32_t maxObjects, uint32_t framesInFlight = 2);
+        ~GpuCulling();
+
+        GpuCulling(const GpuCulling &other) = delete;
+        GpuCulling(GpuCulling &&other) noexcept;
+
+        GpuCulling &operator=(const GpuCulling &other) = delete;
+        GpuCulling &operator=(GpuCulling &&other) noexcept;
+
+        // The object buffer is shared by all frames in flight, so only touch objects no pending frame reads.
+        void SetObjects(std::span<const CullObject> objects, uint32_t first = 0);
+        void SetObjectCount(uint32_t count);
+
+        // For a recreated pyramid, e.g. after a resize. No frame using this culler may be pending.
+        void SetDepthPyramid(const DepthPyramid &depthPyramid);
+
+        // Occlusion tests against whatever the pyramid holds when the dispatch executes, normally the depth of
+        // the previous frame. The previous submission that used frameIndex must have finished executing, as it
+        // has for ViewportSet::GetFrameIndex inside a ViewportSet record callback.
+        void Record(VkCommandBuffer commandBuffer, uint32_t frameIndex, const CullView &view);
+
+        // Binds the mesh pool and draws the commands recorded for frameIndex with the currently bound pipeline.
+        void Draw(VkCommandBuffer commandBuffer, uint32_t frameIndex) const;
+
+        [[nodiscard]] const Vulkan::Buffer &GetObjectBuffer() const;
+        [[nodiscard]] uint32_t              GetObjectCount() const;
+        [[nodiscard]] uint32_t              GetMaxObjects() const;
+        [[nodiscard]] bool                  IsCompacting() const;
+
+    private:
+        struct FrameResources {
+            Vulkan::Buffer  uniforms;
+            Vulkan::Buffer  commands;
+            Vulkan::Buffer  count;
+            VkDescriptorSet descriptorSet = nullptr;
+        };
+
+        Vulkan::Pipeline                     m_Pipeline;
+        Vulkan::Buffer                       m_ObjectBuffer;
+        std::vector<FrameResources>          m_Frames;
+        VkDescriptorSetLayout                m_SetLayout         = nullptr;
+        VkDescriptorPool                     m_DescriptorPool    = nullptr;
+        PFN_vkCmdDrawIndexedIndirectCountKHR m_DrawIndirectCount = nullptr;
+        VkExtent2D                           m_PyramidExtent     = {};
+        uint32_t                             m_ObjectCount       = 0;
+        uint32_t                             m_MaxObjects        = 0;
+        const MeshPool *                     m_MeshPool          = nullptr;
+        Vulkan::Device *                     m_Device            = nullptr;
+
+        GpuCulling(Vulkan::Pipeline &&pipeline, Vulkan::Buffer &&objectBuffer);
+
+        void Destroy();
+    };
+}
+
+#endif //PULSAR_GPUCULLING_HPP
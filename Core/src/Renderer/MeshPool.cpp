@@ -0,0 +1,129 @@
+#include "MeshPool.hpp"
+
+namespace Pulsar::Renderer {
+    MeshPool MeshPool::Create(Vulkan::Device &device, const uint32_t vertexCapacity, const uint32_t indexCapacity,
+                              const uint32_t meshCapacity) {
+        if (meshCapacity > 1U << g_DrawKeyMeshBits) {
+            throw std::runtime_error("Failed to create mesh pool: Mesh capacity exceeds draw key range");
+        }
+
+        MeshPool pool(
+            Vulkan::Buffer::Create(device, static_cast<VkDeviceSize>(vertexCapacity) * sizeof(Mesh::PackedVertex),
+                                   VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                   VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT),
+            Vulkan::Buffer::Create(device, static_cast<VkDeviceSize>(indexCapacity) * sizeof(uint32_t),
+                                   VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                   VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT),
+            Vulkan::Buffer::Create(device, static_cast<VkDeviceSize>(meshCapacity) * sizeof(Mesh::MeshBounds),
+                                   VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                   VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT),
+            Vulkan::Buffer::Create(device, static_cast<VkDeviceSize>(meshCapacity) * sizeof(MeshRange),
+                                   VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                   VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
+        );
+
+        pool.m_Device = &device;
+        pool.m_Ranges.reserve(meshCapacity);
+
+        return pool;
+    }
+
+    uint32_t MeshPool::Add(const Mesh::QuantizedMesh &mesh) {
+        const VkDeviceSize vertexOffset = static_cast<VkDeviceSize>(m_VertexCount) * sizeof(Mesh::PackedVertex);
+        const VkDeviceSize indexOffset  = static_cast<VkDeviceSize>(m_IndexCount) * sizeof(uint32_t);
+        const VkDeviceSize boundsOffset = m_Ranges.size() * sizeof(Mesh::MeshBounds);
+
+        if (vertexOffset + mesh.vertices.size() * sizeof(Mesh::PackedVertex) > m_VertexBuffer.GetSize() ||
+            indexOffset + mesh.indices.size() * sizeof(uint32_t) > m_IndexBuffer.GetSize() ||
+            boundsOffset + sizeof(Mesh::MeshBounds) > m_BoundsBuffer.GetSize()) {
+            throw std::runtime_error("Failed to add mesh: Mesh pool is full");
+        }
+
+        const Mesh::MeshBounds bounds = {
+            {mesh.boundsCenter[0], mesh.boundsCenter[1], mesh.boundsCenter[2], 0.0F},
+            {mesh.boundsExtent[0], mesh.boundsExtent[1], mesh.boundsExtent[2], 0.0F}
+        };
+
+        const MeshRange range = {
+            m_IndexCount, static_cast<uint32_t>(mesh.indices.size()), static_cast<int32_t>(m_VertexCount)
+        };
+
+        const std::array<std::span<const std::byte>, 4> sources = {
+            std::as_bytes(std::span(mesh.vertices)), std::as_bytes(std::span(mesh.indices)),
+            std::as_bytes(std::span(&bounds, 1)), std::as_bytes(std::span(&range, 1))
+        };
+        const std::array<const Vulkan::Buffer *, 4> targets = {
+            &m_VertexBuffer, &m_IndexBuffer, &m_BoundsBuffer, &m_RangeBuffer
+        };
+        const std::array<VkDeviceSize, 4> targetOffsets = {
+            vertexOffset, indexOffset, boundsOffset, m_Ranges.size() * sizeof(MeshRange)
+        };
+
+        std::array<VkDeviceSize, 4> stagingOffsets{};
+        VkDeviceSize                stagingSize = 0;
+        for (size_t i = 0; i < sources.size(); i++) {
+            stagingOffsets[i] = stagingSize;
+            stagingSize       = (stagingSize + sources[i].size() + 15) & ~VkDeviceSize{15};
+        }
+
+        Vulkan::Buffer staging = Vulkan::Buffer::Create(
+            *m_Device, stagingSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        for (size_t i = 0; i < sources.size(); i++) {
+            staging.Write(sources[i], stagingOffsets[i]);
+        }
+        staging.Unmap();
+
+        m_Device->SubmitImmediate([&](const VkCommandBuffer commandBuffer) {
+            for (size_t i = 0; i < sources.size(); i++) {
+                if (sources[i].empty()) {
+                    continue;
+                }
+
+                VkBufferCopy region{};
+                region.srcOffset = stagingOffsets[i];
+                region.dstOffset = targetOffsets[i];
+                region.size      = sources[i].size();
+
+                vkCmdCopyBuffer(commandBuffer, staging.GetVkBuffer(), targets[i]->GetVkBuffer(), 1, &region);
+            }
+        });
+
+        m_Ranges.push_back(range);
+
+        m_VertexCount += static_cast<uint32_t>(mesh.vertices.size());
+        m_IndexCount += static_cast<uint32_t>(mesh.indices.size());
+
+        return static_cast<uint32_t>(m_Ranges.size() - 1);
+    }
+
+    void MeshPool::Bind(const VkCommandBuffer commandBuffer) const {
+        const VkBuffer     vertexBuffer = m_VertexBuffer.GetVkBuffer();
+        const VkDeviceSize offset       = 0;
+
+        vkCmdBindVertexBuffers(commandBuffer, 0, 1, &vertexBuffer, &offset);
+        vkCmdBindIndexBuffer(commandBuffer, m_IndexBuffer.GetVkBuffer(), 0, VK_INDEX_TYPE_UINT32);
+    }
+
+    std::span<const MeshRange> MeshPool::GetRanges() const {
+        return m_Ranges;
+    }
+
+    const Vulkan::Buffer &MeshPool::GetBoundsBuffer() const {
+        return m_BoundsBuffer;
+    }
+
+    const Vulkan::Buffer &MeshPool::GetRangeBuffer() const {
+        return m_RangeBuffer;
+    }
+
+    uint32_t MeshPool::GetMeshCount() const {
+        return static_cast<uint32_t>(m_Ranges.size());
+    }
+
+    MeshPool::MeshPool(Vulkan::Buffer &&vertexBuffer, Vulkan::Buffer &&indexBuffer, Vulkan::Buffer &&boundsBuffer,
+                       Vulkan::Buffer &&rangeBuffer)
+        : m_VertexBuffer(std::move(vertexBuffer)), m_IndexBuffer(std::move(indexBuffer)),
+          m_BoundsBuffer(std::move(boundsBuffer)), m_RangeBuffer(std::move(rangeBuffer)) {
+    }
+}
@@ -0,0 +1,42 @@
+#ifndef PULSAR_MESHPOOL_HPP
+#define PULSAR_MESHPOOL_HPP
+
+#include "DrawList.hpp"
+#include "Mesh/GpuMesh.hpp"
+#include "Vulkan/Buffer.hpp"
+
+namespace Pulsar::Renderer {
+    // All meshes share one vertex and one index buffer so a single indirect call can draw any mix of them.
+    // Per-mesh dequantization bounds and MeshRanges are mirrored into storage buffers indexed by mesh index.
+    class MeshPool {
+    public:
+        static MeshPool Create(Vulkan::Device &device, uint32_t vertexCapacity, uint32_t indexCapacity,
+                               uint32_t meshCapacity);
+
+        // Returns the mesh index used in draw keys. Stages everything in one buffer and waits for a single copy
+        // submit, so the cost is one queue round trip per mesh.
+        uint32_t Add(const Mesh::QuantizedMesh &mesh);
+
+        void Bind(VkCommandBuffer commandBuffer) const;
+
+        [[nodiscard]] std::span<const MeshRange> GetRanges() const;
+        [[nodiscard]] const Vulkan::Buffer &     GetBoundsBuffer() const;
+        [[nodiscard]] const Vulkan::Buffer &     GetRangeBuffer() const;
+        [[nodiscard]] uint32_t                   GetMeshCount() const;
+
+    private:
+        Vulkan::Device *       m_Device = nullptr;
+        Vulkan::Buffer         m_VertexBuffer;
+        Vulkan::Buffer         m_IndexBuffer;
+        Vulkan::Buffer         m_BoundsBuffer;
+        Vulkan::Buffer         m_RangeBuffer;
+        std::vector<MeshRange> m_Ranges;
+        uint32_t               m_VertexCount = 0;
+        uint32_t               m_IndexCount  = 0;
+
+        MeshPool(Vulkan::Buffer &&vertexBuffer, Vulkan::Buffer &&indexBuffer, Vulkan::Buffer &&boundsBuffer,
+                 Vulkan::Buffer &&rangeBuffer);
+    };
+}
+
+#endif //PULSAR_MESHPOOL_HPP
@@ -0,0 +1,54 @@
+#include "RadixSort.hpp"
+
+namespace Pulsar::Renderer {
+    static constexpr uint32_t s_RadixBits   = 8;
+    static constexpr uint32_t s_BucketCount = 1U << s_RadixBits;
+    static constexpr uint32_t s_PassCount   = 64 / s_RadixBits;
+
+    void RadixSort(std::vector<DrawPacket> &packets, std::vector<DrawPacket> &scratch) {
+        const size_t count = packets.size();
+        if (count < 2) {
+            return;
+        }
+
+        // One read of the input builds the histograms for every pass.
+        std::array<std::array<uint32_t, s_BucketCount>, s_PassCount> histograms{};
+
+        for (const DrawPacket &packet : packets) {
+            for (uint32_t pass = 0; pass < s_PassCount; pass++) {
+                histograms[pass][(packet.key >> (pass * s_RadixBits)) & (s_BucketCount - 1)]++;
+            }
+        }
+
+        scratch.resize(count);
+
+        DrawPacket *source      = packets.data();
+        DrawPacket *destination = scratch.data();
+
+        for (uint32_t pass = 0; pass < s_PassCount; pass++) {
+            std::array<uint32_t, s_BucketCount> &histogram = histograms[pass];
+
+            const uint32_t shift = pass * s_RadixBits;
+            if (histogram[(source[0].key >> shift) & (s_BucketCount - 1)] == count) {
+                continue;
+            }
+
+            uint32_t offset = 0;
+            for (uint32_t &bucket : histogram) {
+                const uint32_t bucketCount = bucket;
+                bucket = offset;
+                offset += bucketCount;
+            }
+
+            for (size_t i = 0; i < count; i++) {
+                destination[histogram[(source[i].key >> shift) & (s_BucketCount - 1)]++] = source[i];
+            }
+
+            std::swap(source, destination);
+        }
+
+        if (source != packets.data()) {
+            packets.swap(scratch);
+        }
+    }
+}
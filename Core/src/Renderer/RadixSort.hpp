@@ -0,0 +1,15 @@
+#ifndef PULSAR_RADIXSORT_HPP
+#define PULSAR_RADIXSORT_HPP
+
+#include <vector>
+
+#include "DrawKey.hpp"
+
+namespace Pulsar::Renderer {
+    // Stable LSD radix sort on DrawPacket::key, 8 bits per pass. Passes where every key has the same byte are
+    // skipped, so sparse key spaces (few pipelines, few descriptor sets) only pay for the bytes that vary.
+    // scratch is resized as needed and can be reused between calls to avoid allocations.
+    void RadixSort(std::vector<DrawPacket> &packets, std::vector<DrawPacket> &scratch);
+}
+
+#endif //PULSAR_RADIXSORT_HPP
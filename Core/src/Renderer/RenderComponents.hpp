@@ -0,0 +1,19 @@
+#ifndef PULSAR_RENDERCOMPONENTS_HPP
+#define PULSAR_RENDERCOMPONENTS_HPP
+
+#include "Math/Matrix.hpp"
+
+namespace Pulsar::Renderer {
+    struct WorldTransform {
+        Math::Mat4 matrix = Math::Mat4::Identity();
+    };
+
+    // Indices into the pipeline, descriptor set and MeshPool tables passed to the DrawSubmitter.
+    struct MeshRenderer {
+        uint32_t pipeline      = 0;
+        uint32_t descriptorSet = 0;
+        uint32_t mesh          = 0;
+    };
+}
+
+#endif //PULSAR_RENDERCOMPONENTS_HPP
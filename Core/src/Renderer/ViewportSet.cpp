@@ -0,0 +1,405 @@
+#include "ViewportSet.hpp"
+
+namespace Pulsar::Renderer {
+    static constexpr VkPipelineStageFlags s_WaitStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+
+    ViewportSet ViewportSet::Create(Vulkan::Device &device, Threading::JobSystem &jobSystem,
+                                    const uint32_t framesInFlight) {
+        if (framesInFlight == 0) {
+            throw std::runtime_error("Failed to create viewport set: Frame count is zero");
+        }
+
+        ViewportSet viewportSet;
+        viewportSet.m_Device    = &device;
+        viewportSet.m_JobSystem = &jobSystem;
+
+        viewportSet.m_FrameValues.resize(framesInFlight, 0);
+
+        VkPhysicalDeviceProperties properties;
+        vkGetPhysicalDeviceProperties(device.GetVkPhysicalDevice(), &properties);
+
+        uint32_t familyCount = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(device.GetVkPhysicalDevice(), &familyCount, nullptr);
+
+        std::vector<VkQueueFamilyProperties> families(familyCount);
+        vkGetPhysicalDeviceQueueFamilyProperties(device.GetVkPhysicalDevice(), &familyCount, families.data());
+
+        if (const uint32_t validBits = families[device.GetGraphicsQueueFamily()].timestampValidBits; validBits != 0) {
+            viewportSet.m_TimestampPeriod = properties.limits.timestampPeriod;
+            viewportSet.m_TimestampMask   = validBits >= 64 ? ~0ULL : (1ULL << validBits) - 1;
+        }
+
+        viewportSet.m_TimedFrames.resize(framesInFlight, 0);
+        viewportSet.m_TimedViewports.resize(framesInFlight);
+
+        return viewportSet;
+    }
+
+    ViewportSet::~ViewportSet() {
+        Destroy();
+    }
+
+    ViewportSet::ViewportSet(ViewportSet &&other) noexcept
+        : m_Viewports(std::move(other.m_Viewports)),
+          m_FrameValues(std::move(other.m_FrameValues)),
+          m_FrameIndex(other.m_FrameIndex),
+          m_PresentBatch(std::move(other.m_PresentBatch)),
+          m_Ready(std::move(other.m_Ready)),
+          m_Stale(std::move(other.m_Stale)),
+          m_CommandBuffers(std::move(other.m_CommandBuffers)),
+          m_WaitSemaphores(std::move(other.m_WaitSemaphores)),
+          m_WaitStages(std::move(other.m_WaitStages)),
+          m_SignalSemaphores(std::move(other.m_SignalSemaphores)),
+          m_JobSystem(other.m_JobSystem),
+          m_Device(std::exchange(other.m_Device, nullptr)),
+          m_FrameStats(other.m_FrameStats),
+          m_TimestampPeriod(other.m_TimestampPeriod),
+          m_TimestampMask(other.m_TimestampMask),
+          m_TimedFrames(std::move(other.m_TimedFrames)),
+          m_TimedViewports(std::move(other.m_TimedViewports)) {
+    }
+
+    ViewportSet &ViewportSet::operator=(ViewportSet &&other) noexcept {
+        if (this != &other) {
+            Destroy();
+
+            m_Viewports        = std::move(other.m_Viewports);
+            m_FrameValues      = std::move(other.m_FrameValues);
+            m_FrameIndex       = other.m_FrameIndex;
+            m_PresentBatch     = std::move(other.m_PresentBatch);
+            m_Ready            = std::move(other.m_Ready);
+            m_Stale            = std::move(other.m_Stale);
+            m_CommandBuffers   = std::move(other.m_CommandBuffers);
+            m_WaitSemaphores   = std::move(other.m_WaitSemaphores);
+            m_WaitStages       = std::move(other.m_WaitStages);
+            m_SignalSemaphores = std::move(other.m_SignalSemaphores);
+            m_JobSystem        = other.m_JobSystem;
+            m_Device           = std::exchange(other.m_Device, nullptr);
+
+            m_FrameStats      = other.m_FrameStats;
+            m_TimestampPeriod = other.m_TimestampPeriod;
+            m_TimestampMask   = other.m_TimestampMask;
+            m_TimedFrames     = std::move(other.m_TimedFrames);
+            m_TimedViewports  = std::move(other.m_TimedViewports);
+        }
+
+        return *this;
+    }
+
+    uint32_t ViewportSet::Add(const Glfw::Window &window, Vulkan::SwapChain &swapChain) {
+        // Reuse a removed slot; its per-frame resources are still valid.
+        for (uint32_t i = 0; i < m_Viewports.size(); i++) {
+            if (!m_Viewports[i].active) {
+                m_Viewports[i].window    = &window;
+                m_Viewports[i].swapChain = &swapChain;
+                m_Viewports[i].active    = true;
+
+                return i;
+            }
+        }
+
+        Viewport viewport;
+        viewport.window    = &window;
+        viewport.swapChain = &swapChain;
+        viewport.active    = true;
+
+        for (size_t i = 0; i < m_FrameValues.size(); i++) {
+            viewport.frames.push_back(CreateFrameResources());
+        }
+
+        m_Viewports.push_back(std::move(viewport));
+
+        return static_cast<uint32_t>(m_Viewports.size() - 1);
+    }
+
+    void ViewportSet::Remove(const uint32_t viewport) {
+        // The viewport's semaphores and command buffers may still be in use by frames in flight.
+        m_Device->GetGraphicsTimeline().Wait(std::ranges::max(m_FrameValues));
+
+        Viewport &slot = m_Viewports.at(viewport);
+        slot.window    = nullptr;
+        slot.swapChain = nullptr;
+        slot.active    = false;
+    }
+
+    void ViewportSet::SetSwapChain(const uint32_t viewport, Vulkan::SwapChain &swapChain) {
+        m_Viewports.at(viewport).swapChain = &swapChain;
+    }
+
+    void ViewportSet::SetFrameStats(Telemetry::FrameStats *stats) {
+        m_FrameStats = stats;
+    }
+
+    ViewportStatistics ViewportSet::Render(const RecordFunction &record) {
+        Vulkan::QueueTimeline &timeline = m_Device->GetGraphicsTimeline();
+        const uint32_t         frame    = m_FrameIndex;
+
+        std::optional<Telemetry::FrameStats::ScopedTimer> timer;
+        timer.emplace(m_FrameStats, Telemetry::FrameMetric::AcquireWait);
+
+        timeline.Wait(m_FrameValues[frame]);
+
+        if (m_TimedFrames[frame] != 0) {
+            ResolveGpuTime(frame);
+        }
+
+        ViewportStatistics statistics;
+        m_Ready.clear();
+        m_Stale.clear();
+
+        const bool timed = m_FrameStats != nullptr && m_FrameStats->IsEnabled() && m_TimestampPeriod > 0.0F;
+
+        // An acquired image's semaphore is signaled, so failing before the submit must still wait on it.
+        try {
+            for (uint32_t i = 0; i < m_Viewports.size(); i++) {
+                Viewport &viewport = m_Viewports[i];
+                if (!viewport.active) {
+                    continue;
+                }
+
+                const Glfw::WindowState windowState = viewport.window->GetState();
+                if (windowState.minimized || windowState.framebufferWidth == 0 || windowState.framebufferHeight == 0) {
+                    statistics.skipped++;
+                    continue;
+                }
+
+                const VkResult result = viewport.swapChain->AcquireNextImage(viewport.frames[frame].imageAvailable);
+
+                if (result == VK_ERROR_OUT_OF_DATE_KHR) {
+                    m_Stale.push_back(i);
+                    continue;
+                }
+
+                if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR) {
+                    throw std::runtime_error("Failed to acquire swap chain image: Unknown error");
+                }
+
+                m_Ready.push_back(i);
+            }
+
+            timer.reset();
+
+            if (m_Ready.empty()) {
+                statistics.stale = static_cast<uint32_t>(m_Stale.size());
+                return statistics;
+            }
+
+            // Every viewport records into its own pool, so the jobs never share Vulkan objects.
+            m_JobSystem->ParallelFor(static_cast<uint32_t>(m_Ready.size()), [this, frame, timed, &record](
+                                     const uint32_t begin, const uint32_t end) {
+                for (uint32_t i = begin; i < end; i++) {
+                    const uint32_t        index     = m_Ready[i];
+                    const Viewport &      viewport  = m_Viewports[index];
+                    const FrameResources &resources = viewport.frames[frame];
+
+                    vkResetCommandPool(m_Device->GetVkLogicalDevice(), resources.commandPool, 0);
+
+                    VkCommandBufferBeginInfo beginInfo{};
+                    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+                    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+                    vkBeginCommandBuffer(resources.commandBuffer, &beginInfo);
+
+                    if (timed) {
+                        vkCmdResetQueryPool(resources.commandBuffer, resources.timestampPool, 0, 2);
+                        vkCmdWriteTimestamp(resources.commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                            resources.timestampPool, 0);
+                    }
+
+                    record(resources.commandBuffer, index, *viewport.swapChain);
+
+                    if (timed) {
+                        vkCmdWriteTimestamp(resources.commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                            resources.timestampPool, 1);
+                    }
+
+                    vkEndCommandBuffer(resources.commandBuffer);
+                }
+            }, 1);
+        } catch (...) {
+            AbandonFrame(frame);
+            throw;
+        }
+
+        // One batch for every viewport: each command buffer waits for all acquired images, which are all
+        // acquired by now anyway, and every present waits for the whole batch.
+        m_CommandBuffers.clear();
+        m_WaitSemaphores.clear();
+        m_WaitStages.clear();
+        m_SignalSemaphores.clear();
+
+        for (const uint32_t index : m_Ready) {
+            const FrameResources &resources = m_Viewports[index].frames[frame];
+
+            m_CommandBuffers.push_back(resources.commandBuffer);
+            m_WaitSemaphores.push_back(resources.imageAvailable);
+            m_WaitStages.push_back(s_WaitStage);
+            m_SignalSemaphores.push_back(resources.renderFinished);
+
+            m_PresentBatch.Add(*m_Viewports[index].swapChain, resources.renderFinished);
+        }
+
+        timer.emplace(m_FrameStats, Telemetry::FrameMetric::Submit);
+
+        Vulkan::QueueSubmitInfo submitInfo{};
+        submitInfo.commandBuffers   = m_CommandBuffers;
+        submitInfo.binaryWaits      = m_WaitSemaphores;
+        submitInfo.binaryWaitStages = m_WaitStages;
+        submitInfo.binarySignals    = m_SignalSemaphores;
+
+        m_FrameValues[frame] = timeline.Submit(submitInfo);
+
+        if (timed) {
+            m_TimedFrames[frame]    = m_FrameStats->GetCurrentFrame();
+            m_TimedViewports[frame] = m_Ready;
+        }
+
+        timer.emplace(m_FrameStats, Telemetry::FrameMetric::Present);
+
+        const std::span<const VkResult> results = m_PresentBatch.Present(*m_Device);
+
+        timer.reset();
+
+        for (size_t i = 0; i < results.size(); i++) {
+            if (results[i] == VK_ERROR_OUT_OF_DATE_KHR || results[i] == VK_SUBOPTIMAL_KHR) {
+                m_Stale.push_back(m_Ready[i]);
+            } else if (results[i] == VK_SUCCESS) {
+                statistics.presented++;
+            }
+        }
+
+        statistics.stale = static_cast<uint32_t>(m_Stale.size());
+        m_FrameIndex     = (m_FrameIndex + 1) % static_cast<uint32_t>(m_FrameValues.size());
+
+        return statistics;
+    }
+
+    std::span<const uint32_t> ViewportSet::GetStaleViewports() const {
+        return m_Stale;
+    }
+
+    uint32_t ViewportSet::GetFrameIndex() const {
+        return m_FrameIndex;
+    }
+
+    Vulkan::TimelinePoint ViewportSet::GetFramePoint() const {
+        return m_Device->GetGraphicsTimeline().GetNextPoint();
+    }
+
+    void ViewportSet::AbandonFrame(const uint32_t frame) {
+        m_WaitSemaphores.clear();
+        m_WaitStages.clear();
+
+        for (const uint32_t index : m_Ready) {
+            m_WaitSemaphores.push_back(m_Viewports[index].frames[frame].imageAvailable);
+            m_WaitStages.push_back(s_WaitStage);
+            m_Stale.push_back(index);
+        }
+
+        if (m_WaitSemaphores.empty()) {
+            return;
+        }
+
+        Vulkan::QueueSubmitInfo submitInfo{};
+        submitInfo.binaryWaits      = m_WaitSemaphores;
+        submitInfo.binaryWaitStages = m_WaitStages;
+
+        m_FrameValues[frame] = m_Device->GetGraphicsTimeline().Submit(submitInfo);
+    }
+
+    // The frame's timeline value has been reached, so every query it wrote is available.
+    void ViewportSet::ResolveGpuTime(const uint32_t frame) {
+        uint64_t begin = UINT64_MAX;
+        uint64_t end   = 0;
+
+        for (const uint32_t index : m_TimedViewports[frame]) {
+            std::array<uint64_t, 2> timestamps{};
+
+            if (vkGetQueryPoolResults(m_Device->GetVkLogicalDevice(), m_Viewports[index].frames[frame].timestampPool,
+                                      0, 2, sizeof(timestamps), timestamps.data(), sizeof(uint64_t),
+                                      VK_QUERY_RESULT_64_BIT) == VK_SUCCESS) {
+                begin = std::min(begin, timestamps[0] & m_TimestampMask);
+                end   = std::max(end, timestamps[1] & m_TimestampMask);
+            }
+        }
+
+        if (m_FrameStats != nullptr && end > begin) {
+            const double nanoseconds = static_cast<double>(end - begin) * m_TimestampPeriod;
+            m_FrameStats->Record(m_TimedFrames[frame], Telemetry::FrameMetric::Gpu,
+                                 std::chrono::nanoseconds(static_cast<int64_t>(nanoseconds)));
+        }
+
+        m_TimedFrames[frame] = 0;
+    }
+
+    ViewportSet::FrameResources ViewportSet::CreateFrameResources() const {
+        const VkDevice device = m_Device->GetVkLogicalDevice();
+
+        FrameResources resources;
+
+        VkCommandPoolCreateInfo poolInfo{};
+        poolInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        poolInfo.queueFamilyIndex = m_Device->GetGraphicsQueueFamily();
+
+        if (vkCreateCommandPool(device, &poolInfo, nullptr, &resources.commandPool) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create command pool: Unknown error");
+        }
+
+        VkCommandBufferAllocateInfo allocateInfo{};
+        allocateInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocateInfo.commandPool        = resources.commandPool;
+        allocateInfo.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocateInfo.commandBufferCount = 1;
+
+        VkSemaphoreCreateInfo semaphoreInfo{};
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+
+        VkQueryPoolCreateInfo queryPoolInfo{};
+        queryPoolInfo.sType      = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        queryPoolInfo.queryType  = VK_QUERY_TYPE_TIMESTAMP;
+        queryPoolInfo.queryCount = 2;
+
+        if (vkAllocateCommandBuffers(device, &allocateInfo, &resources.commandBuffer) != VK_SUCCESS ||
+            vkCreateSemaphore(device, &semaphoreInfo, nullptr, &resources.imageAvailable) != VK_SUCCESS ||
+            vkCreateSemaphore(device, &semaphoreInfo, nullptr, &resources.renderFinished) != VK_SUCCESS ||
+            (m_TimestampPeriod > 0.0F &&
+             vkCreateQueryPool(device, &queryPoolInfo, nullptr, &resources.timestampPool) != VK_SUCCESS)) {
+            vkDestroySemaphore(device, resources.renderFinished, nullptr);
+            vkDestroySemaphore(device, resources.imageAvailable, nullptr);
+            vkDestroyCommandPool(device, resources.commandPool, nullptr);
+            throw std::runtime_error("Failed to create viewport frame resources: Unknown error");
+        }
+
+        return resources;
+    }
+
+    void ViewportSet::Destroy() {
+        if (m_Device == nullptr) {
+            return;
+        }
+
+        const VkDevice device = m_Device->GetVkLogicalDevice();
+
+        try {
+            if (!m_FrameValues.empty()) {
+                m_Device->GetGraphicsTimeline().Wait(std::ranges::max(m_FrameValues));
+            }
+        } catch (const std::exception &) {
+            // The device is gone; nothing is left using the frame resources.
+        }
+
+        for (const Viewport &viewport : m_Viewports) {
+            for (const FrameResources &resources : viewport.frames) {
+                vkDestroySemaphore(device, resources.renderFinished, nullptr);
+                vkDestroySemaphore(device, resources.imageAvailable, nullptr);
+                vkDestroyCommandPool(device, resources.commandPool, nullptr);
+                vkDestroyQueryPool(device, resources.timestampPool, nullptr);
+            }
+        }
+
+        m_Viewports.clear();
+        m_FrameValues.clear();
+        m_Device = nullptr;
+    }
+}
@@ -0,0 +1,109 @@
+#ifndef PULSAR_VIEWPORTSET_HPP
+#define PULSAR_VIEWPORTSET_HPP
+
+#include "Telemetry/FrameStats.hpp"
+#include "Threading/JobSystem.hpp"
+#include "Vulkan/PresentBatch.hpp"
+
+namespace Pulsar::Renderer {
+    struct ViewportStatistics {
+        uint32_t presented = 0;
+        uint32_t skipped   = 0;
+        uint32_t stale     = 0;
+    };
+
+    // Renders any number of windows through one Device. Each frame acquires every visible viewport's image,
+    // records their command buffers in parallel on the job system, submits them as one batch on the device's
+    // graphics timeline and presents them with one vkQueuePresentKHR, so another window costs one more job rather
+    // than another full serial frame. Minimized windows and windows with an empty framebuffer are skipped.
+    class ViewportSet {
+    public:
+        // Called once per ready viewport, possibly on several threads at once. The command buffer is already
+        // begun; the callback must leave the acquired image in VK_IMAGE_LAYOUT_PRESENT_SRC_KHR. It must not
+        // submit to the graphics queue itself, e.g. through Device::SubmitImmediate.
+        using RecordFunction = std::function<void(VkCommandBuffer commandBuffer, uint32_t viewport,
+                                                  const Vulkan::SwapChain &swapChain)>;
+
+        static ViewportSet Create(Vulkan::Device &device, Threading::JobSystem &jobSystem,
+                                  uint32_t framesInFlight = 2);
+
+        ~ViewportSet();
+
+        ViewportSet(const ViewportSet &other) = delete;
+        ViewportSet(ViewportSet &&other) noexcept;
+
+        ViewportSet &operator=(const ViewportSet &other) = delete;
+        ViewportSet &operator=(ViewportSet &&other) noexcept;
+
+        // The window and swap chain are borrowed. Returns the viewport index passed to RecordFunction.
+        uint32_t Add(const Glfw::Window &window, Vulkan::SwapChain &swapChain);
+        void     Remove(uint32_t viewport);
+
+        // Call after recreating a swap chain reported by GetStaleViewports.
+        void SetSwapChain(uint32_t viewport, Vulkan::SwapChain &swapChain);
+
+        // Render then records AcquireWait (including the timeline wait), Submit and Present into the stats' current
+        // frame, and Gpu from timestamp queries once the frame has finished. Pass nullptr to detach.
+        void SetFrameStats(Telemetry::FrameStats *stats);
+
+        // Blocks until the GPU has finished the frame that last used the current frame slot.
+        ViewportStatistics Render(const RecordFunction &record);
+
+        // Viewports whose swap chain was out of date or suboptimal during the last Render.
+        [[nodiscard]] std::span<const uint32_t> GetStaleViewports() const;
+        [[nodiscard]] uint32_t                  GetFrameIndex() const;
+
+        // The graphics timeline point the frame being recorded signals. Record callbacks mark what they use with
+        // it (ResourceUsage::Use) so a RetireQueue can free those resources once the frame is done.
+        [[nodiscard]] Vulkan::TimelinePoint GetFramePoint() const;
+
+    private:
+        struct FrameResources {
+            VkCommandPool   commandPool    = nullptr;
+            VkCommandBuffer commandBuffer  = nullptr;
+            VkSemaphore     imageAvailable = nullptr;
+            VkSemaphore     renderFinished = nullptr;
+            VkQueryPool     timestampPool  = nullptr;
+        };
+
+        struct Viewport {
+            const Glfw::Window *         window    = nullptr;
+            Vulkan::SwapChain *         swapChain = nullptr;
+            std::vector<FrameResources> frames;
+            bool                        active = false;
+        };
+
+        std::vector<Viewport>             m_Viewports;
+        std::vector<uint64_t>             m_FrameValues; // Graphics timeline value that last used each slot.
+        uint32_t                          m_FrameIndex = 0;
+        Vulkan::PresentBatch              m_PresentBatch;
+        std::vector<uint32_t>             m_Ready;
+        std::vector<uint32_t>             m_Stale;
+        std::vector<VkCommandBuffer>      m_CommandBuffers;
+        std::vector<VkSemaphore>          m_WaitSemaphores;
+        std::vector<VkPipelineStageFlags> m_WaitStages;
+        std::vector<VkSemaphore>          m_SignalSemaphores;
+        Threading::JobSystem *            m_JobSystem = nullptr;
+        Vulkan::Device *                  m_Device    = nullptr;
+
+        Telemetry::FrameStats *            m_FrameStats      = nullptr;
+        float                              m_TimestampPeriod = 0.0F;
+        uint64_t                           m_TimestampMask   = 0;
+        std::vector<uint64_t>              m_TimedFrames;
+        std::vector<std::vector<uint32_t>> m_TimedViewports;
+
+        ViewportSet() = default;
+
+        [[nodiscard]] FrameResources CreateFrameResources() const;
+
+        // Unsignals the acquire semaphores of a frame that failed before its submit, with a submit that only waits
+        // on them. The acquired images are never presented, so those viewports are reported stale: recreating
+        // their swap chains releases the images.
+        void AbandonFrame(uint32_t frame);
+        void ResolveGpuTime(uint32_t frame);
+
+        void Destroy();
+    };
+}
+
+#endif //PULSAR_VIEWPORTSET_HPP
@@ -0,0 +1,200 @@
+#include "Scene.hpp"
+
+#include "Renderer/RenderComponents.hpp"
+
+namespace Pulsar::Scene {
+    static const SceneSection *FindSection(const std::span<const std::byte> data, const SceneSectionType type) {
+        SceneHeader header;
+        std::memcpy(&header, data.data(), sizeof(header));
+
+        const auto *sections = reinterpret_cast<const SceneSection *>(data.data() + sizeof(SceneHeader));
+
+        for (uint32_t i = 0; i < header.sectionCount; i++) {
+            if (sections[i].type == type) {
+                return &sections[i];
+            }
+        }
+
+        return nullptr;
+    }
+
+    template<typename T>
+    static SceneArray<T> GetArray(const std::span<const std::byte> data, const SceneSectionType type) {
+        const SceneSection *section = FindSection(data, type);
+
+        if (section == nullptr) {
+            return {};
+        }
+
+        return {data.data() + section->offset, section->count, section->stride};
+    }
+
+    Scene Scene::Open(const std::string &path) {
+        Scene scene(FileIo::MappedFile::Open(path));
+
+        const std::span<const std::byte> data = scene.m_File.GetData();
+        Validate(data);
+
+        scene.m_Nodes         = GetArray<SceneNode>(data, SceneSectionType::Nodes);
+        scene.m_Transforms    = GetArray<Math::Mat4>(data, SceneSectionType::Transforms);
+        scene.m_MeshRenderers = GetArray<SceneMeshRenderer>(data, SceneSectionType::MeshRenderers);
+
+        if (const SceneSection *strings = FindSection(data, SceneSectionType::Strings)) {
+            scene.m_Strings = {reinterpret_cast<const char *>(data.data() + strings->offset), strings->size};
+        }
+
+        return scene;
+    }
+
+    void Scene::Validate(const std::span<const std::byte> data) {
+        if (data.size() < sizeof(SceneHeader)) {
+            throw std::runtime_error("Failed to validate scene: File too small");
+        }
+
+        SceneHeader header;
+        std::memcpy(&header, data.data(), sizeof(header));
+
+        if (header.magic != g_SceneMagic) {
+            throw std::runtime_error("Failed to validate scene: Invalid magic");
+        }
+
+        if (header.version != g_SceneVersion) {
+            throw std::runtime_error("Failed to validate scene: Unsupported version");
+        }
+
+        if (header.fileSize != data.size()) {
+            throw std::runtime_error("Failed to validate scene: Truncated file");
+        }
+
+        if (sizeof(SceneHeader) + static_cast<uint64_t>(header.sectionCount) * sizeof(SceneSection) > data.size()) {
+            throw std::runtime_error("Failed to validate scene: Corrupt section table");
+        }
+
+        if (reinterpret_cast<uintptr_t>(data.data()) % g_SceneAlignment != 0) {
+            throw std::runtime_error("Failed to validate scene: Data not aligned");
+        }
+
+        const auto *sections = reinterpret_cast<const SceneSection *>(data.data() + sizeof(SceneHeader));
+
+        // Minimum record size of each known section type; zero for raw bytes.
+        const auto recordSize = [](const SceneSectionType type) -> std::optional<uint64_t> {
+            switch (type) {
+            case SceneSectionType::Nodes:
+                return sizeof(SceneNode);
+            case SceneSectionType::Transforms:
+                return sizeof(Math::Mat4);
+            case SceneSectionType::MeshRenderers:
+                return sizeof(SceneMeshRenderer);
+            case SceneSectionType::Strings:
+                return 0;
+            }
+
+            return std::nullopt;
+        };
+
+        for (uint32_t i = 0; i < header.sectionCount; i++) {
+            const SceneSection &section = sections[i];
+
+            if (section.offset % g_SceneAlignment != 0 || section.offset > data.size() ||
+                section.size > data.size() - section.offset) {
+                throw std::runtime_error("Failed to validate scene: Section out of bounds");
+            }
+
+            const std::optional<uint64_t> minimum = recordSize(section.type);
+            if (!minimum.has_value()) {
+                continue;
+            }
+
+            if (FindSection(data, section.type) != &section) {
+                throw std::runtime_error("Failed to validate scene: Duplicate section");
+            }
+
+            if (*minimum != 0 && (section.stride < *minimum || section.stride % alignof(uint32_t) != 0 ||
+                                  static_cast<uint64_t>(section.count) * section.stride > section.size)) {
+                throw std::runtime_error("Failed to validate scene: Corrupt section");
+            }
+        }
+
+        const SceneArray<SceneNode>         nodes         = GetArray<SceneNode>(data, SceneSectionType::Nodes);
+        const SceneArray<Math::Mat4>        transforms    = GetArray<Math::Mat4>(data, SceneSectionType::Transforms);
+        const SceneArray<SceneMeshRenderer> meshRenderers = GetArray<SceneMeshRenderer>(
+            data, SceneSectionType::MeshRenderers);
+
+        const SceneSection *strings     = FindSection(data, SceneSectionType::Strings);
+        const uint64_t      stringsSize = strings != nullptr ? strings->size : 0;
+
+        if (transforms.size() != nodes.size()) {
+            throw std::runtime_error("Failed to validate scene: Transform count mismatch");
+        }
+
+        if (const SceneSection *section = FindSection(data, SceneSectionType::Transforms);
+            section != nullptr && section->stride % alignof(Math::Mat4) != 0) {
+            throw std::runtime_error("Failed to validate scene: Misaligned transforms");
+        }
+
+        for (uint32_t i = 0; i < nodes.size(); i++) {
+            const SceneNode &node = nodes[i];
+
+            if (static_cast<uint64_t>(node.nameOffset) + node.nameLength > stringsSize) {
+                throw std::runtime_error("Failed to validate scene: Name out of bounds");
+            }
+
+            if (node.parent != g_SceneNoParent && node.parent >= i) {
+                throw std::runtime_error("Failed to validate scene: Parent after child");
+            }
+        }
+
+        for (uint32_t i = 0; i < meshRenderers.size(); i++) {
+            if (meshRenderers[i].node >= nodes.size() ||
+                (i > 0 && meshRenderers[i].node <= meshRenderers[i - 1].node)) {
+                throw std::runtime_error("Failed to validate scene: Mesh renderer node out of order");
+            }
+        }
+    }
+
+    Scene::Scene(FileIo::MappedFile file) : m_File(std::move(file)) {
+    }
+
+    uint32_t Scene::GetNodeCount() const {
+        return m_Nodes.size();
+    }
+
+    SceneArray<SceneNode> Scene::GetNodes() const {
+        return m_Nodes;
+    }
+
+    SceneArray<Math::Mat4> Scene::GetTransforms() const {
+        return m_Transforms;
+    }
+
+    SceneArray<SceneMeshRenderer> Scene::GetMeshRenderers() const {
+        return m_MeshRenderers;
+    }
+
+    std::string_view Scene::GetName(const SceneNode &node) const {
+        return m_Strings.substr(node.nameOffset, node.nameLength);
+    }
+
+    std::vector<Ecs::Entity> Scene::Instantiate(Ecs::World &world) const {
+        std::vector<Ecs::Entity> entities(m_Nodes.size());
+
+        // Mesh renderers are sorted by node, so one pass pairs them up and every entity is created with its
+        // final set of components.
+        uint32_t meshRenderer = 0;
+
+        for (uint32_t node = 0; node < m_Nodes.size(); node++) {
+            const Renderer::WorldTransform transform = {m_Transforms[node]};
+
+            if (meshRenderer < m_MeshRenderers.size() && m_MeshRenderers[meshRenderer].node == node) {
+                const SceneMeshRenderer &stored = m_MeshRenderers[meshRenderer++];
+
+                entities[node] = world.CreateEntity(
+                    transform, Renderer::MeshRenderer{stored.pipeline, stored.descriptorSet, stored.mesh});
+            } else {
+                entities[node] = world.CreateEntity(transform);
+            }
+        }
+
+        return entities;
+    }
+}
@@ -0,0 +1,87 @@
+#ifndef PULSAR_SCENE_HPP
+#define PULSAR_SCENE_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "SceneFormat.hpp"
+#include "Ecs/World.hpp"
+#include "FileIo/MappedFile.hpp"
+
+namespace Pulsar::Scene {
+    // Records of one section, read in place with the section's stride.
+    template<typename T>
+    class SceneArray {
+    public:
+        class Iterator {
+        public:
+            Iterator(const std::byte *record, const uint32_t stride) : m_Record(record), m_Stride(stride) {}
+
+            const T &operator*() const { return *reinterpret_cast<const T *>(m_Record); }
+
+            Iterator &operator++() {
+                m_Record += m_Stride;
+                return *this;
+            }
+
+            bool operator==(const Iterator &other) const { return m_Record == other.m_Record; }
+
+        private:
+            const std::byte *m_Record;
+            uint32_t         m_Stride;
+        };
+
+        SceneArray() = default;
+
+        SceneArray(const std::byte *data, const uint32_t count, const uint32_t stride)
+            : m_Data(data), m_Count(count), m_Stride(stride) {
+        }
+
+        const T &operator[](const uint32_t index) const {
+            return *reinterpret_cast<const T *>(m_Data + static_cast<size_t>(index) * m_Stride);
+        }
+
+        [[nodiscard]] uint32_t size() const { return m_Count; }
+        [[nodiscard]] bool     empty() const { return m_Count == 0; }
+
+        [[nodiscard]] Iterator begin() const { return {m_Data, m_Stride}; }
+        [[nodiscard]] Iterator end() const { return {m_Data + static_cast<size_t>(m_Count) * m_Stride, m_Stride}; }
+
+    private:
+        const std::byte *m_Data   = nullptr;
+        uint32_t         m_Count  = 0;
+        uint32_t         m_Stride = sizeof(T);
+    };
+
+    // A .pscene file mapped and validated once in Open, then read in place: nothing is parsed or copied until
+    // Instantiate creates the entities.
+    class Scene {
+    public:
+        static Scene Open(const std::string &path);
+
+        // Throws with the first problem found. Open runs it, so every accessor can trust the offsets.
+        static void Validate(std::span<const std::byte> data);
+
+        [[nodiscard]] uint32_t                      GetNodeCount() const;
+        [[nodiscard]] SceneArray<SceneNode>         GetNodes() const;
+        [[nodiscard]] SceneArray<Math::Mat4>        GetTransforms() const;
+        [[nodiscard]] SceneArray<SceneMeshRenderer> GetMeshRenderers() const;
+        [[nodiscard]] std::string_view              GetName(const SceneNode &node) const;
+
+        // Creates an entity with a Renderer::WorldTransform per node, plus a Renderer::MeshRenderer where the
+        // scene has one. The result is indexed by node.
+        std::vector<Ecs::Entity> Instantiate(Ecs::World &world) const;
+
+    private:
+        FileIo::MappedFile            m_File;
+        SceneArray<SceneNode>         m_Nodes;
+        SceneArray<Math::Mat4>        m_Transforms;
+        SceneArray<SceneMeshRenderer> m_MeshRenderers;
+        std::string_view              m_Strings;
+
+        explicit Scene(FileIo::MappedFile file);
+    };
+}
+
+#endif //PULSAR_SCENE_HPP
@@ -0,0 +1,73 @@
+#ifndef PULSAR_SCENEFORMAT_HPP
+#define PULSAR_SCENEFORMAT_HPP
+
+#include <array>
+#include <cstdint>
+
+#include "Math/Matrix.hpp"
+
+namespace Pulsar::Scene {
+    // Layout of a .pscene file:
+    //   SceneHeader | SceneSection[sectionCount] | section data (each section 16-byte aligned)
+    // Every reference is an offset, from the start of the file for sections and from the start of the string
+    // section for names, so a mapped file is used in place. Records are read with the section's stride: newer
+    // writers may append fields to a record and bump its section version, which older readers skip over.
+    // Sections of unknown type are ignored. Anything else incompatible bumps g_SceneVersion.
+
+    constexpr std::array<char, 4> g_SceneMagic     = {'P', 'S', 'C', 'N'};
+    constexpr uint32_t            g_SceneVersion   = 1;
+    constexpr uint64_t            g_SceneAlignment = 16;
+    constexpr uint32_t            g_SceneNoParent  = ~0U;
+
+    enum class SceneSectionType : uint32_t {
+        Nodes,         // SceneNode[nodeCount]; parents come before their children.
+        Transforms,    // Math::Mat4[nodeCount], world space.
+        MeshRenderers, // SceneMeshRenderer[], sorted by node, at most one per node.
+        Strings
+    };
+
+    struct SceneHeader {
+        std::array<char, 4> magic;
+        uint32_t            version;
+        uint32_t            sectionCount;
+        uint32_t            reserved;
+        uint64_t            fileSize;
+        uint64_t            reserved2;
+    };
+
+    struct SceneSection {
+        SceneSectionType type;
+        uint32_t         version;
+        uint64_t         offset;
+        uint64_t         size;
+        uint32_t         count;
+        uint32_t         stride;
+    };
+
+    struct SceneNode {
+        uint32_t nameOffset;
+        uint32_t nameLength;
+        uint32_t parent;
+        uint32_t reserved;
+    };
+
+    struct SceneMeshRenderer {
+        uint32_t node;
+        uint32_t pipeline;
+        uint32_t descriptorSet;
+        uint32_t mesh;
+    };
+
+    // Versions written by this build, and the record each one describes.
+    constexpr uint32_t g_SceneNodeVersion         = 1;
+    constexpr uint32_t g_SceneTransformVersion    = 1;
+    constexpr uint32_t g_SceneMeshRendererVersion = 1;
+
+    static_assert(sizeof(SceneHeader) == 32);
+    static_assert(sizeof(SceneSection) == 32);
+    static_assert(sizeof(SceneNode) == 16);
+    static_assert(sizeof(SceneMeshRenderer) == 16);
+    static_assert(alignof(Math::Mat4) <= g_SceneAlignment);
+}
+
+#endif //PULSAR_SCENEFORMAT_HPP
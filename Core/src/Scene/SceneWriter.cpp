@@ -0,0 +1,131 @@
+#include "SceneWriter.hpp"
+
+#include <fstream>
+
+#include "Ecs/Query.hpp"
+
+namespace Pulsar::Scene {
+    SceneWriter SceneWriter::Create() {
+        return {};
+    }
+
+    uint32_t SceneWriter::AddNode(const std::string_view name, const Math::Mat4 &transform, const uint32_t parent) {
+        const auto index = static_cast<uint32_t>(m_Nodes.size());
+
+        if (parent != g_SceneNoParent && parent >= index) {
+            throw std::runtime_error("Failed to add scene node: Parent does not exist");
+        }
+
+        SceneNode node{};
+        node.nameOffset = static_cast<uint32_t>(m_Strings.size());
+        node.nameLength = static_cast<uint32_t>(name.size());
+        node.parent     = parent;
+
+        m_Nodes.push_back(node);
+        m_Transforms.push_back(transform);
+        m_MeshRenderers.emplace_back();
+        m_Strings += name;
+
+        return index;
+    }
+
+    void SceneWriter::SetMeshRenderer(const uint32_t node, const Renderer::MeshRenderer &meshRenderer) {
+        if (node >= m_Nodes.size()) {
+            throw std::runtime_error("Failed to set scene mesh renderer: Node does not exist");
+        }
+
+        m_MeshRenderers[node] = meshRenderer;
+    }
+
+    void SceneWriter::AddWorld(const Ecs::World &world) {
+        Ecs::Query<const Renderer::WorldTransform> query;
+
+        query.ForEach(world, [&](const Ecs::Entity entity, const Renderer::WorldTransform &transform) {
+            const uint32_t node = AddNode({}, transform.matrix);
+
+            if (const auto *meshRenderer = world.GetComponent<Renderer::MeshRenderer>(entity)) {
+                m_MeshRenderers[node] = *meshRenderer;
+            }
+        });
+    }
+
+    std::vector<std::byte> SceneWriter::Serialize() const {
+        std::vector<SceneMeshRenderer> meshRenderers;
+
+        for (uint32_t node = 0; node < m_MeshRenderers.size(); node++) {
+            if (const std::optional<Renderer::MeshRenderer> &meshRenderer = m_MeshRenderers[node]) {
+                meshRenderers.push_back({
+                    node, meshRenderer->pipeline, meshRenderer->descriptorSet, meshRenderer->mesh
+                });
+            }
+        }
+
+        struct PendingSection {
+            SceneSection     section;
+            const std::byte *data;
+        };
+
+        const std::array<PendingSection, 4> pending = {{
+            {{SceneSectionType::Nodes, g_SceneNodeVersion, 0, m_Nodes.size() * sizeof(SceneNode),
+              static_cast<uint32_t>(m_Nodes.size()), sizeof(SceneNode)},
+             reinterpret_cast<const std::byte *>(m_Nodes.data())},
+            {{SceneSectionType::Transforms, g_SceneTransformVersion, 0, m_Transforms.size() * sizeof(Math::Mat4),
+              static_cast<uint32_t>(m_Transforms.size()), sizeof(Math::Mat4)},
+             reinterpret_cast<const std::byte *>(m_Transforms.data())},
+            {{SceneSectionType::MeshRenderers, g_SceneMeshRendererVersion, 0,
+              meshRenderers.size() * sizeof(SceneMeshRenderer), static_cast<uint32_t>(meshRenderers.size()),
+              sizeof(SceneMeshRenderer)},
+             reinterpret_cast<const std::byte *>(meshRenderers.data())},
+            {{SceneSectionType::Strings, 1, 0, m_Strings.size(), static_cast<uint32_t>(m_Strings.size()), 1},
+             reinterpret_cast<const std::byte *>(m_Strings.data())},
+        }};
+
+        const auto alignUp = [](const uint64_t value) {
+            return (value + g_SceneAlignment - 1) & ~(g_SceneAlignment - 1);
+        };
+
+        std::array<SceneSection, pending.size()> sections{};
+        uint64_t                                 offset = alignUp(sizeof(SceneHeader) + sizeof(sections));
+
+        for (size_t i = 0; i < pending.size(); i++) {
+            sections[i]        = pending[i].section;
+            sections[i].offset = offset;
+
+            offset = alignUp(offset + sections[i].size);
+        }
+
+        SceneHeader header{};
+        header.magic        = g_SceneMagic;
+        header.version      = g_SceneVersion;
+        header.sectionCount = static_cast<uint32_t>(sections.size());
+        header.fileSize     = offset;
+
+        std::vector<std::byte> data(offset);
+        std::memcpy(data.data(), &header, sizeof(header));
+        std::memcpy(data.data() + sizeof(header), sections.data(), sizeof(sections));
+
+        for (size_t i = 0; i < pending.size(); i++) {
+            if (sections[i].size != 0) {
+                std::memcpy(data.data() + sections[i].offset, pending[i].data, sections[i].size);
+            }
+        }
+
+        return data;
+    }
+
+    void SceneWriter::Write(const std::string &path) const {
+        const std::vector<std::byte> data = Serialize();
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to write scene: Could not open output file");
+        }
+
+        file.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()));
+
+        if (!file) {
+            throw std::runtime_error("Failed to write scene: Write error");
+        }
+    }
+}
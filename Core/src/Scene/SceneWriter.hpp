@@ -0,0 +1,37 @@
+#ifndef PULSAR_SCENEWRITER_HPP
+#define PULSAR_SCENEWRITER_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "SceneFormat.hpp"
+#include "Ecs/World.hpp"
+#include "Renderer/RenderComponents.hpp"
+
+namespace Pulsar::Scene {
+    class SceneWriter {
+    public:
+        static SceneWriter Create();
+
+        // parent must be a node added earlier. Returns the new node's index.
+        uint32_t AddNode(std::string_view name, const Math::Mat4 &transform, uint32_t parent = g_SceneNoParent);
+        void     SetMeshRenderer(uint32_t node, const Renderer::MeshRenderer &meshRenderer);
+
+        // Adds a root node for every entity with a Renderer::WorldTransform, keeping its Renderer::MeshRenderer.
+        void AddWorld(const Ecs::World &world);
+
+        [[nodiscard]] std::vector<std::byte> Serialize() const;
+        void                                 Write(const std::string &path) const;
+
+    private:
+        std::vector<SceneNode>                            m_Nodes;
+        std::vector<Math::Mat4>                           m_Transforms;
+        std::vector<std::optional<Renderer::MeshRenderer>> m_MeshRenderers;
+        std::string                                       m_Strings;
+
+        SceneWriter() = default;
+    };
+}
+
+#endif //PULSAR_SCENEWRITER_HPP
@@ -0,0 +1,50 @@
+#ifndef PULSAR_AABB_HPP
+#define PULSAR_AABB_HPP
+
+#include <algorithm>
+#include <limits>
+
+#include "Math/Vector.hpp"
+
+namespace Pulsar::Spatial {
+    // Default-constructed boxes are empty: extending one by anything yields that thing's bounds.
+    struct Aabb {
+        Math::Vec3 min = Math::Vec3(std::numeric_limits<float>::infinity());
+        Math::Vec3 max = Math::Vec3(-std::numeric_limits<float>::infinity());
+
+        constexpr void Extend(const Math::Vec3 &point) {
+            min = {std::min(min.x, point.x), std::min(min.y, point.y), std::min(min.z, point.z)};
+            max = {std::max(max.x, point.x), std::max(max.y, point.y), std::max(max.z, point.z)};
+        }
+
+        constexpr void Extend(const Aabb &other) {
+            min = {std::min(min.x, other.min.x), std::min(min.y, other.min.y), std::min(min.z, other.min.z)};
+            max = {std::max(max.x, other.max.x), std::max(max.y, other.max.y), std::max(max.z, other.max.z)};
+        }
+
+        [[nodiscard]] constexpr bool IsEmpty() const {
+            return min.x > max.x || min.y > max.y || min.z > max.z;
+        }
+
+        [[nodiscard]] constexpr Math::Vec3 GetCenter() const { return (min + max) * 0.5F; }
+
+        // Half the surface area, which is all the SAH needs.
+        [[nodiscard]] constexpr float GetHalfArea() const {
+            if (IsEmpty()) {
+                return 0.0F;
+            }
+
+            const Math::Vec3 size = max - min;
+            return size.x * size.y + size.y * size.z + size.z * size.x;
+        }
+
+        [[nodiscard]] constexpr bool Overlaps(const Aabb &other) const {
+            return min.x <= other.max.x && max.x >= other.min.x && min.y <= other.max.y && max.y >= other.min.y &&
+                   min.z <= other.max.z && max.z >= other.min.z;
+        }
+
+        constexpr bool operator==(const Aabb &other) const = default;
+    };
+}
+
+#endif //PULSAR_AABB_HPP
@@ -0,0 +1,994 @@
+#include "Bvh.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <numeric>
+
+#include "Math/Simd.hpp"
+
+namespace Pulsar::Spatial {
+    constexpr uint32_t s_MaxBins = 32;
+
+    // Holds the usual traversal depth inline and only touches the heap for degenerate trees.
+    template<typename T>
+    class TraversalStack {
+    public:
+        void Push(const T &value) {
+            if (m_Size < m_Inline.size()) {
+                m_Inline[m_Size] = value;
+            } else {
+                m_Overflow.push_back(value);
+            }
+
+            m_Size++;
+        }
+
+        T Pop() {
+            m_Size--;
+
+            if (m_Size < m_Inline.size()) {
+                return m_Inline[m_Size];
+            }
+
+            const T value = m_Overflow.back();
+            m_Overflow.pop_back();
+
+            return value;
+        }
+
+        [[nodiscard]] bool IsEmpty() const { return m_Size == 0; }
+
+    private:
+        std::array<T, 64> m_Inline;
+        std::vector<T>    m_Overflow;
+        size_t            m_Size = 0;
+    };
+
+    static Aabb GetSlotBounds(const BvhNode &node, const uint32_t slot) {
+        return {{node.minX[slot], node.minY[slot], node.minZ[slot]},
+                {node.maxX[slot], node.maxY[slot], node.maxZ[slot]}};
+    }
+
+    static void SetSlotBounds(BvhNode &node, const uint32_t slot, const Aabb &bounds) {
+        node.minX[slot] = bounds.min.x;
+        node.minY[slot] = bounds.min.y;
+        node.minZ[slot] = bounds.min.z;
+        node.maxX[slot] = bounds.max.x;
+        node.maxY[slot] = bounds.max.y;
+        node.maxZ[slot] = bounds.max.z;
+    }
+
+    static void ClearNode(BvhNode &node) {
+        for (uint32_t slot = 0; slot < 4; slot++) {
+            SetSlotBounds(node, slot, {});
+            node.children[slot] = g_BvhEmptySlot;
+            node.counts[slot]   = 0;
+        }
+    }
+
+    static int GetSlotMask(const BvhNode &node) {
+        int mask = 0;
+
+        for (uint32_t slot = 0; slot < 4; slot++) {
+            if (node.children[slot] != g_BvhEmptySlot) {
+                mask |= 1 << slot;
+            }
+        }
+
+        return mask;
+    }
+
+    static bool IsAabbVisible(const Math::FrustumPlanes &planes, const Aabb &box) {
+        for (const Math::Vec4 &plane : planes) {
+            const float x = plane.x >= 0.0F ? box.max.x : box.min.x;
+            const float y = plane.y >= 0.0F ? box.max.y : box.min.y;
+            const float z = plane.z >= 0.0F ? box.max.z : box.min.z;
+
+            if (plane.x * x + plane.y * y + plane.z * z + plane.w < 0.0F) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static std::optional<float> IntersectRay(const Aabb &box, const Math::Vec3 &origin, const Math::Vec3 &inverse,
+                                             const float maxDistance) {
+        float entry = 0.0F;
+        float exit  = maxDistance;
+
+        for (size_t axis = 0; axis < 3; axis++) {
+            const float t1 = (box.min[axis] - origin[axis]) * inverse[axis];
+            const float t2 = (box.max[axis] - origin[axis]) * inverse[axis];
+
+            entry = std::max(entry, std::min(t1, t2));
+            exit  = std::min(exit, std::max(t1, t2));
+        }
+
+        return entry <= exit ? std::optional(entry) : std::nullopt;
+    }
+
+    // Bit i of intersecting is set when slot i is not fully outside any plane, and of inside when it is fully
+    // inside all of them. The nearest and farthest corners along each plane normal decide both.
+    static void TestFrustum(const BvhNode &node, const Math::FrustumPlanes &planes, int &intersecting, int &inside) {
+        intersecting = 0xF;
+        inside       = 0xF;
+
+#if defined(PULSAR_MATH_SIMD)
+        using namespace Math::Simd;
+
+        const Float4 minX = Load(node.minX.data());
+        const Float4 minY = Load(node.minY.data());
+        const Float4 minZ = Load(node.minZ.data());
+        const Float4 maxX = Load(node.maxX.data());
+        const Float4 maxY = Load(node.maxY.data());
+        const Float4 maxZ = Load(node.maxZ.data());
+        const Float4 zero = Splat(0.0F);
+
+        for (const Math::Vec4 &plane : planes) {
+            const Float4 x = Splat(plane.x);
+            const Float4 y = Splat(plane.y);
+            const Float4 z = Splat(plane.z);
+
+            Float4 farthest = MulAdd(x, plane.x >= 0.0F ? maxX : minX, Splat(plane.w));
+            farthest        = MulAdd(y, plane.y >= 0.0F ? maxY : minY, farthest);
+            farthest        = MulAdd(z, plane.z >= 0.0F ? maxZ : minZ, farthest);
+
+            Float4 nearest = MulAdd(x, plane.x >= 0.0F ? minX : maxX, Splat(plane.w));
+            nearest        = MulAdd(y, plane.y >= 0.0F ? minY : maxY, nearest);
+            nearest        = MulAdd(z, plane.z >= 0.0F ? minZ : maxZ, nearest);
+
+            intersecting &= GreaterEqualMask(farthest, zero);
+            inside &= GreaterEqualMask(nearest, zero);
+        }
+#else
+        for (uint32_t slot = 0; slot < 4; slot++) {
+            const Aabb box = GetSlotBounds(node, slot);
+
+            for (const Math::Vec4 &plane : planes) {
+                const Math::Vec3 farthest = {plane.x >= 0.0F ? box.max.x : box.min.x,
+                                             plane.y >= 0.0F ? box.max.y : box.min.y,
+                                             plane.z >= 0.0F ? box.max.z : box.min.z};
+                const Math::Vec3 nearest  = {plane.x >= 0.0F ? box.min.x : box.max.x,
+                                             plane.y >= 0.0F ? box.min.y : box.max.y,
+                                             plane.z >= 0.0F ? box.min.z : box.max.z};
+
+                if (plane.x * farthest.x + plane.y * farthest.y + plane.z * farthest.z + plane.w < 0.0F) {
+                    intersecting &= ~(1 << slot);
+                }
+
+                if (plane.x * nearest.x + plane.y * nearest.y + plane.z * nearest.z + plane.w < 0.0F) {
+                    inside &= ~(1 << slot);
+                }
+            }
+        }
+#endif
+
+        inside &= intersecting;
+    }
+
+    // As TestFrustum, with inside meaning the slot lies within box.
+    static void TestAabb(const BvhNode &node, const Aabb &box, int &intersecting, int &inside) {
+#if defined(PULSAR_MATH_SIMD)
+        using namespace Math::Simd;
+
+        const Float4 minX = Load(node.minX.data());
+        const Float4 minY = Load(node.minY.data());
+        const Float4 minZ = Load(node.minZ.data());
+        const Float4 maxX = Load(node.maxX.data());
+        const Float4 maxY = Load(node.maxY.data());
+        const Float4 maxZ = Load(node.maxZ.data());
+
+        const Float4 boxMinX = Splat(box.min.x);
+        const Float4 boxMinY = Splat(box.min.y);
+        const Float4 boxMinZ = Splat(box.min.z);
+        const Float4 boxMaxX = Splat(box.max.x);
+        const Float4 boxMaxY = Splat(box.max.y);
+        const Float4 boxMaxZ = Splat(box.max.z);
+
+        intersecting = GreaterEqualMask(boxMaxX, minX) & GreaterEqualMask(maxX, boxMinX) &
+                       GreaterEqualMask(boxMaxY, minY) & GreaterEqualMask(maxY, boxMinY) &
+                       GreaterEqualMask(boxMaxZ, minZ) & GreaterEqualMask(maxZ, boxMinZ);
+        inside = GreaterEqualMask(minX, boxMinX) & GreaterEqualMask(boxMaxX, maxX) &
+                 GreaterEqualMask(minY, boxMinY) & GreaterEqualMask(boxMaxY, maxY) &
+                 GreaterEqualMask(minZ, boxMinZ) & GreaterEqualMask(boxMaxZ, maxZ);
+#else
+        intersecting = 0;
+        inside       = 0;
+
+        for (uint32_t slot = 0; slot < 4; slot++) {
+            const Aabb slotBounds = GetSlotBounds(node, slot);
+
+            if (slotBounds.Overlaps(box)) {
+                intersecting |= 1 << slot;
+            }
+
+            if (slotBounds.min.x >= box.min.x && slotBounds.max.x <= box.max.x && slotBounds.min.y >= box.min.y &&
+                slotBounds.max.y <= box.max.y && slotBounds.min.z >= box.min.z && slotBounds.max.z <= box.max.z) {
+                inside |= 1 << slot;
+            }
+        }
+#endif
+
+        inside &= intersecting;
+    }
+
+    // Bit i is set when the ray enters slot i before maxDistance; entries receives the entry distances.
+    static int TestRay(const BvhNode &node, const Math::Vec3 &origin, const Math::Vec3 &inverse,
+                       const float maxDistance, std::array<float, 4> &entries) {
+#if defined(PULSAR_MATH_SIMD)
+        using namespace Math::Simd;
+
+        const Float4 originX  = Splat(origin.x);
+        const Float4 originY  = Splat(origin.y);
+        const Float4 originZ  = Splat(origin.z);
+        const Float4 inverseX = Splat(inverse.x);
+        const Float4 inverseY = Splat(inverse.y);
+        const Float4 inverseZ = Splat(inverse.z);
+
+        const Float4 x1 = Mul(Sub(Load(node.minX.data()), originX), inverseX);
+        const Float4 x2 = Mul(Sub(Load(node.maxX.data()), originX), inverseX);
+        const Float4 y1 = Mul(Sub(Load(node.minY.data()), originY), inverseY);
+        const Float4 y2 = Mul(Sub(Load(node.maxY.data()), originY), inverseY);
+        const Float4 z1 = Mul(Sub(Load(node.minZ.data()), originZ), inverseZ);
+        const Float4 z2 = Mul(Sub(Load(node.maxZ.data()), originZ), inverseZ);
+
+        const Float4 entry = Max(Max(Min(x1, x2), Min(y1, y2)), Max(Min(z1, z2), Splat(0.0F)));
+        const Float4 exit  = Min(Min(Max(x1, x2), Max(y1, y2)), Min(Max(z1, z2), Splat(maxDistance)));
+
+        Store(entries.data(), entry);
+
+        return GreaterEqualMask(exit, entry);
+#else
+        int mask = 0;
+
+        for (uint32_t slot = 0; slot < 4; slot++) {
+            if (const std::optional<float> entry = IntersectRay(GetSlotBounds(node, slot), origin, inverse,
+                                                                maxDistance)) {
+                entries[slot] = *entry;
+                mask |= 1 << slot;
+            }
+        }
+
+        return mask;
+#endif
+    }
+
+    // Works on a copy of the primitives' bounds in build order, so binning and partitioning stream through memory
+    // instead of gathering through the primitive order. The result is written back to the Bvh at the end.
+    struct BvhBuilder {
+        struct Reference {
+            Aabb     bounds;
+            uint32_t primitive;
+        };
+
+        struct Range {
+            uint32_t begin;
+            uint32_t end;
+            Aabb     bounds;
+            Aabb     centroids;
+
+            [[nodiscard]] uint32_t GetCount() const { return end - begin; }
+        };
+
+        // Plain floats rather than an Aabb, so a Bins array costs nothing until Split resets the bins it uses.
+        struct Bin {
+            std::array<float, 3> min;
+            std::array<float, 3> max;
+            uint32_t             count;
+
+            void Reset() {
+                min.fill(std::numeric_limits<float>::infinity());
+                max.fill(-std::numeric_limits<float>::infinity());
+                count = 0;
+            }
+
+            void Add(const Aabb &bounds) {
+                min = {std::min(min[0], bounds.min.x), std::min(min[1], bounds.min.y), std::min(min[2], bounds.min.z)};
+                max = {std::max(max[0], bounds.max.x), std::max(max[1], bounds.max.y), std::max(max[2], bounds.max.z)};
+                count++;
+            }
+
+            void Extend(const Bin &other) {
+                for (size_t axis = 0; axis < 3; axis++) {
+                    min[axis] = std::min(min[axis], other.min[axis]);
+                    max[axis] = std::max(max[axis], other.max[axis]);
+                }
+
+                count += other.count;
+            }
+
+            [[nodiscard]] float GetCost() const {
+                const Aabb bounds = {{min[0], min[1], min[2]}, {max[0], max[1], max[2]}};
+                return bounds.GetHalfArea() * static_cast<float>(count);
+            }
+        };
+
+        using Bins = std::array<std::array<Bin, s_MaxBins>, 3>;
+
+        Bvh &                  bvh;
+        Threading::JobSystem * jobs;
+        std::vector<Reference> references;
+        uint32_t               base;
+        std::atomic<uint32_t>  nodeCount;
+
+        // Covers [begin, end) of the primitive order.
+        BvhBuilder(Bvh &bvh, const std::span<const Aabb> bounds, Threading::JobSystem *jobs, const uint32_t begin,
+                   const uint32_t end)
+            : bvh(bvh), jobs(jobs), references(end - begin), base(begin), nodeCount(bvh.m_NodeCount) {
+            ForRange(begin, end, [&](const uint32_t first, const uint32_t last) {
+                for (uint32_t i = first; i < last; i++) {
+                    const uint32_t primitive = bvh.m_PrimitiveOrder[i];
+                    references[i - base]     = {bounds[primitive], primitive};
+                }
+            });
+        }
+
+        // Runs function(begin, end) over [begin, end), split across the job system when the range is big enough.
+        template<typename F>
+        void ForRange(const uint32_t begin, const uint32_t end, F &&function) const {
+            if (jobs != nullptr && end - begin >= bvh.m_Config.parallelBinThreshold) {
+                jobs->ParallelFor(end - begin, [&function, begin](const uint32_t first, const uint32_t last) {
+                    function(begin + first, begin + last);
+                }, bvh.m_Config.parallelBinThreshold / 4);
+            } else {
+                function(begin, end);
+            }
+        }
+
+        Range MakeRange(const uint32_t begin, const uint32_t end) const {
+            Range      range = {begin, end, {}, {}};
+            std::mutex mutex;
+
+            ForRange(begin, end, [&](const uint32_t first, const uint32_t last) {
+                Aabb rangeBounds;
+                Aabb centroids;
+
+                for (uint32_t i = first; i < last; i++) {
+                    const Aabb &primitive = references[i - base].bounds;
+
+                    rangeBounds.Extend(primitive);
+                    centroids.Extend(primitive.GetCenter());
+                }
+
+                std::lock_guard lock(mutex);
+                range.bounds.Extend(rangeBounds);
+                range.centroids.Extend(centroids);
+            });
+
+            return range;
+        }
+
+        std::optional<std::pair<Range, Range>> Split(const Range &range) {
+            const BvhConfig &config = bvh.m_Config;
+            const uint32_t   count  = range.GetCount();
+
+            if (count <= 1) {
+                return std::nullopt;
+            }
+
+            // Small ranges get a bin per primitive at most; the bins beyond binCount are never touched.
+            const uint32_t binCount = std::min(config.binCount, std::max(count, 2u));
+
+            const Math::Vec3 origin = range.centroids.min;
+            const Math::Vec3 extent = range.centroids.max - origin;
+            const Math::Vec3 scale  = {extent.x > 0.0F ? static_cast<float>(binCount) / extent.x : 0.0F,
+                                       extent.y > 0.0F ? static_cast<float>(binCount) / extent.y : 0.0F,
+                                       extent.z > 0.0F ? static_cast<float>(binCount) / extent.z : 0.0F};
+
+            const auto getBin = [binCount](const float centroid, const float axisOrigin, const float axisScale) {
+                return std::min(static_cast<uint32_t>((centroid - axisOrigin) * axisScale), binCount - 1);
+            };
+
+            const auto binPrimitives = [&](Bins &target, const uint32_t first, const uint32_t last) {
+                for (size_t axis = 0; axis < 3; axis++) {
+                    for (uint32_t bin = 0; bin < binCount; bin++) {
+                        target[axis][bin].Reset();
+                    }
+                }
+
+                for (uint32_t i = first; i < last; i++) {
+                    const Aabb &     primitive = references[i - base].bounds;
+                    const Math::Vec3 centroid  = primitive.GetCenter();
+
+                    target[0][getBin(centroid.x, origin.x, scale.x)].Add(primitive);
+                    target[1][getBin(centroid.y, origin.y, scale.y)].Add(primitive);
+                    target[2][getBin(centroid.z, origin.z, scale.z)].Add(primitive);
+                }
+            };
+
+            Bins bins;
+
+            if (jobs != nullptr && count >= config.parallelBinThreshold) {
+                binPrimitives(bins, 0, 0);
+
+                std::mutex mutex;
+                ForRange(range.begin, range.end, [&](const uint32_t first, const uint32_t last) {
+                    Bins local;
+                    binPrimitives(local, first, last);
+
+                    std::lock_guard lock(mutex);
+                    for (size_t axis = 0; axis < 3; axis++) {
+                        for (uint32_t bin = 0; bin < binCount; bin++) {
+                            bins[axis][bin].Extend(local[axis][bin]);
+                        }
+                    }
+                });
+            } else {
+                binPrimitives(bins, range.begin, range.end);
+            }
+
+            float    bestCost = std::numeric_limits<float>::infinity();
+            size_t   bestAxis = 0;
+            uint32_t bestBin  = 0;
+
+            for (size_t axis = 0; axis < 3; axis++) {
+                // Cost of everything right of each bin boundary, swept from the right.
+                std::array<float, s_MaxBins> rightCost{};
+                Bin                          right;
+                right.Reset();
+
+                for (uint32_t bin = binCount - 1; bin > 0; bin--) {
+                    right.Extend(bins[axis][bin]);
+                    rightCost[bin] = right.count > 0 ? right.GetCost() : std::numeric_limits<float>::infinity();
+                }
+
+                Bin left;
+                left.Reset();
+
+                for (uint32_t bin = 0; bin + 1 < binCount; bin++) {
+                    left.Extend(bins[axis][bin]);
+
+                    if (left.count == 0) {
+                        continue;
+                    }
+
+                    const float cost = left.GetCost() + rightCost[bin + 1];
+                    if (cost < bestCost) {
+                        bestCost = cost;
+                        bestAxis = axis;
+                        bestBin  = bin;
+                    }
+                }
+            }
+
+            if (bestCost == std::numeric_limits<float>::infinity()) {
+                // Every centroid coincides, so binning cannot separate them: halve the range as it is.
+                if (count <= config.maxLeafSize) {
+                    return std::nullopt;
+                }
+
+                const uint32_t middle = range.begin + count / 2;
+                return std::pair(MakeRange(range.begin, middle), MakeRange(middle, range.end));
+            }
+
+            const float area = range.bounds.GetHalfArea();
+            bestCost         = config.traversalCost + (area > 0.0F ? bestCost / area : 0.0F);
+
+            if (count <= config.maxLeafSize && bestCost >= static_cast<float>(count)) {
+                return std::nullopt;
+            }
+
+            Reference *    first  = references.data() + (range.begin - base);
+            const uint32_t middle = static_cast<uint32_t>(
+                std::partition(first, first + count, [&](const Reference &reference) {
+                    return getBin(reference.bounds.GetCenter()[bestAxis], origin[bestAxis], scale[bestAxis]) <= bestBin;
+                }) - references.data()) + base;
+
+            return std::pair(MakeRange(range.begin, middle), MakeRange(middle, range.end));
+        }
+
+        // Fills node index with up to four children, found by repeatedly splitting the largest candidate.
+        void BuildNode(const uint32_t index, const Range &left, const Range &right) {
+            struct Candidate {
+                Range range;
+                bool  leaf = false;
+            };
+
+            std::array<Candidate, 4> candidates     = {Candidate{left}, Candidate{right}};
+            uint32_t                 candidateCount = 2;
+
+            while (candidateCount < 4) {
+                std::optional<uint32_t> largest;
+                float                   largestArea = -1.0F;
+
+                for (uint32_t i = 0; i < candidateCount; i++) {
+                    const float area = candidates[i].range.bounds.GetHalfArea();
+
+                    if (!candidates[i].leaf && area > largestArea) {
+                        largest     = i;
+                        largestArea = area;
+                    }
+                }
+
+                if (!largest.has_value()) {
+                    break;
+                }
+
+                const std::optional<std::pair<Range, Range>> split = Split(candidates[*largest].range);
+
+                if (!split.has_value()) {
+                    candidates[*largest].leaf = true;
+                    continue;
+                }
+
+                candidates[*largest]         = {split->first};
+                candidates[candidateCount++] = {split->second};
+            }
+
+            BvhNode &node = bvh.m_Nodes[index];
+            ClearNode(node);
+
+            Aabb                  nodeBounds;
+            uint32_t              first = std::numeric_limits<uint32_t>::max();
+            uint32_t              count = 0;
+            Threading::JobCounter counter;
+
+            for (uint32_t slot = 0; slot < candidateCount; slot++) {
+                const Range &range = candidates[slot].range;
+
+                SetSlotBounds(node, slot, range.bounds);
+                nodeBounds.Extend(range.bounds);
+                first = std::min(first, range.begin);
+                count += range.GetCount();
+
+                std::optional<std::pair<Range, Range>> split;
+                if (!candidates[slot].leaf) {
+                    split = Split(range);
+                }
+
+                if (!split.has_value()) {
+                    node.children[slot] = range.begin;
+                    node.counts[slot]   = range.GetCount();
+                    continue;
+                }
+
+                const uint32_t child = nodeCount.fetch_add(1, std::memory_order_relaxed);
+                node.children[slot]  = child;
+
+                if (jobs != nullptr && range.GetCount() >= bvh.m_Config.parallelThreshold) {
+                    jobs->Schedule([this, child, split] { BuildNode(child, split->first, split->second); }, &counter);
+                } else {
+                    BuildNode(child, split->first, split->second);
+                }
+            }
+
+            bvh.m_NodeInfo[index] = {first, count, nodeBounds.GetHalfArea()};
+
+            if (jobs != nullptr) {
+                jobs->Wait(counter);
+            }
+        }
+
+        // Builds [begin, end) of the primitive order into a new subtree and returns its root node.
+        uint32_t BuildSubtree(const uint32_t begin, const uint32_t end) {
+            const uint32_t root  = nodeCount.fetch_add(1, std::memory_order_relaxed);
+            const Range    range = MakeRange(begin, end);
+
+            if (const std::optional<std::pair<Range, Range>> split = Split(range)) {
+                BuildNode(root, split->first, split->second);
+            } else {
+                BvhNode &node = bvh.m_Nodes[root];
+                ClearNode(node);
+
+                if (range.GetCount() > 0) {
+                    SetSlotBounds(node, 0, range.bounds);
+                    node.children[0] = begin;
+                    node.counts[0]   = range.GetCount();
+                }
+
+                bvh.m_NodeInfo[root] = {begin, range.GetCount(), range.bounds.GetHalfArea()};
+            }
+
+            ForRange(begin, end, [this](const uint32_t first, const uint32_t last) {
+                for (uint32_t i = first; i < last; i++) {
+                    bvh.m_PrimitiveOrder[i]  = references[i - base].primitive;
+                    bvh.m_PrimitiveBounds[i] = references[i - base].bounds;
+                }
+            });
+
+            bvh.m_NodeCount = nodeCount.load(std::memory_order_relaxed);
+
+            return root;
+        }
+    };
+
+    Bvh Bvh::Build(const std::span<const Aabb> bounds, const BvhConfig &config, Threading::JobSystem *jobs) {
+        if (bounds.size() >= g_BvhEmptySlot) {
+            throw std::runtime_error("Failed to build BVH: Too many primitives");
+        }
+
+        const auto primitiveCount = static_cast<uint32_t>(bounds.size());
+
+        Bvh bvh;
+        bvh.m_Config             = config;
+        bvh.m_Config.maxLeafSize = std::max(config.maxLeafSize, 1u);
+        bvh.m_Config.binCount    = std::clamp(config.binCount, 2u, s_MaxBins);
+
+        bvh.m_PrimitiveOrder.resize(primitiveCount);
+        bvh.m_PrimitiveBounds.resize(primitiveCount);
+        std::iota(bvh.m_PrimitiveOrder.begin(), bvh.m_PrimitiveOrder.end(), 0);
+
+        // Every inner node has at least two children, so there are fewer nodes than primitives. The arrays are
+        // left uninitialized, so the pages beyond what the build uses are never touched.
+        bvh.m_NodeCapacity = std::max(primitiveCount, 1u);
+        bvh.m_Nodes.reset(new BvhNode[bvh.m_NodeCapacity]);
+        bvh.m_NodeInfo.reset(new NodeInfo[bvh.m_NodeCapacity]);
+
+        BvhBuilder(bvh, bounds, jobs, 0, primitiveCount).BuildSubtree(0, primitiveCount);
+
+        return bvh;
+    }
+
+    void Bvh::Refit(const std::span<const Aabb> bounds, Threading::JobSystem *jobs) {
+        if (bounds.size() != m_PrimitiveOrder.size()) {
+            throw std::runtime_error("Failed to refit BVH: Primitive count changed");
+        }
+
+        const auto gather = [this, bounds](const uint32_t begin, const uint32_t end) {
+            for (uint32_t i = begin; i < end; i++) {
+                m_PrimitiveBounds[i] = bounds[m_PrimitiveOrder[i]];
+            }
+        };
+
+        if (jobs != nullptr) {
+            jobs->ParallelFor(GetPrimitiveCount(), gather, m_Config.parallelBinThreshold / 4);
+        } else {
+            gather(0, GetPrimitiveCount());
+        }
+
+        if (m_NodeCount > 0) {
+            RefitNode(0, jobs);
+        }
+    }
+
+    uint32_t Bvh::Update(const std::span<const Aabb> bounds, Threading::JobSystem *jobs) {
+        Refit(bounds, jobs);
+
+        if (m_NodeCount == 0) {
+            return 0;
+        }
+
+        if (GetBounds().GetHalfArea() > m_NodeInfo[0].builtArea * m_Config.rebuildThreshold) {
+            *this = Build(bounds, m_Config, jobs);
+            return 1;
+        }
+
+        const uint32_t rebuilt = UpdateNode(0, bounds, jobs);
+
+        if (m_DeadNodeCount * 2 > m_NodeCount) {
+            *this = Build(bounds, m_Config, jobs);
+        }
+
+        return rebuilt;
+    }
+
+    void Bvh::QueryFrustum(const Math::FrustumPlanes &planes, std::vector<uint32_t> &result) const {
+        if (m_NodeCount == 0) {
+            return;
+        }
+
+        TraversalStack<uint32_t> stack;
+        stack.Push(0);
+
+        while (!stack.IsEmpty()) {
+            const BvhNode &node = m_Nodes[stack.Pop()];
+
+            int intersecting;
+            int inside;
+            TestFrustum(node, planes, intersecting, inside);
+            intersecting &= GetSlotMask(node);
+
+            for (uint32_t slot = 0; slot < 4; slot++) {
+                if ((intersecting & (1 << slot)) == 0) {
+                    continue;
+                }
+
+                const uint32_t child = node.children[slot];
+                const uint32_t count = node.counts[slot];
+
+                if ((inside & (1 << slot)) != 0) {
+                    // Everything below is visible, and every subtree is one contiguous run of the primitive order.
+                    const uint32_t first = count != 0 ? child : m_NodeInfo[child].first;
+                    const uint32_t total = count != 0 ? count : m_NodeInfo[child].count;
+
+                    result.insert(result.end(), m_PrimitiveOrder.begin() + first,
+                                  m_PrimitiveOrder.begin() + first + total);
+                } else if (count != 0) {
+                    for (uint32_t i = child; i < child + count; i++) {
+                        if (IsAabbVisible(planes, m_PrimitiveBounds[i])) {
+                            result.push_back(m_PrimitiveOrder[i]);
+                        }
+                    }
+                } else {
+                    stack.Push(child);
+                }
+            }
+        }
+    }
+
+    void Bvh::QueryAabb(const Aabb &box, std::vector<uint32_t> &result) const {
+        if (m_NodeCount == 0) {
+            return;
+        }
+
+        TraversalStack<uint32_t> stack;
+        stack.Push(0);
+
+        while (!stack.IsEmpty()) {
+            const BvhNode &node = m_Nodes[stack.Pop()];
+
+            int intersecting;
+            int inside;
+            TestAabb(node, box, intersecting, inside);
+            intersecting &= GetSlotMask(node);
+
+            for (uint32_t slot = 0; slot < 4; slot++) {
+                if ((intersecting & (1 << slot)) == 0) {
+                    continue;
+                }
+
+                const uint32_t child = node.children[slot];
+                const uint32_t count = node.counts[slot];
+
+                if ((inside & (1 << slot)) != 0) {
+                    const uint32_t first = count != 0 ? child : m_NodeInfo[child].first;
+                    const uint32_t total = count != 0 ? count : m_NodeInfo[child].count;
+
+                    result.insert(result.end(), m_PrimitiveOrder.begin() + first,
+                                  m_PrimitiveOrder.begin() + first + total);
+                } else if (count != 0) {
+                    for (uint32_t i = child; i < child + count; i++) {
+                        if (m_PrimitiveBounds[i].Overlaps(box)) {
+                            result.push_back(m_PrimitiveOrder[i]);
+                        }
+                    }
+                } else {
+                    stack.Push(child);
+                }
+            }
+        }
+    }
+
+    std::optional<BvhHit> Bvh::Raycast(const Ray &ray,
+                                       const std::function<std::optional<float>(uint32_t)> &intersect) const {
+        if (m_NodeCount == 0) {
+            return std::nullopt;
+        }
+
+        struct Entry {
+            uint32_t node;
+            float    distance;
+        };
+
+        const Math::Vec3 inverse = {1.0F / ray.direction.x, 1.0F / ray.direction.y, 1.0F / ray.direction.z};
+
+        std::optional<BvhHit> hit;
+        float                 maxDistance = ray.maxDistance;
+
+        const auto accept = [&](const uint32_t primitive, const float distance) {
+            if (distance >= 0.0F && (distance < maxDistance || (!hit.has_value() && distance <= maxDistance))) {
+                hit         = BvhHit{primitive, distance};
+                maxDistance = distance;
+            }
+        };
+
+        TraversalStack<Entry> stack;
+        stack.Push({0, 0.0F});
+
+        while (!stack.IsEmpty()) {
+            const Entry top = stack.Pop();
+
+            if (top.distance > maxDistance) {
+                continue;
+            }
+
+            const BvhNode &      node = m_Nodes[top.node];
+            std::array<float, 4> entries{};
+            const int            mask = TestRay(node, ray.origin, inverse, maxDistance, entries) & GetSlotMask(node);
+
+            // Visit hit slots front to back: leaves right away, inner nodes pushed so the nearest pops first.
+            std::array<uint32_t, 4> slots{};
+            uint32_t                slotCount = 0;
+
+            for (uint32_t slot = 0; slot < 4; slot++) {
+                if ((mask & (1 << slot)) != 0) {
+                    slots[slotCount++] = slot;
+                }
+            }
+
+            // Insertion sort: at most four slots, and std::sort over the fixed array trips -Warray-bounds at -O2.
+            for (uint32_t i = 1; i < slotCount; i++) {
+                const uint32_t slot = slots[i];
+
+                uint32_t j = i;
+                for (; j > 0 && entries[slot] < entries[slots[j - 1]]; j--) {
+                    slots[j] = slots[j - 1];
+                }
+                slots[j] = slot;
+            }
+
+            for (uint32_t i = 0; i < slotCount; i++) {
+                const uint32_t slot  = slots[i];
+                const uint32_t child = node.children[slot];
+
+                if (node.counts[slot] == 0 || entries[slot] > maxDistance) {
+                    continue;
+                }
+
+                for (uint32_t j = child; j < child + node.counts[slot]; j++) {
+                    const std::optional<float> entryDistance = IntersectRay(m_PrimitiveBounds[j], ray.origin, inverse,
+                                                                            maxDistance);
+                    if (!entryDistance.has_value()) {
+                        continue;
+                    }
+
+                    const uint32_t primitive = m_PrimitiveOrder[j];
+
+                    if (!intersect) {
+                        accept(primitive, *entryDistance);
+                    } else if (const std::optional<float> distance = intersect(primitive)) {
+                        accept(primitive, *distance);
+                    }
+                }
+            }
+
+            for (uint32_t i = slotCount; i-- > 0;) {
+                const uint32_t slot = slots[i];
+
+                if (node.counts[slot] == 0) {
+                    stack.Push({node.children[slot], entries[slot]});
+                }
+            }
+        }
+
+        return hit;
+    }
+
+    std::span<const BvhNode> Bvh::GetNodes() const {
+        return {m_Nodes.get(), m_NodeCount};
+    }
+
+    std::span<const uint32_t> Bvh::GetPrimitiveOrder() const {
+        return m_PrimitiveOrder;
+    }
+
+    uint32_t Bvh::GetPrimitiveCount() const {
+        return static_cast<uint32_t>(m_PrimitiveOrder.size());
+    }
+
+    Aabb Bvh::GetBounds() const {
+        Aabb bounds;
+
+        if (m_NodeCount > 0) {
+            for (uint32_t slot = 0; slot < 4; slot++) {
+                bounds.Extend(GetSlotBounds(m_Nodes[0], slot));
+            }
+        }
+
+        return bounds;
+    }
+
+    float Bvh::GetSahCost() const {
+        const float rootArea = GetBounds().GetHalfArea();
+
+        if (rootArea <= 0.0F) {
+            return 0.0F;
+        }
+
+        float                    cost = 0.0F;
+        TraversalStack<uint32_t> stack;
+        stack.Push(0);
+
+        while (!stack.IsEmpty()) {
+            const uint32_t index = stack.Pop();
+            const BvhNode &node  = m_Nodes[index];
+
+            Aabb nodeBounds;
+            for (uint32_t slot = 0; slot < 4; slot++) {
+                const Aabb slotBounds = GetSlotBounds(node, slot);
+                nodeBounds.Extend(slotBounds);
+
+                if (node.counts[slot] != 0) {
+                    cost += slotBounds.GetHalfArea() * static_cast<float>(node.counts[slot]);
+                } else if (node.children[slot] != g_BvhEmptySlot) {
+                    stack.Push(node.children[slot]);
+                }
+            }
+
+            cost += nodeBounds.GetHalfArea() * m_Config.traversalCost;
+        }
+
+        return cost / rootArea;
+    }
+
+    Aabb Bvh::RefitNode(const uint32_t index, Threading::JobSystem *jobs) {
+        BvhNode &             node = m_Nodes[index];
+        std::array<Aabb, 4>   slotBounds;
+        Threading::JobCounter counter;
+
+        for (uint32_t slot = 0; slot < 4; slot++) {
+            const uint32_t child = node.children[slot];
+
+            if (node.counts[slot] != 0) {
+                for (uint32_t i = child; i < child + node.counts[slot]; i++) {
+                    slotBounds[slot].Extend(m_PrimitiveBounds[i]);
+                }
+            } else if (child == g_BvhEmptySlot) {
+                continue;
+            } else if (jobs != nullptr && m_NodeInfo[child].count >= m_Config.parallelThreshold) {
+                jobs->Schedule([this, &slotBounds, slot, child, jobs] {
+                    slotBounds[slot] = RefitNode(child, jobs);
+                }, &counter);
+            } else {
+                slotBounds[slot] = RefitNode(child, jobs);
+            }
+        }
+
+        if (jobs != nullptr) {
+            jobs->Wait(counter);
+        }
+
+        Aabb bounds;
+        for (uint32_t slot = 0; slot < 4; slot++) {
+            SetSlotBounds(node, slot, slotBounds[slot]);
+            bounds.Extend(slotBounds[slot]);
+        }
+
+        return bounds;
+    }
+
+    uint32_t Bvh::UpdateNode(const uint32_t index, const std::span<const Aabb> bounds, Threading::JobSystem *jobs) {
+        uint32_t rebuilt = 0;
+
+        for (uint32_t slot = 0; slot < 4; slot++) {
+            const uint32_t child = m_Nodes[index].children[slot];
+
+            if (m_Nodes[index].counts[slot] != 0 || child == g_BvhEmptySlot) {
+                continue;
+            }
+
+            const NodeInfo info = m_NodeInfo[child];
+
+            if (GetSlotBounds(m_Nodes[index], slot).GetHalfArea() <= info.builtArea * m_Config.rebuildThreshold) {
+                rebuilt += UpdateNode(child, bounds, jobs);
+                continue;
+            }
+
+            // The replacement is appended and the old subtree is left unreferenced until the next full Build.
+            m_DeadNodeCount += CountNodes(child);
+
+            if (m_NodeCount + info.count > m_NodeCapacity) {
+                const uint32_t capacity = std::max(m_NodeCapacity + m_NodeCapacity / 2, m_NodeCount + info.count);
+
+                std::unique_ptr<BvhNode[]>  nodes(new BvhNode[capacity]);
+                std::unique_ptr<NodeInfo[]> nodeInfo(new NodeInfo[capacity]);
+                std::copy_n(m_Nodes.get(), m_NodeCount, nodes.get());
+                std::copy_n(m_NodeInfo.get(), m_NodeCount, nodeInfo.get());
+
+                m_Nodes        = std::move(nodes);
+                m_NodeInfo     = std::move(nodeInfo);
+                m_NodeCapacity = capacity;
+            }
+
+            const uint32_t end = info.first + info.count;
+            m_Nodes[index].children[slot] = BvhBuilder(*this, bounds, jobs, info.first, end).BuildSubtree(info.first,
+                                                                                                           end);
+            rebuilt++;
+        }
+
+        return rebuilt;
+    }
+
+    uint32_t Bvh::CountNodes(const uint32_t index) const {
+        uint32_t count = 1;
+
+        for (uint32_t slot = 0; slot < 4; slot++) {
+            if (m_Nodes[index].counts[slot] == 0 && m_Nodes[index].children[slot] != g_BvhEmptySlot) {
+                count += CountNodes(m_Nodes[index].children[slot]);
+            }
+        }
+
+        return count;
+    }
+}
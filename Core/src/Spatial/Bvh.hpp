@@ -0,0 +1,128 @@
+#ifndef PULSAR_BVH_HPP
+#define PULSAR_BVH_HPP
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "Aabb.hpp"
+#include "Math/Batch.hpp"
+#include "Threading/JobSystem.hpp"
+
+namespace Pulsar::Spatial {
+    struct BvhConfig {
+        // Leaves never hold more primitives than this; below it the SAH decides whether splitting pays off.
+        uint32_t maxLeafSize = 4;
+        uint32_t binCount    = 16;
+        // Cost of visiting a node relative to testing one primitive.
+        float traversalCost = 1.0F;
+        // Subtrees with at least this many primitives are built and refit as separate jobs.
+        uint32_t parallelThreshold = 4096;
+        // Nodes with at least this many primitives bin their centroids with ParallelFor.
+        uint32_t parallelBinThreshold = 65536;
+        // Update rebuilds a subtree once refitting has grown its surface area by this factor.
+        float rebuildThreshold = 2.0F;
+    };
+
+    // Four children per node, stored axis by axis so one SIMD compare tests all four boxes. A leaf slot has a
+    // non-zero count and child is its first entry in the primitive order; an inner slot has a count of zero and
+    // child is a node index. Unused slots have an empty box and g_BvhEmptySlot as child.
+    struct alignas(64) BvhNode {
+        std::array<float, 4>    minX;
+        std::array<float, 4>    minY;
+        std::array<float, 4>    minZ;
+        std::array<float, 4>    maxX;
+        std::array<float, 4>    maxY;
+        std::array<float, 4>    maxZ;
+        std::array<uint32_t, 4> children;
+        std::array<uint32_t, 4> counts;
+    };
+
+    static_assert(sizeof(BvhNode) == 128);
+
+    constexpr uint32_t g_BvhEmptySlot = ~0U;
+
+    struct Ray {
+        Math::Vec3 origin;
+        Math::Vec3 direction;
+        float      maxDistance = std::numeric_limits<float>::infinity();
+    };
+
+    struct BvhHit {
+        uint32_t primitive;
+        float    distance;
+    };
+
+    // Bounding volume hierarchy over primitive boxes, built with binned SAH. Primitives are identified by their
+    // index in the bounds passed to Build; that span only needs to live for the call, as the tree keeps its own
+    // copy in leaf order. The primitive count is fixed per build: moving primitives go through Refit or Update,
+    // added or removed ones need a new Build.
+    class Bvh {
+    public:
+        // Subtrees are built in parallel when jobs is given.
+        static Bvh Build(std::span<const Aabb> bounds, const BvhConfig &config = {},
+                         Threading::JobSystem *jobs = nullptr);
+
+        Bvh(const Bvh &other) = delete;
+        Bvh(Bvh &&other) noexcept = default;
+
+        Bvh &operator=(const Bvh &other) = delete;
+        Bvh &operator=(Bvh &&other) noexcept = default;
+
+        // Recomputes every box from bounds, keeping the topology. Quality degrades as primitives move away from
+        // where they were built.
+        void Refit(std::span<const Aabb> bounds, Threading::JobSystem *jobs = nullptr);
+
+        // Refits, then rebuilds the largest subtrees that degraded past rebuildThreshold. Falls back to a full
+        // Build when the root degraded or replaced nodes make up most of the tree. Returns the number of subtrees
+        // rebuilt.
+        uint32_t Update(std::span<const Aabb> bounds, Threading::JobSystem *jobs = nullptr);
+
+        // Append the primitives whose boxes intersect the query. Order is unspecified.
+        void QueryFrustum(const Math::FrustumPlanes &planes, std::vector<uint32_t> &result) const;
+        void QueryAabb(const Aabb &box, std::vector<uint32_t> &result) const;
+
+        // Nearest hit along the ray. intersect returns the exact distance to a primitive whose box the ray
+        // enters, if it is hit at all; without it, the distance to the box is used.
+        [[nodiscard]] std::optional<BvhHit> Raycast(
+            const Ray &ray, const std::function<std::optional<float>(uint32_t)> &intersect = {}) const;
+
+        [[nodiscard]] std::span<const BvhNode>  GetNodes() const;
+        [[nodiscard]] std::span<const uint32_t> GetPrimitiveOrder() const;
+        [[nodiscard]] uint32_t                  GetPrimitiveCount() const;
+        [[nodiscard]] Aabb                      GetBounds() const;
+
+        // Expected cost of a random ray under the SAH; grows as refits degrade the tree.
+        [[nodiscard]] float GetSahCost() const;
+
+    private:
+        friend struct BvhBuilder;
+
+        // Cold per-node data: the node's range in the primitive order and its surface area when built.
+        struct NodeInfo {
+            uint32_t first;
+            uint32_t count;
+            float    builtArea;
+        };
+
+        BvhConfig                   m_Config;
+        std::unique_ptr<BvhNode[]>  m_Nodes;
+        std::unique_ptr<NodeInfo[]> m_NodeInfo;
+        uint32_t                    m_NodeCount     = 0;
+        uint32_t                    m_NodeCapacity  = 0;
+        uint32_t                    m_DeadNodeCount = 0;
+        std::vector<uint32_t>       m_PrimitiveOrder;
+        std::vector<Aabb>           m_PrimitiveBounds;
+
+        Bvh() = default;
+
+        Aabb     RefitNode(uint32_t index, Threading::JobSystem *jobs);
+        uint32_t UpdateNode(uint32_t index, std::span<const Aabb> bounds, Threading::JobSystem *jobs);
+        uint32_t CountNodes(uint32_t index) const;
+    };
+}
+
+#endif //PULSAR_BVH_HPP
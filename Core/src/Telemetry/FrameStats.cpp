@@ -0,0 +1,246 @@
+#include "FrameStats.hpp"
+
+#include <fstream>
+#include <stdexcept>
+
+namespace Pulsar::Telemetry {
+    static constexpr std::array<const char *, g_FrameMetricCount> s_MetricNames = {
+        "CpuFrame", "AcquireWait", "Submit", "Present", "Gpu"
+    };
+
+    const char *GetFrameMetricName(const FrameMetric metric) {
+        return s_MetricNames[static_cast<size_t>(metric)];
+    }
+
+    FrameStats::ScopedTimer::ScopedTimer(FrameStats *stats, const FrameMetric metric)
+        : m_Stats(stats != nullptr && stats->IsEnabled() ? stats : nullptr), m_Metric(metric) {
+        if (m_Stats != nullptr) {
+            m_Start = std::chrono::steady_clock::now();
+        }
+    }
+
+    FrameStats::ScopedTimer::~ScopedTimer() {
+        if (m_Stats != nullptr) {
+            m_Stats->Record(m_Metric, std::chrono::steady_clock::now() - m_Start);
+        }
+    }
+
+    FrameStats FrameStats::Create(const FrameStatsConfig &config) {
+        if (config.windowFrames == 0) {
+            throw std::runtime_error("Failed to create frame stats: Window is empty");
+        }
+
+        FrameStats stats;
+        stats.m_State         = std::make_unique<State>();
+        stats.m_State->config = config;
+        stats.m_State->slots  = std::make_unique<Slot[]>(config.windowFrames);
+        stats.m_State->enabled.store(config.enabled, std::memory_order_relaxed);
+        stats.m_State->nextDump = std::chrono::steady_clock::now() + config.dumpInterval;
+
+        for (uint32_t i = 0; i < config.windowFrames; i++) {
+            for (std::atomic<uint64_t> &value : stats.m_State->slots[i].values) {
+                value.store(s_Missing, std::memory_order_relaxed);
+            }
+        }
+
+        return stats;
+    }
+
+    void FrameStats::SetEnabled(const bool enabled) {
+        m_State->enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool FrameStats::IsEnabled() const {
+        return m_State->enabled.load(std::memory_order_relaxed);
+    }
+
+    uint64_t FrameStats::BeginFrame() {
+        if (!IsEnabled()) {
+            return 0;
+        }
+
+        State &        state = *m_State;
+        const uint64_t frame = state.frame.load(std::memory_order_relaxed) + 1;
+        Slot &         slot  = state.slots[frame % state.config.windowFrames];
+
+        // Claim the slot before clearing it so late Records for the frame it held are dropped.
+        slot.frame.store(frame, std::memory_order_release);
+
+        for (size_t i = 0; i < g_FrameMetricCount; i++) {
+            const uint64_t old = slot.values[i].exchange(s_Missing, std::memory_order_acq_rel);
+
+            if (old != s_Missing) {
+                state.histograms[i].Remove(old);
+            }
+        }
+
+        state.frame.store(frame, std::memory_order_release);
+        state.frameStart = std::chrono::steady_clock::now();
+
+        return frame;
+    }
+
+    void FrameStats::EndFrame() {
+        if (!IsEnabled()) {
+            return;
+        }
+
+        State &    state = *m_State;
+        const auto now   = std::chrono::steady_clock::now();
+
+        Record(FrameMetric::CpuFrame, now - state.frameStart);
+
+        if (!state.config.dumpPath.empty() && now >= state.nextDump) {
+            Dump();
+            state.nextDump = now + state.config.dumpInterval;
+        }
+    }
+
+    void FrameStats::Record(const FrameMetric metric, const std::chrono::nanoseconds duration) {
+        Record(m_State->frame.load(std::memory_order_acquire), metric, duration);
+    }
+
+    void FrameStats::Record(const uint64_t frame, const FrameMetric metric, const std::chrono::nanoseconds duration) {
+        if (!IsEnabled() || frame == 0) {
+            return;
+        }
+
+        State &state = *m_State;
+        Slot & slot  = state.slots[frame % state.config.windowFrames];
+
+        if (slot.frame.load(std::memory_order_acquire) != frame) {
+            return;
+        }
+
+        const auto     index = static_cast<size_t>(metric);
+        const uint64_t value = static_cast<uint64_t>(std::max<int64_t>(duration.count(), 0));
+
+        // Count the value before publishing it, so whoever evicts it from the slot never removes it from the
+        // histogram first. A racing BeginFrame at worst mislabels one sample.
+        state.histograms[index].Record(value);
+
+        const uint64_t old = slot.values[index].exchange(value, std::memory_order_acq_rel);
+
+        if (old != s_Missing) {
+            state.histograms[index].Remove(old);
+        }
+
+        if (duration > state.config.hitchThreshold) {
+            state.totalHitches[index].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    FrameStats::ScopedTimer FrameStats::Measure(const FrameMetric metric) {
+        return {this, metric};
+    }
+
+    uint64_t FrameStats::GetCurrentFrame() const {
+        return m_State->frame.load(std::memory_order_acquire);
+    }
+
+    MetricSummary FrameStats::GetSummary(const FrameMetric metric) const {
+        const Histogram &histogram = GetHistogram(metric);
+        const auto       threshold = static_cast<uint64_t>(m_State->config.hitchThreshold.count());
+
+        MetricSummary summary;
+        summary.count         = histogram.GetCount();
+        summary.min           = histogram.GetMin();
+        summary.max           = histogram.GetMax();
+        summary.mean          = histogram.GetMean();
+        summary.p50           = histogram.GetPercentile(50.0);
+        summary.p95           = histogram.GetPercentile(95.0);
+        summary.p99           = histogram.GetPercentile(99.0);
+        summary.p999          = histogram.GetPercentile(99.9);
+        summary.windowHitches = histogram.GetCountAbove(threshold);
+        summary.totalHitches  = m_State->totalHitches[static_cast<size_t>(metric)].load(std::memory_order_relaxed);
+
+        return summary;
+    }
+
+    const Histogram &FrameStats::GetHistogram(const FrameMetric metric) const {
+        return m_State->histograms[static_cast<size_t>(metric)];
+    }
+
+    std::optional<FrameSample> FrameStats::GetFrame(const uint64_t frame) const {
+        const Slot &slot = m_State->slots[frame % m_State->config.windowFrames];
+
+        if (frame == 0 || slot.frame.load(std::memory_order_acquire) != frame) {
+            return std::nullopt;
+        }
+
+        FrameSample sample;
+        sample.frame = frame;
+
+        for (size_t i = 0; i < g_FrameMetricCount; i++) {
+            const uint64_t value = slot.values[i].load(std::memory_order_acquire);
+
+            if (value != s_Missing) {
+                sample.durations[i] = std::chrono::nanoseconds(value);
+            }
+        }
+
+        return sample;
+    }
+
+    void FrameStats::WriteCsv(std::ostream &stream, const bool header) const {
+        if (header) {
+            stream << "frame,metric,count,mean_ns,min_ns,p50_ns,p95_ns,p99_ns,p999_ns,max_ns,window_hitches,"
+                    "total_hitches\n";
+        }
+
+        const uint64_t frame = GetCurrentFrame();
+
+        for (size_t i = 0; i < g_FrameMetricCount; i++) {
+            const MetricSummary summary = GetSummary(static_cast<FrameMetric>(i));
+
+            stream << frame << ',' << s_MetricNames[i] << ',' << summary.count << ',' << summary.mean << ','
+                    << summary.min << ',' << summary.p50 << ',' << summary.p95 << ',' << summary.p99 << ','
+                    << summary.p999 << ',' << summary.max << ',' << summary.windowHitches << ','
+                    << summary.totalHitches << '\n';
+        }
+    }
+
+    void FrameStats::WriteJson(std::ostream &stream) const {
+        stream << "{\n  \"frame\": " << GetCurrentFrame() << ",\n  \"windowFrames\": "
+                << m_State->config.windowFrames << ",\n  \"hitchThresholdNs\": "
+                << m_State->config.hitchThreshold.count() << ",\n  \"metrics\": {";
+
+        for (size_t i = 0; i < g_FrameMetricCount; i++) {
+            const MetricSummary summary = GetSummary(static_cast<FrameMetric>(i));
+
+            stream << (i == 0 ? "\n" : ",\n") << "    \"" << s_MetricNames[i] << "\": {\"count\": " << summary.count
+                    << ", \"meanNs\": " << summary.mean << ", \"minNs\": " << summary.min << ", \"p50Ns\": "
+                    << summary.p50 << ", \"p95Ns\": " << summary.p95 << ", \"p99Ns\": " << summary.p99
+                    << ", \"p999Ns\": " << summary.p999 << ", \"maxNs\": " << summary.max
+                    << ", \"windowHitches\": " << summary.windowHitches << ", \"totalHitches\": "
+                    << summary.totalHitches << '}';
+        }
+
+        stream << "\n  }\n}\n";
+    }
+
+    void FrameStats::Dump() const {
+        const std::filesystem::path &path = m_State->config.dumpPath;
+
+        if (m_State->config.dumpFormat == DumpFormat::Csv) {
+            std::error_code errorCode;
+            const bool      header = !std::filesystem::exists(path, errorCode) ||
+                                     std::filesystem::file_size(path, errorCode) == 0;
+
+            std::ofstream file(path, std::ios::app);
+            if (!file.is_open()) {
+                throw std::runtime_error("Failed to dump frame stats: Could not open " + path.string());
+            }
+
+            WriteCsv(file, header);
+            return;
+        }
+
+        std::ofstream file(path, std::ios::trunc);
+        if (!file.is_open()) {
+            throw std::runtime_error("Failed to dump frame stats: Could not open " + path.string());
+        }
+
+        WriteJson(file);
+    }
+}
@@ -0,0 +1,145 @@
+#ifndef PULSAR_FRAMESTATS_HPP
+#define PULSAR_FRAMESTATS_HPP
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <ostream>
+
+#include "Histogram.hpp"
+
+namespace Pulsar::Telemetry {
+    enum class FrameMetric : uint8_t {
+        CpuFrame,
+        AcquireWait,
+        Submit,
+        Present,
+        Gpu
+    };
+
+    constexpr size_t g_FrameMetricCount = 5;
+
+    const char *GetFrameMetricName(FrameMetric metric);
+
+    enum class DumpFormat : uint8_t {
+        Csv,
+        Json
+    };
+
+    struct FrameStatsConfig {
+        // Size of the rolling window the histograms cover.
+        uint32_t windowFrames = 1024;
+
+        // Any sample above this counts as a hitch, whatever the metric.
+        std::chrono::nanoseconds hitchThreshold = std::chrono::milliseconds(33);
+
+        // When set, EndFrame writes a dump every dumpInterval. CSV appends one row per metric so the file is a
+        // time series; JSON overwrites the file with the latest summaries.
+        std::filesystem::path     dumpPath;
+        DumpFormat                dumpFormat   = DumpFormat::Json;
+        std::chrono::milliseconds dumpInterval = std::chrono::seconds(10);
+
+        bool enabled = true;
+    };
+
+    // All durations are in nanoseconds.
+    struct MetricSummary {
+        uint64_t count         = 0;
+        uint64_t min           = 0;
+        uint64_t max           = 0;
+        double   mean          = 0.0;
+        uint64_t p50           = 0;
+        uint64_t p95           = 0;
+        uint64_t p99           = 0;
+        uint64_t p999          = 0;
+        uint64_t windowHitches = 0;
+        uint64_t totalHitches  = 0;
+    };
+
+    struct FrameSample {
+        uint64_t                                                                frame = 0;
+        std::array<std::optional<std::chrono::nanoseconds>, g_FrameMetricCount> durations;
+    };
+
+    // Frame-time telemetry. Each frame owns a slot in a ring of windowFrames slots holding one atomic value per
+    // metric; the histograms always describe exactly the values in the ring, since overwriting a slot removes
+    // its old values from them. Nothing locks, so the frame loop, a thread resolving GPU timestamps and a
+    // reader can all use it at once, as long as each metric has one writer. While disabled every call returns
+    // after one relaxed load.
+    class FrameStats {
+    public:
+        // Records the time until it goes out of scope into the current frame. Reads no clock while disabled.
+        class ScopedTimer {
+        public:
+            ScopedTimer(FrameStats *stats, FrameMetric metric);
+
+            ~ScopedTimer();
+
+            ScopedTimer(const ScopedTimer &other) = delete;
+
+            ScopedTimer &operator=(const ScopedTimer &other) = delete;
+
+        private:
+            FrameStats *                          m_Stats;
+            FrameMetric                           m_Metric;
+            std::chrono::steady_clock::time_point m_Start;
+        };
+
+        static FrameStats Create(const FrameStatsConfig &config = {});
+
+        void               SetEnabled(bool enabled);
+        [[nodiscard]] bool IsEnabled() const;
+
+        // Returns the new frame number, or 0 while disabled. Frame numbers start at 1.
+        uint64_t BeginFrame();
+
+        // Records CpuFrame as the time since BeginFrame and writes a dump if one is due.
+        void EndFrame();
+
+        // Recording a metric twice for the same frame keeps the later value.
+        void Record(FrameMetric metric, std::chrono::nanoseconds duration);
+
+        // For values that arrive late, like GPU timestamps. Dropped once the frame has left the window.
+        void Record(uint64_t frame, FrameMetric metric, std::chrono::nanoseconds duration);
+
+        [[nodiscard]] ScopedTimer Measure(FrameMetric metric);
+
+        [[nodiscard]] uint64_t                   GetCurrentFrame() const;
+        [[nodiscard]] MetricSummary              GetSummary(FrameMetric metric) const;
+        [[nodiscard]] const Histogram &          GetHistogram(FrameMetric metric) const;
+        [[nodiscard]] std::optional<FrameSample> GetFrame(uint64_t frame) const;
+
+        void WriteCsv(std::ostream &stream, bool header = true) const;
+        void WriteJson(std::ostream &stream) const;
+
+        // Writes to the configured dump path now.
+        void Dump() const;
+
+    private:
+        static constexpr uint64_t s_Missing = ~0ULL;
+
+        struct Slot {
+            std::atomic<uint64_t>                                  frame = 0;
+            std::array<std::atomic<uint64_t>, g_FrameMetricCount> values{};
+        };
+
+        // Heap-allocated because the atomics cannot move.
+        struct State {
+            FrameStatsConfig                                       config;
+            std::unique_ptr<Slot[]>                                slots;
+            std::array<Histogram, g_FrameMetricCount>              histograms;
+            std::array<std::atomic<uint64_t>, g_FrameMetricCount> totalHitches{};
+            std::atomic<uint64_t>                                  frame   = 0;
+            std::atomic<bool>                                      enabled = false;
+            std::chrono::steady_clock::time_point                  frameStart;
+            std::chrono::steady_clock::time_point                  nextDump;
+        };
+
+        std::unique_ptr<State> m_State;
+
+        FrameStats() = default;
+    };
+}
+
+#endif //PULSAR_FRAMESTATS_HPP
@@ -0,0 +1,121 @@
+#include "Histogram.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace Pulsar::Telemetry {
+    void Histogram::Record(const uint64_t value) {
+        m_Buckets[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        m_Count.fetch_add(1, std::memory_order_relaxed);
+        m_Sum.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    void Histogram::Remove(const uint64_t value) {
+        m_Buckets[GetBucketIndex(value)].fetch_sub(1, std::memory_order_relaxed);
+        m_Count.fetch_sub(1, std::memory_order_relaxed);
+        m_Sum.fetch_sub(value, std::memory_order_relaxed);
+    }
+
+    void Histogram::Reset() {
+        for (std::atomic<uint32_t> &bucket : m_Buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+
+        m_Count.store(0, std::memory_order_relaxed);
+        m_Sum.store(0, std::memory_order_relaxed);
+    }
+
+    uint64_t Histogram::GetCount() const {
+        return m_Count.load(std::memory_order_relaxed);
+    }
+
+    uint64_t Histogram::GetMin() const {
+        for (uint32_t i = 0; i < s_BucketCount; i++) {
+            if (m_Buckets[i].load(std::memory_order_relaxed) != 0) {
+                return GetBucketLowest(i);
+            }
+        }
+
+        return 0;
+    }
+
+    uint64_t Histogram::GetMax() const {
+        for (uint32_t i = s_BucketCount; i > 0; i--) {
+            if (m_Buckets[i - 1].load(std::memory_order_relaxed) != 0) {
+                return GetBucketHighest(i - 1);
+            }
+        }
+
+        return 0;
+    }
+
+    double Histogram::GetMean() const {
+        const uint64_t count = GetCount();
+        return count == 0 ? 0.0 : static_cast<double>(m_Sum.load(std::memory_order_relaxed)) / count;
+    }
+
+    uint64_t Histogram::GetPercentile(const double percentile) const {
+        const uint64_t count = GetCount();
+        if (count == 0) {
+            return 0;
+        }
+
+        const double   fraction = std::clamp(percentile, 0.0, 100.0) / 100.0;
+        const uint64_t target   = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(fraction * count)));
+
+        uint64_t cumulative = 0;
+        for (uint32_t i = 0; i < s_BucketCount; i++) {
+            cumulative += m_Buckets[i].load(std::memory_order_relaxed);
+
+            if (cumulative >= target) {
+                return GetBucketHighest(i);
+            }
+        }
+
+        return GetMax();
+    }
+
+    uint64_t Histogram::GetCountAbove(const uint64_t threshold) const {
+        const uint32_t first = GetBucketIndex(threshold) + 1;
+
+        uint64_t count = 0;
+        for (uint32_t i = first; i < s_BucketCount; i++) {
+            count += m_Buckets[i].load(std::memory_order_relaxed);
+        }
+
+        return count;
+    }
+
+    uint32_t Histogram::GetBucketIndex(const uint64_t value) {
+        if (value < s_SubBucketCount) {
+            return static_cast<uint32_t>(value);
+        }
+
+        const uint32_t shift = std::min(static_cast<uint32_t>(std::bit_width(value)) - s_SubBucketBits, s_MaxShift);
+        const uint64_t sub   = std::min<uint64_t>(value >> shift, s_SubBucketCount - 1);
+
+        return s_SubBucketCount + (shift - 1) * s_HalfCount + static_cast<uint32_t>(sub - s_HalfCount);
+    }
+
+    uint64_t Histogram::GetBucketLowest(const uint32_t index) {
+        if (index < s_SubBucketCount) {
+            return index;
+        }
+
+        const uint32_t shift = (index - s_SubBucketCount) / s_HalfCount + 1;
+        const uint64_t sub   = (index - s_SubBucketCount) % s_HalfCount + s_HalfCount;
+
+        return sub << shift;
+    }
+
+    uint64_t Histogram::GetBucketHighest(const uint32_t index) {
+        if (index < s_SubBucketCount) {
+            return index;
+        }
+
+        const uint32_t shift = (index - s_SubBucketCount) / s_HalfCount + 1;
+
+        return GetBucketLowest(index) + (uint64_t{1} << shift) - 1;
+    }
+}
@@ -0,0 +1,55 @@
+#ifndef PULSAR_HISTOGRAM_HPP
+#define PULSAR_HISTOGRAM_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace Pulsar::Telemetry {
+    // HDR-style log-linear histogram of nanosecond durations. Values below 128 are exact; above that every
+    // power of two is split into 64 buckets, so any value is known to within 1.6% from 1 ns up to about
+    // 36 minutes, in a fixed 2304 buckets. Counters are atomic: Record and Remove can run concurrently with
+    // queries, which see a slightly stale but never corrupt view.
+    class Histogram {
+    public:
+        static constexpr uint32_t s_SubBucketBits  = 7;
+        static constexpr uint32_t s_SubBucketCount = 1U << s_SubBucketBits;
+        static constexpr uint32_t s_HalfCount      = s_SubBucketCount / 2;
+        static constexpr uint32_t s_MaxShift       = 34;
+        static constexpr uint32_t s_BucketCount    = s_SubBucketCount + s_MaxShift * s_HalfCount;
+
+        Histogram() = default;
+
+        Histogram(const Histogram &other) = delete;
+
+        Histogram &operator=(const Histogram &other) = delete;
+
+        void Record(uint64_t value);
+
+        // Undoes a previous Record of the same value; used to slide a window over a stream.
+        void Remove(uint64_t value);
+
+        void Reset();
+
+        [[nodiscard]] uint64_t GetCount() const;
+        [[nodiscard]] uint64_t GetMin() const;
+        [[nodiscard]] uint64_t GetMax() const;
+        [[nodiscard]] double   GetMean() const;
+
+        // percentile is in [0, 100]. Returns the highest value equivalent to the bucket the percentile falls in.
+        [[nodiscard]] uint64_t GetPercentile(double percentile) const;
+
+        [[nodiscard]] uint64_t GetCountAbove(uint64_t threshold) const;
+
+        [[nodiscard]] static uint32_t GetBucketIndex(uint64_t value);
+        [[nodiscard]] static uint64_t GetBucketLowest(uint32_t index);
+        [[nodiscard]] static uint64_t GetBucketHighest(uint32_t index);
+
+    private:
+        std::array<std::atomic<uint32_t>, s_BucketCount> m_Buckets{};
+        std::atomic<uint64_t>                            m_Count = 0;
+        std::atomic<uint64_t>                            m_Sum   = 0;
+    };
+}
+
+#endif //PULSAR_HISTOGRAM_HPP
@@ -0,0 +1,1476 @@
+#include "BlockCompression.hpp"
+
+#include <cmath>
+
+#include "Math/Simd.hpp"
+
+namespace Pulsar::Texture {
+    static constexpr uint32_t s_MinBlockRowsPerJob = 4;
+
+    static constexpr std::array<uint32_t, 4>  s_Bc7Weights2 = {0, 21, 43, 64};
+    static constexpr std::array<uint32_t, 8>  s_Bc7Weights3 = {0, 9, 18, 27, 37, 46, 55, 64};
+    static constexpr std::array<uint32_t, 16> s_Bc7Weights4 = {
+        0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64
+    };
+
+    // One block channel by channel, so four pixels of a channel load as one Float4.
+    struct BlockPixels {
+        alignas(16) std::array<std::array<float, 16>, 4> channels;
+    };
+
+    // Entries of one palette channel by channel, indexed [channel][entry].
+    using Palette = std::array<std::array<float, 16>, 4>;
+
+    template<uint32_t Channels>
+    using Endpoint = std::array<float, Channels>;
+
+    static BlockPixels LoadBlock(const uint8_t *pixels) {
+        BlockPixels block;
+
+        for (uint32_t i = 0; i < 16; i++) {
+            for (uint32_t channel = 0; channel < 4; channel++) {
+                block.channels[channel][i] = pixels[i * 4 + channel];
+            }
+        }
+
+        return block;
+    }
+
+    // Picks the closest palette entry for every pixel over channels [first, first + Channels) and returns the summed
+    // squared error. Only pixels in mask are considered; the indices of the others are left untouched.
+    template<uint32_t Channels>
+    static float FitIndices(const BlockPixels &pixels, const uint32_t first, const Palette &palette,
+                            const uint32_t paletteSize, std::array<uint8_t, 16> &indices,
+                            const uint16_t mask = 0xFFFF) {
+        float total = 0.0F;
+
+#if defined(PULSAR_MATH_SIMD)
+        for (uint32_t group = 0; group < 16; group += 4) {
+            Math::Simd::Float4 values[Channels];
+            for (uint32_t channel = 0; channel < Channels; channel++) {
+                values[channel] = Math::Simd::Load(pixels.channels[first + channel].data() + group);
+            }
+
+            Math::Simd::Float4 best      = Math::Simd::Splat(std::numeric_limits<float>::max());
+            Math::Simd::Float4 bestEntry = Math::Simd::Splat(0.0F);
+
+            for (uint32_t entry = 0; entry < paletteSize; entry++) {
+                Math::Simd::Float4 error = Math::Simd::Splat(0.0F);
+
+                for (uint32_t channel = 0; channel < Channels; channel++) {
+                    const Math::Simd::Float4 difference = Math::Simd::Sub(
+                        values[channel], Math::Simd::Splat(palette[channel][entry]));
+                    error = Math::Simd::MulAdd(difference, difference, error);
+                }
+
+                const Math::Simd::Float4 closer = Math::Simd::Less(error, best);
+                best      = Math::Simd::Min(error, best);
+                bestEntry = Math::Simd::Select(closer, Math::Simd::Splat(static_cast<float>(entry)), bestEntry);
+            }
+
+            alignas(16) std::array<float, 4> errors;
+            alignas(16) std::array<float, 4> entries;
+            Math::Simd::Store(errors.data(), best);
+            Math::Simd::Store(entries.data(), bestEntry);
+
+            for (uint32_t i = 0; i < 4; i++) {
+                if ((mask >> (group + i) & 1) != 0) {
+                    indices[group + i] = static_cast<uint8_t>(entries[i]);
+                    total += errors[i];
+                }
+            }
+        }
+#else
+        for (uint32_t i = 0; i < 16; i++) {
+            if ((mask >> i & 1) == 0) {
+                continue;
+            }
+
+            float best = std::numeric_limits<float>::max();
+
+            for (uint32_t entry = 0; entry < paletteSize; entry++) {
+                float error = 0.0F;
+
+                for (uint32_t channel = 0; channel < Channels; channel++) {
+                    const float difference = pixels.channels[first + channel][i] - palette[channel][entry];
+                    error += difference * difference;
+                }
+
+                if (error < best) {
+                    best       = error;
+                    indices[i] = static_cast<uint8_t>(entry);
+                }
+            }
+
+            total += best;
+        }
+#endif
+
+        return total;
+    }
+
+    // Extremes of the pixels in mask along their principal axis, found by power iteration on the covariance matrix.
+    template<uint32_t Channels>
+    static void FindEndpoints(const BlockPixels &pixels, const uint32_t first, Endpoint<Channels> &low,
+                              Endpoint<Channels> &high, const uint16_t mask = 0xFFFF) {
+        Endpoint<Channels> mean{};
+        Endpoint<Channels> minimum;
+        Endpoint<Channels> maximum;
+        minimum.fill(255.0F);
+        maximum.fill(0.0F);
+
+        const auto count = static_cast<float>(std::popcount(mask));
+
+        for (uint32_t channel = 0; channel < Channels; channel++) {
+            for (uint32_t i = 0; i < 16; i++) {
+                if ((mask >> i & 1) == 0) {
+                    continue;
+                }
+
+                const float value = pixels.channels[first + channel][i];
+                mean[channel] += value;
+                minimum[channel] = std::min(minimum[channel], value);
+                maximum[channel] = std::max(maximum[channel], value);
+            }
+
+            mean[channel] /= count;
+        }
+
+        std::array<std::array<float, Channels>, Channels> covariance{};
+        for (uint32_t i = 0; i < 16; i++) {
+            if ((mask >> i & 1) == 0) {
+                continue;
+            }
+
+            for (uint32_t row = 0; row < Channels; row++) {
+                const float rowValue = pixels.channels[first + row][i] - mean[row];
+
+                for (uint32_t column = row; column < Channels; column++) {
+                    covariance[row][column] += rowValue * (pixels.channels[first + column][i] - mean[column]);
+                }
+            }
+        }
+
+        // The bounding box diagonal is usually close already, so a few iterations are enough.
+        Endpoint<Channels> axis;
+        for (uint32_t channel = 0; channel < Channels; channel++) {
+            axis[channel] = maximum[channel] - minimum[channel];
+        }
+
+        for (uint32_t iteration = 0; iteration < 4; iteration++) {
+            Endpoint<Channels> next{};
+            for (uint32_t row = 0; row < Channels; row++) {
+                for (uint32_t column = 0; column < Channels; column++) {
+                    const float value = row <= column ? covariance[row][column] : covariance[column][row];
+                    next[row] += value * axis[column];
+                }
+            }
+
+            float length = 0.0F;
+            for (const float value : next) {
+                length = std::max(length, std::abs(value));
+            }
+
+            if (length < 1e-6F) {
+                break;
+            }
+
+            for (uint32_t channel = 0; channel < Channels; channel++) {
+                axis[channel] = next[channel] / length;
+            }
+        }
+
+        float lengthSquared = 0.0F;
+        for (const float value : axis) {
+            lengthSquared += value * value;
+        }
+
+        if (lengthSquared < 1e-12F) {
+            low  = mean;
+            high = mean;
+            return;
+        }
+
+        float minimumT = std::numeric_limits<float>::max();
+        float maximumT = std::numeric_limits<float>::lowest();
+
+        for (uint32_t i = 0; i < 16; i++) {
+            if ((mask >> i & 1) == 0) {
+                continue;
+            }
+
+            float t = 0.0F;
+            for (uint32_t channel = 0; channel < Channels; channel++) {
+                t += (pixels.channels[first + channel][i] - mean[channel]) * axis[channel];
+            }
+
+            minimumT = std::min(minimumT, t);
+            maximumT = std::max(maximumT, t);
+        }
+
+        for (uint32_t channel = 0; channel < Channels; channel++) {
+            low[channel]  = std::clamp(mean[channel] + axis[channel] * minimumT / lengthSquared, 0.0F, 255.0F);
+            high[channel] = std::clamp(mean[channel] + axis[channel] * maximumT / lengthSquared, 0.0F, 255.0F);
+        }
+    }
+
+    // Least-squares endpoints for the given indices, where weights[index] is how far that entry lies from low
+    // towards high. Entries with a negative weight and pixels outside mask are left out. Returns false when the fit
+    // is degenerate.
+    template<uint32_t Channels>
+    static bool RefineEndpoints(const BlockPixels &pixels, const uint32_t first, const std::array<uint8_t, 16> &indices,
+                                const float *weights, Endpoint<Channels> &low, Endpoint<Channels> &high,
+                                const uint16_t mask = 0xFFFF) {
+        float lowLow   = 0.0F;
+        float lowHigh  = 0.0F;
+        float highHigh = 0.0F;
+
+        Endpoint<Channels> lowSum{};
+        Endpoint<Channels> highSum{};
+
+        for (uint32_t i = 0; i < 16; i++) {
+            if ((mask >> i & 1) == 0) {
+                continue;
+            }
+
+            const float weight = weights[indices[i]];
+            if (weight < 0.0F) {
+                continue;
+            }
+
+            const float inverse = 1.0F - weight;
+            lowLow += inverse * inverse;
+            lowHigh += inverse * weight;
+            highHigh += weight * weight;
+
+            for (uint32_t channel = 0; channel < Channels; channel++) {
+                lowSum[channel] += inverse * pixels.channels[first + channel][i];
+                highSum[channel] += weight * pixels.channels[first + channel][i];
+            }
+        }
+
+        const float determinant = lowLow * highHigh - lowHigh * lowHigh;
+        if (std::abs(determinant) < 1e-6F) {
+            return false;
+        }
+
+        for (uint32_t channel = 0; channel < Channels; channel++) {
+            low[channel] = std::clamp((highHigh * lowSum[channel] - lowHigh * highSum[channel]) / determinant, 0.0F,
+                                      255.0F);
+            high[channel] = std::clamp((lowLow * highSum[channel] - lowHigh * lowSum[channel]) / determinant, 0.0F,
+                                       255.0F);
+        }
+
+        return true;
+    }
+
+    static uint32_t GetRefinementCount(const CompressionQuality quality) {
+        switch (quality) {
+        case CompressionQuality::Fast:
+            return 0;
+        case CompressionQuality::Balanced:
+            return 1;
+        case CompressionQuality::High:
+            return 3;
+        }
+
+        return 0;
+    }
+
+    // Writes fields least significant bit first, as BC7 lays them out.
+    class BitWriter {
+    public:
+        explicit BitWriter(uint8_t *output) : m_Output(output) {
+            std::memset(m_Output, 0, 16);
+        }
+
+        void Write(const uint32_t value, const uint32_t count) {
+            for (uint32_t i = 0; i < count; i++, m_Bit++) {
+                m_Output[m_Bit / 8] |= static_cast<uint8_t>(((value >> i) & 1) << (m_Bit % 8));
+            }
+        }
+
+    private:
+        uint8_t *m_Output;
+        uint32_t m_Bit = 0;
+    };
+
+    // BC1 ------------------------------------------------------------------------------------------------------------
+
+    struct Bc1Result {
+        uint16_t                color0  = 0;
+        uint16_t                color1  = 0;
+        std::array<uint8_t, 16> indices = {};
+        float                   error   = std::numeric_limits<float>::max();
+    };
+
+    static uint16_t ToRgb565(const Endpoint<3> &color) {
+        const auto quantize = [](const float value, const float maximum) {
+            return static_cast<uint16_t>(std::lround(std::clamp(value, 0.0F, 255.0F) * maximum / 255.0F));
+        };
+
+        return static_cast<uint16_t>(quantize(color[0], 31) << 11 | quantize(color[1], 63) << 5 |
+                                     quantize(color[2], 31));
+    }
+
+    static Endpoint<3> FromRgb565(const uint16_t color) {
+        const uint32_t red   = color >> 11;
+        const uint32_t green = (color >> 5) & 63;
+        const uint32_t blue  = color & 31;
+
+        return {
+            static_cast<float>(red << 3 | red >> 2), static_cast<float>(green << 2 | green >> 4),
+            static_cast<float>(blue << 3 | blue >> 2)
+        };
+    }
+
+    // Indices are relative to the endpoints as given; OrderBc1 swaps them into the order the decoder expects.
+    // transparent marks pixels that must use index 3 of a three-color block.
+    static Bc1Result EvaluateBc1(const BlockPixels &pixels, const Endpoint<3> &endpoint0, const Endpoint<3> &endpoint1,
+                                 const bool threeColor, const uint16_t transparent) {
+        Bc1Result result;
+        result.color0 = ToRgb565(endpoint0);
+        result.color1 = ToRgb565(endpoint1);
+
+        const Endpoint<3> color0 = FromRgb565(result.color0);
+        const Endpoint<3> color1 = FromRgb565(result.color1);
+
+        Palette palette{};
+        for (uint32_t channel = 0; channel < 3; channel++) {
+            const float value0 = color0[channel];
+            const float value1 = color1[channel];
+
+            palette[channel][0] = value0;
+            palette[channel][1] = value1;
+
+            if (threeColor) {
+                palette[channel][2] = std::floor((value0 + value1) / 2.0F);
+            } else {
+                palette[channel][2] = std::floor((2.0F * value0 + value1) / 3.0F);
+                palette[channel][3] = std::floor((value0 + 2.0F * value1) / 3.0F);
+            }
+        }
+
+        result.error = FitIndices<3>(pixels, 0, palette, threeColor ? 3 : 4, result.indices);
+
+        for (uint32_t i = 0; i < 16; i++) {
+            if ((transparent >> i) & 1) {
+                result.indices[i] = 3;
+            }
+        }
+
+        return result;
+    }
+
+    // The decoder picks the mode from the endpoint order: four colors need color0 > color1, three colors the
+    // opposite. Swapping the endpoints swaps indices 0 and 1, and in four-color blocks 2 and 3 as well.
+    static void OrderBc1(Bc1Result &result, const bool threeColor) {
+        if (threeColor ? result.color0 <= result.color1 : result.color0 >= result.color1) {
+            return;
+        }
+
+        std::swap(result.color0, result.color1);
+
+        for (uint8_t &index : result.indices) {
+            index = !threeColor || index < 2 ? index ^ 1 : index;
+        }
+    }
+
+    static Bc1Result EncodeBc1Mode(const BlockPixels &pixels, const bool threeColor, const uint16_t transparent,
+                                   const CompressionQuality quality) {
+        static constexpr std::array<float, 4> s_FourColorWeights  = {0.0F, 1.0F, 1.0F / 3.0F, 2.0F / 3.0F};
+        static constexpr std::array<float, 4> s_ThreeColorWeights = {0.0F, 1.0F, 0.5F, -1.0F};
+
+        const float *weights = threeColor ? s_ThreeColorWeights.data() : s_FourColorWeights.data();
+
+        Endpoint<3> endpoint0;
+        Endpoint<3> endpoint1;
+        FindEndpoints<3>(pixels, 0, endpoint1, endpoint0);
+
+        Bc1Result best = EvaluateBc1(pixels, endpoint0, endpoint1, threeColor, transparent);
+
+        for (uint32_t i = 0; i < GetRefinementCount(quality) && best.error > 0.0F; i++) {
+            if (!RefineEndpoints<3>(pixels, 0, best.indices, weights, endpoint0, endpoint1)) {
+                break;
+            }
+
+            const Bc1Result refined = EvaluateBc1(pixels, endpoint0, endpoint1, threeColor, transparent);
+            if (refined.error >= best.error) {
+                break;
+            }
+
+            best = refined;
+        }
+
+        OrderBc1(best, threeColor);
+
+        return best;
+    }
+
+    static void WriteBc1(const Bc1Result &result, uint8_t *block) {
+        uint32_t indices = 0;
+        for (uint32_t i = 0; i < 16; i++) {
+            indices |= static_cast<uint32_t>(result.indices[i]) << (2 * i);
+        }
+
+        block[0] = static_cast<uint8_t>(result.color0);
+        block[1] = static_cast<uint8_t>(result.color0 >> 8);
+        block[2] = static_cast<uint8_t>(result.color1);
+        block[3] = static_cast<uint8_t>(result.color1 >> 8);
+
+        for (uint32_t i = 0; i < 4; i++) {
+            block[4 + i] = static_cast<uint8_t>(indices >> (8 * i));
+        }
+    }
+
+    // In BC3 the color block always decodes as four colors, so allowThreeColor is false there.
+    static void EncodeBc1Color(BlockPixels pixels, uint8_t *block, const CompressionQuality quality,
+                               const bool allowThreeColor) {
+        uint16_t transparent = 0;
+        if (allowThreeColor) {
+            for (uint32_t i = 0; i < 16; i++) {
+                transparent |= static_cast<uint16_t>(pixels.channels[3][i] < 128.0F) << i;
+            }
+        }
+
+        if (transparent == 0xFFFF) {
+            WriteBc1({0, 0, {3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3}, 0.0F}, block);
+            return;
+        }
+
+        if (transparent != 0) {
+            // Transparent pixels keep their index either way; moving them to the mean of the others keeps them from
+            // pulling the endpoints around.
+            Endpoint<3> mean{};
+            for (uint32_t i = 0; i < 16; i++) {
+                if (((transparent >> i) & 1) == 0) {
+                    for (uint32_t channel = 0; channel < 3; channel++) {
+                        mean[channel] += pixels.channels[channel][i];
+                    }
+                }
+            }
+
+            const auto opaqueCount = static_cast<float>(16 - std::popcount(transparent));
+            for (uint32_t i = 0; i < 16; i++) {
+                if ((transparent >> i) & 1) {
+                    for (uint32_t channel = 0; channel < 3; channel++) {
+                        pixels.channels[channel][i] = mean[channel] / opaqueCount;
+                    }
+                }
+            }
+
+            WriteBc1(EncodeBc1Mode(pixels, true, transparent, quality), block);
+            return;
+        }
+
+        Bc1Result best = EncodeBc1Mode(pixels, false, 0, quality);
+
+        if (allowThreeColor && quality == CompressionQuality::High) {
+            const Bc1Result threeColor = EncodeBc1Mode(pixels, true, 0, quality);
+            if (threeColor.error < best.error) {
+                best = threeColor;
+            }
+        }
+
+        WriteBc1(best, block);
+    }
+
+    // BC4 ------------------------------------------------------------------------------------------------------------
+
+    struct Bc4Result {
+        uint8_t                 value0  = 0;
+        uint8_t                 value1  = 0;
+        std::array<uint8_t, 16> indices = {};
+        float                   error   = std::numeric_limits<float>::max();
+    };
+
+    // Eight interpolated values when value0 > value1, otherwise six plus 0 and 255.
+    static Bc4Result EvaluateBc4(const BlockPixels &pixels, const uint32_t channel, const uint8_t value0,
+                                 const uint8_t value1) {
+        Palette palette{};
+        std::array<float, 16> &entries = palette[0];
+
+        const float low  = value0;
+        const float high = value1;
+        entries[0]       = low;
+        entries[1]       = high;
+
+        if (value0 > value1) {
+            for (uint32_t i = 1; i < 7; i++) {
+                entries[i + 1] = std::floor(((7.0F - i) * low + i * high) / 7.0F);
+            }
+        } else {
+            for (uint32_t i = 1; i < 5; i++) {
+                entries[i + 1] = std::floor(((5.0F - i) * low + i * high) / 5.0F);
+            }
+
+            entries[6] = 0.0F;
+            entries[7] = 255.0F;
+        }
+
+        Bc4Result result;
+        result.value0 = value0;
+        result.value1 = value1;
+        result.error  = FitIndices<1>(pixels, channel, palette, 8, result.indices);
+
+        return result;
+    }
+
+    static void EncodeBc4Channel(const BlockPixels &pixels, const uint32_t channel, uint8_t *block,
+                                 const CompressionQuality quality) {
+        const std::array<float, 16> &values = pixels.channels[channel];
+
+        const auto [minimumIt, maximumIt] = std::ranges::minmax_element(values);
+        const auto minimum                = static_cast<uint8_t>(*minimumIt);
+        const auto maximum                = static_cast<uint8_t>(*maximumIt);
+
+        Bc4Result best = EvaluateBc4(pixels, channel, maximum, minimum);
+
+        if (quality != CompressionQuality::Fast) {
+            // The six-value mode spends its range on everything but exact 0 and 255, which it has for free.
+            uint8_t innerMinimum = 255;
+            uint8_t innerMaximum = 0;
+
+            for (const float value : values) {
+                if (value > 0.0F && value < 255.0F) {
+                    innerMinimum = std::min(innerMinimum, static_cast<uint8_t>(value));
+                    innerMaximum = std::max(innerMaximum, static_cast<uint8_t>(value));
+                }
+            }
+
+            if (innerMinimum <= innerMaximum) {
+                const Bc4Result sixValue = EvaluateBc4(pixels, channel, innerMinimum, innerMaximum);
+                if (sixValue.error < best.error) {
+                    best = sixValue;
+                }
+            }
+        }
+
+        if (quality == CompressionQuality::High && best.error > 0.0F && maximum > minimum) {
+            // Small search around the extremes; the interpolated values rarely land best exactly on them.
+            const uint8_t baseHigh = best.value0 > best.value1 ? best.value0 : best.value1;
+            const uint8_t baseLow  = best.value0 > best.value1 ? best.value1 : best.value0;
+            const bool    eight    = best.value0 > best.value1;
+
+            for (int highOffset = -2; highOffset <= 2; highOffset++) {
+                for (int lowOffset = -2; lowOffset <= 2; lowOffset++) {
+                    const int high = baseHigh + highOffset;
+                    const int low  = baseLow + lowOffset;
+                    if (low < 0 || high > 255 || low >= high) {
+                        continue;
+                    }
+
+                    const Bc4Result candidate = eight
+                                                    ? EvaluateBc4(pixels, channel, static_cast<uint8_t>(high),
+                                                                  static_cast<uint8_t>(low))
+                                                    : EvaluateBc4(pixels, channel, static_cast<uint8_t>(low),
+                                                                  static_cast<uint8_t>(high));
+                    if (candidate.error < best.error) {
+                        best = candidate;
+                    }
+                }
+            }
+        }
+
+        uint64_t indices = 0;
+        for (uint32_t i = 0; i < 16; i++) {
+            indices |= static_cast<uint64_t>(best.indices[i]) << (3 * i);
+        }
+
+        block[0] = best.value0;
+        block[1] = best.value1;
+        for (uint32_t i = 0; i < 6; i++) {
+            block[2 + i] = static_cast<uint8_t>(indices >> (8 * i));
+        }
+    }
+
+    // BC7 ------------------------------------------------------------------------------------------------------------
+
+    struct Bc7Result {
+        std::array<uint8_t, 16> block = {};
+        float                   error = std::numeric_limits<float>::max();
+    };
+
+    static float Interpolate(const uint32_t low, const uint32_t high, const uint32_t weight) {
+        return static_cast<float>(((64 - weight) * low + weight * high + 32) >> 6);
+    }
+
+    // Mode 6: one subset, 7-bit RGBA endpoints with a p-bit each, 4-bit indices.
+    struct Bc7Mode6 {
+        std::array<uint32_t, 4> endpoint0;
+        std::array<uint32_t, 4> endpoint1;
+        uint32_t                pBit0;
+        uint32_t                pBit1;
+        std::array<uint8_t, 16> indices;
+        float                   error;
+    };
+
+    static Bc7Mode6 EvaluateMode6(const BlockPixels &pixels, const Endpoint<4> &low, const Endpoint<4> &high,
+                                  const uint32_t pBit0, const uint32_t pBit1) {
+        Bc7Mode6 mode{};
+        mode.pBit0 = pBit0;
+        mode.pBit1 = pBit1;
+
+        Palette palette{};
+        for (uint32_t channel = 0; channel < 4; channel++) {
+            mode.endpoint0[channel] = static_cast<uint32_t>(
+                std::clamp(std::lround((low[channel] - pBit0) / 2.0F), 0L, 127L));
+            mode.endpoint1[channel] = static_cast<uint32_t>(
+                std::clamp(std::lround((high[channel] - pBit1) / 2.0F), 0L, 127L));
+
+            const uint32_t value0 = mode.endpoint0[channel] << 1 | pBit0;
+            const uint32_t value1 = mode.endpoint1[channel] << 1 | pBit1;
+
+            for (uint32_t entry = 0; entry < 16; entry++) {
+                palette[channel][entry] = Interpolate(value0, value1, s_Bc7Weights4[entry]);
+            }
+        }
+
+        mode.error = FitIndices<4>(pixels, 0, palette, 16, mode.indices);
+
+        return mode;
+    }
+
+    // The p-bit of each endpoint that quantizes it best on its own.
+    static uint32_t ChoosePBit(const Endpoint<4> &endpoint) {
+        std::array<float, 2> errors{};
+
+        for (uint32_t pBit = 0; pBit < 2; pBit++) {
+            for (const float value : endpoint) {
+                const float quantized = std::clamp(std::round((value - pBit) / 2.0F), 0.0F, 127.0F) * 2.0F + pBit;
+                errors[pBit] += (value - quantized) * (value - quantized);
+            }
+        }
+
+        return errors[1] < errors[0] ? 1 : 0;
+    }
+
+    static Bc7Mode6 SearchMode6(const BlockPixels &pixels, const Endpoint<4> &low, const Endpoint<4> &high,
+                                const CompressionQuality quality) {
+        if (quality == CompressionQuality::Fast) {
+            return EvaluateMode6(pixels, low, high, ChoosePBit(low), ChoosePBit(high));
+        }
+
+        Bc7Mode6 best{};
+        best.error = std::numeric_limits<float>::max();
+
+        for (uint32_t pBits = 0; pBits < 4; pBits++) {
+            const Bc7Mode6 candidate = EvaluateMode6(pixels, low, high, pBits & 1, pBits >> 1);
+            if (candidate.error < best.error) {
+                best = candidate;
+            }
+        }
+
+        return best;
+    }
+
+    static Bc7Result EncodeMode6(const BlockPixels &pixels, const CompressionQuality quality) {
+        std::array<float, 16> weights;
+        for (uint32_t i = 0; i < 16; i++) {
+            weights[i] = static_cast<float>(s_Bc7Weights4[i]) / 64.0F;
+        }
+
+        Endpoint<4> low;
+        Endpoint<4> high;
+        FindEndpoints<4>(pixels, 0, low, high);
+
+        Bc7Mode6 best = SearchMode6(pixels, low, high, quality);
+
+        for (uint32_t i = 0; i < GetRefinementCount(quality) && best.error > 0.0F; i++) {
+            if (!RefineEndpoints<4>(pixels, 0, best.indices, weights.data(), low, high)) {
+                break;
+            }
+
+            const Bc7Mode6 refined = SearchMode6(pixels, low, high, quality);
+            if (refined.error >= best.error) {
+                break;
+            }
+
+            best = refined;
+        }
+
+        // The anchor index is stored without its top bit, so it must be below 8.
+        if (best.indices[0] >= 8) {
+            std::swap(best.endpoint0, best.endpoint1);
+            std::swap(best.pBit0, best.pBit1);
+
+            for (uint8_t &index : best.indices) {
+                index = static_cast<uint8_t>(15 - index);
+            }
+        }
+
+        Bc7Result result;
+        result.error = best.error;
+
+        BitWriter writer(result.block.data());
+        writer.Write(1 << 6, 7);
+
+        for (uint32_t channel = 0; channel < 4; channel++) {
+            writer.Write(best.endpoint0[channel], 7);
+            writer.Write(best.endpoint1[channel], 7);
+        }
+
+        writer.Write(best.pBit0, 1);
+        writer.Write(best.pBit1, 1);
+
+        for (uint32_t i = 0; i < 16; i++) {
+            writer.Write(best.indices[i], i == 0 ? 3 : 4);
+        }
+
+        return result;
+    }
+
+    // One half of a mode 5 block: 2-bit indices into either 7-bit RGB or 8-bit scalar endpoints.
+    template<uint32_t Channels>
+    struct Bc7Mode5Part {
+        std::array<uint32_t, Channels> endpoint0;
+        std::array<uint32_t, Channels> endpoint1;
+        std::array<uint8_t, 16>        indices;
+        float                          error;
+    };
+
+    template<uint32_t Channels>
+    static Bc7Mode5Part<Channels> EvaluateMode5Part(const BlockPixels &pixels, const uint32_t first,
+                                                    const Endpoint<Channels> &low, const Endpoint<Channels> &high) {
+        // Color endpoints have 7 bits, expanded by repeating the top bit; alpha endpoints have 8.
+        constexpr uint32_t bits = Channels == 3 ? 7 : 8;
+
+        Bc7Mode5Part<Channels> part{};
+        Palette                palette{};
+
+        for (uint32_t channel = 0; channel < Channels; channel++) {
+            const auto quantize = [](const float value) {
+                return static_cast<uint32_t>(std::lround(value * ((1 << bits) - 1) / 255.0F));
+            };
+            const auto expand = [](const uint32_t value) {
+                return bits == 8 ? value : value << 1 | value >> 6;
+            };
+
+            part.endpoint0[channel] = quantize(low[channel]);
+            part.endpoint1[channel] = quantize(high[channel]);
+
+            for (uint32_t entry = 0; entry < 4; entry++) {
+                palette[channel][entry] = Interpolate(expand(part.endpoint0[channel]),
+                                                      expand(part.endpoint1[channel]), s_Bc7Weights2[entry]);
+            }
+        }
+
+        part.error = FitIndices<Channels>(pixels, first, palette, 4, part.indices);
+
+        return part;
+    }
+
+    template<uint32_t Channels>
+    static Bc7Mode5Part<Channels> EncodeMode5Part(const BlockPixels &pixels, const uint32_t first,
+                                                  const CompressionQuality quality) {
+        static constexpr std::array<float, 4> s_Weights = {0.0F, 21.0F / 64.0F, 43.0F / 64.0F, 1.0F};
+
+        Endpoint<Channels> low;
+        Endpoint<Channels> high;
+        FindEndpoints<Channels>(pixels, first, low, high);
+
+        Bc7Mode5Part<Channels> best = EvaluateMode5Part<Channels>(pixels, first, low, high);
+
+        for (uint32_t i = 0; i < GetRefinementCount(quality) && best.error > 0.0F; i++) {
+            if (!RefineEndpoints<Channels>(pixels, first, best.indices, s_Weights.data(), low, high)) {
+                break;
+            }
+
+            const Bc7Mode5Part<Channels> refined = EvaluateMode5Part<Channels>(pixels, first, low, high);
+            if (refined.error >= best.error) {
+                break;
+            }
+
+            best = refined;
+        }
+
+        if (best.indices[0] >= 2) {
+            std::swap(best.endpoint0, best.endpoint1);
+
+            for (uint8_t &index : best.indices) {
+                index = static_cast<uint8_t>(3 - index);
+            }
+        }
+
+        return best;
+    }
+
+    // Mode 5: one subset with color and alpha encoded separately. The rotation swaps alpha with one of the color
+    // channels first, so whichever channel correlates least with the rest gets its own indices.
+    static Bc7Result EncodeMode5(const BlockPixels &pixels, const uint32_t rotation, const CompressionQuality quality) {
+        BlockPixels rotated = pixels;
+        if (rotation != 0) {
+            std::swap(rotated.channels[rotation - 1], rotated.channels[3]);
+        }
+
+        const Bc7Mode5Part<3> color = EncodeMode5Part<3>(rotated, 0, quality);
+        const Bc7Mode5Part<1> alpha = EncodeMode5Part<1>(rotated, 3, quality);
+
+        Bc7Result result;
+        result.error = color.error + alpha.error;
+
+        BitWriter writer(result.block.data());
+        writer.Write(1 << 5, 6);
+        writer.Write(rotation, 2);
+
+        for (uint32_t channel = 0; channel < 3; channel++) {
+            writer.Write(color.endpoint0[channel], 7);
+            writer.Write(color.endpoint1[channel], 7);
+        }
+
+        writer.Write(alpha.endpoint0[0], 8);
+        writer.Write(alpha.endpoint1[0], 8);
+
+        for (uint32_t i = 0; i < 16; i++) {
+            writer.Write(color.indices[i], i == 0 ? 1 : 2);
+        }
+
+        for (uint32_t i = 0; i < 16; i++) {
+            writer.Write(alpha.indices[i], i == 0 ? 1 : 2);
+        }
+
+        return result;
+    }
+
+    // Modes 0-3 and 7: two or three subsets laid out by one of the partition tables below, each subset with its own
+    // endpoints. Modes 0-3 store RGB only and decode alpha as 255.
+
+    // Subset 1 pixels of each two-subset partition, bit i for pixel i.
+    static constexpr std::array<uint16_t, 64> s_Bc7Partitions2 = {
+        0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+        0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+        0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+        0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+        0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+        0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+        0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C,
+        0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22
+    };
+
+    // Subset of every pixel of each three-subset partition, two bits per pixel starting at pixel 0.
+    static constexpr std::array<uint32_t, 64> s_Bc7Partitions3 = {
+        0xAA685050, 0x6A5A5040, 0x5A5A4200, 0x5450A0A8, 0xA5A50000, 0xA0A05050, 0x5555A0A0, 0x5A5A5050,
+        0xAA550000, 0xAA555500, 0xAAAA5500, 0x90909090, 0x94949494, 0xA4A4A4A4, 0xA9A59450, 0x2A0A4250,
+        0xA5945040, 0x0A425054, 0xA5A5A500, 0x55A0A0A0, 0xA8A85454, 0x6A6A4040, 0xA4A45000, 0x1A1A0500,
+        0x0050A4A4, 0xAAA59090, 0x14696914, 0x69691400, 0xA08585A0, 0xAA821414, 0x50A4A450, 0x6A5A0200,
+        0xA9A58000, 0x5090A0A8, 0xA8A09050, 0x24242424, 0x00AA5500, 0x24924924, 0x24499224, 0x50A50A50,
+        0x500AA550, 0xAAAA4444, 0x66660000, 0xA5A0A5A0, 0x50A050A0, 0x69286928, 0x44AAAA44, 0x66666600,
+        0xAA444444, 0x54A854A8, 0x95809580, 0x96969600, 0xA85454A8, 0x80959580, 0xAA141414, 0x96960000,
+        0xAAAA1414, 0xA05050A0, 0xA0A5A5A0, 0x96000000, 0x40804080, 0xA9A8A9A8, 0xAAAAAA44, 0x2A4A5254
+    };
+
+    // The anchor pixel of subset 0 is always pixel 0; these are the anchors of the other subsets.
+    static constexpr std::array<uint8_t, 64> s_Bc7Anchors2 = {
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 2, 8, 2, 2, 8, 8, 15, 2, 8, 2, 2, 8, 8, 2, 2,
+        15, 15, 6, 8, 2, 8, 15, 15, 2, 8, 2, 2, 2, 15, 15, 6,
+        6, 2, 6, 8, 15, 15, 2, 2, 15, 15, 15, 15, 15, 2, 2, 15
+    };
+
+    static constexpr std::array<uint8_t, 64> s_Bc7Anchors3Second = {
+        3, 3, 15, 15, 8, 3, 15, 15, 8, 8, 6, 6, 6, 5, 3, 3,
+        3, 3, 8, 15, 3, 3, 6, 10, 5, 8, 8, 6, 8, 5, 15, 15,
+        8, 15, 3, 5, 6, 10, 8, 15, 15, 3, 15, 5, 15, 15, 15, 15,
+        3, 15, 5, 5, 5, 8, 5, 10, 5, 10, 8, 13, 15, 12, 3, 3
+    };
+
+    static constexpr std::array<uint8_t, 64> s_Bc7Anchors3Third = {
+        15, 8, 8, 3, 15, 15, 3, 8, 15, 15, 15, 15, 15, 15, 15, 8,
+        15, 8, 15, 3, 15, 8, 15, 8, 3, 15, 6, 10, 15, 15, 10, 8,
+        15, 3, 15, 10, 10, 8, 9, 10, 6, 15, 8, 15, 3, 6, 6, 8,
+        15, 3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 3, 15, 15, 8
+    };
+
+    // Partitions fully encoded per mode, picked by EstimatePartition.
+    static constexpr uint32_t s_Bc7PartitionCandidates = 4;
+
+    enum class Bc7PBits : uint8_t {
+        None,
+        Shared, // One per subset.
+        Unique  // One per endpoint.
+    };
+
+    struct Bc7PartitionedMode {
+        uint32_t mode;
+        uint32_t subsets;
+        uint32_t partitionCount;
+        uint32_t endpointBits; // Per channel, not counting the p-bit.
+        Bc7PBits pBits;
+        uint32_t indexBits;
+    };
+
+    static constexpr Bc7PartitionedMode s_Bc7Mode0 = {0, 3, 16, 4, Bc7PBits::Unique, 3};
+    static constexpr Bc7PartitionedMode s_Bc7Mode1 = {1, 2, 64, 6, Bc7PBits::Shared, 3};
+    static constexpr Bc7PartitionedMode s_Bc7Mode2 = {2, 3, 64, 5, Bc7PBits::None, 2};
+    static constexpr Bc7PartitionedMode s_Bc7Mode3 = {3, 2, 64, 7, Bc7PBits::Unique, 2};
+    static constexpr Bc7PartitionedMode s_Bc7Mode7 = {7, 2, 64, 5, Bc7PBits::Unique, 2};
+
+    static uint16_t GetSubsetMask(const uint32_t subsets, const uint32_t partition, const uint32_t subset) {
+        if (subsets == 2) {
+            return static_cast<uint16_t>(subset == 0 ? ~s_Bc7Partitions2[partition] : s_Bc7Partitions2[partition]);
+        }
+
+        uint16_t mask = 0;
+        for (uint32_t i = 0; i < 16; i++) {
+            if ((s_Bc7Partitions3[partition] >> (2 * i) & 3) == subset) {
+                mask |= static_cast<uint16_t>(1 << i);
+            }
+        }
+
+        return mask;
+    }
+
+    static uint32_t GetAnchor(const uint32_t subsets, const uint32_t partition, const uint32_t subset) {
+        if (subset == 0) {
+            return 0;
+        }
+
+        if (subsets == 2) {
+            return s_Bc7Anchors2[partition];
+        }
+
+        return subset == 1 ? s_Bc7Anchors3Second[partition] : s_Bc7Anchors3Third[partition];
+    }
+
+    static const uint32_t *GetBc7Weights(const uint32_t indexBits) {
+        return indexBits == 2 ? s_Bc7Weights2.data() : indexBits == 3 ? s_Bc7Weights3.data() : s_Bc7Weights4.data();
+    }
+
+    // Expands an endpoint of the given width (p-bit included) to 8 bits by repeating its top bits.
+    static uint32_t ExpandEndpoint(const uint32_t value, const uint32_t bits) {
+        const uint32_t shifted = value << (8 - bits);
+        return shifted | shifted >> bits;
+    }
+
+    // The stored endpoint value whose expansion lands closest to value; pBit is ignored for modes without p-bits.
+    static uint32_t QuantizeEndpoint(const float value, const Bc7PartitionedMode &mode, const uint32_t pBit) {
+        const bool     hasPBit = mode.pBits != Bc7PBits::None;
+        const uint32_t bits    = mode.endpointBits + (hasPBit ? 1 : 0);
+        const auto     maximum = static_cast<long>((1U << mode.endpointBits) - 1);
+
+        const float scaled = value * static_cast<float>((1U << bits) - 1) / 255.0F;
+        const long  guess  = hasPBit ? std::lround((scaled - static_cast<float>(pBit)) / 2.0F) : std::lround(scaled);
+
+        uint32_t best      = 0;
+        float    bestError = std::numeric_limits<float>::max();
+
+        for (long candidate = std::max(guess - 1, 0L); candidate <= std::min(guess + 1, maximum); candidate++) {
+            const auto     stored   = static_cast<uint32_t>(candidate);
+            const uint32_t expanded = ExpandEndpoint(hasPBit ? stored << 1 | pBit : stored, bits);
+            const float    error    = std::abs(static_cast<float>(expanded) - value);
+
+            if (error < bestError) {
+                best      = stored;
+                bestError = error;
+            }
+        }
+
+        return best;
+    }
+
+    struct Bc7Subset {
+        std::array<uint32_t, 4> endpoint0;
+        std::array<uint32_t, 4> endpoint1;
+        uint32_t                pBit0;
+        uint32_t                pBit1;
+        std::array<uint8_t, 16> indices; // Only the pixels of the subset are set.
+        float                   error;
+    };
+
+    template<uint32_t Channels>
+    static Bc7Subset EvaluateSubset(const BlockPixels &pixels, const uint16_t mask, const Bc7PartitionedMode &mode,
+                                    const Endpoint<Channels> &low, const Endpoint<Channels> &high,
+                                    const uint32_t pBit0, const uint32_t pBit1) {
+        const bool      hasPBit = mode.pBits != Bc7PBits::None;
+        const uint32_t  bits    = mode.endpointBits + (hasPBit ? 1 : 0);
+        const uint32_t *weights = GetBc7Weights(mode.indexBits);
+
+        Bc7Subset subset{};
+        subset.pBit0 = pBit0;
+        subset.pBit1 = pBit1;
+
+        Palette palette{};
+        for (uint32_t channel = 0; channel < Channels; channel++) {
+            subset.endpoint0[channel] = QuantizeEndpoint(low[channel], mode, pBit0);
+            subset.endpoint1[channel] = QuantizeEndpoint(high[channel], mode, pBit1);
+
+            const uint32_t value0 = ExpandEndpoint(
+                hasPBit ? subset.endpoint0[channel] << 1 | pBit0 : subset.endpoint0[channel], bits);
+            const uint32_t value1 = ExpandEndpoint(
+                hasPBit ? subset.endpoint1[channel] << 1 | pBit1 : subset.endpoint1[channel], bits);
+
+            for (uint32_t entry = 0; entry < 1U << mode.indexBits; entry++) {
+                palette[channel][entry] = Interpolate(value0, value1, weights[entry]);
+            }
+        }
+
+        subset.error = FitIndices<Channels>(pixels, 0, palette, 1U << mode.indexBits, subset.indices, mask);
+
+        return subset;
+    }
+
+    template<uint32_t Channels>
+    static Bc7Subset SearchSubset(const BlockPixels &pixels, const uint16_t mask, const Bc7PartitionedMode &mode,
+                                  const Endpoint<Channels> &low, const Endpoint<Channels> &high) {
+        switch (mode.pBits) {
+        case Bc7PBits::None:
+            return EvaluateSubset<Channels>(pixels, mask, mode, low, high, 0, 0);
+        case Bc7PBits::Shared: {
+            const Bc7Subset zero = EvaluateSubset<Channels>(pixels, mask, mode, low, high, 0, 0);
+            const Bc7Subset one  = EvaluateSubset<Channels>(pixels, mask, mode, low, high, 1, 1);
+            return one.error < zero.error ? one : zero;
+        }
+        case Bc7PBits::Unique:
+            break;
+        }
+
+        Bc7Subset best{};
+        best.error = std::numeric_limits<float>::max();
+
+        for (uint32_t pBits = 0; pBits < 4; pBits++) {
+            const Bc7Subset candidate = EvaluateSubset<Channels>(pixels, mask, mode, low, high, pBits & 1, pBits >> 1);
+            if (candidate.error < best.error) {
+                best = candidate;
+            }
+        }
+
+        return best;
+    }
+
+    template<uint32_t Channels>
+    static Bc7Subset EncodeSubset(const BlockPixels &pixels, const uint16_t mask, const Bc7PartitionedMode &mode,
+                                  const CompressionQuality quality) {
+        const uint32_t *weights = GetBc7Weights(mode.indexBits);
+
+        std::array<float, 16> refineWeights{};
+        for (uint32_t i = 0; i < 1U << mode.indexBits; i++) {
+            refineWeights[i] = static_cast<float>(weights[i]) / 64.0F;
+        }
+
+        Endpoint<Channels> low;
+        Endpoint<Channels> high;
+        FindEndpoints<Channels>(pixels, 0, low, high, mask);
+
+        Bc7Subset best = SearchSubset<Channels>(pixels, mask, mode, low, high);
+
+        for (uint32_t i = 0; i < GetRefinementCount(quality) && best.error > 0.0F; i++) {
+            if (!RefineEndpoints<Channels>(pixels, 0, best.indices, refineWeights.data(), low, high, mask)) {
+                break;
+            }
+
+            const Bc7Subset refined = SearchSubset<Channels>(pixels, mask, mode, low, high);
+            if (refined.error >= best.error) {
+                break;
+            }
+
+            best = refined;
+        }
+
+        return best;
+    }
+
+    // What is left of the pixels in mask after projecting them onto their principal axis: the error of an ideal
+    // line fit with unquantized endpoints and indices. Cheap enough to rank every partition.
+    template<uint32_t Channels>
+    static float EstimateLineError(const BlockPixels &pixels, const uint16_t mask) {
+        const auto count = static_cast<float>(std::popcount(mask));
+
+        Endpoint<Channels> mean{};
+        for (uint32_t i = 0; i < 16; i++) {
+            if ((mask >> i & 1) != 0) {
+                for (uint32_t channel = 0; channel < Channels; channel++) {
+                    mean[channel] += pixels.channels[channel][i];
+                }
+            }
+        }
+
+        for (float &value : mean) {
+            value /= count;
+        }
+
+        std::array<std::array<float, Channels>, Channels> covariance{};
+        for (uint32_t i = 0; i < 16; i++) {
+            if ((mask >> i & 1) == 0) {
+                continue;
+            }
+
+            for (uint32_t row = 0; row < Channels; row++) {
+                const float rowValue = pixels.channels[row][i] - mean[row];
+
+                for (uint32_t column = 0; column < Channels; column++) {
+                    covariance[row][column] += rowValue * (pixels.channels[column][i] - mean[column]);
+                }
+            }
+        }
+
+        float trace = 0.0F;
+        for (uint32_t channel = 0; channel < Channels; channel++) {
+            trace += covariance[channel][channel];
+        }
+
+        Endpoint<Channels> axis;
+        axis.fill(1.0F);
+
+        float largest = 0.0F;
+        for (uint32_t iteration = 0; iteration < 4; iteration++) {
+            Endpoint<Channels> next{};
+            for (uint32_t row = 0; row < Channels; row++) {
+                for (uint32_t column = 0; column < Channels; column++) {
+                    next[row] += covariance[row][column] * axis[column];
+                }
+            }
+
+            float lengthSquared = 0.0F;
+            float projection    = 0.0F;
+            for (uint32_t channel = 0; channel < Channels; channel++) {
+                lengthSquared += axis[channel] * axis[channel];
+                projection += axis[channel] * next[channel];
+            }
+
+            largest = projection / lengthSquared;
+
+            float length = 0.0F;
+            for (const float value : next) {
+                length = std::max(length, std::abs(value));
+            }
+
+            if (length < 1e-6F) {
+                break;
+            }
+
+            for (uint32_t channel = 0; channel < Channels; channel++) {
+                axis[channel] = next[channel] / length;
+            }
+        }
+
+        return std::max(trace - largest, 0.0F);
+    }
+
+    // The partitions of mode with the lowest estimated error, best first.
+    template<uint32_t Channels>
+    static std::array<uint32_t, s_Bc7PartitionCandidates> RankPartitions(const BlockPixels &pixels,
+                                                                         const Bc7PartitionedMode &mode) {
+        std::array<float, 64>    errors{};
+        std::array<uint32_t, 64> order{};
+
+        for (uint32_t partition = 0; partition < mode.partitionCount; partition++) {
+            for (uint32_t subset = 0; subset < mode.subsets; subset++) {
+                const uint16_t mask = GetSubsetMask(mode.subsets, partition, subset);
+                errors[partition] += EstimateLineError<Channels>(pixels, mask);
+            }
+
+            order[partition] = partition;
+        }
+
+        std::partial_sort(order.begin(), order.begin() + s_Bc7PartitionCandidates,
+                          order.begin() + mode.partitionCount,
+                          [&errors](const uint32_t a, const uint32_t b) { return errors[a] < errors[b]; });
+
+        std::array<uint32_t, s_Bc7PartitionCandidates> best{};
+        std::copy_n(order.begin(), s_Bc7PartitionCandidates, best.begin());
+
+        return best;
+    }
+
+    // alphaError is added for the RGB-only modes, whose alpha always decodes as 255.
+    template<uint32_t Channels>
+    static Bc7Result EncodePartitioned(const BlockPixels &pixels, const Bc7PartitionedMode &mode,
+                                       const uint32_t partition, const CompressionQuality quality,
+                                       const float alphaError) {
+        std::array<Bc7Subset, 3> subsets{};
+
+        Bc7Result result;
+        result.error = alphaError;
+
+        for (uint32_t subset = 0; subset < mode.subsets; subset++) {
+            subsets[subset] = EncodeSubset<Channels>(pixels, GetSubsetMask(mode.subsets, partition, subset), mode,
+                                                     quality);
+            result.error += subsets[subset].error;
+        }
+
+        // Anchor indices are stored without their top bit, so swap the endpoints of any subset where it is set.
+        const uint32_t maximumIndex = (1U << mode.indexBits) - 1;
+
+        for (uint32_t subset = 0; subset < mode.subsets; subset++) {
+            Bc7Subset &current = subsets[subset];
+            if (current.indices[GetAnchor(mode.subsets, partition, subset)] <= maximumIndex / 2) {
+                continue;
+            }
+
+            std::swap(current.endpoint0, current.endpoint1);
+            std::swap(current.pBit0, current.pBit1);
+
+            const uint16_t mask = GetSubsetMask(mode.subsets, partition, subset);
+            for (uint32_t i = 0; i < 16; i++) {
+                if ((mask >> i & 1) != 0) {
+                    current.indices[i] = static_cast<uint8_t>(maximumIndex - current.indices[i]);
+                }
+            }
+        }
+
+        BitWriter writer(result.block.data());
+        writer.Write(1U << mode.mode, mode.mode + 1);
+        writer.Write(partition, mode.partitionCount == 16 ? 4 : 6);
+
+        for (uint32_t channel = 0; channel < Channels; channel++) {
+            for (uint32_t subset = 0; subset < mode.subsets; subset++) {
+                writer.Write(subsets[subset].endpoint0[channel], mode.endpointBits);
+                writer.Write(subsets[subset].endpoint1[channel], mode.endpointBits);
+            }
+        }
+
+        for (uint32_t subset = 0; subset < mode.subsets; subset++) {
+            if (mode.pBits == Bc7PBits::Unique) {
+                writer.Write(subsets[subset].pBit0, 1);
+                writer.Write(subsets[subset].pBit1, 1);
+            } else if (mode.pBits == Bc7PBits::Shared) {
+                writer.Write(subsets[subset].pBit0, 1);
+            }
+        }
+
+        std::array<uint8_t, 16> owners{};
+        for (uint32_t subset = 1; subset < mode.subsets; subset++) {
+            const uint16_t mask = GetSubsetMask(mode.subsets, partition, subset);
+            for (uint32_t i = 0; i < 16; i++) {
+                if ((mask >> i & 1) != 0) {
+                    owners[i] = static_cast<uint8_t>(subset);
+                }
+            }
+        }
+
+        for (uint32_t i = 0; i < 16; i++) {
+            const uint32_t subset = owners[i];
+            const bool     anchor = GetAnchor(mode.subsets, partition, subset) == i;
+
+            writer.Write(subsets[subset].indices[i], anchor ? mode.indexBits - 1 : mode.indexBits);
+        }
+
+        return result;
+    }
+
+    template<uint32_t Channels>
+    static Bc7Result SearchPartitions(const BlockPixels &pixels, const Bc7PartitionedMode &mode,
+                                      const CompressionQuality quality, const float alphaError) {
+        Bc7Result best;
+
+        for (const uint32_t partition : RankPartitions<Channels>(pixels, mode)) {
+            const Bc7Result candidate = EncodePartitioned<Channels>(pixels, mode, partition, quality, alphaError);
+            if (candidate.error < best.error) {
+                best = candidate;
+            }
+        }
+
+        return best;
+    }
+
+    // Encoders -------------------------------------------------------------------------------------------------------
+
+    void EncodeBc1Block(const uint8_t *pixels, uint8_t *block, const CompressionQuality quality) {
+        EncodeBc1Color(LoadBlock(pixels), block, quality, true);
+    }
+
+    void EncodeBc3Block(const uint8_t *pixels, uint8_t *block, const CompressionQuality quality) {
+        const BlockPixels loaded = LoadBlock(pixels);
+
+        EncodeBc4Channel(loaded, 3, block, quality);
+        EncodeBc1Color(loaded, block + 8, quality, false);
+    }
+
+    void EncodeBc4Block(const uint8_t *pixels, uint8_t *block, const CompressionQuality quality) {
+        EncodeBc4Channel(LoadBlock(pixels), 0, block, quality);
+    }
+
+    void EncodeBc5Block(const uint8_t *pixels, uint8_t *block, const CompressionQuality quality) {
+        const BlockPixels loaded = LoadBlock(pixels);
+
+        EncodeBc4Channel(loaded, 0, block, quality);
+        EncodeBc4Channel(loaded, 1, block + 8, quality);
+    }
+
+    static float GetAlphaError(const BlockPixels &pixels) {
+        float error = 0.0F;
+        for (const float alpha : pixels.channels[3]) {
+            error += (255.0F - alpha) * (255.0F - alpha);
+        }
+
+        return error;
+    }
+
+    static Bc7Result EncodeBc7Mode(const BlockPixels &pixels, const uint32_t mode, const CompressionQuality quality) {
+        switch (mode) {
+        case 0:
+            return SearchPartitions<3>(pixels, s_Bc7Mode0, quality, GetAlphaError(pixels));
+        case 1:
+            return SearchPartitions<3>(pixels, s_Bc7Mode1, quality, GetAlphaError(pixels));
+        case 2:
+            return SearchPartitions<3>(pixels, s_Bc7Mode2, quality, GetAlphaError(pixels));
+        case 3:
+            return SearchPartitions<3>(pixels, s_Bc7Mode3, quality, GetAlphaError(pixels));
+        case 5: {
+            Bc7Result best;
+            for (uint32_t rotation = 0; rotation < 4; rotation++) {
+                const Bc7Result candidate = EncodeMode5(pixels, rotation, quality);
+                if (candidate.error < best.error) {
+                    best = candidate;
+                }
+            }
+
+            return best;
+        }
+        case 6:
+            return EncodeMode6(pixels, quality);
+        case 7:
+            return SearchPartitions<4>(pixels, s_Bc7Mode7, quality, 0.0F);
+        default:
+            break;
+        }
+
+        throw std::runtime_error("Failed to encode block: Unsupported BC7 mode");
+    }
+
+    void EncodeBc7Block(const uint8_t *pixels, uint8_t *block, const CompressionQuality quality) {
+        const BlockPixels loaded = LoadBlock(pixels);
+
+        Bc7Result best = EncodeMode6(loaded, quality);
+
+        if (quality == CompressionQuality::High) {
+            // The RGB-only modes decode alpha as 255; skip them once that error alone loses. Mode 7 only beats
+            // mode 3 when there is alpha to keep.
+            const float alphaError = GetAlphaError(loaded);
+
+            for (const uint32_t mode : {5U, 1U, 3U, 0U, 2U, 7U}) {
+                if (best.error <= 0.0F) {
+                    break;
+                }
+
+                if ((mode < 4 && alphaError >= best.error) || (mode == 7 && alphaError == 0.0F)) {
+                    continue;
+                }
+
+                const Bc7Result candidate = EncodeBc7Mode(loaded, mode, quality);
+                if (candidate.error < best.error) {
+                    best = candidate;
+                }
+            }
+        }
+
+        std::memcpy(block, best.block.data(), best.block.size());
+    }
+
+    void Detail::EncodeBc7Block(const uint8_t *pixels, uint8_t *block, const uint32_t mode,
+                                const CompressionQuality quality) {
+        const Bc7Result result = EncodeBc7Mode(LoadBlock(pixels), mode, quality);
+        std::memcpy(block, result.block.data(), result.block.size());
+    }
+
+    // Images ---------------------------------------------------------------------------------------------------------
+
+    using BlockEncoder = void (*)(const uint8_t *, uint8_t *, CompressionQuality);
+
+    static BlockEncoder GetBlockEncoder(const TextureFormat format) {
+        switch (format) {
+        case TextureFormat::Bc1Unorm:
+        case TextureFormat::Bc1Srgb:
+            return EncodeBc1Block;
+        case TextureFormat::Bc3Unorm:
+        case TextureFormat::Bc3Srgb:
+            return EncodeBc3Block;
+        case TextureFormat::Bc4Unorm:
+            return EncodeBc4Block;
+        case TextureFormat::Bc5Unorm:
+            return EncodeBc5Block;
+        case TextureFormat::Bc7Unorm:
+        case TextureFormat::Bc7Srgb:
+            return EncodeBc7Block;
+        case TextureFormat::Rgba8Unorm:
+        case TextureFormat::Rgba8Srgb:
+            break;
+        }
+
+        throw std::runtime_error("Failed to compress texture: Format is not block-compressed");
+    }
+
+    static void CompressBlockRows(const Image &image, CompressedImage &output, const BlockEncoder encoder,
+                                  const uint32_t blockSize, const CompressionQuality quality, const uint32_t rowBegin,
+                                  const uint32_t rowEnd) {
+        const uint32_t blocksWide = (image.width + 3) / 4;
+
+        std::array<uint8_t, 64> pixels;
+
+        for (uint32_t blockY = rowBegin; blockY < rowEnd; blockY++) {
+            for (uint32_t blockX = 0; blockX < blocksWide; blockX++) {
+                for (uint32_t y = 0; y < 4; y++) {
+                    const uint32_t sourceY = std::min(blockY * 4 + y, image.height - 1);
+                    const uint8_t *row     = image.pixels.data() + static_cast<size_t>(sourceY) * image.width * 4;
+
+                    if (blockX * 4 + 4 <= image.width) {
+                        std::memcpy(pixels.data() + y * 16, row + blockX * 16, 16);
+                        continue;
+                    }
+
+                    for (uint32_t x = 0; x < 4; x++) {
+                        const uint32_t sourceX = std::min(blockX * 4 + x, image.width - 1);
+                        std::memcpy(pixels.data() + y * 16 + x * 4, row + sourceX * 4, 4);
+                    }
+                }
+
+                encoder(pixels.data(),
+                        output.blocks.data() + (static_cast<size_t>(blockY) * blocksWide + blockX) * blockSize,
+                        quality);
+            }
+        }
+    }
+
+    CompressedImage CompressImage(const Image &image, const TextureFormat format, const CompressionQuality quality,
+                                  Threading::JobSystem *jobSystem) {
+        std::vector<CompressedImage> levels = CompressMipChain(std::span(&image, 1), format, quality, jobSystem);
+        return std::move(levels.front());
+    }
+
+    std::vector<CompressedImage> CompressMipChain(const std::span<const Image> levels, const TextureFormat format,
+                                                  const CompressionQuality quality, Threading::JobSystem *jobSystem) {
+        const BlockEncoder encoder   = GetBlockEncoder(format);
+        const uint32_t     blockSize = GetBlockSize(format);
+
+        std::vector<CompressedImage> output(levels.size());
+        // First block row of each level when the rows of every level are numbered one after another.
+        std::vector<uint32_t> firstRows(levels.size() + 1, 0);
+
+        for (size_t i = 0; i < levels.size(); i++) {
+            const Image &level = levels[i];
+
+            if (level.width == 0 || level.height == 0 ||
+                level.pixels.size() != static_cast<size_t>(level.width) * level.height * 4) {
+                throw std::runtime_error("Failed to compress texture: Invalid image");
+            }
+
+            output[i].width  = level.width;
+            output[i].height = level.height;
+            output[i].blocks.resize(GetLevelSize(format, level.width, level.height));
+
+            firstRows[i + 1] = firstRows[i] + (level.height + 3) / 4;
+        }
+
+        const auto compressRows = [&](const uint32_t begin, const uint32_t end) {
+            auto level = static_cast<size_t>(std::ranges::upper_bound(firstRows, begin) - firstRows.begin() - 1);
+
+            for (uint32_t row = begin; row < end; level++) {
+                const uint32_t levelEnd = std::min(end, firstRows[level + 1]);
+
+                CompressBlockRows(levels[level], output[level], encoder, blockSize, quality, row - firstRows[level],
+                                  levelEnd - firstRows[level]);
+                row = levelEnd;
+            }
+        };
+
+        const uint32_t rowCount = firstRows.back();
+
+        if (jobSystem == nullptr || rowCount < 2 * s_MinBlockRowsPerJob) {
+            compressRows(0, rowCount);
+        } else {
+            jobSystem->ParallelFor(rowCount, compressRows, s_MinBlockRowsPerJob);
+        }
+
+        return output;
+    }
+}
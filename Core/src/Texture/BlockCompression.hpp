@@ -0,0 +1,42 @@
+#ifndef PULSAR_BLOCKCOMPRESSION_HPP
+#define PULSAR_BLOCKCOMPRESSION_HPP
+
+#include <span>
+#include <vector>
+
+#include "Image.hpp"
+#include "TextureFormat.hpp"
+#include "Threading/JobSystem.hpp"
+
+namespace Pulsar::Texture {
+    enum class CompressionQuality {
+        Fast,     // Endpoints straight from the principal axis; BC7 uses mode 6 only.
+        Balanced, // Adds least-squares endpoint refinement and tries every BC7 p-bit combination.
+        High      // More refinement, BC1 also tries three-color blocks, BC7 also tries mode 5 with each rotation and
+                  // the partitioned modes 0-3 and 7 on the best few partitions of each.
+    };
+
+    // Each encoder takes one 4x4 block of RGBA8 pixels, row by row, and writes GetBlockSize bytes.
+    void EncodeBc1Block(const uint8_t *pixels, uint8_t *block, CompressionQuality quality);
+    void EncodeBc3Block(const uint8_t *pixels, uint8_t *block, CompressionQuality quality);
+    void EncodeBc4Block(const uint8_t *pixels, uint8_t *block, CompressionQuality quality); // Red channel.
+    void EncodeBc5Block(const uint8_t *pixels, uint8_t *block, CompressionQuality quality); // Red and green.
+    void EncodeBc7Block(const uint8_t *pixels, uint8_t *block, CompressionQuality quality);
+
+    namespace Detail {
+        // Encodes with one BC7 mode only, still searching its rotations or partitions. Mode 4 is not supported.
+        // For tests and tools that compare modes.
+        void EncodeBc7Block(const uint8_t *pixels, uint8_t *block, uint32_t mode, CompressionQuality quality);
+    }
+
+    // Edge blocks repeat the last row and column. Rows of blocks are split across the job system when one is
+    // given; CompressMipChain splits every level at once, so the small levels do not run one after another.
+    [[nodiscard]] CompressedImage CompressImage(const Image &image, TextureFormat format,
+                                                CompressionQuality    quality   = CompressionQuality::Balanced,
+                                                Threading::JobSystem *jobSystem = nullptr);
+    [[nodiscard]] std::vector<CompressedImage> CompressMipChain(
+        std::span<const Image> levels, TextureFormat format, CompressionQuality quality = CompressionQuality::Balanced,
+        Threading::JobSystem *jobSystem = nullptr);
+}
+
+#endif //PULSAR_BLOCKCOMPRESSION_HPP
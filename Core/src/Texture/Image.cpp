@@ -0,0 +1,33 @@
+#include "Image.hpp"
+
+#include <stdexcept>
+#include <string>
+
+#define STB_IMAGE_IMPLEMENTATION
+#define STBI_NO_STDIO
+#include <stb_image.h>
+
+namespace Pulsar::Texture {
+    Image DecodeImage(const std::span<const std::byte> encoded) {
+        int width    = 0;
+        int height   = 0;
+        int channels = 0;
+
+        stbi_uc *pixels = stbi_load_from_memory(reinterpret_cast<const stbi_uc *>(encoded.data()),
+                                                static_cast<int>(encoded.size()), &width, &height, &channels,
+                                                STBI_rgb_alpha);
+
+        if (pixels == nullptr) {
+            throw std::runtime_error(std::string("Failed to decode image: ") + stbi_failure_reason());
+        }
+
+        Image image;
+        image.width  = static_cast<uint32_t>(width);
+        image.height = static_cast<uint32_t>(height);
+        image.pixels.assign(pixels, pixels + static_cast<size_t>(width) * height * 4);
+
+        stbi_image_free(pixels);
+
+        return image;
+    }
+}
@@ -0,0 +1,27 @@
+#ifndef PULSAR_IMAGE_HPP
+#define PULSAR_IMAGE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Pulsar::Texture {
+    // Tightly packed RGBA8 pixels.
+    struct Image {
+        uint32_t             width  = 0;
+        uint32_t             height = 0;
+        std::vector<uint8_t> pixels;
+    };
+
+    // Rows of 4x4 blocks in one of the block-compressed TextureFormats; width and height are in pixels.
+    struct CompressedImage {
+        uint32_t             width  = 0;
+        uint32_t             height = 0;
+        std::vector<uint8_t> blocks;
+    };
+
+    Image DecodeImage(std::span<const std::byte> encoded);
+}
+
+#endif //PULSAR_IMAGE_HPP
@@ -0,0 +1,217 @@
+#include "MipChain.hpp"
+
+#include <bit>
+#include <cmath>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+namespace Pulsar::Texture {
+    static constexpr uint32_t s_ParallelRowThreshold = 256;
+    static constexpr uint32_t s_MinRowsPerJob        = 32;
+
+    // sRGB bytes to 16-bit linear, and 16-bit linear back to the nearest sRGB byte.
+    struct SrgbTables {
+        std::array<uint16_t, 256>   toLinear;
+        std::array<uint8_t, 65536> toSrgb;
+
+        SrgbTables() {
+            for (uint32_t i = 0; i < toLinear.size(); i++) {
+                const float value = static_cast<float>(i) / 255.0f;
+                const float linear = value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+                toLinear[i] = static_cast<uint16_t>(std::lround(linear * 65535.0f));
+            }
+
+            for (uint32_t i = 0; i < toSrgb.size(); i++) {
+                const float linear = static_cast<float>(i) / 65535.0f;
+                const float value  = linear <= 0.0031308f ? linear * 12.92f
+                                                          : 1.055f * std::pow(linear, 1.0f / 2.4f) - 0.055f;
+                toSrgb[i] = static_cast<uint8_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+            }
+        }
+    };
+
+    static const SrgbTables &GetSrgbTables() {
+        static const SrgbTables s_Tables;
+        return s_Tables;
+    }
+
+    // The source rows or columns a destination pixel averages: two, or three for the last one when the source size
+    // is odd.
+    struct Footprint {
+        uint32_t first;
+        uint32_t count;
+    };
+
+    static Footprint GetFootprint(const uint32_t index, const uint32_t sourceSize, const uint32_t destinationSize) {
+        if (sourceSize == 1) {
+            return {0, 1};
+        }
+
+        return {2 * index, index == destinationSize - 1 && sourceSize % 2 != 0 ? 3u : 2u};
+    }
+
+    static void DownsampleRowScalar(std::span<const uint8_t *const> rows, uint8_t *destination,
+                                    const uint32_t sourceWidth, const uint32_t destinationWidth,
+                                    const uint32_t begin, const SrgbTables *srgb) {
+        for (uint32_t x = begin; x < destinationWidth; x++) {
+            const auto [first, count] = GetFootprint(x, sourceWidth, destinationWidth);
+            const uint32_t taps       = count * static_cast<uint32_t>(rows.size());
+
+            for (uint32_t channel = 0; channel < 4; channel++) {
+                const bool linearize = srgb != nullptr && channel < 3;
+
+                uint32_t sum = 0;
+                for (const uint8_t *row : rows) {
+                    for (uint32_t column = first; column < first + count; column++) {
+                        const uint8_t value = row[column * 4 + channel];
+                        sum += linearize ? srgb->toLinear[value] : value;
+                    }
+                }
+
+                const uint32_t average       = (sum + taps / 2) / taps;
+                destination[x * 4 + channel] = linearize ? srgb->toSrgb[average] : static_cast<uint8_t>(average);
+            }
+        }
+    }
+
+    // Handles the first pixels of a row that each average exactly two columns of both rows.
+    static uint32_t DownsampleRowSimd(const uint8_t *row0, const uint8_t *row1, uint8_t *destination,
+                                      const uint32_t pixelCount) {
+        uint32_t x = 0;
+
+#if defined(__AVX2__)
+        const __m256i zero     = _mm256_setzero_si256();
+        const __m256i rounding = _mm256_set1_epi16(2);
+
+        for (; x + 4 <= pixelCount; x += 4) {
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row0 + x * 8));
+            const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row1 + x * 8));
+
+            // Per 128-bit lane: lo holds source pixels 0-1, hi holds source pixels 2-3, widened to 16 bits.
+            const __m256i lo = _mm256_add_epi16(_mm256_unpacklo_epi8(a, zero), _mm256_unpacklo_epi8(b, zero));
+            const __m256i hi = _mm256_add_epi16(_mm256_unpackhi_epi8(a, zero), _mm256_unpackhi_epi8(b, zero));
+
+            const __m256i pairLo = _mm256_add_epi16(lo, _mm256_srli_si256(lo, 8));
+            const __m256i pairHi = _mm256_add_epi16(hi, _mm256_srli_si256(hi, 8));
+
+            __m256i sum = _mm256_unpacklo_epi64(pairLo, pairHi);
+            sum         = _mm256_srli_epi16(_mm256_add_epi16(sum, rounding), 2);
+
+            const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(sum, sum), 0b1000);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + x * 4), _mm256_castsi256_si128(packed));
+        }
+#elif defined(__SSE2__) || defined(_M_X64)
+        const __m128i zero     = _mm_setzero_si128();
+        const __m128i rounding = _mm_set1_epi16(2);
+
+        for (; x + 2 <= pixelCount; x += 2) {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row0 + x * 8));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row1 + x * 8));
+
+            const __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+            const __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+
+            const __m128i pairLo = _mm_add_epi16(lo, _mm_srli_si128(lo, 8));
+            const __m128i pairHi = _mm_add_epi16(hi, _mm_srli_si128(hi, 8));
+
+            __m128i sum = _mm_unpacklo_epi64(pairLo, pairHi);
+            sum         = _mm_srli_epi16(_mm_add_epi16(sum, rounding), 2);
+
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(destination + x * 4), _mm_packus_epi16(sum, sum));
+        }
+#else
+        (void)row0;
+        (void)row1;
+        (void)destination;
+        (void)pixelCount;
+#endif
+
+        return x;
+    }
+
+    static void DownsampleRows(const Image &source, Image &destination, const uint32_t rowBegin,
+                               const uint32_t rowEnd, const bool srgb, const bool useSimd) {
+        const size_t      sourcePitch      = static_cast<size_t>(source.width) * 4;
+        const size_t      destinationPitch = static_cast<size_t>(destination.width) * 4;
+        const SrgbTables *tables           = srgb ? &GetSrgbTables() : nullptr;
+
+        // Destination pixels with a plain 2x2 footprint, which the SIMD path handles.
+        const uint32_t pairs = source.width < 2 ? 0 : source.width / 2 - (source.width % 2);
+
+        for (uint32_t y = rowBegin; y < rowEnd; y++) {
+            const auto [first, count] = GetFootprint(y, source.height, destination.height);
+
+            std::array<const uint8_t *, 3> rows{};
+            for (uint32_t i = 0; i < count; i++) {
+                rows[i] = source.pixels.data() + (first + i) * sourcePitch;
+            }
+
+            uint8_t *row = destination.pixels.data() + y * destinationPitch;
+
+            uint32_t x = 0;
+            if (useSimd && !srgb && count == 2) {
+                x = DownsampleRowSimd(rows[0], rows[1], row, pairs);
+            }
+
+            DownsampleRowScalar({rows.data(), count}, row, source.width, destination.width, x, tables);
+        }
+    }
+
+    static Image AllocateNextLevel(const Image &source) {
+        Image destination;
+        destination.width  = std::max(1u, source.width / 2);
+        destination.height = std::max(1u, source.height / 2);
+        destination.pixels.resize(static_cast<size_t>(destination.width) * destination.height * 4);
+
+        return destination;
+    }
+
+    uint32_t GetMipLevelCount(const uint32_t width, const uint32_t height) {
+        return std::bit_width(std::max(width, height));
+    }
+
+    Image Downsample(const Image &source, const TextureFormat format) {
+        Image destination = AllocateNextLevel(source);
+        DownsampleRows(source, destination, 0, destination.height, IsSrgb(format), true);
+
+        return destination;
+    }
+
+    Image DownsampleScalar(const Image &source, const TextureFormat format) {
+        Image destination = AllocateNextLevel(source);
+        DownsampleRows(source, destination, 0, destination.height, IsSrgb(format), false);
+
+        return destination;
+    }
+
+    std::vector<Image> GenerateMipChain(Image base, const TextureFormat format, Threading::JobSystem *jobSystem) {
+        const uint32_t levelCount = GetMipLevelCount(base.width, base.height);
+        const bool     srgb       = IsSrgb(format);
+
+        std::vector<Image> levels;
+        levels.reserve(levelCount);
+        levels.push_back(std::move(base));
+
+        for (uint32_t level = 1; level < levelCount; level++) {
+            const Image &source      = levels.back();
+            Image        destination = AllocateNextLevel(source);
+
+            if (jobSystem == nullptr || destination.height < s_ParallelRowThreshold) {
+                DownsampleRows(source, destination, 0, destination.height, srgb, true);
+            } else {
+                jobSystem->ParallelFor(destination.height, [&source, &destination, srgb](const uint32_t begin,
+                                                                                        const uint32_t end) {
+                    DownsampleRows(source, destination, begin, end, srgb, true);
+                }, s_MinRowsPerJob);
+            }
+
+            levels.push_back(std::move(destination));
+        }
+
+        return levels;
+    }
+}
@@ -0,0 +1,24 @@
+#ifndef PULSAR_MIPCHAIN_HPP
+#define PULSAR_MIPCHAIN_HPP
+
+#include <vector>
+
+#include "Image.hpp"
+#include "TextureFormat.hpp"
+#include "Threading/JobSystem.hpp"
+
+namespace Pulsar::Texture {
+    [[nodiscard]] uint32_t GetMipLevelCount(uint32_t width, uint32_t height);
+
+    // Box filter of an RGBA8 image into the next mip level. Each pixel averages a 2x2 footprint; along an odd
+    // dimension the last one widens to 3 so the trailing row or column is not dropped. For sRGB formats the color
+    // channels are averaged in linear space, which only the scalar path does.
+    [[nodiscard]] Image Downsample(const Image &source, TextureFormat format);
+    [[nodiscard]] Image DownsampleScalar(const Image &source, TextureFormat format);
+
+    // Returns every level including the source. Rows of large levels are split across the job system when one is given.
+    [[nodiscard]] std::vector<Image> GenerateMipChain(Image base, TextureFormat format,
+                                                      Threading::JobSystem *jobSystem = nullptr);
+}
+
+#endif //PULSAR_MIPCHAIN_HPP
@@ -0,0 +1,189 @@
+#include "TextureFile.hpp"
+
+#include <fstream>
+
+#include "MipChain.hpp"
+
+namespace Pulsar::Texture {
+    static constexpr uint64_t AlignUp(const uint64_t value) {
+        return (value + g_TextureAlignment - 1) & ~(g_TextureAlignment - 1);
+    }
+
+    // Written so that a huge offset cannot wrap around and pass.
+    static bool IsInRange(const uint64_t offset, const uint64_t length, const uint64_t size) {
+        return offset <= size && length <= size - offset;
+    }
+
+    TextureFile TextureFile::Open(const std::string &path) {
+        TextureFile texture(FileIo::MappedFile::Open(path));
+
+        const std::span<const std::byte> data = texture.m_File.GetData();
+
+        if (data.size() < sizeof(TextureHeader)) {
+            throw std::runtime_error("Failed to open texture: File too small");
+        }
+
+        std::memcpy(&texture.m_Header, data.data(), sizeof(TextureHeader));
+        const TextureHeader &header = texture.m_Header;
+
+        if (header.magic != g_TextureMagic) {
+            throw std::runtime_error("Failed to open texture: Invalid magic");
+        }
+
+        if (header.version != g_TextureVersion) {
+            throw std::runtime_error("Failed to open texture: Unsupported version");
+        }
+
+        const uint64_t levelsEnd = sizeof(TextureHeader) + header.levelCount * sizeof(TextureLevel);
+        if (header.width == 0 || header.height == 0 || header.levelCount == 0 ||
+            header.levelCount > GetMipLevelCount(header.width, header.height) || levelsEnd > header.dataOffset ||
+            header.dataOffset % g_TextureAlignment != 0 ||
+            !IsInRange(header.dataOffset, header.dataSize, data.size())) {
+            throw std::runtime_error("Failed to open texture: Corrupt header");
+        }
+
+        texture.m_Levels = {
+            reinterpret_cast<const TextureLevel *>(data.data() + sizeof(TextureHeader)), header.levelCount
+        };
+
+        if (ToVkFormat(header.format) == VK_FORMAT_UNDEFINED) {
+            throw std::runtime_error("Failed to open texture: Unsupported format");
+        }
+
+        for (uint32_t i = 0; i < header.levelCount; i++) {
+            const TextureLevel &level = texture.m_Levels[i];
+
+            // Upload creates the image from the header and copies each level with its own extent.
+            if (level.width != std::max(1U, header.width >> i) || level.height != std::max(1U, header.height >> i)) {
+                throw std::runtime_error("Failed to open texture: Level size mismatch");
+            }
+
+            if (!IsInRange(level.offset, level.size, header.dataSize)) {
+                throw std::runtime_error("Failed to open texture: Level out of bounds");
+            }
+
+            if (level.size < GetLevelSize(header.format, level.width, level.height)) {
+                throw std::runtime_error("Failed to open texture: Level too small for its format");
+            }
+        }
+
+        return texture;
+    }
+
+    const TextureHeader &TextureFile::GetHeader() const {
+        return m_Header;
+    }
+
+    std::span<const TextureLevel> TextureFile::GetLevels() const {
+        return m_Levels;
+    }
+
+    VkFormat TextureFile::GetVkFormat() const {
+        return ToVkFormat(m_Header.format);
+    }
+
+    std::span<const std::byte> TextureFile::GetData() const {
+        return m_File.GetData().subspan(m_Header.dataOffset, m_Header.dataSize);
+    }
+
+    std::vector<VkBufferImageCopy> TextureFile::GetCopyRegions(const VkDeviceSize stagingOffset) const {
+        std::vector<VkBufferImageCopy> regions;
+        regions.reserve(m_Levels.size());
+
+        for (uint32_t i = 0; i < m_Levels.size(); i++) {
+            VkBufferImageCopy region{};
+            region.bufferOffset                    = stagingOffset + m_Levels[i].offset;
+            region.bufferRowLength                 = 0;
+            region.bufferImageHeight               = 0;
+            region.imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+            region.imageSubresource.mipLevel       = i;
+            region.imageSubresource.baseArrayLayer = 0;
+            region.imageSubresource.layerCount     = 1;
+            region.imageExtent                     = {m_Levels[i].width, m_Levels[i].height, 1};
+
+            regions.push_back(region);
+        }
+
+        return regions;
+    }
+
+    TextureFile::TextureFile(FileIo::MappedFile file) : m_File(std::move(file)) {
+    }
+
+    // One level's dimensions and payload, already in the layout of the texture's format.
+    struct LevelSource {
+        uint32_t                 width;
+        uint32_t                 height;
+        std::span<const uint8_t> data;
+    };
+
+    static void WriteLevels(const std::string &path, const std::vector<LevelSource> &levels,
+                            const TextureFormat format) {
+        if (levels.empty()) {
+            throw std::runtime_error("Failed to write texture: No levels");
+        }
+
+        std::vector<TextureLevel> levelInfos;
+        uint64_t                  dataSize = 0;
+
+        for (const LevelSource &level : levels) {
+            if (level.data.size() != GetLevelSize(format, level.width, level.height)) {
+                throw std::runtime_error("Failed to write texture: Level size does not match format");
+            }
+
+            levelInfos.push_back({dataSize, level.data.size(), level.width, level.height});
+            dataSize = AlignUp(dataSize + level.data.size());
+        }
+
+        TextureHeader header{};
+        header.magic      = g_TextureMagic;
+        header.version    = g_TextureVersion;
+        header.format     = format;
+        header.width      = levels.front().width;
+        header.height     = levels.front().height;
+        header.levelCount = static_cast<uint32_t>(levels.size());
+        header.dataOffset = AlignUp(sizeof(TextureHeader) + levelInfos.size() * sizeof(TextureLevel));
+        header.dataSize   = dataSize;
+
+        std::vector<std::byte> output(header.dataOffset + header.dataSize);
+        std::memcpy(output.data(), &header, sizeof(header));
+        std::memcpy(output.data() + sizeof(header), levelInfos.data(), levelInfos.size() * sizeof(TextureLevel));
+
+        for (size_t i = 0; i < levels.size(); i++) {
+            std::memcpy(output.data() + header.dataOffset + levelInfos[i].offset, levels[i].data.data(),
+                        levels[i].data.size());
+        }
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.write(reinterpret_cast<const char *>(output.data()), static_cast<std::streamsize>(output.size()))) {
+            throw std::runtime_error("Failed to write texture: Write error");
+        }
+    }
+
+    void WriteTextureFile(const std::string &path, const std::vector<Image> &levels, const TextureFormat format) {
+        if (IsBlockCompressed(format)) {
+            throw std::runtime_error("Failed to write texture: Compress the levels first");
+        }
+
+        std::vector<LevelSource> sources;
+        for (const Image &image : levels) {
+            sources.push_back({image.width, image.height, image.pixels});
+        }
+
+        WriteLevels(path, sources, format);
+    }
+
+    void WriteTextureFile(const std::string &path, const std::vector<CompressedImage> &levels,
+                          const TextureFormat format) {
+        if (!IsBlockCompressed(format)) {
+            throw std::runtime_error("Failed to write texture: Format is not block-compressed");
+        }
+
+        std::vector<LevelSource> sources;
+        for (const CompressedImage &image : levels) {
+            sources.push_back({image.width, image.height, image.blocks});
+        }
+
+        WriteLevels(path, sources, format);
+    }
+}
@@ -0,0 +1,39 @@
+#ifndef PULSAR_TEXTUREFILE_HPP
+#define PULSAR_TEXTUREFILE_HPP
+
+#include <span>
+#include <string>
+#include <vector>
+
+#include "FileIo/MappedFile.hpp"
+#include "Image.hpp"
+#include "TextureFormat.hpp"
+
+namespace Pulsar::Texture {
+    class TextureFile {
+    public:
+        static TextureFile Open(const std::string &path);
+
+        [[nodiscard]] const TextureHeader &          GetHeader() const;
+        [[nodiscard]] std::span<const TextureLevel> GetLevels() const;
+        [[nodiscard]] VkFormat                      GetVkFormat() const;
+
+        // All levels as one contiguous block, ready to be copied into a staging buffer.
+        [[nodiscard]] std::span<const std::byte> GetData() const;
+
+        [[nodiscard]] std::vector<VkBufferImageCopy> GetCopyRegions(VkDeviceSize stagingOffset = 0) const;
+
+    private:
+        FileIo::MappedFile            m_File;
+        TextureHeader                 m_Header{};
+        std::span<const TextureLevel> m_Levels;
+
+        explicit TextureFile(FileIo::MappedFile file);
+    };
+
+    // Levels go largest first. The first overload takes the RGBA8 formats, the second the block-compressed ones.
+    void WriteTextureFile(const std::string &path, const std::vector<Image> &levels, TextureFormat format);
+    void WriteTextureFile(const std::string &path, const std::vector<CompressedImage> &levels, TextureFormat format);
+}
+
+#endif //PULSAR_TEXTUREFILE_HPP
@@ -0,0 +1,122 @@
+#ifndef PULSAR_TEXTUREFORMAT_HPP
+#define PULSAR_TEXTUREFORMAT_HPP
+
+#include <array>
+#include <cstdint>
+
+#include <vulkan/vulkan_core.h>
+
+namespace Pulsar::Texture {
+    // Layout of a .ptex file:
+    //   TextureHeader | TextureLevel[levelCount] | level data (each level 256-byte aligned, largest first)
+    // Level data is stored exactly as vkCmdCopyBufferToImage expects it, so the whole payload can be
+    // copied into a staging buffer as-is. Block-compressed levels are rows of 4x4 blocks, with partial blocks at
+    // the right and bottom edges of levels that are not a multiple of four.
+
+    constexpr std::array<char, 4> g_TextureMagic     = {'P', 'T', 'E', 'X'};
+    constexpr uint32_t            g_TextureVersion   = 1;
+    constexpr uint64_t            g_TextureAlignment = 256;
+
+    enum class TextureFormat : uint32_t {
+        Rgba8Unorm,
+        Rgba8Srgb,
+        Bc1Unorm, // RGB with 1-bit alpha, 8 bytes per block.
+        Bc1Srgb,
+        Bc3Unorm, // RGBA, 16 bytes per block.
+        Bc3Srgb,
+        Bc4Unorm, // R, 8 bytes per block.
+        Bc5Unorm, // RG, e.g. normal maps, 16 bytes per block.
+        Bc7Unorm, // RGBA at higher quality than BC3, 16 bytes per block.
+        Bc7Srgb
+    };
+
+    struct TextureHeader {
+        std::array<char, 4> magic;
+        uint32_t            version;
+        TextureFormat       format;
+        uint32_t            width;
+        uint32_t            height;
+        uint32_t            levelCount;
+        uint64_t            dataOffset;
+        uint64_t            dataSize;
+    };
+
+    // Offsets are relative to the start of the level data.
+    struct TextureLevel {
+        uint64_t offset;
+        uint64_t size;
+        uint32_t width;
+        uint32_t height;
+    };
+
+    static_assert(sizeof(TextureHeader) == 40);
+    static_assert(sizeof(TextureLevel) == 24);
+
+    constexpr VkFormat ToVkFormat(const TextureFormat format) {
+        switch (format) {
+        case TextureFormat::Rgba8Unorm:
+            return VK_FORMAT_R8G8B8A8_UNORM;
+        case TextureFormat::Rgba8Srgb:
+            return VK_FORMAT_R8G8B8A8_SRGB;
+        case TextureFormat::Bc1Unorm:
+            return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+        case TextureFormat::Bc1Srgb:
+            return VK_FORMAT_BC1_RGBA_SRGB_BLOCK;
+        case TextureFormat::Bc3Unorm:
+            return VK_FORMAT_BC3_UNORM_BLOCK;
+        case TextureFormat::Bc3Srgb:
+            return VK_FORMAT_BC3_SRGB_BLOCK;
+        case TextureFormat::Bc4Unorm:
+            return VK_FORMAT_BC4_UNORM_BLOCK;
+        case TextureFormat::Bc5Unorm:
+            return VK_FORMAT_BC5_UNORM_BLOCK;
+        case TextureFormat::Bc7Unorm:
+            return VK_FORMAT_BC7_UNORM_BLOCK;
+        case TextureFormat::Bc7Srgb:
+            return VK_FORMAT_BC7_SRGB_BLOCK;
+        }
+
+        return VK_FORMAT_UNDEFINED;
+    }
+
+    // Color channels are sRGB encoded; alpha is always linear.
+    constexpr bool IsSrgb(const TextureFormat format) {
+        return format == TextureFormat::Rgba8Srgb || format == TextureFormat::Bc1Srgb ||
+               format == TextureFormat::Bc3Srgb || format == TextureFormat::Bc7Srgb;
+    }
+
+    constexpr bool IsBlockCompressed(const TextureFormat format) {
+        return format != TextureFormat::Rgba8Unorm && format != TextureFormat::Rgba8Srgb;
+    }
+
+    // Bytes per 4x4 block, or per pixel for uncompressed formats.
+    constexpr uint32_t GetBlockSize(const TextureFormat format) {
+        switch (format) {
+        case TextureFormat::Rgba8Unorm:
+        case TextureFormat::Rgba8Srgb:
+            return 4;
+        case TextureFormat::Bc1Unorm:
+        case TextureFormat::Bc1Srgb:
+        case TextureFormat::Bc4Unorm:
+            return 8;
+        case TextureFormat::Bc3Unorm:
+        case TextureFormat::Bc3Srgb:
+        case TextureFormat::Bc5Unorm:
+        case TextureFormat::Bc7Unorm:
+        case TextureFormat::Bc7Srgb:
+            return 16;
+        }
+
+        return 0;
+    }
+
+    constexpr uint64_t GetLevelSize(const TextureFormat format, const uint32_t width, const uint32_t height) {
+        if (!IsBlockCompressed(format)) {
+            return static_cast<uint64_t>(width) * height * GetBlockSize(format);
+        }
+
+        return static_cast<uint64_t>((width + 3) / 4) * ((height + 3) / 4) * GetBlockSize(format);
+    }
+}
+
+#endif //PULSAR_TEXTUREFORMAT_HPP
@@ -0,0 +1,64 @@
+#include "TextureUpload.hpp"
+
+#include "Vulkan/Buffer.hpp"
+
+namespace Pulsar::Texture {
+    Vulkan::Image UploadTexture(Vulkan::Device &device, const TextureFile &texture) {
+        const TextureHeader &header = texture.GetHeader();
+        const VkFormat       format = texture.GetVkFormat();
+
+        constexpr VkFormatFeatureFlags features = VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT |
+                                                  VK_FORMAT_FEATURE_TRANSFER_DST_BIT;
+        if (!device.IsFormatSupported(format, features)) {
+            throw std::runtime_error("Failed to upload texture: Format not supported by device");
+        }
+
+        Vulkan::ImageConfig config{};
+        config.extent    = {header.width, header.height};
+        config.format    = format;
+        config.mipLevels = header.levelCount;
+        config.usage     = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+
+        Vulkan::Image image = Vulkan::Image::Create(device, config);
+
+        Vulkan::Buffer staging = Vulkan::Buffer::Create(device, header.dataSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                                                        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                                        VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        staging.Write(texture.GetData());
+        staging.Unmap();
+
+        const std::vector<VkBufferImageCopy> regions = texture.GetCopyRegions();
+
+        device.SubmitImmediate([&](const VkCommandBuffer commandBuffer) {
+            VkImageMemoryBarrier barrier{};
+            barrier.sType                       = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.srcAccessMask               = 0;
+            barrier.dstAccessMask               = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.oldLayout                   = VK_IMAGE_LAYOUT_UNDEFINED;
+            barrier.newLayout                   = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.srcQueueFamilyIndex         = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex         = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image                       = image.GetVkImage();
+            barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            barrier.subresourceRange.levelCount = header.levelCount;
+            barrier.subresourceRange.layerCount = 1;
+
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+                                 0, nullptr, 0, nullptr, 1, &barrier);
+
+            vkCmdCopyBufferToImage(commandBuffer, staging.GetVkBuffer(), image.GetVkImage(),
+                                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<uint32_t>(regions.size()),
+                                   regions.data());
+
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+            barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.newLayout     = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                                 0, 0, nullptr, 0, nullptr, 1, &barrier);
+        });
+
+        return image;
+    }
+}
@@ -0,0 +1,13 @@
+#ifndef PULSAR_TEXTUREUPLOAD_HPP
+#define PULSAR_TEXTUREUPLOAD_HPP
+
+#include "TextureFile.hpp"
+#include "Vulkan/Image.hpp"
+
+namespace Pulsar::Texture {
+    // Copies every level through a staging buffer into a sampled image, left in SHADER_READ_ONLY_OPTIMAL. Throws
+    // when the device cannot sample the format, e.g. BC textures without textureCompressionBC.
+    Vulkan::Image UploadTexture(Vulkan::Device &device, const TextureFile &texture);
+}
+
+#endif //PULSAR_TEXTUREUPLOAD_HPP
@@ -0,0 +1,365 @@
+#include "JobSystem.hpp"
+
+#include <algorithm>
+#include <random>
+
+#if defined(__linux__)
+#include <pthread.h>
+#elif defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+namespace Pulsar::Threading {
+    struct Job {
+        std::function<void()> function;
+        JobCounter *          counter = nullptr;
+    };
+
+    namespace {
+        const std::thread::id s_MainThreadId = std::this_thread::get_id();
+
+        // Identifies the job system, and the deque within it, owned by the calling worker thread.
+        thread_local const void *t_State       = nullptr;
+        thread_local uint32_t    t_WorkerIndex = 0;
+
+        void PinThread(std::thread &thread, const uint32_t core) {
+#if defined(__linux__)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(core % CPU_SETSIZE, &set);
+            pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#elif defined(_WIN32)
+            SetThreadAffinityMask(static_cast<HANDLE>(thread.native_handle()), static_cast<DWORD_PTR>(1) << core % 64);
+#else
+            (void) thread;
+            (void) core;
+#endif
+        }
+
+        uint32_t RandomIndex(const uint32_t count) {
+            thread_local std::minstd_rand random(
+                static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())));
+
+            return static_cast<uint32_t>(random() % count);
+        }
+    }
+
+    bool JobCounter::IsDone() const {
+        return GetValue() == 0;
+    }
+
+    uint32_t JobCounter::GetValue() const {
+        return m_Value.load(std::memory_order_acquire);
+    }
+
+    bool IsMainThread() {
+        return std::this_thread::get_id() == s_MainThreadId;
+    }
+
+    JobSystem JobSystem::Create(const JobSystemConfig &config) {
+        const uint32_t hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        const uint32_t workerCount     = config.workerCount != 0
+                                             ? config.workerCount
+                                             : std::max(hardwareThreads - 1, 1u);
+
+        JobSystem jobSystem;
+        jobSystem.m_State = std::make_unique<State>();
+
+        State &state = *jobSystem.m_State;
+
+        // Every deque has to exist before the first worker starts stealing.
+        state.workers.reserve(workerCount);
+        for (uint32_t i = 0; i < workerCount; i++) {
+            state.workers.push_back(std::make_unique<Worker>(config.dequeCapacity));
+        }
+
+        for (uint32_t i = 0; i < workerCount; i++) {
+            state.workers[i]->thread = std::thread(WorkerLoop, std::ref(state), i);
+
+            if (config.pinWorkers) {
+                PinThread(state.workers[i]->thread, (i + 1) % hardwareThreads);
+            }
+        }
+
+        return jobSystem;
+    }
+
+    JobSystem::~JobSystem() {
+        Shutdown();
+    }
+
+    JobSystem &JobSystem::operator=(JobSystem &&other) noexcept {
+        if (this != &other) {
+            Shutdown();
+
+            m_State = std::move(other.m_State);
+        }
+
+        return *this;
+    }
+
+    void JobSystem::Schedule(std::function<void()> job, JobCounter *counter) {
+        if (m_State == nullptr) {
+            throw std::runtime_error("Failed to schedule job: Job system not initialized");
+        }
+
+        if (counter != nullptr) {
+            counter->m_Value.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        Push(*m_State, new Job{std::move(job), counter});
+    }
+
+    void JobSystem::Schedule(std::function<void()> job, JobCounter &dependency, JobCounter *counter) {
+        if (m_State == nullptr) {
+            throw std::runtime_error("Failed to schedule job: Job system not initialized");
+        }
+
+        if (counter != nullptr) {
+            counter->m_Value.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        auto *entry = new Job{std::move(job), counter};
+
+        {
+            std::lock_guard lock(dependency.m_Mutex);
+
+            if (dependency.m_Value.load(std::memory_order_acquire) != 0) {
+                dependency.m_Dependents.push_back(entry);
+                return;
+            }
+        }
+
+        Push(*m_State, entry);
+    }
+
+    void JobSystem::ScheduleOnMainThread(std::function<void()> job, JobCounter *counter) {
+        if (m_State == nullptr) {
+            throw std::runtime_error("Failed to schedule job: Job system not initialized");
+        }
+
+        if (counter != nullptr) {
+            counter->m_Value.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        std::lock_guard lock(m_State->mainThreadMutex);
+        m_State->mainThreadJobs.push_back(new Job{std::move(job), counter});
+    }
+
+    void JobSystem::RunMainThreadJobs() {
+        if (!IsMainThread()) {
+            throw std::runtime_error("Failed to run main thread jobs: Not called from the main thread");
+        }
+
+        std::deque<Job *> jobs;
+
+        {
+            std::lock_guard lock(m_State->mainThreadMutex);
+            jobs.swap(m_State->mainThreadJobs);
+        }
+
+        for (Job *job : jobs) {
+            Execute(*m_State, job);
+        }
+    }
+
+    void JobSystem::Wait(const JobCounter &counter) {
+        State &state = *m_State;
+
+        const bool mainThread = IsMainThread();
+
+        while (counter.m_Value.load(std::memory_order_acquire) != 0) {
+            if (mainThread) {
+                RunMainThreadJobs();
+            }
+
+            if (Job *job = FindJob(state)) {
+                Execute(state, job);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+
+        // The thread that released the counter may still hold its mutex; once we own it the
+        // counter can safely be destroyed.
+        std::lock_guard lock(counter.m_Mutex);
+    }
+
+    uint32_t JobSystem::GetWorkerCount() const {
+        return static_cast<uint32_t>(m_State->workers.size());
+    }
+
+    void JobSystem::Shutdown() {
+        if (m_State == nullptr) {
+            return;
+        }
+
+        {
+            std::lock_guard lock(m_State->sleepMutex);
+            m_State->stopping = true;
+        }
+
+        m_State->wakeCondition.notify_all();
+
+        for (const auto &worker : m_State->workers) {
+            if (worker->thread.joinable()) {
+                worker->thread.join();
+            }
+        }
+
+        for (const Job *job : m_State->mainThreadJobs) {
+            delete job;
+        }
+
+        m_State.reset();
+    }
+
+    void JobSystem::ParallelForRanges(const uint32_t count, const uint32_t minGrain,
+                                      const std::function<void(uint32_t, uint32_t)> &function) {
+        if (count == 0) {
+            return;
+        }
+
+        const uint32_t threadCount = GetWorkerCount() + 1;
+        const uint32_t autoGrain   = (count + threadCount * 4 - 1) / (threadCount * 4);
+        const uint32_t grain       = std::max({autoGrain, minGrain, 1u});
+
+        if (grain >= count) {
+            function(0, count);
+            return;
+        }
+
+        JobCounter         counter;
+        std::mutex         errorMutex;
+        std::exception_ptr error;
+
+        const auto runRange = [&function, &errorMutex, &error](const uint32_t begin, const uint32_t end) {
+            try {
+                function(begin, end);
+            } catch (...) {
+                std::lock_guard lock(errorMutex);
+                if (error == nullptr) {
+                    error = std::current_exception();
+                }
+            }
+        };
+
+        for (uint32_t begin = grain; begin < count; begin += grain) {
+            const uint32_t end = std::min(begin + grain, count);
+            Schedule([&runRange, begin, end] { runRange(begin, end); }, &counter);
+        }
+
+        runRange(0, grain);
+        Wait(counter);
+
+        if (error != nullptr) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    void JobSystem::Push(State &state, Job *job) {
+        state.pending.fetch_add(1);
+
+        bool pushed = false;
+        if (t_State == &state) {
+            pushed = state.workers[t_WorkerIndex]->deque.Push(job);
+        }
+
+        if (!pushed) {
+            std::lock_guard lock(state.sharedMutex);
+            state.sharedJobs.push_back(job);
+        }
+
+        // Pairs with the sleeping increment in WorkerLoop: either we see the sleeper, or it sees the job.
+        if (state.sleeping.load() != 0) {
+            { std::lock_guard lock(state.sleepMutex); }
+            state.wakeCondition.notify_one();
+        }
+    }
+
+    Job *JobSystem::FindJob(State &state) {
+        const bool           worker      = t_State == &state;
+        const auto           workerCount = static_cast<uint32_t>(state.workers.size());
+        std::optional<Job *> job;
+
+        if (worker) {
+            job = state.workers[t_WorkerIndex]->deque.Pop();
+        }
+
+        if (!job) {
+            std::lock_guard lock(state.sharedMutex);
+            if (!state.sharedJobs.empty()) {
+                job = state.sharedJobs.front();
+                state.sharedJobs.pop_front();
+            }
+        }
+
+        if (!job) {
+            const uint32_t start = RandomIndex(workerCount);
+            for (uint32_t i = 0; i < workerCount && !job; i++) {
+                const uint32_t victim = (start + i) % workerCount;
+                if (!worker || victim != t_WorkerIndex) {
+                    job = state.workers[victim]->deque.Steal();
+                }
+            }
+        }
+
+        if (!job) {
+            return nullptr;
+        }
+
+        state.pending.fetch_sub(1);
+        return *job;
+    }
+
+    void JobSystem::Execute(State &state, Job *job) {
+        job->function();
+
+        if (job->counter != nullptr) {
+            Release(state, *job->counter);
+        }
+
+        delete job;
+    }
+
+    void JobSystem::Release(State &state, JobCounter &counter) {
+        std::vector<Job *> dependents;
+
+        {
+            std::lock_guard lock(counter.m_Mutex);
+
+            if (counter.m_Value.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                dependents.swap(counter.m_Dependents);
+            }
+        }
+
+        for (Job *dependent : dependents) {
+            Push(state, dependent);
+        }
+    }
+
+    void JobSystem::WorkerLoop(State &state, const uint32_t index) {
+        t_State       = &state;
+        t_WorkerIndex = index;
+
+        while (true) {
+            if (Job *job = FindJob(state)) {
+                Execute(state, job);
+                continue;
+            }
+
+            std::unique_lock lock(state.sleepMutex);
+
+            state.sleeping.fetch_add(1);
+            state.wakeCondition.wait(lock, [&state] { return state.stopping || state.pending.load() > 0; });
+            state.sleeping.fetch_sub(1);
+
+            // Queued jobs are drained before the worker exits.
+            if (state.stopping && state.pending.load() == 0) {
+                return;
+            }
+        }
+    }
+}
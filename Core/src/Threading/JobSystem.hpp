@@ -0,0 +1,153 @@
+#ifndef PULSAR_JOBSYSTEM_HPP
+#define PULSAR_JOBSYSTEM_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "WorkStealingDeque.hpp"
+
+namespace Pulsar::Threading {
+    class JobSystem;
+    struct Job;
+
+    // Number of unfinished jobs attached to it. Other jobs can be scheduled to start once it drops to zero.
+    // Wait on a counter before destroying it.
+    class JobCounter {
+    public:
+        JobCounter() = default;
+
+        JobCounter(const JobCounter &other) = delete;
+        JobCounter &operator=(const JobCounter &other) = delete;
+
+        [[nodiscard]] bool     IsDone() const;
+        [[nodiscard]] uint32_t GetValue() const;
+
+    private:
+        friend class JobSystem;
+
+        std::atomic<uint32_t> m_Value = 0;
+        mutable std::mutex    m_Mutex;
+        std::vector<Job *>    m_Dependents;
+    };
+
+    struct JobSystemConfig {
+        // Zero starts one worker per hardware thread, minus one for the main thread.
+        uint32_t workerCount = 0;
+
+        // Pins worker i to core i + 1, leaving core 0 to the main thread. Ignored where unsupported.
+        bool pinWorkers = false;
+
+        // Per-worker deque size; jobs beyond it overflow into the shared queue.
+        size_t dequeCapacity = 4096;
+    };
+
+    // True on the thread that ran static initialization, i.e. the one that entered main. GLFW must only be
+    // called from this thread; other threads hand such work over with ScheduleOnMainThread.
+    [[nodiscard]] bool IsMainThread();
+
+    // Work-stealing scheduler: every worker owns a Chase-Lev deque it pushes to and pops from, and idle workers
+    // steal from the others. Threads that are not workers submit through a shared queue. Waiting threads execute
+    // jobs instead of blocking, so jobs may wait on other jobs without deadlocking the pool.
+    class JobSystem {
+    public:
+        static JobSystem Create(const JobSystemConfig &config = {});
+
+        // Jobs still queued are run before the workers exit; jobs waiting on a counter that never reaches zero
+        // are dropped.
+        ~JobSystem();
+
+        JobSystem(const JobSystem &other)     = delete;
+        JobSystem(JobSystem &&other) noexcept = default;
+
+        JobSystem &operator=(const JobSystem &other) = delete;
+        JobSystem &operator=(JobSystem &&other) noexcept;
+
+        // counter, if given, is incremented now and decremented when the job has finished. Jobs must not throw;
+        // use Submit or ParallelFor to get exceptions back.
+        void Schedule(std::function<void()> job, JobCounter *counter = nullptr);
+
+        // As above, but the job is held back until dependency reaches zero.
+        void Schedule(std::function<void()> job, JobCounter &dependency, JobCounter *counter = nullptr);
+
+        // The job runs on the main thread, either in RunMainThreadJobs or while the main thread is in Wait.
+        void ScheduleOnMainThread(std::function<void()> job, JobCounter *counter = nullptr);
+
+        // Main thread only.
+        void RunMainThreadJobs();
+
+        template<typename F>
+        [[nodiscard]] auto Submit(F &&function) -> std::future<std::invoke_result_t<F>> {
+            using Result = std::invoke_result_t<F>;
+
+            auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(function));
+            std::future<Result> future = task->get_future();
+
+            Schedule([task] { (*task)(); });
+
+            return future;
+        }
+
+        // Runs other jobs on the calling thread until counter reaches zero.
+        void Wait(const JobCounter &counter);
+
+        // Calls function(begin, end) over disjoint ranges covering [0, count) and returns once all are done. The
+        // range size targets four ranges per thread but never drops below minGrain. The first exception thrown
+        // by function is rethrown here after every range has finished.
+        template<typename F>
+        void ParallelFor(const uint32_t count, F &&function, const uint32_t minGrain = 1) {
+            ParallelForRanges(count, minGrain, [&function](const uint32_t begin, const uint32_t end) {
+                function(begin, end);
+            });
+        }
+
+        [[nodiscard]] uint32_t GetWorkerCount() const;
+
+    private:
+        struct Worker {
+            WorkStealingDeque<Job *> deque;
+            std::thread              thread;
+
+            explicit Worker(const size_t capacity) : deque(capacity) {}
+        };
+
+        struct State {
+            std::vector<std::unique_ptr<Worker>> workers;
+
+            std::mutex        sharedMutex;
+            std::deque<Job *> sharedJobs;
+
+            std::mutex        mainThreadMutex;
+            std::deque<Job *> mainThreadJobs;
+
+            std::mutex              sleepMutex;
+            std::condition_variable wakeCondition;
+            std::atomic<int64_t>    pending  = 0;
+            std::atomic<uint32_t>   sleeping = 0;
+            bool                    stopping = false;
+        };
+
+        std::unique_ptr<State> m_State;
+
+        JobSystem() = default;
+
+        void Shutdown();
+
+        void ParallelForRanges(uint32_t count, uint32_t minGrain,
+                               const std::function<void(uint32_t, uint32_t)> &function);
+
+        static void Push(State &state, Job *job);
+        static Job *FindJob(State &state);
+        static void Execute(State &state, Job *job);
+        static void Release(State &state, JobCounter &counter);
+        static void WorkerLoop(State &state, uint32_t index);
+    };
+}
+
+#endif //PULSAR_JOBSYSTEM_HPP
@@ -0,0 +1,96 @@
+#ifndef PULSAR_SPMCRING_HPP
+#define PULSAR_SPMCRING_HPP
+
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <span>
+
+namespace Pulsar::Threading {
+    // Bounded single-producer/multi-consumer queue. Every cell carries a sequence number (Vyukov's bounded
+    // queue), so a consumer only claims cells the producer has published and the producer only reuses cells a
+    // consumer has released. Push never blocks: it fails when the ring is full.
+    template<typename T>
+    class SpmcRing {
+    public:
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        explicit SpmcRing(const size_t capacity)
+            : m_Mask(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1), m_Cells(std::make_unique<Cell[]>(m_Mask + 1)) {
+            for (size_t i = 0; i <= m_Mask; i++) {
+                m_Cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        // Producer only.
+        bool Push(const T &item) {
+            const size_t position = m_Tail.load(std::memory_order_relaxed);
+            Cell &       cell     = m_Cells[position & m_Mask];
+
+            if (cell.sequence.load(std::memory_order_acquire) != position) {
+                return false;
+            }
+
+            cell.value = item;
+            cell.sequence.store(position + 1, std::memory_order_release);
+            m_Tail.store(position + 1, std::memory_order_relaxed);
+
+            return true;
+        }
+
+        // Any thread.
+        bool Pop(T &item) {
+            size_t position = m_Head.load(std::memory_order_relaxed);
+
+            while (true) {
+                Cell &         cell     = m_Cells[position & m_Mask];
+                const size_t   sequence = cell.sequence.load(std::memory_order_acquire);
+                const intptr_t distance = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+                if (distance < 0) {
+                    return false;
+                }
+
+                if (distance > 0) {
+                    position = m_Head.load(std::memory_order_relaxed);
+                    continue;
+                }
+
+                if (m_Head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    item = cell.value;
+                    cell.sequence.store(position + m_Mask + 1, std::memory_order_release);
+
+                    return true;
+                }
+            }
+        }
+
+        // Any thread. Fills items front to back and returns how many were taken.
+        size_t PopBatch(const std::span<T> items) {
+            size_t count = 0;
+            while (count < items.size() && Pop(items[count])) {
+                count++;
+            }
+
+            return count;
+        }
+
+        [[nodiscard]] size_t GetCapacity() const {
+            return m_Mask + 1;
+        }
+
+    private:
+        struct Cell {
+            std::atomic<size_t> sequence;
+            T                   value;
+        };
+
+        alignas(64) std::atomic<size_t> m_Head = 0;
+        alignas(64) std::atomic<size_t> m_Tail = 0;
+
+        size_t                  m_Mask;
+        std::unique_ptr<Cell[]> m_Cells;
+    };
+}
+
+#endif //PULSAR_SPMCRING_HPP
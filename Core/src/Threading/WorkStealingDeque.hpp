@@ -0,0 +1,92 @@
+#ifndef PULSAR_WORKSTEALINGDEQUE_HPP
+#define PULSAR_WORKSTEALINGDEQUE_HPP
+
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <optional>
+
+namespace Pulsar::Threading {
+    // Fixed-capacity Chase-Lev deque (Le et al., "Correct and Efficient Work-Stealing for Weak Memory Models").
+    // The owning thread pushes and pops at the bottom; any other thread may steal from the top.
+    template<typename T>
+    class WorkStealingDeque {
+    public:
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        explicit WorkStealingDeque(const size_t capacity)
+            : m_Mask(std::bit_ceil(capacity) - 1), m_Buffer(std::make_unique<std::atomic<T>[]>(m_Mask + 1)) {
+        }
+
+        // Owner only. Returns false when full.
+        bool Push(const T item) {
+            const int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+            const int64_t top    = m_Top.load(std::memory_order_acquire);
+
+            if (bottom - top > static_cast<int64_t>(m_Mask)) {
+                return false;
+            }
+
+            m_Buffer[bottom & m_Mask].store(item, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+
+            return true;
+        }
+
+        // Owner only.
+        std::optional<T> Pop() {
+            const int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+            m_Bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t top = m_Top.load(std::memory_order_relaxed);
+
+            if (top > bottom) {
+                m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+
+            const T item = m_Buffer[bottom & m_Mask].load(std::memory_order_relaxed);
+            if (top != bottom) {
+                return item;
+            }
+
+            // Last item: race the thieves for it.
+            const bool won = m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                           std::memory_order_relaxed);
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+
+            return won ? std::optional<T>(item) : std::nullopt;
+        }
+
+        // Any thread. May fail spuriously when racing another thief or the owner.
+        std::optional<T> Steal() {
+            int64_t top = m_Top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+
+            if (top >= bottom) {
+                return std::nullopt;
+            }
+
+            const T item = m_Buffer[top & m_Mask].load(std::memory_order_relaxed);
+            if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return std::nullopt;
+            }
+
+            return item;
+        }
+
+        [[nodiscard]] bool IsEmpty() const {
+            return m_Top.load(std::memory_order_relaxed) >= m_Bottom.load(std::memory_order_relaxed);
+        }
+
+    private:
+        alignas(64) std::atomic<int64_t> m_Top    = 0;
+        alignas(64) std::atomic<int64_t> m_Bottom = 0;
+        size_t                               m_Mask;
+        std::unique_ptr<std::atomic<T>[]>    m_Buffer;
+    };
+}
+
+#endif //PULSAR_WORKSTEALINGDEQUE_HPP
@@ -0,0 +1,160 @@
+#include "Buffer.hpp"
+
+namespace Pulsar::Vulkan {
+    Buffer Buffer::Create(Device &device, const VkDeviceSize size, const VkBufferUsageFlags usage,
+                          const VkMemoryPropertyFlags properties) {
+        Buffer buffer;
+        buffer.m_Device = &device;
+        buffer.m_Size   = size;
+
+        VkBufferCreateInfo createInfo{};
+        createInfo.sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        createInfo.size        = size;
+        createInfo.usage       = usage;
+        createInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        if (vkCreateBuffer(device.GetVkLogicalDevice(), &createInfo, nullptr, &buffer.m_Buffer) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create buffer: Unknown error");
+        }
+
+        VkMemoryRequirements requirements;
+        vkGetBufferMemoryRequirements(device.GetVkLogicalDevice(), buffer.m_Buffer, &requirements);
+
+        VkMemoryAllocateInfo allocateInfo{};
+        allocateInfo.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocateInfo.allocationSize  = requirements.size;
+        allocateInfo.memoryTypeIndex = device.FindMemoryType(requirements.memoryTypeBits, properties);
+        buffer.m_Properties          = device.GetMemoryTypeFlags(allocateInfo.memoryTypeIndex);
+
+        if (vkAllocateMemory(device.GetVkLogicalDevice(), &allocateInfo, nullptr, &buffer.m_Memory) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to allocate buffer memory: Out of memory");
+        }
+
+        vkBindBufferMemory(device.GetVkLogicalDevice(), buffer.m_Buffer, buffer.m_Memory, 0);
+
+        return buffer;
+    }
+
+    Buffer Buffer::CreateDeviceLocal(Device &device, const std::span<const std::byte> data,
+                                     const VkBufferUsageFlags usage) {
+        if (data.empty()) {
+            throw std::runtime_error("Failed to create buffer: No data");
+        }
+
+        Buffer buffer = Create(device, data.size(), usage | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                               VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        buffer.Upload(data);
+
+        return buffer;
+    }
+
+    Buffer::~Buffer() {
+        Destroy();
+    }
+
+    Buffer::Buffer(Buffer &&other) noexcept
+        : m_Buffer(std::exchange(other.m_Buffer, nullptr)),
+          m_Memory(std::exchange(other.m_Memory, nullptr)),
+          m_Size(std::exchange(other.m_Size, 0)),
+          m_Properties(std::exchange(other.m_Properties, 0)),
+          m_Mapped(std::exchange(other.m_Mapped, nullptr)),
+          m_Device(other.m_Device) {
+    }
+
+    Buffer &Buffer::operator=(Buffer &&other) noexcept {
+        if (this != &other) {
+            Destroy();
+
+            m_Buffer     = std::exchange(other.m_Buffer, nullptr);
+            m_Memory     = std::exchange(other.m_Memory, nullptr);
+            m_Size       = std::exchange(other.m_Size, 0);
+            m_Properties = std::exchange(other.m_Properties, 0);
+            m_Mapped     = std::exchange(other.m_Mapped, nullptr);
+            m_Device     = other.m_Device;
+        }
+
+        return *this;
+    }
+
+    void *Buffer::Map() {
+        if (m_Mapped == nullptr) {
+            if (vkMapMemory(m_Device->GetVkLogicalDevice(), m_Memory, 0, m_Size, 0, &m_Mapped) != VK_SUCCESS) {
+                throw std::runtime_error("Failed to map buffer: Memory not host visible");
+            }
+        }
+
+        return m_Mapped;
+    }
+
+    void Buffer::Unmap() {
+        if (m_Mapped != nullptr) {
+            vkUnmapMemory(m_Device->GetVkLogicalDevice(), m_Memory);
+            m_Mapped = nullptr;
+        }
+    }
+
+    void Buffer::Write(const std::span<const std::byte> data, const VkDeviceSize offset) {
+        if (offset + data.size() > m_Size) {
+            throw std::runtime_error("Failed to write buffer: Write out of bounds");
+        }
+
+        std::memcpy(static_cast<std::byte *>(Map()) + offset, data.data(), data.size());
+    }
+
+    void Buffer::Upload(const std::span<const std::byte> data, const VkDeviceSize offset) {
+        if (offset + data.size() > m_Size) {
+            throw std::runtime_error("Failed to upload buffer: Write out of bounds");
+        }
+
+        if (data.empty()) {
+            return;
+        }
+
+        Buffer staging = Create(*m_Device, data.size(), VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        staging.Write(data);
+        staging.Unmap();
+
+        m_Device->SubmitImmediate([this, &staging, offset](VkCommandBuffer commandBuffer) {
+            VkBufferCopy region{};
+            region.dstOffset = offset;
+            region.size      = staging.GetSize();
+
+            vkCmdCopyBuffer(commandBuffer, staging.GetVkBuffer(), m_Buffer, 1, &region);
+        });
+    }
+
+    VkBuffer Buffer::GetVkBuffer() const {
+        return m_Buffer;
+    }
+
+    VkDeviceMemory Buffer::GetVkDeviceMemory() const {
+        return m_Memory;
+    }
+
+    VkDeviceSize Buffer::GetSize() const {
+        return m_Size;
+    }
+
+    VkMemoryPropertyFlags Buffer::GetMemoryProperties() const {
+        return m_Properties;
+    }
+
+    void Buffer::Destroy() {
+        if (m_Device == nullptr) {
+            return;
+        }
+
+        Unmap();
+
+        if (m_Buffer != nullptr) {
+            vkDestroyBuffer(m_Device->GetVkLogicalDevice(), m_Buffer, nullptr);
+            m_Buffer = nullptr;
+        }
+
+        if (m_Memory != nullptr) {
+            vkFreeMemory(m_Device->GetVkLogicalDevice(), m_Memory, nullptr);
+            m_Memory = nullptr;
+        }
+    }
+}
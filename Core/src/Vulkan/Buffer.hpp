@@ -0,0 +1,55 @@
+#ifndef PULSAR_BUFFER_HPP
+#define PULSAR_BUFFER_HPP
+
+#include <span>
+
+#include "Device.hpp"
+
+namespace Pulsar::Vulkan {
+    class Buffer {
+    public:
+        static Buffer Create(Device &device, VkDeviceSize size, VkBufferUsageFlags usage,
+                             VkMemoryPropertyFlags properties);
+
+        // Uploads through a temporary staging buffer into device-local memory.
+        static Buffer CreateDeviceLocal(Device &device, std::span<const std::byte> data, VkBufferUsageFlags usage);
+
+        ~Buffer();
+
+        Buffer(const Buffer &other) = delete;
+        Buffer(Buffer &&other) noexcept;
+
+        Buffer &operator=(const Buffer &other) = delete;
+        Buffer &operator=(Buffer &&other) noexcept;
+
+        [[nodiscard]] void *Map();
+        void                Unmap();
+
+        // Only valid for host-visible buffers.
+        void Write(std::span<const std::byte> data, VkDeviceSize offset = 0);
+
+        // Copies through a temporary staging buffer, for device-local buffers created with TRANSFER_DST usage.
+        void Upload(std::span<const std::byte> data, VkDeviceSize offset = 0);
+
+        [[nodiscard]] VkBuffer       GetVkBuffer() const;
+        [[nodiscard]] VkDeviceMemory GetVkDeviceMemory() const;
+        [[nodiscard]] VkDeviceSize   GetSize() const;
+
+        // Of the memory type actually picked, which can have more flags than were asked for.
+        [[nodiscard]] VkMemoryPropertyFlags GetMemoryProperties() const;
+
+    private:
+        VkBuffer              m_Buffer     = nullptr;
+        VkDeviceMemory        m_Memory     = nullptr;
+        VkDeviceSize          m_Size       = 0;
+        VkMemoryPropertyFlags m_Properties = 0;
+        void *                m_Mapped     = nullptr;
+        Device *              m_Device     = nullptr;
+
+        Buffer() = default;
+
+        void Destroy();
+    };
+}
+
+#endif //PULSAR_BUFFER_HPP
@@ -10,12 +10,41 @@
 namespace Pulsar::Vulkan {
     constexpr auto     g_EngineName    = "Pulsar";
     constexpr Version  g_EngineVersion = {0, 0, 1};
-    constexpr uint32_t g_VulkanVersion = VK_API_VERSION_1_0;
+    // Highest version Pulsar uses. Features past 1.0 are still gated on what the device reports; see
+    // Instance::GetApiVersion.
+    constexpr uint32_t g_VulkanVersion = VK_API_VERSION_1_2;
 
     constexpr std::array g_DeviceExtensions = {
         VK_KHR_SWAPCHAIN_EXTENSION_NAME
     };
 
+    // Enabled when the device supports them; query with Device::IsExtensionEnabled.
+    constexpr std::array g_OptionalDeviceExtensions = {
+        VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME
+    };
+
+    // Enabled when the device supports them and Vulkan 1.1, which their feature queries need; see
+    // Device::GetDynamicStateSupport.
+    constexpr std::array g_DynamicStateDeviceExtensions = {
+        VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME,
+        VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME,
+        VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME
+    };
+
+    // Enabled together when the device supports all of them and Vulkan 1.1, which covers the remaining
+    // dependencies of VK_KHR_create_renderpass2; see Device::IsDynamicRenderingSupported.
+    constexpr std::array g_DynamicRenderingDeviceExtensions = {
+        VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME,
+        VK_KHR_DEPTH_STENCIL_RESOLVE_EXTENSION_NAME,
+        VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME
+    };
+
+    // Enabled on Vulkan 1.1 devices that support it; 1.2 has timeline semaphores in core. See
+    // Device::IsTimelineSemaphoreSupported.
+    constexpr std::array g_TimelineSemaphoreDeviceExtensions = {
+        VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME
+    };
+
     constexpr std::array g_ValidationLayers = {
         "VK_LAYER_KHRONOS_validation"
     };
@@ -0,0 +1,391 @@
+#include "DescriptorAllocator.hpp"
+
+#include <cmath>
+
+namespace Pulsar::Vulkan {
+    static size_t HashCombine(const size_t hash, const uint64_t value) {
+        return hash ^ (std::hash<uint64_t>{}(value) + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2));
+    }
+
+    static bool IsBufferDescriptor(const VkDescriptorType type) {
+        return type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER || type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC ||
+               type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER || type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+    }
+
+    DescriptorWrite DescriptorWrite::Buffer(const uint32_t binding, const VkDescriptorType type, const VkBuffer buffer,
+                                            const VkDeviceSize offset, const VkDeviceSize range) {
+        DescriptorWrite write;
+        write.binding = binding;
+        write.type    = type;
+        write.buffer  = buffer;
+        write.offset  = offset;
+        write.range   = range;
+
+        return write;
+    }
+
+    DescriptorWrite DescriptorWrite::Image(const uint32_t binding, const VkDescriptorType type,
+                                           const VkImageView imageView, const VkSampler sampler,
+                                           const VkImageLayout imageLayout) {
+        DescriptorWrite write;
+        write.binding     = binding;
+        write.type        = type;
+        write.imageView   = imageView;
+        write.sampler     = sampler;
+        write.imageLayout = imageLayout;
+
+        return write;
+    }
+
+    DescriptorAllocator DescriptorAllocator::Create(Device &device, const DescriptorAllocatorConfig &config) {
+        if (config.framesInFlight == 0 || config.initialSetsPerPool == 0 ||
+            config.maxSetsPerPool < config.initialSetsPerPool || config.unusedFramesToEvict < config.framesInFlight) {
+            throw std::runtime_error("Failed to create descriptor allocator: Invalid config");
+        }
+
+        DescriptorAllocator allocator;
+        allocator.m_Device = &device;
+        allocator.m_Config = config;
+        allocator.m_Shared = std::make_unique<Shared>();
+
+        allocator.m_Shared->pools.setsPerPool = config.initialSetsPerPool;
+
+        // Before 1.1 (maintenance1) a full pool is invalid usage rather than VK_ERROR_OUT_OF_POOL_MEMORY, so only
+        // the set count tracked per pool keeps allocations inside it.
+        allocator.m_PoolOverflowReported = device.GetApiVersion() >= VK_API_VERSION_1_1;
+
+        for (uint32_t i = 0; i < config.framesInFlight; i++) {
+            allocator.m_Frames.push_back(std::make_unique<Frame>());
+        }
+
+        return allocator;
+    }
+
+    DescriptorAllocator::~DescriptorAllocator() {
+        Destroy();
+    }
+
+    DescriptorAllocator::DescriptorAllocator(DescriptorAllocator &&other) noexcept
+        : m_Frames(std::move(other.m_Frames)),
+          m_Shared(std::move(other.m_Shared)),
+          m_FrameIndex(std::exchange(other.m_FrameIndex, 0)),
+          m_FrameNumber(std::exchange(other.m_FrameNumber, 0)),
+          m_PoolOverflowReported(other.m_PoolOverflowReported),
+          m_Config(std::move(other.m_Config)),
+          m_Device(std::exchange(other.m_Device, nullptr)) {
+    }
+
+    DescriptorAllocator &DescriptorAllocator::operator=(DescriptorAllocator &&other) noexcept {
+        if (this != &other) {
+            Destroy();
+
+            m_Frames               = std::move(other.m_Frames);
+            m_Shared               = std::move(other.m_Shared);
+            m_FrameIndex           = std::exchange(other.m_FrameIndex, 0);
+            m_FrameNumber          = std::exchange(other.m_FrameNumber, 0);
+            m_PoolOverflowReported = other.m_PoolOverflowReported;
+            m_Config               = std::move(other.m_Config);
+            m_Device               = std::exchange(other.m_Device, nullptr);
+        }
+
+        return *this;
+    }
+
+    void DescriptorAllocator::BeginFrame(const uint32_t frameIndex) {
+        if (frameIndex >= m_Frames.size()) {
+            throw std::runtime_error("Failed to begin descriptor frame: Frame index out of range");
+        }
+
+        m_FrameIndex = frameIndex;
+        m_FrameNumber++;
+
+        Frame &         frame = *m_Frames[frameIndex];
+        std::lock_guard lock(frame.mutex);
+
+        // Pools stay in their chains, so a chain grown once does not have to grow again next time.
+        for (const auto &[thread, chain] : frame.chains) {
+            for (size_t i = 0; i <= chain->current && i < chain->pools.size(); i++) {
+                vkResetDescriptorPool(m_Device->GetVkLogicalDevice(), chain->pools[i], 0);
+            }
+
+            chain->current = 0;
+            chain->used    = 0;
+        }
+
+        RecycleCachedSets();
+    }
+
+    VkDescriptorSet DescriptorAllocator::Allocate(const VkDescriptorSetLayout layout) {
+        return Allocate(GetChain(*m_Frames[m_FrameIndex]), layout);
+    }
+
+    VkDescriptorSet DescriptorAllocator::Get(const VkDescriptorSetLayout layout,
+                                             const std::span<const DescriptorWrite> writes) {
+        Shared &     shared = *m_Shared;
+        const size_t hash   = Hash(layout, writes);
+
+        const auto find = [&]() -> CachedSet * {
+            for (auto [it, end] = shared.cache.equal_range(hash); it != end; ++it) {
+                if (it->second->layout == layout && std::ranges::equal(it->second->writes, writes)) {
+                    return it->second.get();
+                }
+            }
+
+            return nullptr;
+        };
+
+        {
+            std::shared_lock lock(shared.mutex);
+
+            if (CachedSet *cached = find(); cached != nullptr) {
+                cached->lastUsed.store(m_FrameNumber, std::memory_order_relaxed);
+                shared.reused.fetch_add(1, std::memory_order_relaxed);
+                return cached->set;
+            }
+        }
+
+        std::unique_lock lock(shared.mutex);
+
+        // Another thread may have added it between the two locks.
+        if (CachedSet *cached = find(); cached != nullptr) {
+            cached->lastUsed.store(m_FrameNumber, std::memory_order_relaxed);
+            shared.reused.fetch_add(1, std::memory_order_relaxed);
+            return cached->set;
+        }
+
+        VkDescriptorSet set;
+        if (const auto it = shared.free.find(layout); it != shared.free.end()) {
+            set = it->second;
+            shared.free.erase(it);
+        } else {
+            set = Allocate(shared.pools, layout);
+        }
+
+        Write(set, writes);
+
+        shared.cache.emplace(hash, std::make_unique<CachedSet>(layout, std::vector(writes.begin(), writes.end()), set,
+                                                               m_FrameNumber));
+
+        return set;
+    }
+
+    void DescriptorAllocator::ForgetBuffer(const VkBuffer buffer) {
+        Forget([buffer](const DescriptorWrite &write) {
+            return IsBufferDescriptor(write.type) && write.buffer == buffer;
+        });
+    }
+
+    void DescriptorAllocator::ForgetImageView(const VkImageView imageView) {
+        Forget([imageView](const DescriptorWrite &write) {
+            return !IsBufferDescriptor(write.type) && write.imageView == imageView;
+        });
+    }
+
+    DescriptorAllocatorStatistics DescriptorAllocator::GetStatistics() const {
+        DescriptorAllocatorStatistics statistics;
+
+        statistics.pools     = m_Shared->poolCount.load(std::memory_order_relaxed);
+        statistics.allocated = m_Shared->allocated.load(std::memory_order_relaxed);
+        statistics.reused    = m_Shared->reused.load(std::memory_order_relaxed);
+
+        std::shared_lock lock(m_Shared->mutex);
+        statistics.cachedSets = m_Shared->cache.size();
+
+        return statistics;
+    }
+
+    void DescriptorAllocator::Destroy() {
+        if (m_Device == nullptr) {
+            return;
+        }
+
+        for (const std::unique_ptr<Frame> &frame : m_Frames) {
+            for (const auto &[thread, chain] : frame->chains) {
+                for (const VkDescriptorPool pool : chain->pools) {
+                    vkDestroyDescriptorPool(m_Device->GetVkLogicalDevice(), pool, nullptr);
+                }
+            }
+        }
+
+        for (const VkDescriptorPool pool : m_Shared->pools.pools) {
+            vkDestroyDescriptorPool(m_Device->GetVkLogicalDevice(), pool, nullptr);
+        }
+
+        m_Frames.clear();
+        m_Shared.reset();
+        m_Device = nullptr;
+    }
+
+    DescriptorAllocator::PoolChain &DescriptorAllocator::GetChain(Frame &frame) const {
+        std::lock_guard lock(frame.mutex);
+
+        std::unique_ptr<PoolChain> &chain = frame.chains[std::this_thread::get_id()];
+        if (chain == nullptr) {
+            chain              = std::make_unique<PoolChain>();
+            chain->setsPerPool = m_Config.initialSetsPerPool;
+        }
+
+        return *chain;
+    }
+
+    VkDescriptorSet DescriptorAllocator::Allocate(PoolChain &chain, const VkDescriptorSetLayout layout) const {
+        VkDescriptorSetAllocateInfo allocateInfo{};
+        allocateInfo.sType              = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocateInfo.descriptorSetCount = 1;
+        allocateInfo.pSetLayouts        = &layout;
+
+        // Tries the current pool, then moves down the chain, adding a larger pool at its end when it runs out.
+        while (true) {
+            const bool fresh = chain.current == chain.pools.size();
+            if (fresh) {
+                chain.pools.push_back(CreatePool(chain.setsPerPool));
+                chain.capacities.push_back(chain.setsPerPool);
+                chain.setsPerPool = std::min(chain.setsPerPool * 2, m_Config.maxSetsPerPool);
+                m_Shared->poolCount.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            if (chain.used == chain.capacities[chain.current]) {
+                chain.current++;
+                chain.used = 0;
+                continue;
+            }
+
+            allocateInfo.descriptorPool = chain.pools[chain.current];
+
+            VkDescriptorSet set;
+            const VkResult  result = vkAllocateDescriptorSets(m_Device->GetVkLogicalDevice(), &allocateInfo, &set);
+
+            if (result == VK_SUCCESS) {
+                chain.used++;
+                m_Shared->allocated.fetch_add(1, std::memory_order_relaxed);
+                return set;
+            }
+
+            if (result != VK_ERROR_FRAGMENTED_POOL &&
+                (!m_PoolOverflowReported || result != VK_ERROR_OUT_OF_POOL_MEMORY)) {
+                throw std::runtime_error("Failed to allocate descriptor set: Unknown error");
+            }
+
+            // A set that does not fit in an empty pool would make the chain grow forever.
+            if (fresh) {
+                throw std::runtime_error("Failed to allocate descriptor set: Layout exceeds pool size");
+            }
+
+            chain.current++;
+            chain.used = 0;
+        }
+    }
+
+    VkDescriptorPool DescriptorAllocator::CreatePool(const uint32_t setCount) const {
+        std::vector<VkDescriptorPoolSize> poolSizes;
+        poolSizes.reserve(m_Config.ratios.size());
+
+        for (const auto &[type, ratio] : m_Config.ratios) {
+            const auto count = static_cast<uint32_t>(std::ceil(ratio * static_cast<float>(setCount)));
+            poolSizes.push_back({type, std::max(count, 1u)});
+        }
+
+        VkDescriptorPoolCreateInfo poolInfo{};
+        poolInfo.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolInfo.maxSets       = setCount;
+        poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+        poolInfo.pPoolSizes    = poolSizes.data();
+
+        VkDescriptorPool pool;
+        if (vkCreateDescriptorPool(m_Device->GetVkLogicalDevice(), &poolInfo, nullptr, &pool) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create descriptor pool: Unknown error");
+        }
+
+        return pool;
+    }
+
+    void DescriptorAllocator::Write(const VkDescriptorSet set, const std::span<const DescriptorWrite> writes) const {
+        std::vector<VkDescriptorBufferInfo> bufferInfos(writes.size());
+        std::vector<VkDescriptorImageInfo>  imageInfos(writes.size());
+        std::vector<VkWriteDescriptorSet>   vkWrites(writes.size());
+
+        for (size_t i = 0; i < writes.size(); i++) {
+            const DescriptorWrite &write = writes[i];
+
+            vkWrites[i].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            vkWrites[i].dstSet          = set;
+            vkWrites[i].dstBinding      = write.binding;
+            vkWrites[i].dstArrayElement = write.arrayElement;
+            vkWrites[i].descriptorCount = 1;
+            vkWrites[i].descriptorType  = write.type;
+
+            if (IsBufferDescriptor(write.type)) {
+                bufferInfos[i]          = {write.buffer, write.offset, write.range};
+                vkWrites[i].pBufferInfo = &bufferInfos[i];
+            } else {
+                imageInfos[i]          = {write.sampler, write.imageView, write.imageLayout};
+                vkWrites[i].pImageInfo = &imageInfos[i];
+            }
+        }
+
+        vkUpdateDescriptorSets(m_Device->GetVkLogicalDevice(), static_cast<uint32_t>(vkWrites.size()),
+                               vkWrites.data(), 0, nullptr);
+    }
+
+    void DescriptorAllocator::Forget(const std::function<bool(const DescriptorWrite &)> &referencesResource) {
+        std::unique_lock lock(m_Shared->mutex);
+
+        std::erase_if(m_Shared->cache, [&](const auto &entry) {
+            const CachedSet &cached = *entry.second;
+            if (std::ranges::none_of(cached.writes, referencesResource)) {
+                return false;
+            }
+
+            m_Shared->retired.push_back({cached.layout, cached.set, cached.lastUsed.load(std::memory_order_relaxed)});
+            return true;
+        });
+    }
+
+    void DescriptorAllocator::RecycleCachedSets() {
+        Shared &         shared = *m_Shared;
+        std::unique_lock lock(shared.mutex);
+
+        // A set last used in frame n is done once BeginFrame has come around to its slot again.
+        const auto isDone = [this](const uint64_t lastUsed) {
+            return lastUsed + m_Config.framesInFlight <= m_FrameNumber;
+        };
+
+        std::erase_if(shared.retired, [&](const RetiredSet &retired) {
+            if (!isDone(retired.lastUsed)) {
+                return false;
+            }
+
+            shared.free.emplace(retired.layout, retired.set);
+            return true;
+        });
+
+        // unusedFramesToEvict >= framesInFlight, so evicted sets are done as well.
+        std::erase_if(shared.cache, [&](const auto &entry) {
+            const CachedSet &cached = *entry.second;
+            if (cached.lastUsed.load(std::memory_order_relaxed) + m_Config.unusedFramesToEvict > m_FrameNumber) {
+                return false;
+            }
+
+            shared.free.emplace(cached.layout, cached.set);
+            return true;
+        });
+    }
+
+    size_t DescriptorAllocator::Hash(const VkDescriptorSetLayout            layout,
+                                     const std::span<const DescriptorWrite> writes) {
+        size_t hash = std::hash<VkDescriptorSetLayout>{}(layout);
+
+        for (const DescriptorWrite &write : writes) {
+            hash = HashCombine(hash, (static_cast<uint64_t>(write.binding) << 32) | write.arrayElement);
+            hash = HashCombine(hash, write.type);
+            hash = HashCombine(hash, reinterpret_cast<uintptr_t>(write.buffer));
+            hash = HashCombine(hash, write.offset);
+            hash = HashCombine(hash, write.range);
+            hash = HashCombine(hash, reinterpret_cast<uintptr_t>(write.sampler));
+            hash = HashCombine(hash, reinterpret_cast<uintptr_t>(write.imageView));
+            hash = HashCombine(hash, write.imageLayout);
+        }
+
+        return hash;
+    }
+}
@@ -0,0 +1,166 @@
+#ifndef PULSAR_DESCRIPTORALLOCATOR_HPP
+#define PULSAR_DESCRIPTORALLOCATOR_HPP
+
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <thread>
+#include <unordered_map>
+
+#include "Device.hpp"
+
+namespace Pulsar::Vulkan {
+    // Descriptors of type per set a pool is sized for.
+    struct DescriptorPoolRatio {
+        VkDescriptorType type;
+        float            ratio;
+    };
+
+    struct DescriptorAllocatorConfig {
+        uint32_t framesInFlight      = 2;
+        uint32_t initialSetsPerPool  = 64; // Each pool added to a chain holds twice the last, up to the maximum.
+        uint32_t maxSetsPerPool      = 4096;
+        uint32_t unusedFramesToEvict = 120; // At least framesInFlight.
+
+        std::vector<DescriptorPoolRatio> ratios = {
+            {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 2.0F},
+            {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1.0F},
+            {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 2.0F},
+            {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC, 1.0F},
+            {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 4.0F},
+            {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1.0F}
+        };
+    };
+
+    // One descriptor of a set. Buffer descriptors use buffer, offset and range; image and sampler descriptors use
+    // sampler, imageView and imageLayout.
+    struct DescriptorWrite {
+        uint32_t         binding      = 0;
+        uint32_t         arrayElement = 0;
+        VkDescriptorType type         = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        VkBuffer         buffer       = nullptr;
+        VkDeviceSize     offset       = 0;
+        VkDeviceSize     range        = VK_WHOLE_SIZE;
+        VkSampler        sampler      = nullptr;
+        VkImageView      imageView    = nullptr;
+        VkImageLayout    imageLayout  = VK_IMAGE_LAYOUT_UNDEFINED;
+
+        static DescriptorWrite Buffer(uint32_t binding, VkDescriptorType type, VkBuffer buffer,
+                                      VkDeviceSize offset = 0, VkDeviceSize range = VK_WHOLE_SIZE);
+        static DescriptorWrite Image(uint32_t binding, VkDescriptorType type, VkImageView imageView,
+                                     VkSampler sampler = nullptr,
+                                     VkImageLayout imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+        [[nodiscard]] bool operator==(const DescriptorWrite &other) const = default;
+    };
+
+    struct DescriptorAllocatorStatistics {
+        uint32_t pools      = 0;
+        uint64_t allocated  = 0;
+        uint64_t reused     = 0; // Get calls answered from the cache without allocating or writing.
+        uint64_t cachedSets = 0;
+    };
+
+    // Two kinds of sets. Allocate hands out transient sets that live until their frame slot comes around again:
+    // every frame in flight has a chain of pools per thread, grown when the last pool runs out and reset as a whole
+    // in BeginFrame, so sets are never freed one by one and threads never share a pool.
+    //
+    // Get caches sets by layout and writes across frames in a persistent pool chain, so a set whose bindings do
+    // not change costs one hash lookup per frame and no Vulkan calls. Sets not requested for unusedFramesToEvict
+    // frames are recycled for other writes. A destroyed buffer or image view can have its handle reused by a new
+    // one, so pass it to ForgetBuffer or ForgetImageView first.
+    class DescriptorAllocator {
+    public:
+        static DescriptorAllocator Create(Device &device, const DescriptorAllocatorConfig &config = {});
+        ~DescriptorAllocator();
+
+        DescriptorAllocator(const DescriptorAllocator &other) = delete;
+        DescriptorAllocator(DescriptorAllocator &&other) noexcept;
+
+        DescriptorAllocator &operator=(const DescriptorAllocator &other) = delete;
+        DescriptorAllocator &operator=(DescriptorAllocator &&other) noexcept;
+
+        // Switches to frameIndex and resets its pools. The GPU must be done with that frame's sets, and no other
+        // thread may allocate meanwhile.
+        void BeginFrame(uint32_t frameIndex);
+
+        // A set of the current frame with nothing written to it.
+        [[nodiscard]] VkDescriptorSet Allocate(VkDescriptorSetLayout layout);
+
+        // A set with writes applied, shared with every call passing the same arguments in this or earlier frames.
+        [[nodiscard]] VkDescriptorSet Get(VkDescriptorSetLayout layout, std::span<const DescriptorWrite> writes);
+
+        // Drops the cached sets that reference the resource. Their sets are reused once the frames in flight that
+        // may still read them are done.
+        void ForgetBuffer(VkBuffer buffer);
+        void ForgetImageView(VkImageView imageView);
+
+        [[nodiscard]] DescriptorAllocatorStatistics GetStatistics() const;
+
+    private:
+        struct CachedSet {
+            VkDescriptorSetLayout        layout;
+            std::vector<DescriptorWrite> writes;
+            VkDescriptorSet              set;
+            std::atomic<uint64_t>        lastUsed; // Frame number of the last Get that returned it.
+        };
+
+        struct RetiredSet {
+            VkDescriptorSetLayout layout;
+            VkDescriptorSet       set;
+            uint64_t              lastUsed;
+        };
+
+        struct PoolChain {
+            std::vector<VkDescriptorPool> pools;
+            std::vector<uint32_t>         capacities;
+            size_t                        current     = 0;
+            uint32_t                      used        = 0; // Sets taken from the current pool.
+            uint32_t                      setsPerPool = 0;
+        };
+
+        // Transient sets; each chain is used by its thread only, except from BeginFrame.
+        struct Frame {
+            std::mutex                                                      mutex;
+            std::unordered_map<std::thread::id, std::unique_ptr<PoolChain>> chains;
+        };
+
+        // Shared by every thread. Cache lookups take the mutex shared; misses, which allocate and write, take it
+        // exclusively.
+        struct Shared {
+            std::shared_mutex                                               mutex;
+            std::unordered_multimap<size_t, std::unique_ptr<CachedSet>>     cache;
+            PoolChain                                                       pools;
+            std::vector<RetiredSet>                                         retired; // Maybe still read by the GPU.
+            std::unordered_multimap<VkDescriptorSetLayout, VkDescriptorSet> free;    // Ready to be rewritten.
+            std::atomic<uint32_t>                                           poolCount = 0;
+            std::atomic<uint64_t>                                           allocated = 0;
+            std::atomic<uint64_t>                                           reused    = 0;
+        };
+
+        std::vector<std::unique_ptr<Frame>> m_Frames;
+        std::unique_ptr<Shared>             m_Shared;
+        uint32_t                            m_FrameIndex           = 0;
+        uint64_t                            m_FrameNumber          = 0; // BeginFrame calls so far.
+        bool                                m_PoolOverflowReported = false;
+        DescriptorAllocatorConfig           m_Config               = {};
+        Device *                            m_Device               = nullptr;
+
+        DescriptorAllocator() = default;
+
+        void Destroy();
+
+        [[nodiscard]] PoolChain &      GetChain(Frame &frame) const;
+        [[nodiscard]] VkDescriptorSet  Allocate(PoolChain &chain, VkDescriptorSetLayout layout) const;
+        [[nodiscard]] VkDescriptorPool CreatePool(uint32_t setCount) const;
+
+        void Write(VkDescriptorSet set, std::span<const DescriptorWrite> writes) const;
+        void Forget(const std::function<bool(const DescriptorWrite &)> &referencesResource);
+        void RecycleCachedSets();
+
+        [[nodiscard]] static size_t Hash(VkDescriptorSetLayout layout, std::span<const DescriptorWrite> writes);
+    };
+}
+
+#endif //PULSAR_DESCRIPTORALLOCATOR_HPP
@@ -1,6 +1,7 @@
 #include "Device.hpp"
 
 #include "Common.hpp"
+#include "Logging/Log.hpp"
 
 namespace Pulsar::Vulkan {
     Device Device::Create(Instance &instance, Surface &surface) {
@@ -10,15 +11,187 @@ namespace Pulsar::Vulkan {
 
         device.SelectPhysicalDevice();
 
+        VkPhysicalDeviceFeatures supportedFeatures;
+        vkGetPhysicalDeviceFeatures(device.m_PhysicalDevice, &supportedFeatures);
+
+        // Indirect batching needs both to merge many draws into one call; Renderer falls back without them.
         VkPhysicalDeviceFeatures deviceFeatures{};
+        deviceFeatures.multiDrawIndirect         = supportedFeatures.multiDrawIndirect;
+        deviceFeatures.drawIndirectFirstInstance = supportedFeatures.drawIndirectFirstInstance;
+        deviceFeatures.fillModeNonSolid          = supportedFeatures.fillModeNonSolid;
+        // Baked textures are usually block-compressed; UploadTexture rejects those without it.
+        deviceFeatures.textureCompressionBC      = supportedFeatures.textureCompressionBC;
 
         VkDeviceCreateInfo deviceCreateInfo{};
         deviceCreateInfo.sType                = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
         deviceCreateInfo.queueCreateInfoCount = 1;
         deviceCreateInfo.pEnabledFeatures     = &deviceFeatures;
 
-        deviceCreateInfo.enabledExtensionCount   = static_cast<uint32_t>(g_DeviceExtensions.size());
-        deviceCreateInfo.ppEnabledExtensionNames = g_DeviceExtensions.data();
+        uint32_t extensionCount;
+        vkEnumerateDeviceExtensionProperties(device.m_PhysicalDevice, nullptr, &extensionCount, nullptr);
+
+        std::vector<VkExtensionProperties> availableExtensions(extensionCount);
+        vkEnumerateDeviceExtensionProperties(device.m_PhysicalDevice, nullptr, &extensionCount,
+                                             availableExtensions.data());
+
+        std::vector<const char *> extensions(g_DeviceExtensions.begin(), g_DeviceExtensions.end());
+        for (const char *extension : g_OptionalDeviceExtensions) {
+            for (const VkExtensionProperties &properties : availableExtensions) {
+                if (std::strcmp(properties.extensionName, extension) == 0) {
+                    extensions.push_back(extension);
+                    break;
+                }
+            }
+        }
+
+        VkPhysicalDeviceProperties properties;
+        vkGetPhysicalDeviceProperties(device.m_PhysicalDevice, &properties);
+
+        const uint32_t apiVersion = std::min(properties.apiVersion, instance.GetApiVersion());
+        device.m_ApiVersion       = apiVersion;
+
+        if (apiVersion >= VK_API_VERSION_1_1) {
+            for (const char *extension : g_DynamicStateDeviceExtensions) {
+                if (AreDeviceExtensionsSupported(device.m_PhysicalDevice, std::span(&extension, 1))) {
+                    extensions.push_back(extension);
+                }
+            }
+
+            if (AreDeviceExtensionsSupported(device.m_PhysicalDevice, g_DynamicRenderingDeviceExtensions)) {
+                extensions.insert(extensions.end(), g_DynamicRenderingDeviceExtensions.begin(),
+                                  g_DynamicRenderingDeviceExtensions.end());
+            }
+
+            if (apiVersion < VK_API_VERSION_1_2 &&
+                AreDeviceExtensionsSupported(device.m_PhysicalDevice, g_TimelineSemaphoreDeviceExtensions)) {
+                extensions.insert(extensions.end(), g_TimelineSemaphoreDeviceExtensions.begin(),
+                                  g_TimelineSemaphoreDeviceExtensions.end());
+            }
+        }
+
+        device.m_EnabledExtensions.insert(extensions.begin(), extensions.end());
+
+        // Only the features something in Pulsar sets are enabled; the rest of each extension stays off.
+        VkPhysicalDeviceExtendedDynamicStateFeaturesEXT dynamicState{};
+        dynamicState.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
+
+        VkPhysicalDeviceExtendedDynamicState2FeaturesEXT dynamicState2{};
+        dynamicState2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT;
+
+        VkPhysicalDeviceExtendedDynamicState3FeaturesEXT dynamicState3{};
+        dynamicState3.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT;
+
+        VkPhysicalDeviceDynamicRenderingFeaturesKHR dynamicRendering{};
+        dynamicRendering.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
+
+        VkPhysicalDeviceTimelineSemaphoreFeatures timelineSemaphore{};
+        timelineSemaphore.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES;
+
+        VkPhysicalDeviceFeatures2 enabledFeatures{};
+        enabledFeatures.sType    = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        enabledFeatures.features = deviceFeatures;
+
+        if (device.m_EnabledExtensions.contains(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME)) {
+            VkPhysicalDeviceExtendedDynamicStateFeaturesEXT supported{};
+            supported.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
+
+            VkPhysicalDeviceFeatures2 query{};
+            query.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+            query.pNext = &supported;
+            vkGetPhysicalDeviceFeatures2(device.m_PhysicalDevice, &query);
+
+            dynamicState.extendedDynamicState = supported.extendedDynamicState;
+            dynamicState.pNext                = enabledFeatures.pNext;
+            enabledFeatures.pNext             = &dynamicState;
+
+            device.m_DynamicState.extendedDynamicState = supported.extendedDynamicState == VK_TRUE;
+        }
+
+        if (device.m_EnabledExtensions.contains(VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME)) {
+            VkPhysicalDeviceExtendedDynamicState2FeaturesEXT supported{};
+            supported.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT;
+
+            VkPhysicalDeviceFeatures2 query{};
+            query.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+            query.pNext = &supported;
+            vkGetPhysicalDeviceFeatures2(device.m_PhysicalDevice, &query);
+
+            dynamicState2.extendedDynamicState2 = supported.extendedDynamicState2;
+            dynamicState2.pNext                 = enabledFeatures.pNext;
+            enabledFeatures.pNext               = &dynamicState2;
+
+            device.m_DynamicState.extendedDynamicState2 = supported.extendedDynamicState2 == VK_TRUE;
+        }
+
+        if (device.m_EnabledExtensions.contains(VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME)) {
+            VkPhysicalDeviceExtendedDynamicState3FeaturesEXT supported{};
+            supported.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT;
+
+            VkPhysicalDeviceFeatures2 query{};
+            query.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+            query.pNext = &supported;
+            vkGetPhysicalDeviceFeatures2(device.m_PhysicalDevice, &query);
+
+            VkPhysicalDeviceExtendedDynamicState3PropertiesEXT limits{};
+            limits.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_PROPERTIES_EXT;
+
+            VkPhysicalDeviceProperties2 propertiesQuery{};
+            propertiesQuery.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+            propertiesQuery.pNext = &limits;
+            vkGetPhysicalDeviceProperties2(device.m_PhysicalDevice, &propertiesQuery);
+
+            // Non-fill modes need fillModeNonSolid whether they are baked or dynamic.
+            dynamicState3.extendedDynamicState3PolygonMode = supported.extendedDynamicState3PolygonMode &
+                                                             deviceFeatures.fillModeNonSolid;
+            dynamicState3.extendedDynamicState3ColorBlendEnable = supported.extendedDynamicState3ColorBlendEnable &
+                                                                  supported.extendedDynamicState3ColorWriteMask;
+            dynamicState3.extendedDynamicState3ColorWriteMask = dynamicState3.extendedDynamicState3ColorBlendEnable;
+            dynamicState3.pNext                               = enabledFeatures.pNext;
+            enabledFeatures.pNext                             = &dynamicState3;
+
+            device.m_DynamicState.polygonMode = dynamicState3.extendedDynamicState3PolygonMode == VK_TRUE;
+            device.m_DynamicState.colorBlend  = dynamicState3.extendedDynamicState3ColorBlendEnable == VK_TRUE;
+            device.m_DynamicState.unrestrictedTopology = device.m_DynamicState.extendedDynamicState &&
+                                                         limits.dynamicPrimitiveTopologyUnrestricted == VK_TRUE;
+        }
+
+        if (device.m_EnabledExtensions.contains(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME)) {
+            VkPhysicalDeviceDynamicRenderingFeaturesKHR supported{};
+            supported.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR;
+
+            VkPhysicalDeviceFeatures2 query{};
+            query.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+            query.pNext = &supported;
+            vkGetPhysicalDeviceFeatures2(device.m_PhysicalDevice, &query);
+
+            dynamicRendering.dynamicRendering = supported.dynamicRendering;
+            dynamicRendering.pNext            = enabledFeatures.pNext;
+            enabledFeatures.pNext             = &dynamicRendering;
+        }
+
+        // Core in 1.2, where the same feature struct is valid without the extension.
+        if (apiVersion >= VK_API_VERSION_1_2 ||
+            device.m_EnabledExtensions.contains(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME)) {
+            VkPhysicalDeviceTimelineSemaphoreFeatures supported{};
+            supported.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES;
+
+            VkPhysicalDeviceFeatures2 query{};
+            query.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+            query.pNext = &supported;
+            vkGetPhysicalDeviceFeatures2(device.m_PhysicalDevice, &query);
+
+            timelineSemaphore.timelineSemaphore = supported.timelineSemaphore;
+            timelineSemaphore.pNext             = enabledFeatures.pNext;
+            enabledFeatures.pNext               = &timelineSemaphore;
+        }
+
+        if (enabledFeatures.pNext != nullptr) {
+            deviceCreateInfo.pNext            = &enabledFeatures;
+            deviceCreateInfo.pEnabledFeatures = nullptr;
+        }
+
+        deviceCreateInfo.enabledExtensionCount   = static_cast<uint32_t>(extensions.size());
+        deviceCreateInfo.ppEnabledExtensionNames = extensions.data();
 
         if (g_ValidationLayerEnabled) {
             deviceCreateInfo.enabledLayerCount   = static_cast<uint32_t>(g_ValidationLayers.size());
@@ -53,12 +226,45 @@ namespace Pulsar::Vulkan {
         vkGetDeviceQueue(device.m_LogicalDevice, graphicsFamily.value(), 0, &device.m_GraphicsQueue);
         vkGetDeviceQueue(device.m_LogicalDevice, presentFamily.value(), 0, &device.m_PresentQueue);
 
-        std::cout << "[PS] " << "Initialized logical device successfully\n";
+        device.m_GraphicsFamily  = graphicsFamily.value();
+        device.m_PresentFamily   = presentFamily.value();
+        device.m_EnabledFeatures = deviceFeatures;
+        vkGetPhysicalDeviceMemoryProperties(device.m_PhysicalDevice, &device.m_MemoryProperties);
+        device.LoadDynamicStateFunctions();
+        device.m_RenderPassCache = std::make_unique<RenderPassCache>(
+            device.m_LogicalDevice, dynamicRendering.dynamicRendering == VK_TRUE);
+
+        if (timelineSemaphore.timelineSemaphore == VK_TRUE) {
+            device.LoadTimelineFunctions(apiVersion);
+        }
+
+        device.m_GraphicsTimeline = std::make_unique<QueueTimeline>(
+            QueueTimeline::Create(device, device.m_GraphicsQueue));
+
+        if (device.m_PresentQueue != device.m_GraphicsQueue) {
+            device.m_PresentTimeline = std::make_unique<QueueTimeline>(
+                QueueTimeline::Create(device, device.m_PresentQueue));
+        }
+
+        if (!device.IsTimelineSemaphoreSupported()) {
+            Logging::Info(Logging::Category::Vulkan, "Timeline semaphores unsupported, falling back to fences");
+        }
+
+        Logging::Info(Logging::Category::Vulkan, "Initialized logical device successfully");
 
         return device;
     }
 
     Device::~Device() {
+        m_PresentTimeline.reset();
+        m_GraphicsTimeline.reset();
+        m_RenderPassCache.reset();
+
+        if (m_ImmediateCommandPool != nullptr) {
+            vkDestroyCommandPool(m_LogicalDevice, m_ImmediateCommandPool, nullptr);
+            m_ImmediateCommandPool = nullptr;
+        }
+
         if (m_LogicalDevice != nullptr) {
             vkDestroyDevice(m_LogicalDevice, nullptr);
             m_LogicalDevice = nullptr;
@@ -73,6 +279,18 @@ namespace Pulsar::Vulkan {
         return QuerySwapChainSupport(m_PhysicalDevice, *m_Surface);
     }
 
+    SwapChainSupportInfo Device::QuerySwapChainSupport(const Surface &surface) const {
+        return QuerySwapChainSupport(m_PhysicalDevice, surface);
+    }
+
+    bool Device::SupportsPresent(const Surface &surface) const {
+        VkBool32 presentSupport = VK_FALSE;
+        vkGetPhysicalDeviceSurfaceSupportKHR(m_PhysicalDevice, m_PresentFamily, surface.GetVkSurface(),
+                                             &presentSupport);
+
+        return presentSupport == VK_TRUE;
+    }
+
     uint16_t Device::RateDevice() const {
         return RateDevice(m_PhysicalDevice, *m_Surface);
     }
@@ -97,6 +315,146 @@ namespace Pulsar::Vulkan {
         return m_PresentQueue;
     }
 
+    const VkPhysicalDeviceFeatures &Device::GetEnabledFeatures() const {
+        return m_EnabledFeatures;
+    }
+
+    const DynamicStateSupport &Device::GetDynamicStateSupport() const {
+        return m_DynamicState;
+    }
+
+    const DynamicStateFunctions &Device::GetDynamicStateFunctions() const {
+        return m_DynamicStateFuncs;
+    }
+
+    bool Device::IsDynamicRenderingSupported() const {
+        return m_RenderPassCache != nullptr && m_RenderPassCache->IsDynamicRenderingSupported();
+    }
+
+    bool Device::IsTimelineSemaphoreSupported() const {
+        return m_TimelineFuncs.waitSemaphores != nullptr;
+    }
+
+    bool Device::IsFormatSupported(const VkFormat format, const VkFormatFeatureFlags features) const {
+        // The BC formats can report features even when textureCompressionBC was not enabled.
+        if (format >= VK_FORMAT_BC1_RGB_UNORM_BLOCK && format <= VK_FORMAT_BC7_SRGB_BLOCK &&
+            !m_EnabledFeatures.textureCompressionBC) {
+            return false;
+        }
+
+        VkFormatProperties properties;
+        vkGetPhysicalDeviceFormatProperties(m_PhysicalDevice, format, &properties);
+
+        return (properties.optimalTilingFeatures & features) == features;
+    }
+
+    const TimelineFunctions &Device::GetTimelineFunctions() const {
+        return m_TimelineFuncs;
+    }
+
+    uint32_t Device::GetApiVersion() const {
+        return m_ApiVersion;
+    }
+
+    bool Device::IsExtensionEnabled(const std::string &name) const {
+        return m_EnabledExtensions.contains(name);
+    }
+
+    PFN_vkVoidFunction Device::GetProcAddress(const char *name) const {
+        return vkGetDeviceProcAddr(m_LogicalDevice, name);
+    }
+
+    RenderPassCache &Device::GetRenderPassCache() const {
+        return *m_RenderPassCache;
+    }
+
+    QueueTimeline &Device::GetGraphicsTimeline() const {
+        return *m_GraphicsTimeline;
+    }
+
+    QueueTimeline &Device::GetPresentTimeline() const {
+        return m_PresentTimeline != nullptr ? *m_PresentTimeline : *m_GraphicsTimeline;
+    }
+
+    uint32_t Device::GetGraphicsQueueFamily() const {
+        return m_GraphicsFamily;
+    }
+
+    uint32_t Device::GetPresentQueueFamily() const {
+        return m_PresentFamily;
+    }
+
+    uint32_t Device::FindMemoryType(const uint32_t typeFilter, const VkMemoryPropertyFlags properties) const {
+        for (uint32_t i = 0; i < m_MemoryProperties.memoryTypeCount; i++) {
+            if ((typeFilter & (1u << i)) != 0 &&
+                (m_MemoryProperties.memoryTypes[i].propertyFlags & properties) == properties) {
+                return i;
+            }
+        }
+
+        throw std::runtime_error("Failed to find memory type: No suitable memory type");
+    }
+
+    VkMemoryPropertyFlags Device::GetMemoryTypeFlags(const uint32_t memoryType) const {
+        return m_MemoryProperties.memoryTypes[memoryType].propertyFlags;
+    }
+
+    void Device::SubmitImmediate(const std::function<void(VkCommandBuffer)> &record) {
+        if (m_ImmediateCommandPool == nullptr) {
+            VkCommandPoolCreateInfo poolInfo{};
+            poolInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            poolInfo.flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+            poolInfo.queueFamilyIndex = m_GraphicsFamily;
+
+            if (vkCreateCommandPool(m_LogicalDevice, &poolInfo, nullptr, &m_ImmediateCommandPool) != VK_SUCCESS) {
+                throw std::runtime_error("Failed to create command pool: Unknown error");
+            }
+        }
+
+        VkCommandBufferAllocateInfo allocateInfo{};
+        allocateInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocateInfo.commandPool        = m_ImmediateCommandPool;
+        allocateInfo.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocateInfo.commandBufferCount = 1;
+
+        VkCommandBuffer commandBuffer;
+        if (vkAllocateCommandBuffers(m_LogicalDevice, &allocateInfo, &commandBuffer) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to allocate command buffer: Unknown error");
+        }
+
+        // Frees the command buffer on every way out, except while it may still be pending: if the wait fails after
+        // a successful submit, it is left to the pool, which frees it when the device is destroyed.
+        struct CommandBufferGuard {
+            VkDevice        device;
+            VkCommandPool   pool;
+            VkCommandBuffer commandBuffer;
+            bool            pending = false;
+
+            ~CommandBufferGuard() {
+                if (!pending) {
+                    vkFreeCommandBuffers(device, pool, 1, &commandBuffer);
+                }
+            }
+        } guard{m_LogicalDevice, m_ImmediateCommandPool, commandBuffer};
+
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+        vkBeginCommandBuffer(commandBuffer, &beginInfo);
+        record(commandBuffer);
+        vkEndCommandBuffer(commandBuffer);
+
+        QueueSubmitInfo submitInfo{};
+        submitInfo.commandBuffers = std::span(&commandBuffer, 1);
+
+        const uint64_t value = m_GraphicsTimeline->Submit(submitInfo);
+
+        guard.pending = true;
+        m_GraphicsTimeline->Wait(value);
+        guard.pending = false;
+    }
+
     QueueFamilyIndices Device::FindQueueFamilies(const VkPhysicalDevice &device, const Surface &surface) {
         QueueFamilyIndices indices;
 
@@ -133,7 +491,7 @@ namespace Pulsar::Vulkan {
         return indices;
     }
 
-    SwapChainSupportInfo Device::QuerySwapChainSupport(const VkPhysicalDevice &device, Surface &surface) {
+    SwapChainSupportInfo Device::QuerySwapChainSupport(const VkPhysicalDevice &device, const Surface &surface) {
         SwapChainSupportInfo info;
 
         vkGetPhysicalDeviceSurfaceCapabilitiesKHR(device, surface.GetVkSurface(), &info.capabilities);
@@ -158,7 +516,7 @@ namespace Pulsar::Vulkan {
         return info;
     }
 
-    uint16_t Device::RateDevice(const VkPhysicalDevice &device, Surface &surface) {
+    uint16_t Device::RateDevice(const VkPhysicalDevice &device, const Surface &surface) {
         if (!FindQueueFamilies(device, surface).IsValid()) {
             return 0;
         }
@@ -192,13 +550,18 @@ namespace Pulsar::Vulkan {
     }
 
     bool Device::AreDeviceExtensionsSupported(const VkPhysicalDevice &device) {
+        return AreDeviceExtensionsSupported(device, g_DeviceExtensions);
+    }
+
+    bool Device::AreDeviceExtensionsSupported(const VkPhysicalDevice &           device,
+                                              const std::span<const char *const> extensions) {
         uint32_t extensionCount;
         vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, nullptr);
 
         std::vector<VkExtensionProperties> availableExtensions(extensionCount);
         vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, availableExtensions.data());
 
-        std::set<std::string> requiredExtensions(g_DeviceExtensions.begin(), g_DeviceExtensions.end());
+        std::set<std::string> requiredExtensions(extensions.begin(), extensions.end());
 
         for (const auto &[extensionName, specVersion] : availableExtensions) {
             requiredExtensions.erase(extensionName);
@@ -231,4 +594,57 @@ namespace Pulsar::Vulkan {
             throw std::runtime_error("Failed to select physical device: No suitable device found");
         }
     }
+
+    void Device::LoadTimelineFunctions(const uint32_t apiVersion) {
+        const bool core = apiVersion >= VK_API_VERSION_1_2;
+
+        TimelineFunctions functions;
+        functions.waitSemaphores = reinterpret_cast<PFN_vkWaitSemaphoresKHR>(
+            GetProcAddress(core ? "vkWaitSemaphores" : "vkWaitSemaphoresKHR"));
+        functions.getSemaphoreCounterValue = reinterpret_cast<PFN_vkGetSemaphoreCounterValueKHR>(
+            GetProcAddress(core ? "vkGetSemaphoreCounterValue" : "vkGetSemaphoreCounterValueKHR"));
+
+        // Either all or nothing, so IsTimelineSemaphoreSupported can check one of them.
+        if (functions.waitSemaphores != nullptr && functions.getSemaphoreCounterValue != nullptr) {
+            m_TimelineFuncs = functions;
+        }
+    }
+
+    void Device::LoadDynamicStateFunctions() {
+        DynamicStateFunctions &functions = m_DynamicStateFuncs;
+
+        if (m_DynamicState.extendedDynamicState) {
+            functions.setCullMode = reinterpret_cast<PFN_vkCmdSetCullModeEXT>(
+                GetProcAddress("vkCmdSetCullModeEXT"));
+            functions.setFrontFace = reinterpret_cast<PFN_vkCmdSetFrontFaceEXT>(
+                GetProcAddress("vkCmdSetFrontFaceEXT"));
+            functions.setPrimitiveTopology = reinterpret_cast<PFN_vkCmdSetPrimitiveTopologyEXT>(
+                GetProcAddress("vkCmdSetPrimitiveTopologyEXT"));
+            functions.setDepthTestEnable = reinterpret_cast<PFN_vkCmdSetDepthTestEnableEXT>(
+                GetProcAddress("vkCmdSetDepthTestEnableEXT"));
+            functions.setDepthWriteEnable = reinterpret_cast<PFN_vkCmdSetDepthWriteEnableEXT>(
+                GetProcAddress("vkCmdSetDepthWriteEnableEXT"));
+            functions.setDepthCompareOp = reinterpret_cast<PFN_vkCmdSetDepthCompareOpEXT>(
+                GetProcAddress("vkCmdSetDepthCompareOpEXT"));
+        }
+
+        if (m_DynamicState.extendedDynamicState2) {
+            functions.setDepthBiasEnable = reinterpret_cast<PFN_vkCmdSetDepthBiasEnableEXT>(
+                GetProcAddress("vkCmdSetDepthBiasEnableEXT"));
+            functions.setPrimitiveRestartEnable = reinterpret_cast<PFN_vkCmdSetPrimitiveRestartEnableEXT>(
+                GetProcAddress("vkCmdSetPrimitiveRestartEnableEXT"));
+        }
+
+        if (m_DynamicState.polygonMode) {
+            functions.setPolygonMode = reinterpret_cast<PFN_vkCmdSetPolygonModeEXT>(
+                GetProcAddress("vkCmdSetPolygonModeEXT"));
+        }
+
+        if (m_DynamicState.colorBlend) {
+            functions.setColorBlendEnable = reinterpret_cast<PFN_vkCmdSetColorBlendEnableEXT>(
+                GetProcAddress("vkCmdSetColorBlendEnableEXT"));
+            functions.setColorWriteMask = reinterpret_cast<PFN_vkCmdSetColorWriteMaskEXT>(
+                GetProcAddress("vkCmdSetColorWriteMaskEXT"));
+        }
+    }
 }
\ No newline at end of file
@@ -2,7 +2,9 @@
 #define PULSAR_DEVICE_HPP
 
 #include "Instance.hpp"
+#include "RenderPassCache.hpp"
 #include "Surface.hpp"
+#include "Timeline.hpp"
 
 namespace Pulsar::Vulkan {
     struct QueueFamilyIndices {
@@ -20,6 +22,32 @@ namespace Pulsar::Vulkan {
         std::vector<VkPresentModeKHR>   presentModes{};
     };
 
+    // Pipeline state beyond viewport and scissor that pipelines on this device can leave dynamic.
+    struct DynamicStateSupport {
+        bool extendedDynamicState  = false; // Cull mode, front face, topology, depth test/write/compare.
+        bool extendedDynamicState2 = false; // Depth bias enable, primitive restart enable.
+        bool polygonMode           = false;
+        bool colorBlend            = false; // Blend enable and color write mask.
+        bool unrestrictedTopology  = false; // Dynamic topology may change topology class, not just the topology.
+    };
+
+    // Null where the matching DynamicStateSupport flag is false.
+    struct DynamicStateFunctions {
+        PFN_vkCmdSetCullModeEXT               setCullMode               = nullptr;
+        PFN_vkCmdSetFrontFaceEXT              setFrontFace              = nullptr;
+        PFN_vkCmdSetPrimitiveTopologyEXT      setPrimitiveTopology      = nullptr;
+        PFN_vkCmdSetDepthTestEnableEXT        setDepthTestEnable        = nullptr;
+        PFN_vkCmdSetDepthWriteEnableEXT       setDepthWriteEnable       = nullptr;
+        PFN_vkCmdSetDepthCompareOpEXT         setDepthCompareOp         = nullptr;
+        PFN_vkCmdSetDepthBiasEnableEXT        setDepthBiasEnable        = nullptr;
+        PFN_vkCmdSetPrimitiveRestartEnableEXT setPrimitiveRestartEnable = nullptr;
+        PFN_vkCmdSetPolygonModeEXT            setPolygonMode            = nullptr;
+        PFN_vkCmdSetColorBlendEnableEXT       setColorBlendEnable       = nullptr;
+        PFN_vkCmdSetColorWriteMaskEXT         setColorWriteMask         = nullptr;
+    };
+
+    // The device is picked against one surface, but any number of surfaces can present through it as long as
+    // SupportsPresent holds for them.
     class Device {
     public:
         static Device Create(Instance &instance, Surface &surface);
@@ -27,9 +55,11 @@ namespace Pulsar::Vulkan {
         [[nodiscard]] static QueueFamilyIndices FindQueueFamilies(const VkPhysicalDevice &device,
                                                                   const Surface &         surface);
         [[nodiscard]] static SwapChainSupportInfo QuerySwapChainSupport(const VkPhysicalDevice &device,
-                                                                        Surface &               surface);
-        [[nodiscard]] static uint16_t RateDevice(const VkPhysicalDevice &device, Surface &surface);
+                                                                        const Surface &         surface);
+        [[nodiscard]] static uint16_t RateDevice(const VkPhysicalDevice &device, const Surface &surface);
         [[nodiscard]] static bool     AreDeviceExtensionsSupported(const VkPhysicalDevice &device);
+        [[nodiscard]] static bool     AreDeviceExtensionsSupported(const VkPhysicalDevice &       device,
+                                                                   std::span<const char *const> extensions);
 
         ~Device();
 
@@ -41,6 +71,8 @@ namespace Pulsar::Vulkan {
 
         [[nodiscard]] QueueFamilyIndices   FindQueueFamilies() const;
         [[nodiscard]] SwapChainSupportInfo QuerySwapChainSupport() const;
+        [[nodiscard]] SwapChainSupportInfo QuerySwapChainSupport(const Surface &surface) const;
+        [[nodiscard]] bool                 SupportsPresent(const Surface &surface) const;
         [[nodiscard]] uint16_t             RateDevice() const;
         [[nodiscard]] bool                 AreDeviceExtensionsSupported() const;
 
@@ -48,18 +80,63 @@ namespace Pulsar::Vulkan {
         [[nodiscard]] VkDevice         GetVkLogicalDevice() const;
         [[nodiscard]] VkQueue          GetVkGraphicsQueue() const;
         [[nodiscard]] VkQueue          GetVkPresentQueue() const;
+        [[nodiscard]] uint32_t         GetGraphicsQueueFamily() const;
+        [[nodiscard]] uint32_t         GetPresentQueueFamily() const;
+
+        [[nodiscard]] const VkPhysicalDeviceFeatures &GetEnabledFeatures() const;
+        [[nodiscard]] const DynamicStateSupport &     GetDynamicStateSupport() const;
+        [[nodiscard]] const DynamicStateFunctions &   GetDynamicStateFunctions() const;
+        [[nodiscard]] bool                            IsDynamicRenderingSupported() const;
+        [[nodiscard]] bool                            IsTimelineSemaphoreSupported() const;
+        [[nodiscard]] const TimelineFunctions &       GetTimelineFunctions() const;
+        [[nodiscard]] uint32_t                        GetApiVersion() const; // Lower of instance and device.
+        [[nodiscard]] bool                            IsExtensionEnabled(const std::string &name) const;
+        [[nodiscard]] PFN_vkVoidFunction              GetProcAddress(const char *name) const;
+
+        // With optimal tiling. Block-compressed formats also need textureCompressionBC enabled.
+        [[nodiscard]] bool IsFormatSupported(VkFormat format, VkFormatFeatureFlags features) const;
+
+        // Shared by everything rendering on this device; views evict themselves from it when destroyed.
+        [[nodiscard]] RenderPassCache &GetRenderPassCache() const;
+
+        // Every submission to a queue should go through its timeline, so one value orders all work on it. The
+        // present timeline is the graphics one when both families share a queue.
+        [[nodiscard]] QueueTimeline &GetGraphicsTimeline() const;
+        [[nodiscard]] QueueTimeline &GetPresentTimeline() const;
+
+        [[nodiscard]] uint32_t              FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) const;
+        [[nodiscard]] VkMemoryPropertyFlags GetMemoryTypeFlags(uint32_t memoryType) const;
+
+        // Records and submits a one-off command buffer on the graphics timeline and waits for it to finish. Work
+        // submitted before it is not waited for.
+        void SubmitImmediate(const std::function<void(VkCommandBuffer)> &record);
 
     private:
-        VkPhysicalDevice m_PhysicalDevice = nullptr;
-        VkDevice         m_LogicalDevice  = nullptr;
-        VkQueue          m_GraphicsQueue  = nullptr;
-        VkQueue          m_PresentQueue   = nullptr;
-        Instance *       m_Instance       = nullptr;
-        Surface *        m_Surface        = nullptr;
+        VkPhysicalDevice                 m_PhysicalDevice       = nullptr;
+        VkDevice                         m_LogicalDevice        = nullptr;
+        VkQueue                          m_GraphicsQueue        = nullptr;
+        VkQueue                          m_PresentQueue         = nullptr;
+        uint32_t                         m_GraphicsFamily       = 0;
+        uint32_t                         m_PresentFamily        = 0;
+        VkPhysicalDeviceMemoryProperties m_MemoryProperties     = {};
+        uint32_t                         m_ApiVersion           = VK_API_VERSION_1_0;
+        VkPhysicalDeviceFeatures         m_EnabledFeatures      = {};
+        DynamicStateSupport              m_DynamicState         = {};
+        DynamicStateFunctions            m_DynamicStateFuncs    = {};
+        TimelineFunctions                m_TimelineFuncs        = {};
+        std::set<std::string>            m_EnabledExtensions    = {};
+        std::unique_ptr<RenderPassCache> m_RenderPassCache      = nullptr;
+        std::unique_ptr<QueueTimeline>   m_GraphicsTimeline     = nullptr;
+        std::unique_ptr<QueueTimeline>   m_PresentTimeline      = nullptr;
+        VkCommandPool                    m_ImmediateCommandPool = nullptr;
+        Instance *                       m_Instance             = nullptr;
+        Surface *                        m_Surface              = nullptr;
 
         Device() = default;
 
         void SelectPhysicalDevice();
+        void LoadDynamicStateFunctions();
+        void LoadTimelineFunctions(uint32_t apiVersion);
     };
 }
 
@@ -0,0 +1,198 @@
+#include "DynamicStateRecorder.hpp"
+
+namespace Pulsar::Vulkan {
+    DynamicStateRecorder::DynamicStateRecorder(const Device &device, const VkCommandBuffer commandBuffer)
+        : m_Functions(&device.GetDynamicStateFunctions()), m_CommandBuffer(commandBuffer) {
+    }
+
+    void DynamicStateRecorder::Reset(const VkCommandBuffer commandBuffer) {
+        m_CommandBuffer = commandBuffer;
+        m_Pipeline      = nullptr;
+        m_Dynamic       = {};
+        m_Statistics    = {};
+
+        m_Viewport.reset();
+        m_Scissor.reset();
+        m_Cull.reset();
+        m_Topology.reset();
+        m_Depth.reset();
+        m_DepthBias.reset();
+        m_PrimitiveRestart.reset();
+        m_PolygonMode.reset();
+        m_ColorBlend.reset();
+    }
+
+    void DynamicStateRecorder::BindPipeline(const Pipeline &pipeline) {
+        if (pipeline.GetVkPipeline() == m_Pipeline) {
+            return;
+        }
+
+        pipeline.Bind(m_CommandBuffer);
+        m_Pipeline = pipeline.GetVkPipeline();
+        m_Dynamic  = pipeline.GetDynamicState();
+        m_Statistics.pipelineBinds++;
+
+        // Binding a pipeline that bakes a piece of state leaves the dynamic value undefined afterwards.
+        if (!m_Dynamic.viewport) {
+            m_Viewport.reset();
+            m_Scissor.reset();
+        }
+
+        if (!m_Dynamic.cullMode) {
+            m_Cull.reset();
+        }
+
+        if (!m_Dynamic.topology) {
+            m_Topology.reset();
+        }
+
+        if (!m_Dynamic.depth) {
+            m_Depth.reset();
+        }
+
+        if (!m_Dynamic.depthBias) {
+            m_DepthBias.reset();
+        }
+
+        if (!m_Dynamic.primitiveRestart) {
+            m_PrimitiveRestart.reset();
+        }
+
+        if (!m_Dynamic.polygonMode) {
+            m_PolygonMode.reset();
+        }
+
+        if (!m_Dynamic.colorBlend) {
+            m_ColorBlend.reset();
+        }
+    }
+
+    void DynamicStateRecorder::SetViewport(const VkViewport &viewport) {
+        const bool changed = !m_Viewport.has_value() || std::memcmp(&*m_Viewport, &viewport, sizeof(viewport)) != 0;
+        if (!Update(m_Dynamic.viewport, changed)) {
+            return;
+        }
+
+        vkCmdSetViewport(m_CommandBuffer, 0, 1, &viewport);
+        m_Viewport = viewport;
+    }
+
+    void DynamicStateRecorder::SetScissor(const VkRect2D &scissor) {
+        const bool changed = !m_Scissor.has_value() || std::memcmp(&*m_Scissor, &scissor, sizeof(scissor)) != 0;
+        if (!Update(m_Dynamic.viewport, changed)) {
+            return;
+        }
+
+        vkCmdSetScissor(m_CommandBuffer, 0, 1, &scissor);
+        m_Scissor = scissor;
+    }
+
+    void DynamicStateRecorder::SetExtent(const VkExtent2D extent) {
+        VkViewport viewport{};
+        viewport.width    = static_cast<float>(extent.width);
+        viewport.height   = static_cast<float>(extent.height);
+        viewport.minDepth = 0.0F;
+        viewport.maxDepth = 1.0F;
+
+        VkRect2D scissor{};
+        scissor.extent = extent;
+
+        SetViewport(viewport);
+        SetScissor(scissor);
+    }
+
+    void DynamicStateRecorder::SetCullMode(const VkCullModeFlags cullMode, const VkFrontFace frontFace) {
+        const bool changed = !m_Cull.has_value() || m_Cull->cullMode != cullMode || m_Cull->frontFace != frontFace;
+        if (!Update(m_Dynamic.cullMode, changed)) {
+            return;
+        }
+
+        m_Functions->setCullMode(m_CommandBuffer, cullMode);
+        m_Functions->setFrontFace(m_CommandBuffer, frontFace);
+        m_Cull = CullState{cullMode, frontFace};
+    }
+
+    void DynamicStateRecorder::SetPrimitiveTopology(const VkPrimitiveTopology topology) {
+        if (!Update(m_Dynamic.topology, m_Topology != topology)) {
+            return;
+        }
+
+        m_Functions->setPrimitiveTopology(m_CommandBuffer, topology);
+        m_Topology = topology;
+    }
+
+    void DynamicStateRecorder::SetDepth(const bool test, const bool write, const VkCompareOp compareOp) {
+        const bool changed = !m_Depth.has_value() || m_Depth->test != test || m_Depth->write != write ||
+                             m_Depth->compareOp != compareOp;
+        if (!Update(m_Dynamic.depth, changed)) {
+            return;
+        }
+
+        m_Functions->setDepthTestEnable(m_CommandBuffer, test ? VK_TRUE : VK_FALSE);
+        m_Functions->setDepthWriteEnable(m_CommandBuffer, write ? VK_TRUE : VK_FALSE);
+        m_Functions->setDepthCompareOp(m_CommandBuffer, compareOp);
+        m_Depth = DepthState{test, write, compareOp};
+    }
+
+    void DynamicStateRecorder::SetDepthBias(const bool enable, const float constantFactor, const float slopeFactor) {
+        const bool changed = !m_DepthBias.has_value() || m_DepthBias->enable != enable ||
+                             m_DepthBias->constantFactor != constantFactor || m_DepthBias->slopeFactor != slopeFactor;
+        if (!Update(m_Dynamic.depthBias, changed)) {
+            return;
+        }
+
+        m_Functions->setDepthBiasEnable(m_CommandBuffer, enable ? VK_TRUE : VK_FALSE);
+        vkCmdSetDepthBias(m_CommandBuffer, constantFactor, 0.0F, slopeFactor);
+        m_DepthBias = DepthBiasState{enable, constantFactor, slopeFactor};
+    }
+
+    void DynamicStateRecorder::SetPrimitiveRestart(const bool enable) {
+        if (!Update(m_Dynamic.primitiveRestart, m_PrimitiveRestart != enable)) {
+            return;
+        }
+
+        m_Functions->setPrimitiveRestartEnable(m_CommandBuffer, enable ? VK_TRUE : VK_FALSE);
+        m_PrimitiveRestart = enable;
+    }
+
+    void DynamicStateRecorder::SetPolygonMode(const VkPolygonMode polygonMode) {
+        if (!Update(m_Dynamic.polygonMode, m_PolygonMode != polygonMode)) {
+            return;
+        }
+
+        m_Functions->setPolygonMode(m_CommandBuffer, polygonMode);
+        m_PolygonMode = polygonMode;
+    }
+
+    void DynamicStateRecorder::SetColorBlend(const bool enable, const VkColorComponentFlags writeMask) {
+        const bool changed = !m_ColorBlend.has_value() || m_ColorBlend->enable != enable ||
+                             m_ColorBlend->writeMask != writeMask;
+        if (!Update(m_Dynamic.colorBlend, changed)) {
+            return;
+        }
+
+        const VkBool32 blendEnable = enable ? VK_TRUE : VK_FALSE;
+        m_Functions->setColorBlendEnable(m_CommandBuffer, 0, 1, &blendEnable);
+        m_Functions->setColorWriteMask(m_CommandBuffer, 0, 1, &writeMask);
+        m_ColorBlend = ColorBlendState{enable, writeMask};
+    }
+
+    const DynamicStateStatistics &DynamicStateRecorder::GetStatistics() const {
+        return m_Statistics;
+    }
+
+    bool DynamicStateRecorder::Update(const bool dynamic, const bool changed) {
+        if (!dynamic) {
+            m_Statistics.bakedCalls++;
+            return false;
+        }
+
+        if (!changed) {
+            m_Statistics.skippedCalls++;
+            return false;
+        }
+
+        m_Statistics.stateCalls++;
+        return true;
+    }
+}
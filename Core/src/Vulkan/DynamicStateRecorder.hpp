@@ -0,0 +1,89 @@
+#ifndef PULSAR_DYNAMICSTATERECORDER_HPP
+#define PULSAR_DYNAMICSTATERECORDER_HPP
+
+#include "Pipeline.hpp"
+
+namespace Pulsar::Vulkan {
+    struct DynamicStateStatistics {
+        uint32_t pipelineBinds = 0;
+        uint32_t stateCalls    = 0;
+        uint32_t skippedCalls  = 0; // Redundant: the value is already set.
+        uint32_t bakedCalls    = 0; // Ignored: the bound pipeline does not declare the state dynamic.
+    };
+
+    // Binds pipelines and sets their dynamic state in one command buffer, skipping calls that would not change
+    // anything. Calls for state the bound pipeline bakes are ignored without a diagnostic: the baked value applies
+    // and only DynamicStateStatistics::bakedCalls counts them. On devices where PipelineConfig::dynamicState fell
+    // back to baked state, each combination therefore needs its own pipeline. Use one recorder per command buffer,
+    // on one thread.
+    class DynamicStateRecorder {
+    public:
+        DynamicStateRecorder(const Device &device, VkCommandBuffer commandBuffer);
+
+        // Starts over on another command buffer, forgetting everything recorded so far.
+        void Reset(VkCommandBuffer commandBuffer);
+
+        void BindPipeline(const Pipeline &pipeline);
+
+        void SetViewport(const VkViewport &viewport);
+        void SetScissor(const VkRect2D &scissor);
+
+        // A viewport and scissor covering extent, with depth from 0 to 1.
+        void SetExtent(VkExtent2D extent);
+
+        void SetCullMode(VkCullModeFlags cullMode, VkFrontFace frontFace);
+        void SetPrimitiveTopology(VkPrimitiveTopology topology);
+        void SetDepth(bool test, bool write, VkCompareOp compareOp);
+        void SetDepthBias(bool enable, float constantFactor = 0.0F, float slopeFactor = 0.0F);
+        void SetPrimitiveRestart(bool enable);
+        void SetPolygonMode(VkPolygonMode polygonMode);
+        void SetColorBlend(bool enable, VkColorComponentFlags writeMask);
+
+        [[nodiscard]] const DynamicStateStatistics &GetStatistics() const;
+
+    private:
+        struct CullState {
+            VkCullModeFlags cullMode;
+            VkFrontFace     frontFace;
+        };
+
+        struct DepthState {
+            bool        test;
+            bool        write;
+            VkCompareOp compareOp;
+        };
+
+        struct DepthBiasState {
+            bool  enable;
+            float constantFactor;
+            float slopeFactor;
+        };
+
+        struct ColorBlendState {
+            bool                  enable;
+            VkColorComponentFlags writeMask;
+        };
+
+        const DynamicStateFunctions *m_Functions     = nullptr;
+        VkCommandBuffer              m_CommandBuffer = nullptr;
+        VkPipeline                   m_Pipeline      = nullptr;
+        PipelineDynamicState         m_Dynamic       = {};
+        DynamicStateStatistics       m_Statistics    = {};
+
+        // Empty when unknown: nothing set yet in this command buffer, or the last bound pipeline baked it.
+        std::optional<VkViewport>          m_Viewport;
+        std::optional<VkRect2D>            m_Scissor;
+        std::optional<CullState>           m_Cull;
+        std::optional<VkPrimitiveTopology> m_Topology;
+        std::optional<DepthState>          m_Depth;
+        std::optional<DepthBiasState>      m_DepthBias;
+        std::optional<bool>                m_PrimitiveRestart;
+        std::optional<VkPolygonMode>       m_PolygonMode;
+        std::optional<ColorBlendState>     m_ColorBlend;
+
+        // Counts the call and returns whether it needs recording.
+        bool Update(bool dynamic, bool changed);
+    };
+}
+
+#endif //PULSAR_DYNAMICSTATERECORDER_HPP
@@ -0,0 +1,169 @@
+#include "Image.hpp"
+
+namespace Pulsar::Vulkan {
+    Image Image::Create(Device &device, const ImageConfig &config) {
+        Image image;
+        image.m_Device    = &device;
+        image.m_Extent    = config.extent;
+        image.m_Format    = config.format;
+        image.m_MipLevels = config.mipLevels;
+
+        VkImageCreateInfo createInfo{};
+        createInfo.sType         = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        createInfo.imageType     = VK_IMAGE_TYPE_2D;
+        createInfo.format        = config.format;
+        createInfo.extent        = {config.extent.width, config.extent.height, 1};
+        createInfo.mipLevels     = config.mipLevels;
+        createInfo.arrayLayers   = 1;
+        createInfo.samples       = VK_SAMPLE_COUNT_1_BIT;
+        createInfo.tiling        = VK_IMAGE_TILING_OPTIMAL;
+        createInfo.usage         = config.usage;
+        createInfo.sharingMode   = VK_SHARING_MODE_EXCLUSIVE;
+        createInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+        if (vkCreateImage(device.GetVkLogicalDevice(), &createInfo, nullptr, &image.m_Image) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create image: Unknown error");
+        }
+
+        VkMemoryRequirements requirements;
+        vkGetImageMemoryRequirements(device.GetVkLogicalDevice(), image.m_Image, &requirements);
+
+        VkMemoryAllocateInfo allocateInfo{};
+        allocateInfo.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocateInfo.allocationSize  = requirements.size;
+        allocateInfo.memoryTypeIndex = device.FindMemoryType(requirements.memoryTypeBits,
+                                                             VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+        if (vkAllocateMemory(device.GetVkLogicalDevice(), &allocateInfo, nullptr, &image.m_Memory) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to allocate image memory: Out of memory");
+        }
+
+        vkBindImageMemory(device.GetVkLogicalDevice(), image.m_Image, image.m_Memory, 0);
+
+        image.m_View = image.CreateView(config.aspectMask, 0, config.mipLevels);
+
+        if (config.mipViews) {
+            for (uint32_t level = 0; level < config.mipLevels; level++) {
+                image.m_MipViews.push_back(image.CreateView(config.aspectMask, level, 1));
+            }
+        }
+
+        return image;
+    }
+
+    Image::~Image() {
+        Destroy();
+    }
+
+    Image::Image(Image &&other) noexcept
+        : m_Image(std::exchange(other.m_Image, nullptr)),
+          m_Memory(std::exchange(other.m_Memory, nullptr)),
+          m_View(std::exchange(other.m_View, nullptr)),
+          m_MipViews(std::move(other.m_MipViews)),
+          m_Extent(other.m_Extent),
+          m_Format(other.m_Format),
+          m_MipLevels(other.m_MipLevels),
+          m_Device(other.m_Device) {
+        other.m_MipViews.clear();
+    }
+
+    Image &Image::operator=(Image &&other) noexcept {
+        if (this != &other) {
+            Destroy();
+
+            m_Image     = std::exchange(other.m_Image, nullptr);
+            m_Memory    = std::exchange(other.m_Memory, nullptr);
+            m_View      = std::exchange(other.m_View, nullptr);
+            m_MipViews  = std::move(other.m_MipViews);
+            m_Extent    = other.m_Extent;
+            m_Format    = other.m_Format;
+            m_MipLevels = other.m_MipLevels;
+            m_Device    = other.m_Device;
+
+            other.m_MipViews.clear();
+        }
+
+        return *this;
+    }
+
+    VkImage Image::GetVkImage() const {
+        return m_Image;
+    }
+
+    VkImageView Image::GetVkImageView() const {
+        return m_View;
+    }
+
+    VkImageView Image::GetVkMipView(const uint32_t level) const {
+        return m_MipViews.at(level);
+    }
+
+    VkExtent2D Image::GetExtent() const {
+        return m_Extent;
+    }
+
+    VkExtent2D Image::GetMipExtent(const uint32_t level) const {
+        return {std::max(m_Extent.width >> level, 1U), std::max(m_Extent.height >> level, 1U)};
+    }
+
+    VkFormat Image::GetFormat() const {
+        return m_Format;
+    }
+
+    uint32_t Image::GetMipLevels() const {
+        return m_MipLevels;
+    }
+
+    void Image::Destroy() {
+        if (m_Device == nullptr) {
+            return;
+        }
+
+        RenderPassCache &renderPassCache = m_Device->GetRenderPassCache();
+
+        for (const VkImageView view : m_MipViews) {
+            renderPassCache.EvictImageView(view);
+            vkDestroyImageView(m_Device->GetVkLogicalDevice(), view, nullptr);
+        }
+
+        m_MipViews.clear();
+
+        if (m_View != nullptr) {
+            renderPassCache.EvictImageView(m_View);
+            vkDestroyImageView(m_Device->GetVkLogicalDevice(), m_View, nullptr);
+            m_View = nullptr;
+        }
+
+        if (m_Image != nullptr) {
+            vkDestroyImage(m_Device->GetVkLogicalDevice(), m_Image, nullptr);
+            m_Image = nullptr;
+        }
+
+        if (m_Memory != nullptr) {
+            vkFreeMemory(m_Device->GetVkLogicalDevice(), m_Memory, nullptr);
+            m_Memory = nullptr;
+        }
+    }
+
+    VkImageView Image::CreateView(const VkImageAspectFlags aspectMask, const uint32_t baseLevel,
+                                  const uint32_t levelCount) const {
+        VkImageViewCreateInfo createInfo{};
+        createInfo.sType    = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        createInfo.image    = m_Image;
+        createInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        createInfo.format   = m_Format;
+
+        createInfo.subresourceRange.aspectMask     = aspectMask;
+        createInfo.subresourceRange.baseMipLevel   = baseLevel;
+        createInfo.subresourceRange.levelCount     = levelCount;
+        createInfo.subresourceRange.baseArrayLayer = 0;
+        createInfo.subresourceRange.layerCount     = 1;
+
+        VkImageView view;
+        if (vkCreateImageView(m_Device->GetVkLogicalDevice(), &createInfo, nullptr, &view) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create image view: Unknown error");
+        }
+
+        return view;
+    }
+}
@@ -0,0 +1,56 @@
+#ifndef PULSAR_VULKAN_IMAGE_HPP
+#define PULSAR_VULKAN_IMAGE_HPP
+
+#include "Device.hpp"
+
+namespace Pulsar::Vulkan {
+    struct ImageConfig {
+        VkExtent2D         extent     = {1, 1};
+        VkFormat           format     = VK_FORMAT_R8G8B8A8_UNORM;
+        uint32_t           mipLevels  = 1;
+        VkImageUsageFlags  usage      = VK_IMAGE_USAGE_SAMPLED_BIT;
+        VkImageAspectFlags aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+
+        // Also create one view per mip level, e.g. for storage writes into individual levels.
+        bool mipViews = false;
+    };
+
+    class Image {
+    public:
+        static Image Create(Device &device, const ImageConfig &config);
+        ~Image();
+
+        Image(const Image &other) = delete;
+        Image(Image &&other) noexcept;
+
+        Image &operator=(const Image &other) = delete;
+        Image &operator=(Image &&other) noexcept;
+
+        [[nodiscard]] VkImage     GetVkImage() const;
+        [[nodiscard]] VkImageView GetVkImageView() const;
+        [[nodiscard]] VkImageView GetVkMipView(uint32_t level) const;
+        [[nodiscard]] VkExtent2D  GetExtent() const;
+        [[nodiscard]] VkExtent2D  GetMipExtent(uint32_t level) const;
+        [[nodiscard]] VkFormat    GetFormat() const;
+        [[nodiscard]] uint32_t    GetMipLevels() const;
+
+    private:
+        VkImage                  m_Image     = nullptr;
+        VkDeviceMemory           m_Memory    = nullptr;
+        VkImageView              m_View      = nullptr;
+        std::vector<VkImageView> m_MipViews;
+        VkExtent2D               m_Extent    = {};
+        VkFormat                 m_Format    = VK_FORMAT_UNDEFINED;
+        uint32_t                 m_MipLevels = 0;
+        Device *                 m_Device    = nullptr;
+
+        Image() = default;
+
+        void Destroy();
+
+        [[nodiscard]] VkImageView CreateView(VkImageAspectFlags aspectMask, uint32_t baseLevel,
+                                             uint32_t levelCount) const;
+    };
+}
+
+#endif //PULSAR_VULKAN_IMAGE_HPP
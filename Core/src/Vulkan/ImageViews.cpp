@@ -36,13 +36,14 @@ namespace Pulsar::Vulkan {
 
     ImageViews::~ImageViews() {
         for (const auto &imageView : m_SwapChainImageViews) {
+            m_Device->GetRenderPassCache().EvictImageView(imageView);
             vkDestroyImageView(m_Device->GetVkLogicalDevice(), imageView, nullptr);
         }
 
         m_SwapChainImageViews.clear();
     }
 
-    std::vector<VkImageView> ImageViews::GetVkImageViews() const {
+    std::span<const VkImageView> ImageViews::GetVkImageViews() const {
         return m_SwapChainImageViews;
     }
 }
\ No newline at end of file
@@ -16,7 +16,7 @@ namespace Pulsar::Vulkan {
         ImageViews &operator=(const ImageViews &other)     = delete;
         ImageViews &operator=(ImageViews &&other) noexcept = default;
 
-        [[nodiscard]] std::vector<VkImageView> GetVkImageViews() const;
+        [[nodiscard]] std::span<const VkImageView> GetVkImageViews() const;
 
     private:
         std::vector<VkImageView> m_SwapChainImageViews;
@@ -3,24 +3,23 @@
 #include "Common.hpp"
 #include "Extensions.hpp"
 #include "Glfw/Window.hpp"
+#include "Logging/Log.hpp"
 
 namespace Pulsar::Vulkan {
     Instance Instance::Create(const ApplicationInfo &info) {
 #ifndef NDEBUG
-        uint32_t extensionCount;
-        vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount, nullptr);
-        auto *extensions = static_cast<VkExtensionProperties *>(malloc(extensionCount * sizeof(VkExtensionProperties)));
-        vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount, extensions);
-
-        std::cout << extensionCount << " extensions supported\n";
-        std::cout << "=======================\n";
-        for (uint32_t i = 0; i < extensionCount; i++) {
-            std::cout << extensions[i].extensionName << '\n';
-        }
+        if (Logging::IsEnabled(Logging::Category::Vulkan, Logging::Severity::Debug)) {
+            uint32_t extensionCount;
+            vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount, nullptr);
 
-        std::cout << "=======================\n";
+            std::vector<VkExtensionProperties> extensions(extensionCount);
+            vkEnumerateInstanceExtensionProperties(nullptr, &extensionCount, extensions.data());
 
-        free(extensions);
+            Logging::Debug(Logging::Category::Vulkan, "{} instance extensions supported", extensionCount);
+            for (const VkExtensionProperties &extension : extensions) {
+                Logging::Debug(Logging::Category::Vulkan, "  {}", extension.extensionName);
+            }
+        }
 #endif
 
         VkApplicationInfo appInfo{};
@@ -31,6 +30,11 @@ namespace Pulsar::Vulkan {
         appInfo.engineVersion = VK_MAKE_VERSION(g_EngineVersion.major, g_EngineVersion.minor, g_EngineVersion.hotfix);
         appInfo.apiVersion = g_VulkanVersion;
 
+        // A 1.0 loader has no vkEnumerateInstanceVersion and rejects any other version.
+        if (vkGetInstanceProcAddr(nullptr, "vkEnumerateInstanceVersion") == nullptr) {
+            appInfo.apiVersion = VK_API_VERSION_1_0;
+        }
+
         VkInstanceCreateInfo createInfo{};
         createInfo.sType            = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
         createInfo.pApplicationInfo = &appInfo;
@@ -74,15 +78,12 @@ namespace Pulsar::Vulkan {
             throw std::runtime_error("Failed to create Vulkan instance: Unknown error");
         }
 
+        instance.m_ApiVersion = appInfo.apiVersion;
         instance.InitDebugMessenger();
 
         return instance;
     }
 
-    void Instance::SetMessageCallback(const std::function<void(std::string)> &callback) {
-        s_MessageCallback = callback;
-    }
-
     Instance::~Instance() {
         if (m_Instance != nullptr) {
             DeinitDebugMessenger();
@@ -92,6 +93,7 @@ namespace Pulsar::Vulkan {
 
     Instance::Instance(Instance &&other) noexcept {
         m_Instance       = other.m_Instance;
+        m_ApiVersion     = other.m_ApiVersion;
         other.m_Instance = nullptr;
     }
 
@@ -101,6 +103,7 @@ namespace Pulsar::Vulkan {
         }
 
         m_Instance       = other.m_Instance;
+        m_ApiVersion     = other.m_ApiVersion;
         other.m_Instance = nullptr;
 
         return *this;
@@ -110,14 +113,25 @@ namespace Pulsar::Vulkan {
         return m_Instance;
     }
 
+    uint32_t Instance::GetApiVersion() const {
+        return m_ApiVersion;
+    }
+
     VkBool32 Instance::debugCallback(VkDebugUtilsMessageSeverityFlagBitsEXT      messageSeverity,
                                      VkDebugUtilsMessageTypeFlagsEXT             messageType,
                                      const VkDebugUtilsMessengerCallbackDataEXT *pCallbackData,
                                      void *                                      pUserData) {
-        if (s_MessageCallback) {
-            s_MessageCallback.value()(pCallbackData->pMessage);
+        constexpr Logging::Category category = Logging::Category::Validation;
+        const char *                message  = pCallbackData->pMessage;
+
+        if (messageSeverity >= VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) {
+            Logging::Error(category, "{}", message);
+        } else if (messageSeverity >= VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) {
+            Logging::Warning(category, "{}", message);
+        } else if (messageSeverity >= VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT) {
+            Logging::Debug(category, "{}", message);
         } else {
-            std::cout << "[VK] " << pCallbackData->pMessage << '\n';
+            Logging::Trace(category, "{}", message);
         }
 
         return VK_FALSE;
@@ -14,7 +14,6 @@ namespace Pulsar::Vulkan {
     class Instance {
     public:
         static Instance Create(const ApplicationInfo &info = {});
-        static void     SetMessageCallback(const std::function<void(std::string)> &callback);
 
         ~Instance();
 
@@ -26,11 +25,14 @@ namespace Pulsar::Vulkan {
 
         [[nodiscard]] VkInstance GetVkInstance() const;
 
-    private:
-        inline static std::optional<std::function<void(std::string)>> s_MessageCallback = std::nullopt;
+        // The version the instance was created with: g_VulkanVersion, or 1.0 on loaders that predate 1.1. Devices
+        // can use features up to the lower of this and their own version.
+        [[nodiscard]] uint32_t GetApiVersion() const;
 
+    private:
         VkInstance               m_Instance       = nullptr;
         VkDebugUtilsMessengerEXT m_DebugMessenger = nullptr;
+        uint32_t                 m_ApiVersion     = VK_API_VERSION_1_0;
 
         Instance() = default;
 
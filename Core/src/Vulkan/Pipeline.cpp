@@ -1,12 +1,20 @@
 #include "Pipeline.hpp"
 
 namespace Pulsar::Vulkan {
-    Pipeline Pipeline::Create(Device &device, const std::string &vertexShader, const std::string &fragmentShader) {
+    Pipeline Pipeline::Create(Device &device, const std::string &vertexShader, const std::string &fragmentShader,
+                              const PipelineConfig &config) {
         Pipeline pipeline;
         pipeline.m_Device = &device;
 
         VkShaderModule vertShaderModule = pipeline.CreateShaderModule(ShaderType::Vertex, vertexShader);
-        VkShaderModule fragShaderModule = pipeline.CreateShaderModule(ShaderType::Fragment, fragmentShader);
+        VkShaderModule fragShaderModule = nullptr;
+
+        try {
+            fragShaderModule = pipeline.CreateShaderModule(ShaderType::Fragment, fragmentShader);
+        } catch (...) {
+            vkDestroyShaderModule(device.GetVkLogicalDevice(), vertShaderModule, nullptr);
+            throw;
+        }
 
         VkPipelineShaderStageCreateInfo vertShaderStageInfo{};
         vertShaderStageInfo.sType  = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
@@ -15,36 +23,312 @@ namespace Pulsar::Vulkan {
         vertShaderStageInfo.pName  = "main";
 
         VkPipelineShaderStageCreateInfo fragShaderStageInfo{};
-        vertShaderStageInfo.sType  = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-        vertShaderStageInfo.stage  = VK_SHADER_STAGE_FRAGMENT_BIT;
-        vertShaderStageInfo.module = fragShaderModule;
-        vertShaderStageInfo.pName  = "main";
+        fragShaderStageInfo.sType  = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        fragShaderStageInfo.stage  = VK_SHADER_STAGE_FRAGMENT_BIT;
+        fragShaderStageInfo.module = fragShaderModule;
+        fragShaderStageInfo.pName  = "main";
 
         VkPipelineShaderStageCreateInfo shaderStages[] = {vertShaderStageInfo, fragShaderStageInfo};
 
+        std::vector<VkVertexInputBindingDescription>   bindings;
+        std::vector<VkVertexInputAttributeDescription> attributes;
+
+        for (uint32_t binding = 0; binding < config.vertexLayouts.size(); binding++) {
+            const VertexLayout &layout = config.vertexLayouts[binding];
+
+            bindings.push_back({binding, layout.stride, layout.inputRate});
+
+            for (const VertexAttribute &attribute : layout.attributes) {
+                attributes.push_back({attribute.location, binding, attribute.format, attribute.offset});
+            }
+        }
+
+        VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
+        vertexInputInfo.sType                           = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+        vertexInputInfo.vertexBindingDescriptionCount   = static_cast<uint32_t>(bindings.size());
+        vertexInputInfo.pVertexBindingDescriptions      = bindings.data();
+        vertexInputInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(attributes.size());
+        vertexInputInfo.pVertexAttributeDescriptions    = attributes.data();
+
+        VkPipelineInputAssemblyStateCreateInfo inputAssembly{};
+        inputAssembly.sType                  = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+        inputAssembly.topology               = config.topology;
+        inputAssembly.primitiveRestartEnable = config.primitiveRestart ? VK_TRUE : VK_FALSE;
+
+        VkViewport viewport{};
+        viewport.width    = static_cast<float>(config.extent.width);
+        viewport.height   = static_cast<float>(config.extent.height);
+        viewport.minDepth = 0.0F;
+        viewport.maxDepth = 1.0F;
+
+        VkRect2D scissor{};
+        scissor.extent = config.extent;
+
+        VkPipelineViewportStateCreateInfo viewportState{};
+        viewportState.sType         = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+        viewportState.viewportCount = 1;
+        viewportState.pViewports    = &viewport;
+        viewportState.scissorCount  = 1;
+        viewportState.pScissors     = &scissor;
+
+        VkPipelineRasterizationStateCreateInfo rasterizer{};
+        rasterizer.sType                   = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+        rasterizer.polygonMode             = config.polygonMode;
+        rasterizer.lineWidth               = 1.0F;
+        rasterizer.cullMode                = config.cullMode;
+        rasterizer.frontFace               = config.frontFace;
+        rasterizer.depthBiasEnable         = config.depthBias ? VK_TRUE : VK_FALSE;
+        rasterizer.depthBiasConstantFactor = config.depthBiasConst;
+        rasterizer.depthBiasSlopeFactor    = config.depthBiasSlope;
+
+        VkPipelineDepthStencilStateCreateInfo depthStencil{};
+        depthStencil.sType            = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+        depthStencil.depthTestEnable  = config.depthTest ? VK_TRUE : VK_FALSE;
+        depthStencil.depthWriteEnable = config.depthWrite ? VK_TRUE : VK_FALSE;
+        depthStencil.depthCompareOp   = config.depthCompareOp;
+        depthStencil.maxDepthBounds   = 1.0F;
+
+        VkPipelineMultisampleStateCreateInfo multisampling{};
+        multisampling.sType                = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+        multisampling.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+        VkPipelineColorBlendAttachmentState colorBlendAttachment{};
+        colorBlendAttachment.colorWriteMask      = config.colorWriteMask;
+        colorBlendAttachment.blendEnable         = config.blendEnable ? VK_TRUE : VK_FALSE;
+        colorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+        colorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+        colorBlendAttachment.colorBlendOp        = VK_BLEND_OP_ADD;
+        colorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+        colorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+        colorBlendAttachment.alphaBlendOp        = VK_BLEND_OP_ADD;
+
+        VkPipelineColorBlendStateCreateInfo colorBlending{};
+        colorBlending.sType           = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+        colorBlending.attachmentCount = 1;
+        colorBlending.pAttachments    = &colorBlendAttachment;
+
+        pipeline.m_DynamicState = GetSupportedDynamicState(device, config.dynamicState);
+        const PipelineDynamicState &dynamic = pipeline.m_DynamicState;
+
+        std::vector<VkDynamicState> dynamicStates;
+
+        if (dynamic.viewport) {
+            dynamicStates.push_back(VK_DYNAMIC_STATE_VIEWPORT);
+            dynamicStates.push_back(VK_DYNAMIC_STATE_SCISSOR);
+        }
+
+        if (dynamic.cullMode) {
+            dynamicStates.push_back(VK_DYNAMIC_STATE_CULL_MODE_EXT);
+            dynamicStates.push_back(VK_DYNAMIC_STATE_FRONT_FACE_EXT);
+        }
+
+        if (dynamic.topology) {
+            dynamicStates.push_back(VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY_EXT);
+        }
+
+        if (dynamic.depth) {
+            dynamicStates.push_back(VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT);
+            dynamicStates.push_back(VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT);
+            dynamicStates.push_back(VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT);
+        }
+
+        if (dynamic.depthBias) {
+            dynamicStates.push_back(VK_DYNAMIC_STATE_DEPTH_BIAS);
+            dynamicStates.push_back(VK_DYNAMIC_STATE_DEPTH_BIAS_ENABLE_EXT);
+        }
+
+        if (dynamic.primitiveRestart) {
+            dynamicStates.push_back(VK_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE_EXT);
+        }
+
+        if (dynamic.polygonMode) {
+            dynamicStates.push_back(VK_DYNAMIC_STATE_POLYGON_MODE_EXT);
+        }
+
+        if (dynamic.colorBlend) {
+            dynamicStates.push_back(VK_DYNAMIC_STATE_COLOR_BLEND_ENABLE_EXT);
+            dynamicStates.push_back(VK_DYNAMIC_STATE_COLOR_WRITE_MASK_EXT);
+        }
+
+        VkPipelineDynamicStateCreateInfo dynamicStateInfo{};
+        dynamicStateInfo.sType             = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+        dynamicStateInfo.dynamicStateCount = static_cast<uint32_t>(dynamicStates.size());
+        dynamicStateInfo.pDynamicStates    = dynamicStates.data();
+
+        try {
+            pipeline.m_Layout = pipeline.CreateLayout(config.descriptorSetLayouts, config.pushConstantRanges);
+
+            if (config.dynamicRendering && !device.IsDynamicRenderingSupported()) {
+                throw std::runtime_error("Failed to create graphics pipeline: Dynamic rendering unsupported");
+            }
+
+            VkPipelineRenderingCreateInfoKHR renderingInfo{};
+            renderingInfo.sType                   = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+            renderingInfo.colorAttachmentCount    = 1;
+            renderingInfo.pColorAttachmentFormats = &config.colorFormat;
+            renderingInfo.depthAttachmentFormat   = config.depthFormat;
+
+            if (config.depthFormat == VK_FORMAT_D24_UNORM_S8_UINT ||
+                config.depthFormat == VK_FORMAT_D32_SFLOAT_S8_UINT) {
+                renderingInfo.stencilAttachmentFormat = config.depthFormat;
+            }
+
+            if (config.renderPass != nullptr) {
+                pipeline.m_RenderPass = config.renderPass;
+            } else if (!config.dynamicRendering) {
+                pipeline.m_RenderPass     = pipeline.CreateRenderPass(config.colorFormat);
+                pipeline.m_OwnsRenderPass = true;
+            }
+
+            VkGraphicsPipelineCreateInfo pipelineInfo{};
+            pipelineInfo.sType               = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+            pipelineInfo.pNext               = pipeline.m_RenderPass == nullptr ? &renderingInfo : nullptr;
+            pipelineInfo.stageCount          = 2;
+            pipelineInfo.pStages             = shaderStages;
+            pipelineInfo.pVertexInputState   = &vertexInputInfo;
+            pipelineInfo.pInputAssemblyState = &inputAssembly;
+            pipelineInfo.pViewportState      = &viewportState;
+            pipelineInfo.pRasterizationState = &rasterizer;
+            pipelineInfo.pMultisampleState   = &multisampling;
+            pipelineInfo.pDepthStencilState  = &depthStencil;
+            pipelineInfo.pColorBlendState    = &colorBlending;
+            pipelineInfo.pDynamicState       = dynamicStates.empty() ? nullptr : &dynamicStateInfo;
+            pipelineInfo.layout              = pipeline.m_Layout;
+            pipelineInfo.renderPass          = pipeline.m_RenderPass;
+            pipelineInfo.subpass             = config.subpass;
+
+            if (vkCreateGraphicsPipelines(device.GetVkLogicalDevice(), nullptr, 1, &pipelineInfo, nullptr,
+                                          &pipeline.m_Pipeline) != VK_SUCCESS) {
+                throw std::runtime_error("Failed to create graphics pipeline: Unknown error");
+            }
+        } catch (...) {
+            vkDestroyShaderModule(device.GetVkLogicalDevice(), fragShaderModule, nullptr);
+            vkDestroyShaderModule(device.GetVkLogicalDevice(), vertShaderModule, nullptr);
+            throw;
+        }
+
         vkDestroyShaderModule(device.GetVkLogicalDevice(), fragShaderModule, nullptr);
         vkDestroyShaderModule(device.GetVkLogicalDevice(), vertShaderModule, nullptr);
 
         return pipeline;
     }
 
+    Pipeline Pipeline::CreateCompute(Device &device, const std::string &computeShader,
+                                     const ComputePipelineConfig &config) {
+        Pipeline pipeline;
+        pipeline.m_Device    = &device;
+        pipeline.m_BindPoint = VK_PIPELINE_BIND_POINT_COMPUTE;
+
+        VkShaderModule shaderModule = pipeline.CreateShaderModule(ShaderType::Compute, computeShader);
+
+        try {
+            pipeline.m_Layout = pipeline.CreateLayout(config.descriptorSetLayouts, config.pushConstantRanges);
+
+            VkComputePipelineCreateInfo pipelineInfo{};
+            pipelineInfo.sType        = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+            pipelineInfo.stage.sType  = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+            pipelineInfo.stage.stage  = VK_SHADER_STAGE_COMPUTE_BIT;
+            pipelineInfo.stage.module = shaderModule;
+            pipelineInfo.stage.pName  = "main";
+            pipelineInfo.layout       = pipeline.m_Layout;
+
+            if (vkCreateComputePipelines(device.GetVkLogicalDevice(), nullptr, 1, &pipelineInfo, nullptr,
+                                         &pipeline.m_Pipeline) != VK_SUCCESS) {
+                throw std::runtime_error("Failed to create compute pipeline: Unknown error");
+            }
+        } catch (...) {
+            vkDestroyShaderModule(device.GetVkLogicalDevice(), shaderModule, nullptr);
+            throw;
+        }
+
+        vkDestroyShaderModule(device.GetVkLogicalDevice(), shaderModule, nullptr);
+
+        return pipeline;
+    }
+
     Pipeline::~Pipeline() {
-        if (m_Pipeline != nullptr) {
-            vkDestroyPipeline(m_Device->GetVkLogicalDevice(), m_Pipeline, nullptr);
-            m_Pipeline = nullptr;
+        Destroy();
+    }
+
+    Pipeline::Pipeline(Pipeline &&other) noexcept
+        : m_Pipeline(std::exchange(other.m_Pipeline, nullptr)),
+          m_Layout(std::exchange(other.m_Layout, nullptr)),
+          m_RenderPass(std::exchange(other.m_RenderPass, nullptr)),
+          m_OwnsRenderPass(std::exchange(other.m_OwnsRenderPass, false)),
+          m_BindPoint(other.m_BindPoint),
+          m_DynamicState(other.m_DynamicState),
+          m_Device(other.m_Device) {
+    }
+
+    Pipeline &Pipeline::operator=(Pipeline &&other) noexcept {
+        if (this != &other) {
+            Destroy();
+
+            m_Pipeline       = std::exchange(other.m_Pipeline, nullptr);
+            m_Layout         = std::exchange(other.m_Layout, nullptr);
+            m_RenderPass     = std::exchange(other.m_RenderPass, nullptr);
+            m_OwnsRenderPass = std::exchange(other.m_OwnsRenderPass, false);
+            m_BindPoint      = other.m_BindPoint;
+            m_DynamicState   = other.m_DynamicState;
+            m_Device         = other.m_Device;
         }
+
+        return *this;
     }
 
     VkPipeline Pipeline::GetVkPipeline() const {
         return m_Pipeline;
     }
 
+    VkPipelineLayout Pipeline::GetVkPipelineLayout() const {
+        return m_Layout;
+    }
+
+    VkRenderPass Pipeline::GetVkRenderPass() const {
+        return m_RenderPass;
+    }
+
+    VkPipelineBindPoint Pipeline::GetVkBindPoint() const {
+        return m_BindPoint;
+    }
+
+    const PipelineDynamicState &Pipeline::GetDynamicState() const {
+        return m_DynamicState;
+    }
+
+    void Pipeline::Bind(const VkCommandBuffer commandBuffer) const {
+        vkCmdBindPipeline(commandBuffer, m_BindPoint, m_Pipeline);
+    }
+
+    void Pipeline::Destroy() {
+        if (m_Device == nullptr) {
+            return;
+        }
+
+        if (m_Pipeline != nullptr) {
+            vkDestroyPipeline(m_Device->GetVkLogicalDevice(), m_Pipeline, nullptr);
+            m_Pipeline = nullptr;
+        }
+
+        if (m_Layout != nullptr) {
+            vkDestroyPipelineLayout(m_Device->GetVkLogicalDevice(), m_Layout, nullptr);
+            m_Layout = nullptr;
+        }
+
+        if (m_RenderPass != nullptr && m_OwnsRenderPass) {
+            vkDestroyRenderPass(m_Device->GetVkLogicalDevice(), m_RenderPass, nullptr);
+        }
+
+        m_RenderPass     = nullptr;
+        m_OwnsRenderPass = false;
+    }
+
     VkShaderModule Pipeline::CreateShaderModule(const ShaderType type, const std::string &source) const {
         const std::vector<uint32_t> spirv = CompileShader(type, source);
 
         VkShaderModuleCreateInfo createInfo{};
         createInfo.sType    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-        createInfo.codeSize = spirv.size();
+        createInfo.codeSize = spirv.size() * sizeof(uint32_t);
         createInfo.pCode    = spirv.data();
 
         VkShaderModule shaderModule;
@@ -54,4 +338,73 @@ namespace Pulsar::Vulkan {
 
         return shaderModule;
     }
-}
\ No newline at end of file
+
+    VkRenderPass Pipeline::CreateRenderPass(const VkFormat colorFormat) const {
+        VkAttachmentDescription colorAttachment{};
+        colorAttachment.format         = colorFormat;
+        colorAttachment.samples        = VK_SAMPLE_COUNT_1_BIT;
+        colorAttachment.loadOp         = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        colorAttachment.storeOp        = VK_ATTACHMENT_STORE_OP_STORE;
+        colorAttachment.stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        colorAttachment.initialLayout  = VK_IMAGE_LAYOUT_UNDEFINED;
+        colorAttachment.finalLayout    = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+
+        VkAttachmentReference colorAttachmentRef{};
+        colorAttachmentRef.attachment = 0;
+        colorAttachmentRef.layout     = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+        VkSubpassDescription subpass{};
+        subpass.pipelineBindPoint    = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        subpass.colorAttachmentCount = 1;
+        subpass.pColorAttachments    = &colorAttachmentRef;
+
+        VkRenderPassCreateInfo renderPassInfo{};
+        renderPassInfo.sType           = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+        renderPassInfo.attachmentCount = 1;
+        renderPassInfo.pAttachments    = &colorAttachment;
+        renderPassInfo.subpassCount    = 1;
+        renderPassInfo.pSubpasses      = &subpass;
+
+        VkRenderPass renderPass;
+        if (vkCreateRenderPass(m_Device->GetVkLogicalDevice(), &renderPassInfo, nullptr, &renderPass) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create render pass: Unknown error");
+        }
+
+        return renderPass;
+    }
+
+    PipelineDynamicState Pipeline::GetSupportedDynamicState(const Device &               device,
+                                                            const PipelineDynamicState &requested) {
+        const DynamicStateSupport &support = device.GetDynamicStateSupport();
+
+        PipelineDynamicState state;
+        state.viewport         = requested.viewport;
+        state.cullMode         = requested.cullMode && support.extendedDynamicState;
+        state.topology         = requested.topology && support.extendedDynamicState;
+        state.depth            = requested.depth && support.extendedDynamicState;
+        state.depthBias        = requested.depthBias && support.extendedDynamicState2;
+        state.primitiveRestart = requested.primitiveRestart && support.extendedDynamicState2;
+        state.polygonMode      = requested.polygonMode && support.polygonMode;
+        state.colorBlend       = requested.colorBlend && support.colorBlend;
+
+        return state;
+    }
+
+    VkPipelineLayout Pipeline::CreateLayout(const std::span<const VkDescriptorSetLayout> descriptorSetLayouts,
+                                            const std::span<const VkPushConstantRange>   pushConstantRanges) const {
+        VkPipelineLayoutCreateInfo layoutInfo{};
+        layoutInfo.sType                  = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        layoutInfo.setLayoutCount         = static_cast<uint32_t>(descriptorSetLayouts.size());
+        layoutInfo.pSetLayouts            = descriptorSetLayouts.data();
+        layoutInfo.pushConstantRangeCount = static_cast<uint32_t>(pushConstantRanges.size());
+        layoutInfo.pPushConstantRanges    = pushConstantRanges.data();
+
+        VkPipelineLayout layout;
+        if (vkCreatePipelineLayout(m_Device->GetVkLogicalDevice(), &layoutInfo, nullptr, &layout) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create pipeline layout: Unknown error");
+        }
+
+        return layout;
+    }
+}
@@ -3,29 +3,110 @@
 
 #include "Device.hpp"
 #include "Shader.hpp"
+#include "VertexLayout.hpp"
 
 namespace Pulsar::Vulkan {
+    // State a pipeline leaves to be set while recording (see DynamicStateRecorder) instead of baking it from
+    // PipelineConfig, so one pipeline covers every combination. Groups the device cannot make dynamic are baked;
+    // Pipeline::GetDynamicState reports what a pipeline ended up with.
+    struct PipelineDynamicState {
+        bool viewport         = false; // Viewport and scissor; always available.
+        bool cullMode         = false; // Cull mode and front face.
+        bool topology         = false; // Within the configured topology's class unless the device is unrestricted.
+        bool depth            = false; // Depth test, write and compare op.
+        bool depthBias        = false; // Depth bias enable and factors.
+        bool primitiveRestart = false;
+        bool polygonMode      = false;
+        bool colorBlend       = false; // Blend enable and write mask of attachment 0.
+
+        [[nodiscard]] bool operator==(const PipelineDynamicState &other) const = default;
+    };
+
+    struct PipelineConfig {
+        std::vector<VertexLayout>          vertexLayouts;
+        std::vector<VkDescriptorSetLayout> descriptorSetLayouts;
+        std::vector<VkPushConstantRange>   pushConstantRanges;
+
+        VkPrimitiveTopology topology         = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        VkCullModeFlags     cullMode         = VK_CULL_MODE_BACK_BIT;
+        VkFrontFace         frontFace        = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+        VkPolygonMode       polygonMode      = VK_POLYGON_MODE_FILL;
+        VkExtent2D          extent           = {800, 600};
+        bool                primitiveRestart = false;
+
+        // Only take effect when the render pass has a depth attachment.
+        bool        depthTest      = false;
+        bool        depthWrite     = false;
+        VkCompareOp depthCompareOp = VK_COMPARE_OP_LESS_OR_EQUAL;
+        bool        depthBias      = false;
+        float       depthBiasConst = 0.0F;
+        float       depthBiasSlope = 0.0F;
+
+        bool                  blendEnable    = false; // Standard alpha blending.
+        VkColorComponentFlags colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
+                                               VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+
+        PipelineDynamicState dynamicState;
+
+        // When no render pass is given the pipeline creates and owns a single-subpass one for colorFormat, or with
+        // dynamicRendering none at all; such pipelines draw in RenderPassCache passes with dynamic rendering
+        // enabled, whose attachments match colorFormat and depthFormat.
+        VkFormat     colorFormat      = VK_FORMAT_B8G8R8A8_SRGB;
+        VkFormat     depthFormat      = VK_FORMAT_UNDEFINED;
+        VkRenderPass renderPass       = nullptr;
+        uint32_t     subpass          = 0;
+        bool         dynamicRendering = false;
+    };
+
+    struct ComputePipelineConfig {
+        std::vector<VkDescriptorSetLayout> descriptorSetLayouts;
+        std::vector<VkPushConstantRange>   pushConstantRanges;
+    };
+
     class Pipeline {
     public:
-        static Pipeline Create(Device &device, const std::string &vertexShader, const std::string &fragmentShader);
+        static Pipeline Create(Device &device, const std::string &vertexShader, const std::string &fragmentShader,
+                               const PipelineConfig &config = {});
+        static Pipeline CreateCompute(Device &device, const std::string &computeShader,
+                                      const ComputePipelineConfig &config = {});
         ~Pipeline();
 
-        Pipeline(const Pipeline &other)     = delete;
-        Pipeline(Pipeline &&other) noexcept = default;
+        Pipeline(const Pipeline &other) = delete;
+        Pipeline(Pipeline &&other) noexcept;
 
-        Pipeline &operator=(const Pipeline &other)     = delete;
-        Pipeline &operator=(Pipeline &&other) noexcept = default;
+        Pipeline &operator=(const Pipeline &other) = delete;
+        Pipeline &operator=(Pipeline &&other) noexcept;
 
-        [[nodiscard]] VkPipeline GetVkPipeline() const;
+        [[nodiscard]] VkPipeline          GetVkPipeline() const;
+        [[nodiscard]] VkPipelineLayout    GetVkPipelineLayout() const;
+        [[nodiscard]] VkRenderPass        GetVkRenderPass() const;
+        [[nodiscard]] VkPipelineBindPoint GetVkBindPoint() const;
+
+        [[nodiscard]] const PipelineDynamicState &GetDynamicState() const;
+
+        void Bind(VkCommandBuffer commandBuffer) const;
 
     private:
-        VkPipeline m_Pipeline = nullptr;
-        Device *   m_Device   = nullptr;
+        VkPipeline           m_Pipeline       = nullptr;
+        VkPipelineLayout     m_Layout         = nullptr;
+        VkRenderPass         m_RenderPass     = nullptr;
+        bool                 m_OwnsRenderPass = false;
+        VkPipelineBindPoint  m_BindPoint      = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        PipelineDynamicState m_DynamicState   = {};
+        Device *             m_Device         = nullptr;
 
         Pipeline() = default;
 
-        [[nodiscard]] VkShaderModule CreateShaderModule(ShaderType type, const std::string &source) const;
+        void Destroy();
+
+        [[nodiscard]] VkShaderModule   CreateShaderModule(ShaderType type, const std::string &source) const;
+        [[nodiscard]] VkRenderPass     CreateRenderPass(VkFormat colorFormat) const;
+
+        [[nodiscard]] static PipelineDynamicState GetSupportedDynamicState(const Device &               device,
+                                                                           const PipelineDynamicState &requested);
+        [[nodiscard]] VkPipelineLayout CreateLayout(std::span<const VkDescriptorSetLayout> descriptorSetLayouts,
+                                                    std::span<const VkPushConstantRange> pushConstantRanges) const;
     };
 }
 
-#endif //PULSAR_PIPELINE_HPP
\ No newline at end of file
+#endif //PULSAR_PIPELINE_HPP
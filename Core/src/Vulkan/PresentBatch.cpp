@@ -0,0 +1,50 @@
+#include "PresentBatch.hpp"
+
+namespace Pulsar::Vulkan {
+    void PresentBatch::Add(const SwapChain &swapChain, const VkSemaphore waitSemaphore) {
+        m_SwapChains.push_back(swapChain.GetVkSwapChain());
+        m_ImageIndices.push_back(swapChain.GetImageIndex());
+
+        if (waitSemaphore != nullptr) {
+            m_WaitSemaphores.push_back(waitSemaphore);
+        }
+    }
+
+    std::span<const VkResult> PresentBatch::Present(const Device &device) {
+        m_Results.assign(m_SwapChains.size(), VK_SUCCESS);
+
+        if (m_SwapChains.empty()) {
+            return m_Results;
+        }
+
+        VkPresentInfoKHR presentInfo{};
+        presentInfo.sType              = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+        presentInfo.waitSemaphoreCount = static_cast<uint32_t>(m_WaitSemaphores.size());
+        presentInfo.pWaitSemaphores    = m_WaitSemaphores.data();
+        presentInfo.swapchainCount     = static_cast<uint32_t>(m_SwapChains.size());
+        presentInfo.pSwapchains        = m_SwapChains.data();
+        presentInfo.pImageIndices      = m_ImageIndices.data();
+        presentInfo.pResults           = m_Results.data();
+
+        const VkResult result = vkQueuePresentKHR(device.GetVkPresentQueue(), &presentInfo);
+
+        m_SwapChains.clear();
+        m_ImageIndices.clear();
+        m_WaitSemaphores.clear();
+
+        if (result == VK_ERROR_DEVICE_LOST || result == VK_ERROR_OUT_OF_HOST_MEMORY ||
+            result == VK_ERROR_OUT_OF_DEVICE_MEMORY) {
+            throw std::runtime_error("Failed to present swap chains: Device lost or out of memory");
+        }
+
+        return m_Results;
+    }
+
+    bool PresentBatch::IsEmpty() const {
+        return m_SwapChains.empty();
+    }
+
+    uint32_t PresentBatch::GetCount() const {
+        return static_cast<uint32_t>(m_SwapChains.size());
+    }
+}
@@ -0,0 +1,33 @@
+#ifndef PULSAR_PRESENTBATCH_HPP
+#define PULSAR_PRESENTBATCH_HPP
+
+#include <span>
+#include <vector>
+
+#include "SwapChain.hpp"
+
+namespace Pulsar::Vulkan {
+    // Collects the swap chains that finished rendering this frame and presents all of them with one
+    // vkQueuePresentKHR call.
+    class PresentBatch {
+    public:
+        // Presents the swap chain's last acquired image once waitSemaphore is signalled.
+        void Add(const SwapChain &swapChain, VkSemaphore waitSemaphore);
+
+        // Returns one result per Add, in order, and clears the batch. Only failures that affect the whole call
+        // (device lost, out of memory) throw; per-swap-chain results such as VK_ERROR_OUT_OF_DATE_KHR are
+        // reported so the caller can recreate that swap chain alone.
+        std::span<const VkResult> Present(const Device &device);
+
+        [[nodiscard]] bool     IsEmpty() const;
+        [[nodiscard]] uint32_t GetCount() const;
+
+    private:
+        std::vector<VkSwapchainKHR> m_SwapChains;
+        std::vector<uint32_t>       m_ImageIndices;
+        std::vector<VkSemaphore>    m_WaitSemaphores;
+        std::vector<VkResult>       m_Results;
+    };
+}
+
+#endif //PULSAR_PRESENTBATCH_HPP
@@ -0,0 +1,460 @@
+#include "RenderPassCache.hpp"
+
+namespace Pulsar::Vulkan {
+    static bool HasStencil(const VkFormat format) {
+        return format == VK_FORMAT_D16_UNORM_S8_UINT || format == VK_FORMAT_D24_UNORM_S8_UINT ||
+               format == VK_FORMAT_D32_SFLOAT_S8_UINT || format == VK_FORMAT_S8_UINT;
+    }
+
+    static size_t HashBytes(const void *data, const size_t size, size_t hash = 14695981039346656037ULL) {
+        const auto *bytes = static_cast<const uint8_t *>(data);
+
+        for (size_t i = 0; i < size; i++) {
+            hash = (hash ^ bytes[i]) * 1099511628211ULL;
+        }
+
+        return hash;
+    }
+
+    // Moves an attachment between the layout the caller hands it over in and the one it is rendered in.
+    static VkImageMemoryBarrier MakeLayoutBarrier(const AttachmentInfo &attachment, const bool depth,
+                                                  const VkImageLayout oldLayout, const VkImageLayout newLayout) {
+        VkImageMemoryBarrier barrier{};
+        barrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.oldLayout           = oldLayout;
+        barrier.newLayout           = newLayout;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image               = attachment.image;
+
+        barrier.subresourceRange.aspectMask = depth ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
+        if (depth && HasStencil(attachment.format)) {
+            barrier.subresourceRange.aspectMask |= VK_IMAGE_ASPECT_STENCIL_BIT;
+        }
+
+        barrier.subresourceRange.levelCount = VK_REMAINING_MIP_LEVELS;
+        barrier.subresourceRange.layerCount = VK_REMAINING_ARRAY_LAYERS;
+
+        return barrier;
+    }
+
+    RenderPassCache::RenderPassCache(const VkDevice device, const bool dynamicRenderingSupported)
+        : m_Device(device), m_DynamicRenderingSupported(dynamicRenderingSupported) {
+        if (dynamicRenderingSupported) {
+            m_BeginRendering = reinterpret_cast<PFN_vkCmdBeginRenderingKHR>(
+                vkGetDeviceProcAddr(device, "vkCmdBeginRenderingKHR"));
+            m_EndRendering = reinterpret_cast<PFN_vkCmdEndRenderingKHR>(
+                vkGetDeviceProcAddr(device, "vkCmdEndRenderingKHR"));
+        }
+    }
+
+    RenderPassCache::~RenderPassCache() {
+        Clear();
+    }
+
+    void RenderPassCache::SetDynamicRendering(const bool enabled) {
+        if (enabled && !m_DynamicRenderingSupported) {
+            throw std::runtime_error("Failed to enable dynamic rendering: VK_KHR_dynamic_rendering unsupported");
+        }
+
+        m_DynamicRendering = enabled;
+    }
+
+    bool RenderPassCache::IsDynamicRenderingEnabled() const {
+        return m_DynamicRendering;
+    }
+
+    bool RenderPassCache::IsDynamicRenderingSupported() const {
+        return m_DynamicRenderingSupported;
+    }
+
+    VkRenderPass RenderPassCache::GetRenderPass(const RenderPassInfo &info) {
+        const RenderPassKey key = MakeRenderPassKey(info);
+
+        std::lock_guard lock(m_Mutex);
+
+        if (const auto it = m_RenderPasses.find(key); it != m_RenderPasses.end()) {
+            m_Statistics.hits++;
+            return it->second;
+        }
+
+        const VkRenderPass renderPass = CreateRenderPass(key);
+        m_RenderPasses.emplace(key, renderPass);
+        m_Statistics.misses++;
+
+        return renderPass;
+    }
+
+    VkFramebuffer RenderPassCache::GetFramebuffer(const VkRenderPass renderPass, const RenderPassInfo &info) {
+        if (info.colorAttachments.size() > s_MaxColorAttachments) {
+            throw std::runtime_error("Failed to get framebuffer: Too many color attachments");
+        }
+
+        FramebufferKey key;
+        key.renderPass = renderPass;
+        key.width      = info.extent.width;
+        key.height     = info.extent.height;
+
+        for (const AttachmentInfo &attachment : info.colorAttachments) {
+            key.views[key.viewCount++] = attachment.view;
+        }
+
+        if (info.depthAttachment != nullptr) {
+            key.views[key.viewCount++] = info.depthAttachment->view;
+        }
+
+        std::lock_guard lock(m_Mutex);
+
+        if (const auto it = m_Framebuffers.find(key); it != m_Framebuffers.end()) {
+            m_Statistics.hits++;
+            return it->second;
+        }
+
+        const VkFramebuffer framebuffer = CreateFramebuffer(key);
+        m_Framebuffers.emplace(key, framebuffer);
+        m_Statistics.misses++;
+
+        for (uint32_t i = 0; i < key.viewCount; i++) {
+            m_ViewFramebuffers[key.views[i]].push_back(key);
+        }
+
+        return framebuffer;
+    }
+
+    void RenderPassCache::Begin(const VkCommandBuffer commandBuffer, const RenderPassInfo &info) {
+        if (m_DynamicRendering) {
+            BeginRendering(commandBuffer, info);
+            return;
+        }
+
+        const VkRenderPass  renderPass  = GetRenderPass(info);
+        const VkFramebuffer framebuffer = GetFramebuffer(renderPass, info);
+
+        std::array<VkClearValue, s_MaxAttachments> clearValues{};
+        uint32_t                                   clearCount = 0;
+
+        for (const AttachmentInfo &attachment : info.colorAttachments) {
+            clearValues[clearCount++] = attachment.clearValue;
+        }
+
+        if (info.depthAttachment != nullptr) {
+            clearValues[clearCount++] = info.depthAttachment->clearValue;
+        }
+
+        VkRenderPassBeginInfo beginInfo{};
+        beginInfo.sType             = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+        beginInfo.renderPass        = renderPass;
+        beginInfo.framebuffer       = framebuffer;
+        beginInfo.renderArea.extent = info.extent;
+        beginInfo.clearValueCount   = clearCount;
+        beginInfo.pClearValues      = clearValues.data();
+
+        vkCmdBeginRenderPass(commandBuffer, &beginInfo, VK_SUBPASS_CONTENTS_INLINE);
+    }
+
+    void RenderPassCache::End(const VkCommandBuffer commandBuffer, const RenderPassInfo &info) {
+        if (m_DynamicRendering) {
+            EndRendering(commandBuffer, info);
+            return;
+        }
+
+        vkCmdEndRenderPass(commandBuffer);
+    }
+
+    void RenderPassCache::EvictImageView(const VkImageView view) {
+        std::lock_guard lock(m_Mutex);
+
+        const auto entry = m_ViewFramebuffers.find(view);
+        if (entry == m_ViewFramebuffers.end()) {
+            return;
+        }
+
+        const std::vector<FramebufferKey> keys = std::move(entry->second);
+        m_ViewFramebuffers.erase(entry);
+
+        for (const FramebufferKey &key : keys) {
+            const auto framebuffer = m_Framebuffers.find(key);
+            if (framebuffer == m_Framebuffers.end()) {
+                continue;
+            }
+
+            vkDestroyFramebuffer(m_Device, framebuffer->second, nullptr);
+            m_Framebuffers.erase(framebuffer);
+            m_Statistics.evicted++;
+
+            // Unlink the framebuffer from the other views it used.
+            for (uint32_t i = 0; i < key.viewCount; i++) {
+                const auto other = m_ViewFramebuffers.find(key.views[i]);
+                if (other != m_ViewFramebuffers.end()) {
+                    std::erase(other->second, key);
+
+                    if (other->second.empty()) {
+                        m_ViewFramebuffers.erase(other);
+                    }
+                }
+            }
+        }
+    }
+
+    void RenderPassCache::Clear() {
+        std::lock_guard lock(m_Mutex);
+
+        for (const auto &[key, framebuffer] : m_Framebuffers) {
+            vkDestroyFramebuffer(m_Device, framebuffer, nullptr);
+        }
+
+        for (const auto &[key, renderPass] : m_RenderPasses) {
+            vkDestroyRenderPass(m_Device, renderPass, nullptr);
+        }
+
+        m_Framebuffers.clear();
+        m_RenderPasses.clear();
+        m_ViewFramebuffers.clear();
+    }
+
+    RenderPassCacheStatistics RenderPassCache::GetStatistics() const {
+        std::lock_guard lock(m_Mutex);
+
+        RenderPassCacheStatistics statistics = m_Statistics;
+        statistics.renderPasses              = static_cast<uint32_t>(m_RenderPasses.size());
+        statistics.framebuffers              = static_cast<uint32_t>(m_Framebuffers.size());
+
+        return statistics;
+    }
+
+    size_t RenderPassCache::KeyHash::operator()(const RenderPassKey &key) const {
+        const uint32_t count = key.colorCount + (key.hasDepth ? 1 : 0);
+
+        size_t hash = HashBytes(&key.colorCount, sizeof(key.colorCount));
+        hash        = HashBytes(&key.hasDepth, sizeof(key.hasDepth), hash);
+
+        return HashBytes(key.attachments.data(), count * sizeof(AttachmentKey), hash);
+    }
+
+    size_t RenderPassCache::KeyHash::operator()(const FramebufferKey &key) const {
+        size_t hash = HashBytes(&key.renderPass, sizeof(key.renderPass));
+        hash        = HashBytes(&key.width, sizeof(key.width), hash);
+        hash        = HashBytes(&key.height, sizeof(key.height), hash);
+
+        return HashBytes(key.views.data(), key.viewCount * sizeof(VkImageView), hash);
+    }
+
+    RenderPassCache::RenderPassKey RenderPassCache::MakeRenderPassKey(const RenderPassInfo &info) {
+        if (info.colorAttachments.size() > s_MaxColorAttachments) {
+            throw std::runtime_error("Failed to get render pass: Too many color attachments");
+        }
+
+        RenderPassKey key;
+        key.colorCount = static_cast<uint32_t>(info.colorAttachments.size());
+        key.hasDepth   = info.depthAttachment != nullptr;
+
+        for (uint32_t i = 0; i < key.colorCount; i++) {
+            key.attachments[i] = MakeAttachmentKey(info.colorAttachments[i]);
+        }
+
+        if (key.hasDepth) {
+            key.attachments[key.colorCount] = MakeAttachmentKey(*info.depthAttachment);
+        }
+
+        return key;
+    }
+
+    RenderPassCache::AttachmentKey RenderPassCache::MakeAttachmentKey(const AttachmentInfo &attachment) {
+        return {
+            attachment.format, attachment.samples, attachment.loadOp, attachment.storeOp, attachment.initialLayout,
+            attachment.finalLayout
+        };
+    }
+
+    VkRenderPass RenderPassCache::CreateRenderPass(const RenderPassKey &key) const {
+        std::array<VkAttachmentDescription, s_MaxAttachments> attachments{};
+        std::array<VkAttachmentReference, s_MaxColorAttachments> colorReferences{};
+        const uint32_t attachmentCount = key.colorCount + (key.hasDepth ? 1 : 0);
+
+        for (uint32_t i = 0; i < attachmentCount; i++) {
+            const AttachmentKey &attachment = key.attachments[i];
+            const bool           stencil    = i == key.colorCount && HasStencil(attachment.format);
+
+            attachments[i].format         = attachment.format;
+            attachments[i].samples        = attachment.samples;
+            attachments[i].loadOp         = attachment.loadOp;
+            attachments[i].storeOp        = attachment.storeOp;
+            attachments[i].stencilLoadOp  = stencil ? attachment.loadOp : VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+            attachments[i].stencilStoreOp = stencil ? attachment.storeOp : VK_ATTACHMENT_STORE_OP_DONT_CARE;
+            attachments[i].initialLayout  = attachment.initialLayout;
+            attachments[i].finalLayout    = attachment.finalLayout;
+        }
+
+        for (uint32_t i = 0; i < key.colorCount; i++) {
+            colorReferences[i] = {i, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+        }
+
+        const VkAttachmentReference depthReference = {key.colorCount, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL};
+
+        VkSubpassDescription subpass{};
+        subpass.pipelineBindPoint       = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        subpass.colorAttachmentCount    = key.colorCount;
+        subpass.pColorAttachments       = colorReferences.data();
+        subpass.pDepthStencilAttachment = key.hasDepth ? &depthReference : nullptr;
+
+        // Waits for the previous user of the attachments, including the presentation engine when the acquire
+        // semaphore is waited on at the color output stage.
+        VkSubpassDependency dependency{};
+        dependency.srcSubpass    = VK_SUBPASS_EXTERNAL;
+        dependency.dstSubpass    = 0;
+        dependency.srcStageMask  = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+                                   VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+        dependency.dstStageMask  = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+                                   VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+        dependency.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+                                   VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+        dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+                                   VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT |
+                                   VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+
+        VkRenderPassCreateInfo renderPassInfo{};
+        renderPassInfo.sType           = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+        renderPassInfo.attachmentCount = attachmentCount;
+        renderPassInfo.pAttachments    = attachments.data();
+        renderPassInfo.subpassCount    = 1;
+        renderPassInfo.pSubpasses      = &subpass;
+        renderPassInfo.dependencyCount = 1;
+        renderPassInfo.pDependencies   = &dependency;
+
+        VkRenderPass renderPass;
+        if (vkCreateRenderPass(m_Device, &renderPassInfo, nullptr, &renderPass) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create render pass: Unknown error");
+        }
+
+        return renderPass;
+    }
+
+    VkFramebuffer RenderPassCache::CreateFramebuffer(const FramebufferKey &key) const {
+        VkFramebufferCreateInfo framebufferInfo{};
+        framebufferInfo.sType           = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        framebufferInfo.renderPass      = key.renderPass;
+        framebufferInfo.attachmentCount = key.viewCount;
+        framebufferInfo.pAttachments    = key.views.data();
+        framebufferInfo.width           = key.width;
+        framebufferInfo.height          = key.height;
+        framebufferInfo.layers          = 1;
+
+        VkFramebuffer framebuffer;
+        if (vkCreateFramebuffer(m_Device, &framebufferInfo, nullptr, &framebuffer) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create framebuffer: Unknown error");
+        }
+
+        return framebuffer;
+    }
+
+    void RenderPassCache::BeginRendering(const VkCommandBuffer commandBuffer, const RenderPassInfo &info) const {
+        if (info.colorAttachments.size() > s_MaxColorAttachments) {
+            throw std::runtime_error("Failed to begin rendering: Too many color attachments");
+        }
+
+        std::array<VkImageMemoryBarrier, s_MaxAttachments>         barriers{};
+        std::array<VkRenderingAttachmentInfoKHR, s_MaxAttachments> attachments{};
+        uint32_t                                                   barrierCount = 0;
+
+        const auto add = [&](const AttachmentInfo &attachment, const bool depth, VkRenderingAttachmentInfoKHR &out) {
+            const VkImageLayout layout = depth
+                                             ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
+                                             : VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+            out.sType       = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+            out.imageView   = attachment.view;
+            out.imageLayout = layout;
+            out.loadOp      = attachment.loadOp;
+            out.storeOp     = attachment.storeOp;
+            out.clearValue  = attachment.clearValue;
+
+            if (attachment.image != nullptr && attachment.initialLayout != layout) {
+                barriers[barrierCount] = MakeLayoutBarrier(attachment, depth, attachment.initialLayout, layout);
+                barriers[barrierCount].srcAccessMask = attachment.initialLayout == VK_IMAGE_LAYOUT_UNDEFINED
+                                                           ? 0
+                                                           : VK_ACCESS_MEMORY_WRITE_BIT;
+                barriers[barrierCount].dstAccessMask = depth
+                                                           ? VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT |
+                                                             VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT
+                                                           : VK_ACCESS_COLOR_ATTACHMENT_READ_BIT |
+                                                             VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+                barrierCount++;
+            }
+        };
+
+        const auto colorCount = static_cast<uint32_t>(info.colorAttachments.size());
+        for (uint32_t i = 0; i < colorCount; i++) {
+            add(info.colorAttachments[i], false, attachments[i]);
+        }
+
+        if (info.depthAttachment != nullptr) {
+            add(*info.depthAttachment, true, attachments[colorCount]);
+        }
+
+        if (barrierCount > 0) {
+            vkCmdPipelineBarrier(commandBuffer,
+                                 VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                 VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+                                 VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT |
+                                 VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+                                 0, 0, nullptr, 0, nullptr, barrierCount, barriers.data());
+        }
+
+        const bool stencil = info.depthAttachment != nullptr && HasStencil(info.depthAttachment->format);
+
+        VkRenderingInfoKHR renderingInfo{};
+        renderingInfo.sType                = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR;
+        renderingInfo.renderArea.extent    = info.extent;
+        renderingInfo.layerCount           = 1;
+        renderingInfo.colorAttachmentCount = colorCount;
+        renderingInfo.pColorAttachments    = attachments.data();
+        renderingInfo.pDepthAttachment     = info.depthAttachment != nullptr ? &attachments[colorCount] : nullptr;
+        renderingInfo.pStencilAttachment   = stencil ? &attachments[colorCount] : nullptr;
+
+        m_BeginRendering(commandBuffer, &renderingInfo);
+    }
+
+    void RenderPassCache::EndRendering(const VkCommandBuffer commandBuffer, const RenderPassInfo &info) const {
+        m_EndRendering(commandBuffer);
+
+        std::array<VkImageMemoryBarrier, s_MaxAttachments> barriers{};
+        uint32_t                                           barrierCount = 0;
+        VkPipelineStageFlags                               dstStages    = 0;
+
+        const auto add = [&](const AttachmentInfo &attachment, const bool depth) {
+            const VkImageLayout layout = depth
+                                             ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
+                                             : VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+            if (attachment.image == nullptr || attachment.finalLayout == layout ||
+                attachment.finalLayout == VK_IMAGE_LAYOUT_UNDEFINED) {
+                return;
+            }
+
+            const bool present = attachment.finalLayout == VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+
+            barriers[barrierCount] = MakeLayoutBarrier(attachment, depth, layout, attachment.finalLayout);
+            barriers[barrierCount].srcAccessMask = depth
+                                                       ? VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT
+                                                       : VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+            barriers[barrierCount].dstAccessMask = present ? 0 : VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+            dstStages |= present ? VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT : VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+            barrierCount++;
+        };
+
+        for (const AttachmentInfo &attachment : info.colorAttachments) {
+            add(attachment, false);
+        }
+
+        if (info.depthAttachment != nullptr) {
+            add(*info.depthAttachment, true);
+        }
+
+        if (barrierCount > 0) {
+            vkCmdPipelineBarrier(commandBuffer,
+                                 VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+                                 VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+                                 dstStages, 0, 0, nullptr, 0, nullptr, barrierCount, barriers.data());
+        }
+    }
+}
@@ -0,0 +1,137 @@
+#ifndef PULSAR_RENDERPASSCACHE_HPP
+#define PULSAR_RENDERPASSCACHE_HPP
+
+#include <array>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+namespace Pulsar::Vulkan {
+    // One attachment of a pass. Everything but view, image and clearValue is part of the render pass key.
+    struct AttachmentInfo {
+        VkImageView           view          = nullptr;
+        VkImage               image         = nullptr; // Only needed for the layout barriers of dynamic rendering.
+        VkFormat              format        = VK_FORMAT_UNDEFINED;
+        VkSampleCountFlagBits samples       = VK_SAMPLE_COUNT_1_BIT;
+        VkAttachmentLoadOp    loadOp        = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        VkAttachmentStoreOp   storeOp       = VK_ATTACHMENT_STORE_OP_STORE;
+        VkImageLayout         initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        VkImageLayout         finalLayout   = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        VkClearValue          clearValue    = {};
+    };
+
+    struct RenderPassInfo {
+        std::span<const AttachmentInfo> colorAttachments;
+        const AttachmentInfo *          depthAttachment = nullptr;
+        VkExtent2D                      extent          = {};
+    };
+
+    struct RenderPassCacheStatistics {
+        uint32_t renderPasses = 0;
+        uint32_t framebuffers = 0;
+        uint64_t hits         = 0;
+        uint64_t misses       = 0;
+        uint64_t evicted      = 0; // Framebuffers destroyed because one of their views went away.
+    };
+
+    // Hands out single-subpass render passes keyed by attachment formats, sample counts, load/store ops and
+    // layouts, and framebuffers keyed by render pass, views and extent, creating each on first use. Image and
+    // ImageViews evict their views when destroyed, which destroys every framebuffer using them, so recreating a
+    // swap chain drops exactly its framebuffers. Render passes live until Clear. Safe to use from several threads.
+    //
+    // With dynamic rendering, Begin and End use vkCmdBeginRenderingKHR instead and create neither object; barriers
+    // on AttachmentInfo::image stand in for the render pass's layout transitions. Pipelines drawn in such a pass
+    // need PipelineConfig::dynamicRendering.
+    class RenderPassCache {
+    public:
+        static constexpr uint32_t s_MaxColorAttachments = 8;
+
+        RenderPassCache(VkDevice device, bool dynamicRenderingSupported);
+        ~RenderPassCache();
+
+        RenderPassCache(const RenderPassCache &other) = delete;
+
+        RenderPassCache &operator=(const RenderPassCache &other) = delete;
+
+        // Throws when enabling it on a device without VK_KHR_dynamic_rendering.
+        void               SetDynamicRendering(bool enabled);
+        [[nodiscard]] bool IsDynamicRenderingEnabled() const;
+        [[nodiscard]] bool IsDynamicRenderingSupported() const;
+
+        [[nodiscard]] VkRenderPass  GetRenderPass(const RenderPassInfo &info);
+        [[nodiscard]] VkFramebuffer GetFramebuffer(VkRenderPass renderPass, const RenderPassInfo &info);
+
+        void Begin(VkCommandBuffer commandBuffer, const RenderPassInfo &info);
+        void End(VkCommandBuffer commandBuffer, const RenderPassInfo &info);
+
+        // Destroys the framebuffers using view. The GPU must be done with them, as with the view itself.
+        void EvictImageView(VkImageView view);
+
+        // Destroys everything. Nothing handed out may still be in use.
+        void Clear();
+
+        [[nodiscard]] RenderPassCacheStatistics GetStatistics() const;
+
+    private:
+        static constexpr uint32_t s_MaxAttachments = s_MaxColorAttachments + 1;
+
+        struct AttachmentKey {
+            VkFormat              format;
+            VkSampleCountFlagBits samples;
+            VkAttachmentLoadOp    loadOp;
+            VkAttachmentStoreOp   storeOp;
+            VkImageLayout         initialLayout;
+            VkImageLayout         finalLayout;
+
+            [[nodiscard]] bool operator==(const AttachmentKey &other) const = default;
+        };
+
+        struct RenderPassKey {
+            std::array<AttachmentKey, s_MaxAttachments> attachments{};
+            uint32_t                                    colorCount = 0;
+            bool                                        hasDepth   = false;
+
+            [[nodiscard]] bool operator==(const RenderPassKey &other) const = default;
+        };
+
+        struct FramebufferKey {
+            VkRenderPass                              renderPass = nullptr;
+            std::array<VkImageView, s_MaxAttachments> views{};
+            uint32_t                                  viewCount = 0;
+            uint32_t                                  width     = 0;
+            uint32_t                                  height    = 0;
+
+            [[nodiscard]] bool operator==(const FramebufferKey &other) const = default;
+        };
+
+        struct KeyHash {
+            size_t operator()(const RenderPassKey &key) const;
+            size_t operator()(const FramebufferKey &key) const;
+        };
+
+        VkDevice                   m_Device                    = nullptr;
+        bool                       m_DynamicRenderingSupported = false;
+        bool                       m_DynamicRendering          = false;
+        PFN_vkCmdBeginRenderingKHR m_BeginRendering            = nullptr;
+        PFN_vkCmdEndRenderingKHR   m_EndRendering              = nullptr;
+
+        mutable std::mutex                                           m_Mutex;
+        std::unordered_map<RenderPassKey, VkRenderPass, KeyHash>     m_RenderPasses;
+        std::unordered_map<FramebufferKey, VkFramebuffer, KeyHash>   m_Framebuffers;
+        std::unordered_map<VkImageView, std::vector<FramebufferKey>> m_ViewFramebuffers;
+        RenderPassCacheStatistics                                    m_Statistics;
+
+        [[nodiscard]] static RenderPassKey MakeRenderPassKey(const RenderPassInfo &info);
+        [[nodiscard]] static AttachmentKey MakeAttachmentKey(const AttachmentInfo &attachment);
+        [[nodiscard]] VkRenderPass         CreateRenderPass(const RenderPassKey &key) const;
+        [[nodiscard]] VkFramebuffer        CreateFramebuffer(const FramebufferKey &key) const;
+
+        void BeginRendering(VkCommandBuffer commandBuffer, const RenderPassInfo &info) const;
+        void EndRendering(VkCommandBuffer commandBuffer, const RenderPassInfo &info) const;
+    };
+}
+
+#endif //PULSAR_RENDERPASSCACHE_HPP
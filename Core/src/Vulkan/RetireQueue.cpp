@@ -0,0 +1,151 @@
+#include "RetireQueue.hpp"
+
+namespace Pulsar::Vulkan {
+    // Min-heap on value, so the entry due first is at the front.
+    static constexpr auto s_IsLater = [](const auto &left, const auto &right) {
+        return left.value > right.value;
+    };
+
+    void ResourceUsage::Use(const QueueTimeline &timeline) {
+        Use(timeline.GetNextPoint());
+    }
+
+    void ResourceUsage::Use(const TimelinePoint point) {
+        for (TimelinePoint &existing : m_Points) {
+            if (existing.timeline == point.timeline) {
+                existing.value = std::max(existing.value, point.value);
+                return;
+            }
+        }
+
+        m_Points.push_back(point);
+    }
+
+    bool ResourceUsage::IsComplete() const {
+        return std::ranges::all_of(m_Points, [](const TimelinePoint &point) {
+            return point.timeline->IsComplete(point.value);
+        });
+    }
+
+    std::span<const TimelinePoint> ResourceUsage::GetPoints() const {
+        return m_Points;
+    }
+
+    // A point that was never submitted, e.g. because recording failed after Use, has nothing on the GPU beyond
+    // what was submitted before it.
+    static void WaitForPoint(const TimelinePoint &point) {
+        point.timeline->Wait(std::min(point.value, point.timeline->GetSubmittedPoint().value));
+    }
+
+    RetireQueue::~RetireQueue() {
+        try {
+            WaitForAll();
+        } catch (const std::exception &) {
+            // Only a lost device fails the wait, and then nothing is left reading the resources.
+        }
+
+        DestroyAll();
+    }
+
+    void RetireQueue::Retire(const ResourceUsage &usage, std::function<void()> destroy) {
+        const std::span<const TimelinePoint> points = usage.GetPoints();
+        Push({points.begin(), points.end()}, std::move(destroy));
+    }
+
+    void RetireQueue::Retire(const TimelinePoint point, std::function<void()> destroy) {
+        Push({point}, std::move(destroy));
+    }
+
+    void RetireQueue::Retire(const QueueTimeline &timeline, std::function<void()> destroy) {
+        Push({timeline.GetSubmittedPoint()}, std::move(destroy));
+    }
+
+    uint32_t RetireQueue::Collect() {
+        uint32_t destroyed = 0;
+
+        for (size_t i = 0; i < m_Lanes.size(); i++) {
+            if (m_Lanes[i].heap.empty()) {
+                continue;
+            }
+
+            // Polled once per lane; entries that turn due meanwhile wait for the next Collect.
+            const uint64_t completed = m_Lanes[i].timeline->GetCompletedValue();
+
+            while (!m_Lanes[i].heap.empty() && m_Lanes[i].heap.front().value <= completed) {
+                std::vector<Entry> &heap = m_Lanes[i].heap;
+                std::ranges::pop_heap(heap, s_IsLater);
+
+                Entry entry = std::move(heap.back());
+                heap.pop_back();
+                m_PendingCount--;
+
+                // Push may add lanes, so heap is not used past this point.
+                if (Push(std::move(entry.remaining), std::move(entry.destroy))) {
+                    destroyed++;
+                }
+            }
+        }
+
+        return destroyed;
+    }
+
+    void RetireQueue::Flush() {
+        WaitForAll();
+        DestroyAll();
+    }
+
+    size_t RetireQueue::GetPendingCount() const {
+        return m_PendingCount;
+    }
+
+    void RetireQueue::WaitForAll() const {
+        for (const Lane &lane : m_Lanes) {
+            for (const Entry &entry : lane.heap) {
+                WaitForPoint({lane.timeline, entry.value});
+
+                for (const TimelinePoint &point : entry.remaining) {
+                    WaitForPoint(point);
+                }
+            }
+        }
+    }
+
+    void RetireQueue::DestroyAll() {
+        for (Lane &lane : m_Lanes) {
+            for (Entry &entry : lane.heap) {
+                entry.destroy();
+            }
+
+            lane.heap.clear();
+        }
+
+        m_PendingCount = 0;
+    }
+
+    bool RetireQueue::Push(std::vector<TimelinePoint> points, std::function<void()> destroy) {
+        // Points already reached are dropped. The entry waits in the lane of one of the rest, and moves on to the
+        // next lane from Collect.
+        std::erase_if(points, [](const TimelinePoint &point) {
+            return point.timeline->IsComplete(point.value);
+        });
+
+        if (points.empty()) {
+            destroy();
+            return true;
+        }
+
+        const TimelinePoint next = points.back();
+        points.pop_back();
+
+        auto lane = std::ranges::find(m_Lanes, next.timeline, &Lane::timeline);
+        if (lane == m_Lanes.end()) {
+            lane = m_Lanes.insert(m_Lanes.end(), {next.timeline, {}});
+        }
+
+        lane->heap.push_back({next.value, std::move(points), std::move(destroy)});
+        std::ranges::push_heap(lane->heap, s_IsLater);
+        m_PendingCount++;
+
+        return false;
+    }
+}
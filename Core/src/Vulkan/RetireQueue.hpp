@@ -0,0 +1,77 @@
+#ifndef PULSAR_RETIREQUEUE_HPP
+#define PULSAR_RETIREQUEUE_HPP
+
+#include <functional>
+#include <span>
+#include <vector>
+
+#include "Timeline.hpp"
+
+namespace Pulsar::Vulkan {
+    // The last submission on each queue that used a resource. Mark it while recording, then hand it to a
+    // RetireQueue once the resource is no longer wanted.
+    class ResourceUsage {
+    public:
+        // Marks the submission timeline is about to make.
+        void Use(const QueueTimeline &timeline);
+        void Use(TimelinePoint point);
+
+        [[nodiscard]] bool                           IsComplete() const;
+        [[nodiscard]] std::span<const TimelinePoint> GetPoints() const;
+
+    private:
+        std::vector<TimelinePoint> m_Points; // One per timeline.
+    };
+
+    // Deferred destruction: resources the GPU may still be reading are handed over with the points they were last
+    // used at, and destroyed by Collect once every one of those is reached. Each timeline keeps its own heap
+    // ordered by value, so Collect only looks at entries that are due. The timelines must outlive the queue.
+    class RetireQueue {
+    public:
+        RetireQueue() = default;
+        ~RetireQueue();
+
+        RetireQueue(const RetireQueue &other)     = delete;
+        RetireQueue(RetireQueue &&other) noexcept = default;
+
+        RetireQueue &operator=(const RetireQueue &other)     = delete;
+        RetireQueue &operator=(RetireQueue &&other) noexcept = default;
+
+        // destroy runs immediately when every point is already reached.
+        void Retire(const ResourceUsage &usage, std::function<void()> destroy);
+        void Retire(TimelinePoint point, std::function<void()> destroy);
+        // After everything submitted to timeline so far.
+        void Retire(const QueueTimeline &timeline, std::function<void()> destroy);
+
+        // Destroys everything that is due. Returns the number of resources destroyed.
+        uint32_t Collect();
+        // Waits for every pending point and destroys everything. The destructor does the same, and still destroys
+        // everything if the wait fails.
+        void Flush();
+
+        [[nodiscard]] size_t GetPendingCount() const;
+
+    private:
+        struct Entry {
+            uint64_t                   value;
+            std::vector<TimelinePoint> remaining; // Other points still to reach once value is.
+            std::function<void()>      destroy;
+        };
+
+        struct Lane {
+            const QueueTimeline *timeline;
+            std::vector<Entry>   heap;
+        };
+
+        std::vector<Lane> m_Lanes;
+        size_t            m_PendingCount = 0;
+
+        // Returns whether destroy ran right away.
+        bool Push(std::vector<TimelinePoint> points, std::function<void()> destroy);
+
+        void WaitForAll() const;
+        void DestroyAll();
+    };
+}
+
+#endif //PULSAR_RETIREQUEUE_HPP
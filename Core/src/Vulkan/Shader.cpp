@@ -20,6 +20,9 @@ namespace Pulsar::Vulkan {
         case ShaderType::Fragment:
             shaderType = shaderc_glsl_fragment_shader;
             break;
+        case ShaderType::Compute:
+            shaderType = shaderc_glsl_compute_shader;
+            break;
         }
 
         const shaderc::SpvCompilationResult result = compiler.CompileGlslToSpv(
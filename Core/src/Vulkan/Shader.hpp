@@ -4,7 +4,8 @@
 namespace Pulsar::Vulkan {
     enum class ShaderType : uint8_t {
         Vertex,
-        Fragment
+        Fragment,
+        Compute
     };
 
     std::vector<uint32_t> CompileShader(ShaderType type, const std::string &source);
@@ -2,7 +2,11 @@
 
 namespace Pulsar::Vulkan {
     SwapChain SwapChain::Create(const Surface &surface, Device &device, const Glfw::Window &window) {
-        auto [capabilities, formats, presentModes] = device.QuerySwapChainSupport();
+        if (!device.SupportsPresent(surface)) {
+            throw std::runtime_error("Failed to initialize swap chain: Present queue does not support surface");
+        }
+
+        auto [capabilities, formats, presentModes] = device.QuerySwapChainSupport(surface);
 
         VkSurfaceFormatKHR surfaceFormat = SelectSwapSurfaceFormat(formats);
         VkPresentModeKHR   presentMode   = SelectSwapPresentMode(presentModes);
@@ -23,8 +27,9 @@ namespace Pulsar::Vulkan {
         createInfo.imageArrayLayers = 1;
         createInfo.imageUsage       = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
 
-        auto           [graphicsFamily, presentFamily] = device.FindQueueFamilies();
-        const uint32_t queueFamilyIndices[]            = {graphicsFamily.value(), presentFamily.value()};
+        const uint32_t graphicsFamily       = device.GetGraphicsQueueFamily();
+        const uint32_t presentFamily        = device.GetPresentQueueFamily();
+        const uint32_t queueFamilyIndices[] = {graphicsFamily, presentFamily};
 
         if (graphicsFamily != presentFamily) {
             createInfo.imageSharingMode      = VK_SHARING_MODE_CONCURRENT;
@@ -60,17 +65,51 @@ namespace Pulsar::Vulkan {
     }
 
     SwapChain::~SwapChain() {
-        if (m_SwapChain != nullptr) {
-            vkDestroySwapchainKHR(m_Device->GetVkLogicalDevice(), m_SwapChain, nullptr);
-            m_SwapChain = nullptr;
+        Destroy();
+    }
+
+    SwapChain::SwapChain(SwapChain &&other) noexcept
+        : m_SwapChain(std::exchange(other.m_SwapChain, nullptr)), m_Images(std::move(other.m_Images)),
+          m_ImageFormat(other.m_ImageFormat), m_SwapChainExtent(other.m_SwapChainExtent),
+          m_ImageIndex(other.m_ImageIndex), m_Device(other.m_Device) {
+    }
+
+    SwapChain &SwapChain::operator=(SwapChain &&other) noexcept {
+        if (this != &other) {
+            Destroy();
+
+            m_SwapChain       = std::exchange(other.m_SwapChain, nullptr);
+            m_Images          = std::move(other.m_Images);
+            m_ImageFormat     = other.m_ImageFormat;
+            m_SwapChainExtent = other.m_SwapChainExtent;
+            m_ImageIndex      = other.m_ImageIndex;
+            m_Device          = other.m_Device;
+        }
+
+        return *this;
+    }
+
+    VkResult SwapChain::AcquireNextImage(const VkSemaphore semaphore, const uint64_t timeout) {
+        uint32_t       imageIndex = 0;
+        const VkResult result     = vkAcquireNextImageKHR(m_Device->GetVkLogicalDevice(), m_SwapChain, timeout,
+                                                          semaphore, nullptr, &imageIndex);
+
+        if (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR) {
+            m_ImageIndex = imageIndex;
         }
+
+        return result;
+    }
+
+    uint32_t SwapChain::GetImageIndex() const {
+        return m_ImageIndex;
     }
 
     VkSwapchainKHR SwapChain::GetVkSwapChain() const {
         return m_SwapChain;
     }
 
-    std::vector<VkImage> SwapChain::GetVkImages() const {
+    std::span<const VkImage> SwapChain::GetVkImages() const {
         return m_Images;
     }
 
@@ -78,6 +117,10 @@ namespace Pulsar::Vulkan {
         return m_ImageFormat;
     }
 
+    VkExtent2D SwapChain::GetVkExtent() const {
+        return m_SwapChainExtent;
+    }
+
     VkSurfaceFormatKHR SwapChain::SelectSwapSurfaceFormat(const std::vector<VkSurfaceFormatKHR> &availableFormats) {
         for (const auto &availableFormat : availableFormats) {
             if (availableFormat.format == VK_FORMAT_B8G8R8A8_SRGB &&
@@ -119,4 +162,11 @@ namespace Pulsar::Vulkan {
 
         return actualExtent;
     }
+
+    void SwapChain::Destroy() {
+        if (m_SwapChain != nullptr) {
+            vkDestroySwapchainKHR(m_Device->GetVkLogicalDevice(), m_SwapChain, nullptr);
+            m_SwapChain = nullptr;
+        }
+    }
 }
\ No newline at end of file
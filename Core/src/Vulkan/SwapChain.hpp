@@ -1,6 +1,8 @@
 #ifndef PULSAR_SWAPCHAIN_HPP
 #define PULSAR_SWAPCHAIN_HPP
 
+#include <span>
+
 #include <vulkan/vulkan_core.h>
 
 #include "Device.hpp"
@@ -8,25 +10,35 @@
 namespace Pulsar::Vulkan {
     class SwapChain {
     public:
+        // Throws if the device's present queue cannot present to surface.
         static SwapChain Create(const Surface &surface, Device &device, const Glfw::Window &window);
         ~SwapChain();
 
-        SwapChain(const SwapChain &other)     = delete;
-        SwapChain(SwapChain &&other) noexcept = default;
+        SwapChain(const SwapChain &other) = delete;
+        SwapChain(SwapChain &&other) noexcept;
+
+        SwapChain &operator=(const SwapChain &other) = delete;
+        SwapChain &operator=(SwapChain &&other) noexcept;
 
-        SwapChain &operator=(const SwapChain &other)     = delete;
-        SwapChain &operator=(SwapChain &&other) noexcept = default;
+        // Acquires the next image, signalling semaphore once it is ready to be rendered to. Returns the Vulkan
+        // result so callers can recreate the swap chain on VK_ERROR_OUT_OF_DATE_KHR or VK_SUBOPTIMAL_KHR.
+        VkResult AcquireNextImage(VkSemaphore semaphore, uint64_t timeout = UINT64_MAX);
 
-        [[nodiscard]] VkSwapchainKHR       GetVkSwapChain() const;
-        [[nodiscard]] std::vector<VkImage> GetVkImages() const;
-        [[nodiscard]] VkFormat             GetVkImageFormat() const;
+        // Index of the image returned by the last successful AcquireNextImage.
+        [[nodiscard]] uint32_t GetImageIndex() const;
+
+        [[nodiscard]] VkSwapchainKHR           GetVkSwapChain() const;
+        [[nodiscard]] std::span<const VkImage> GetVkImages() const;
+        [[nodiscard]] VkFormat                 GetVkImageFormat() const;
+        [[nodiscard]] VkExtent2D               GetVkExtent() const;
 
     private:
-        VkSwapchainKHR       m_SwapChain;
+        VkSwapchainKHR       m_SwapChain = nullptr;
         std::vector<VkImage> m_Images;
         VkFormat             m_ImageFormat{};
         VkExtent2D           m_SwapChainExtent{};
-        Device *             m_Device;
+        uint32_t             m_ImageIndex = 0;
+        Device *             m_Device     = nullptr;
 
         [[nodiscard]] static VkSurfaceFormatKHR SelectSwapSurfaceFormat(
             const std::vector<VkSurfaceFormatKHR> &availableFormats);
@@ -36,6 +48,8 @@ namespace Pulsar::Vulkan {
                                                          const Glfw::Window &            window);
 
         SwapChain() = default;
+
+        void Destroy();
     };
 }
 
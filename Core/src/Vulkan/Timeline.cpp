@@ -0,0 +1,310 @@
+#include "Timeline.hpp"
+
+#include "Device.hpp"
+
+namespace Pulsar::Vulkan {
+    QueueTimeline QueueTimeline::Create(const Device &device, const VkQueue queue) {
+        QueueTimeline timeline;
+        timeline.m_Device = device.GetVkLogicalDevice();
+        timeline.m_Queue  = queue;
+
+        if (!device.IsTimelineSemaphoreSupported()) {
+            return timeline;
+        }
+
+        VkSemaphoreTypeCreateInfo typeInfo{};
+        typeInfo.sType         = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+        typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+        typeInfo.initialValue  = 0;
+
+        VkSemaphoreCreateInfo semaphoreInfo{};
+        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphoreInfo.pNext = &typeInfo;
+
+        if (vkCreateSemaphore(timeline.m_Device, &semaphoreInfo, nullptr, &timeline.m_Semaphore) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create timeline semaphore: Unknown error");
+        }
+
+        timeline.m_Functions = device.GetTimelineFunctions();
+
+        return timeline;
+    }
+
+    QueueTimeline::~QueueTimeline() {
+        Destroy();
+    }
+
+    QueueTimeline::QueueTimeline(QueueTimeline &&other) noexcept
+        : m_Device(std::exchange(other.m_Device, nullptr)),
+          m_Queue(std::exchange(other.m_Queue, nullptr)),
+          m_Semaphore(std::exchange(other.m_Semaphore, nullptr)),
+          m_Functions(std::exchange(other.m_Functions, {})),
+          m_Submitted(std::exchange(other.m_Submitted, 0)),
+          m_PendingFences(std::move(other.m_PendingFences)),
+          m_FreeFences(std::move(other.m_FreeFences)),
+          m_Completed(std::exchange(other.m_Completed, 0)) {
+        other.m_PendingFences.clear();
+        other.m_FreeFences.clear();
+    }
+
+    QueueTimeline &QueueTimeline::operator=(QueueTimeline &&other) noexcept {
+        if (this != &other) {
+            Destroy();
+
+            m_Device        = std::exchange(other.m_Device, nullptr);
+            m_Queue         = std::exchange(other.m_Queue, nullptr);
+            m_Semaphore     = std::exchange(other.m_Semaphore, nullptr);
+            m_Functions     = std::exchange(other.m_Functions, {});
+            m_Submitted     = std::exchange(other.m_Submitted, 0);
+            m_PendingFences = std::move(other.m_PendingFences);
+            m_FreeFences    = std::move(other.m_FreeFences);
+            m_Completed     = std::exchange(other.m_Completed, 0);
+
+            other.m_PendingFences.clear();
+            other.m_FreeFences.clear();
+        }
+
+        return *this;
+    }
+
+    uint64_t QueueTimeline::Submit(const QueueSubmitInfo &info) {
+        if (info.binaryWaits.size() != info.binaryWaitStages.size()) {
+            throw std::runtime_error("Failed to submit to timeline: Every binary wait needs a stage mask");
+        }
+
+        const uint64_t value = m_Submitted + 1;
+
+        std::vector<VkSemaphore>          waitSemaphores(info.binaryWaits.begin(), info.binaryWaits.end());
+        std::vector<VkPipelineStageFlags> waitStages(info.binaryWaitStages.begin(), info.binaryWaitStages.end());
+        std::vector<uint64_t>             waitValues(waitSemaphores.size(), 0);
+
+        for (const auto &[point, stages] : info.waits) {
+            if (point.timeline->IsComplete(point.value)) {
+                continue;
+            }
+
+            if (m_Semaphore == nullptr) {
+                point.timeline->Wait(point.value);
+                continue;
+            }
+
+            waitSemaphores.push_back(point.timeline->m_Semaphore);
+            waitStages.push_back(stages);
+            waitValues.push_back(point.value);
+        }
+
+        std::vector<VkSemaphore> signalSemaphores(info.binarySignals.begin(), info.binarySignals.end());
+        std::vector<uint64_t>    signalValues(signalSemaphores.size(), 0);
+
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType              = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.waitSemaphoreCount = static_cast<uint32_t>(waitSemaphores.size());
+        submitInfo.pWaitSemaphores    = waitSemaphores.data();
+        submitInfo.pWaitDstStageMask  = waitStages.data();
+        submitInfo.commandBufferCount = static_cast<uint32_t>(info.commandBuffers.size());
+        submitInfo.pCommandBuffers    = info.commandBuffers.data();
+
+        // Binary semaphores take a value too; it is ignored.
+        VkTimelineSemaphoreSubmitInfo timelineInfo{};
+        VkFence                       fence = nullptr;
+
+        if (m_Semaphore != nullptr) {
+            signalSemaphores.push_back(m_Semaphore);
+            signalValues.push_back(value);
+
+            timelineInfo.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+            timelineInfo.waitSemaphoreValueCount   = static_cast<uint32_t>(waitValues.size());
+            timelineInfo.pWaitSemaphoreValues      = waitValues.data();
+            timelineInfo.signalSemaphoreValueCount = static_cast<uint32_t>(signalValues.size());
+            timelineInfo.pSignalSemaphoreValues    = signalValues.data();
+            submitInfo.pNext                       = &timelineInfo;
+        } else {
+            PollFences();
+
+            if (m_FreeFences.empty()) {
+                VkFenceCreateInfo fenceInfo{};
+                fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+                if (vkCreateFence(m_Device, &fenceInfo, nullptr, &fence) != VK_SUCCESS) {
+                    throw std::runtime_error("Failed to submit to timeline: Could not create fence");
+                }
+            } else {
+                fence = m_FreeFences.back();
+                m_FreeFences.pop_back();
+            }
+        }
+
+        submitInfo.signalSemaphoreCount = static_cast<uint32_t>(signalSemaphores.size());
+        submitInfo.pSignalSemaphores    = signalSemaphores.data();
+
+        if (vkQueueSubmit(m_Queue, 1, &submitInfo, fence) != VK_SUCCESS) {
+            if (fence != nullptr) {
+                vkDestroyFence(m_Device, fence, nullptr);
+            }
+
+            throw std::runtime_error("Failed to submit to timeline: Unknown error");
+        }
+
+        if (fence != nullptr) {
+            m_PendingFences.push_back({value, fence});
+        }
+
+        m_Submitted = value;
+
+        return value;
+    }
+
+    bool QueueTimeline::Wait(const uint64_t value, const uint64_t timeout) const {
+        if (value > m_Submitted) {
+            throw std::runtime_error("Failed to wait for timeline: Value not submitted yet");
+        }
+
+        if (value <= m_Completed) {
+            return true;
+        }
+
+        VkResult result;
+
+        if (m_Semaphore != nullptr) {
+            VkSemaphoreWaitInfo waitInfo{};
+            waitInfo.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+            waitInfo.semaphoreCount = 1;
+            waitInfo.pSemaphores    = &m_Semaphore;
+            waitInfo.pValues        = &value;
+
+            result = m_Functions.waitSemaphores(m_Device, &waitInfo, timeout);
+        } else {
+            // Fences can signal out of order, so reaching value means waiting for everything before it too.
+            std::vector<VkFence> fences;
+            for (const auto &[pendingValue, fence] : m_PendingFences) {
+                if (pendingValue > value) {
+                    break;
+                }
+
+                fences.push_back(fence);
+            }
+
+            result = vkWaitForFences(m_Device, static_cast<uint32_t>(fences.size()), fences.data(), VK_TRUE,
+                                     timeout);
+        }
+
+        if (result == VK_TIMEOUT) {
+            return false;
+        }
+
+        if (result == VK_ERROR_DEVICE_LOST) {
+            throw std::runtime_error("Failed to wait for timeline: Device lost");
+        }
+
+        if (result != VK_SUCCESS) {
+            throw std::runtime_error("Failed to wait for timeline: Unknown error");
+        }
+
+        if (m_Semaphore == nullptr) {
+            PollFences();
+        }
+
+        m_Completed = std::max(m_Completed, value);
+
+        return true;
+    }
+
+    void QueueTimeline::WaitIdle() const {
+        Wait(m_Submitted);
+    }
+
+    uint64_t QueueTimeline::GetCompletedValue() const {
+        if (m_Completed == m_Submitted) {
+            return m_Completed;
+        }
+
+        if (m_Semaphore == nullptr) {
+            PollFences();
+            return m_Completed;
+        }
+
+        uint64_t value = 0;
+        if (m_Functions.getSemaphoreCounterValue(m_Device, m_Semaphore, &value) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to query timeline: Unknown error");
+        }
+
+        m_Completed = std::max(m_Completed, value);
+
+        return m_Completed;
+    }
+
+    bool QueueTimeline::IsComplete(const uint64_t value) const {
+        return value <= m_Completed || value <= GetCompletedValue();
+    }
+
+    uint64_t QueueTimeline::GetSubmittedValue() const {
+        return m_Submitted;
+    }
+
+    TimelinePoint QueueTimeline::GetNextPoint() const {
+        return {this, m_Submitted + 1};
+    }
+
+    TimelinePoint QueueTimeline::GetSubmittedPoint() const {
+        return {this, m_Submitted};
+    }
+
+    VkQueue QueueTimeline::GetVkQueue() const {
+        return m_Queue;
+    }
+
+    VkSemaphore QueueTimeline::GetVkSemaphore() const {
+        return m_Semaphore;
+    }
+
+    bool QueueTimeline::IsFenceBased() const {
+        return m_Semaphore == nullptr;
+    }
+
+    void QueueTimeline::Destroy() {
+        if (m_Device == nullptr) {
+            return;
+        }
+
+        // Whatever was submitted may still be using the semaphore or fences, so let it finish first. Errors are
+        // ignored: with a lost device there is nothing left to wait for.
+        if (m_Semaphore != nullptr) {
+            if (m_Submitted > m_Completed) {
+                VkSemaphoreWaitInfo waitInfo{};
+                waitInfo.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+                waitInfo.semaphoreCount = 1;
+                waitInfo.pSemaphores    = &m_Semaphore;
+                waitInfo.pValues        = &m_Submitted;
+
+                m_Functions.waitSemaphores(m_Device, &waitInfo, UINT64_MAX);
+            }
+
+            vkDestroySemaphore(m_Device, m_Semaphore, nullptr);
+            m_Semaphore = nullptr;
+        }
+
+        for (const auto &[value, fence] : m_PendingFences) {
+            vkWaitForFences(m_Device, 1, &fence, VK_TRUE, UINT64_MAX);
+            vkDestroyFence(m_Device, fence, nullptr);
+        }
+
+        for (const VkFence fence : m_FreeFences) {
+            vkDestroyFence(m_Device, fence, nullptr);
+        }
+
+        m_PendingFences.clear();
+        m_FreeFences.clear();
+        m_Device = nullptr;
+    }
+
+    void QueueTimeline::PollFences() const {
+        while (!m_PendingFences.empty() && vkGetFenceStatus(m_Device, m_PendingFences.front().fence) == VK_SUCCESS) {
+            const auto [value, fence] = m_PendingFences.front();
+            m_PendingFences.pop_front();
+
+            vkResetFences(m_Device, 1, &fence);
+            m_FreeFences.push_back(fence);
+            m_Completed = value;
+        }
+    }
+}
@@ -0,0 +1,106 @@
+#ifndef PULSAR_TIMELINE_HPP
+#define PULSAR_TIMELINE_HPP
+
+#include <deque>
+#include <span>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+namespace Pulsar::Vulkan {
+    class Device;
+    class QueueTimeline;
+
+    // Entry points of timeline semaphores, from core 1.2 or VK_KHR_timeline_semaphore. All null when the device
+    // has neither.
+    struct TimelineFunctions {
+        PFN_vkWaitSemaphoresKHR           waitSemaphores           = nullptr;
+        PFN_vkGetSemaphoreCounterValueKHR getSemaphoreCounterValue = nullptr;
+    };
+
+    // The moment a timeline reaches value, i.e. every submission up to and including value has finished.
+    struct TimelinePoint {
+        const QueueTimeline *timeline = nullptr;
+        uint64_t             value    = 0;
+    };
+
+    // Makes a submission wait for another submission, usually from another queue, before stages run.
+    struct TimelineWait {
+        TimelinePoint        point;
+        VkPipelineStageFlags stages = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    };
+
+    struct QueueSubmitInfo {
+        std::span<const VkCommandBuffer>      commandBuffers;
+        std::span<const TimelineWait>         waits;
+        // Binary semaphores still used by the swap chain, for acquire and present.
+        std::span<const VkSemaphore>          binaryWaits;
+        std::span<const VkPipelineStageFlags> binaryWaitStages;
+        std::span<const VkSemaphore>          binarySignals;
+    };
+
+    // Numbers every submission to one queue with a monotonically increasing value, and signals that value when
+    // the submission finishes. Anything that needs to know when GPU work is done holds on to the value instead of
+    // a fence or semaphore of its own.
+    //
+    // Backed by one timeline semaphore when the device supports them. Otherwise each submission gets a pooled
+    // fence, and waits on other queues become CPU waits before vkQueueSubmit, so they still order the work but
+    // stall the submitting thread. Not thread-safe; the queue needs external synchronization anyway.
+    class QueueTimeline {
+    public:
+        static QueueTimeline Create(const Device &device, VkQueue queue);
+
+        ~QueueTimeline();
+
+        QueueTimeline(const QueueTimeline &other) = delete;
+        QueueTimeline(QueueTimeline &&other) noexcept;
+
+        QueueTimeline &operator=(const QueueTimeline &other) = delete;
+        QueueTimeline &operator=(QueueTimeline &&other) noexcept;
+
+        // Returns the value the submission signals. Every wait must be on a timeline of the same device.
+        uint64_t Submit(const QueueSubmitInfo &info);
+
+        // Blocks until value is reached. Returns false on timeout; throws for values never submitted, which
+        // would never be reached.
+        bool Wait(uint64_t value, uint64_t timeout = UINT64_MAX) const;
+        void WaitIdle() const;
+
+        // Polls the GPU; the result is cached, so IsComplete on older values stays cheap.
+        [[nodiscard]] uint64_t GetCompletedValue() const;
+        [[nodiscard]] bool     IsComplete(uint64_t value) const;
+
+        [[nodiscard]] uint64_t      GetSubmittedValue() const;
+        // The value the next Submit signals, for marking resources used by commands still being recorded.
+        [[nodiscard]] TimelinePoint GetNextPoint() const;
+        [[nodiscard]] TimelinePoint GetSubmittedPoint() const;
+
+        [[nodiscard]] VkQueue     GetVkQueue() const;
+        [[nodiscard]] VkSemaphore GetVkSemaphore() const; // Null in fence mode.
+        [[nodiscard]] bool        IsFenceBased() const;
+
+    private:
+        struct PendingFence {
+            uint64_t value;
+            VkFence  fence;
+        };
+
+        VkDevice          m_Device    = nullptr;
+        VkQueue           m_Queue     = nullptr;
+        VkSemaphore       m_Semaphore = nullptr;
+        TimelineFunctions m_Functions = {};
+        uint64_t          m_Submitted = 0;
+
+        // Fence mode: submissions not yet seen finished, oldest first, and reset fences ready for reuse.
+        mutable std::deque<PendingFence> m_PendingFences;
+        mutable std::vector<VkFence>     m_FreeFences;
+        mutable uint64_t                 m_Completed = 0;
+
+        QueueTimeline() = default;
+
+        void Destroy();
+        void PollFences() const;
+    };
+}
+
+#endif //PULSAR_TIMELINE_HPP
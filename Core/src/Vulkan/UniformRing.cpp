@@ -0,0 +1,159 @@
+#include "UniformRing.hpp"
+
+namespace Pulsar::Vulkan {
+    static VkDeviceSize AlignUp(const VkDeviceSize value, const VkDeviceSize alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    UniformRing UniformRing::Create(Device &device, const VkDeviceSize frameSize, const uint32_t framesInFlight,
+                                    const VkBufferUsageFlags usage) {
+        if (frameSize == 0 || framesInFlight == 0) {
+            throw std::runtime_error("Failed to create uniform ring: Size and frame count must be non-zero");
+        }
+
+        VkPhysicalDeviceProperties properties;
+        vkGetPhysicalDeviceProperties(device.GetVkPhysicalDevice(), &properties);
+
+        const VkPhysicalDeviceLimits &limits = properties.limits;
+
+        // All of these are powers of two, so the largest is a multiple of the others.
+        const VkDeviceSize alignment = std::max({
+            limits.minUniformBufferOffsetAlignment, limits.minStorageBufferOffsetAlignment, VkDeviceSize{16}
+        });
+        const VkDeviceSize atomSize = std::max(limits.nonCoherentAtomSize, VkDeviceSize{1});
+
+        // Regions start and end on flushable boundaries, so a flush never touches the neighbouring frame.
+        const VkDeviceSize alignedFrameSize = AlignUp(frameSize, std::max(alignment, atomSize));
+        const VkDeviceSize size             = alignedFrameSize * framesInFlight;
+
+        if (size > std::numeric_limits<uint32_t>::max()) {
+            throw std::runtime_error("Failed to create uniform ring: Dynamic offsets would overflow");
+        }
+
+        Buffer buffer = [&] {
+            try {
+                return Buffer::Create(device, size, usage,
+                                      VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+            } catch (const std::runtime_error &) {
+                return Buffer::Create(device, size, usage, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+            }
+        }();
+
+        UniformRing ring(std::move(buffer));
+        ring.m_Mapped     = static_cast<std::byte *>(ring.m_Buffer.Map());
+        ring.m_FrameSize  = alignedFrameSize;
+        ring.m_Alignment  = alignment;
+        ring.m_AtomSize   = atomSize;
+        ring.m_FrameCount = framesInFlight;
+        ring.m_Coherent   = (ring.m_Buffer.GetMemoryProperties() & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+        ring.m_Device     = &device;
+
+        return ring;
+    }
+
+    UniformRing::UniformRing(Buffer &&buffer)
+        : m_Buffer(std::move(buffer)) {
+    }
+
+    UniformRing::UniformRing(UniformRing &&other) noexcept
+        : m_Buffer(std::move(other.m_Buffer)),
+          m_Mapped(std::exchange(other.m_Mapped, nullptr)),
+          m_FrameSize(std::exchange(other.m_FrameSize, 0)),
+          m_Alignment(std::exchange(other.m_Alignment, 0)),
+          m_AtomSize(std::exchange(other.m_AtomSize, 0)),
+          m_FrameCount(std::exchange(other.m_FrameCount, 0)),
+          m_Frame(std::exchange(other.m_Frame, 0)),
+          m_Head(std::exchange(other.m_Head, 0)),
+          m_FlushedHead(std::exchange(other.m_FlushedHead, 0)),
+          m_Coherent(std::exchange(other.m_Coherent, false)),
+          m_Device(other.m_Device) {
+    }
+
+    UniformRing &UniformRing::operator=(UniformRing &&other) noexcept {
+        if (this != &other) {
+            m_Buffer      = std::move(other.m_Buffer);
+            m_Mapped      = std::exchange(other.m_Mapped, nullptr);
+            m_FrameSize   = std::exchange(other.m_FrameSize, 0);
+            m_Alignment   = std::exchange(other.m_Alignment, 0);
+            m_AtomSize    = std::exchange(other.m_AtomSize, 0);
+            m_FrameCount  = std::exchange(other.m_FrameCount, 0);
+            m_Frame       = std::exchange(other.m_Frame, 0);
+            m_Head        = std::exchange(other.m_Head, 0);
+            m_FlushedHead = std::exchange(other.m_FlushedHead, 0);
+            m_Coherent    = std::exchange(other.m_Coherent, false);
+            m_Device      = other.m_Device;
+        }
+
+        return *this;
+    }
+
+    void UniformRing::BeginFrame(const uint32_t frameIndex) {
+        if (frameIndex >= m_FrameCount) {
+            throw std::runtime_error("Failed to begin uniform frame: Frame index out of range");
+        }
+
+        m_Frame       = frameIndex;
+        m_Head        = 0;
+        m_FlushedHead = 0;
+    }
+
+    UniformAllocation UniformRing::Allocate(const VkDeviceSize size) {
+        const VkDeviceSize offset = AlignUp(m_Head, m_Alignment);
+
+        if (offset + size > m_FrameSize) {
+            throw std::runtime_error("Failed to allocate uniform memory: Frame region is full");
+        }
+
+        m_Head = offset + size;
+
+        const VkDeviceSize regionOffset = m_Frame * m_FrameSize + offset;
+        return {m_Mapped + regionOffset, static_cast<uint32_t>(regionOffset)};
+    }
+
+    void UniformRing::Flush() {
+        if (m_FlushedHead == m_Head) {
+            return;
+        }
+
+        if (!m_Coherent) {
+            const VkDeviceSize regionOffset = m_Frame * m_FrameSize;
+            const VkDeviceSize begin        = m_FlushedHead / m_AtomSize * m_AtomSize;
+            const VkDeviceSize end          = std::min(AlignUp(m_Head, m_AtomSize), m_FrameSize);
+
+            VkMappedMemoryRange range{};
+            range.sType  = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+            range.memory = m_Buffer.GetVkDeviceMemory();
+            range.offset = regionOffset + begin;
+            range.size   = end - begin;
+
+            vkFlushMappedMemoryRanges(m_Device->GetVkLogicalDevice(), 1, &range);
+        }
+
+        m_FlushedHead = m_Head;
+    }
+
+    DescriptorWrite UniformRing::GetDescriptorWrite(const uint32_t binding, const VkDescriptorType type,
+                                                    const VkDeviceSize range) const {
+        return DescriptorWrite::Buffer(binding, type, m_Buffer.GetVkBuffer(), 0, range);
+    }
+
+    VkBuffer UniformRing::GetVkBuffer() const {
+        return m_Buffer.GetVkBuffer();
+    }
+
+    VkDeviceSize UniformRing::GetFrameSize() const {
+        return m_FrameSize;
+    }
+
+    VkDeviceSize UniformRing::GetAlignment() const {
+        return m_Alignment;
+    }
+
+    VkDeviceSize UniformRing::GetUsed() const {
+        return m_Head;
+    }
+
+    bool UniformRing::IsCoherent() const {
+        return m_Coherent;
+    }
+}
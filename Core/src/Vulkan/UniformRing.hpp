@@ -0,0 +1,78 @@
+#ifndef PULSAR_UNIFORMRING_HPP
+#define PULSAR_UNIFORMRING_HPP
+
+#include <cstring>
+
+#include "Buffer.hpp"
+#include "DescriptorAllocator.hpp"
+
+namespace Pulsar::Vulkan {
+    struct UniformAllocation {
+        std::byte *data   = nullptr;
+        uint32_t   offset = 0; // Dynamic offset to bind the allocation with.
+    };
+
+    // Ring of framesInFlight regions in one persistently mapped buffer, for per-draw constants. Allocations are
+    // aligned for both uniform and storage buffer offsets, and are bound through one descriptor with a dynamic
+    // offset instead of a buffer or descriptor per draw. Writes are plain memcpys; Flush publishes everything
+    // since the last one with at most one vkFlushMappedMemoryRanges, which coherent memory skips.
+    class UniformRing {
+    public:
+        // Picks host-visible device-local memory when there is any, so the GPU reads constants without a copy.
+        static UniformRing Create(Device &device, VkDeviceSize frameSize, uint32_t framesInFlight = 2,
+                                  VkBufferUsageFlags usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
+                                                             VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+
+        UniformRing(const UniformRing &other) = delete;
+        UniformRing(UniformRing &&other) noexcept;
+
+        UniformRing &operator=(const UniformRing &other) = delete;
+        UniformRing &operator=(UniformRing &&other) noexcept;
+
+        // Switches to frameIndex and starts its region over. The GPU must be done reading that frame.
+        void BeginFrame(uint32_t frameIndex);
+
+        // Throws when the frame's region is full.
+        [[nodiscard]] UniformAllocation Allocate(VkDeviceSize size);
+
+        template<typename T>
+        uint32_t Push(const T &value) {
+            static_assert(std::is_trivially_copyable_v<T>, "Uniform data must be trivially copyable");
+
+            const UniformAllocation allocation = Allocate(sizeof(T));
+            std::memcpy(allocation.data, &value, sizeof(T));
+
+            return allocation.offset;
+        }
+
+        // Makes everything allocated so far visible to the GPU. Must be called before submitting the draws.
+        void Flush();
+
+        // For a dynamic uniform or storage buffer descriptor covering range bytes from each allocation.
+        [[nodiscard]] DescriptorWrite GetDescriptorWrite(uint32_t binding, VkDescriptorType type,
+                                                         VkDeviceSize range) const;
+
+        [[nodiscard]] VkBuffer     GetVkBuffer() const;
+        [[nodiscard]] VkDeviceSize GetFrameSize() const;
+        [[nodiscard]] VkDeviceSize GetAlignment() const;
+        [[nodiscard]] VkDeviceSize GetUsed() const;
+        [[nodiscard]] bool         IsCoherent() const;
+
+    private:
+        Buffer       m_Buffer;
+        std::byte *  m_Mapped      = nullptr;
+        VkDeviceSize m_FrameSize   = 0;
+        VkDeviceSize m_Alignment   = 0;
+        VkDeviceSize m_AtomSize    = 0;
+        uint32_t     m_FrameCount  = 0;
+        uint32_t     m_Frame       = 0;
+        VkDeviceSize m_Head        = 0;
+        VkDeviceSize m_FlushedHead = 0;
+        bool         m_Coherent    = false;
+        Device *     m_Device      = nullptr;
+
+        explicit UniformRing(Buffer &&buffer);
+    };
+}
+
+#endif //PULSAR_UNIFORMRING_HPP
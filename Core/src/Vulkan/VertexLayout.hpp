@@ -0,0 +1,23 @@
+#ifndef PULSAR_VERTEXLAYOUT_HPP
+#define PULSAR_VERTEXLAYOUT_HPP
+
+#include <vector>
+
+#include <vulkan/vulkan_core.h>
+
+namespace Pulsar::Vulkan {
+    struct VertexAttribute {
+        uint32_t location = 0;
+        VkFormat format   = VK_FORMAT_UNDEFINED;
+        uint32_t offset   = 0;
+    };
+
+    // Describes one vertex buffer binding; the binding index is its position in PipelineConfig::vertexLayouts.
+    struct VertexLayout {
+        uint32_t                     stride    = 0;
+        VkVertexInputRate            inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        std::vector<VertexAttribute> attributes;
+    };
+}
+
+#endif //PULSAR_VERTEXLAYOUT_HPP
@@ -1,4 +1,7 @@
 #include "Glfw/Window.hpp"
+#include "Mesh/GpuMesh.hpp"
+#include "Mesh/MeshProcessing.hpp"
+#include "Mesh/Primitives.hpp"
 #include "Vulkan/Device.hpp"
 #include "Vulkan/ImageViews.hpp"
 #include "Vulkan/Instance.hpp"
@@ -9,23 +12,28 @@
 static constexpr auto s_VertShader = R"(
 #version 450
 
-vec2 positions[3] = vec2[](
-    vec2(0.0, -0.5),
-    vec2(0.5, 0.5),
-    vec2(-0.5, 0.5)
-);
+layout(push_constant) uniform MeshBounds {
+    vec4 center;
+    vec4 extent;
+} bounds;
 
-vec3 colors[3] = vec3[](
-    vec3(1.0, 0.0, 0.0),
-    vec3(0.0, 1.0, 0.0),
-    vec3(0.0, 0.0, 1.0)
-);
+layout(location = 0) in vec4 inPosition;
+layout(location = 1) in vec2 inNormal;
+layout(location = 2) in vec2 inUv;
 
 layout(location = 0) out vec3 fragColor;
 
+vec3 DecodeOctahedral(vec2 e) {
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.xy += vec2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t);
+    return normalize(n);
+}
+
 void main() {
-    gl_Position = vec4(positions[gl_VertexIndex], 0.0, 1.0);
-    fragColor = colors[gl_VertexIndex];
+    vec3 position = inPosition.xyz * bounds.extent.xyz + bounds.center.xyz;
+    gl_Position = vec4(position * 0.5, 1.0);
+    fragColor = DecodeOctahedral(inNormal) * 0.5 + 0.5;
 }
 )";
 
@@ -51,9 +59,24 @@ int main() {
     Device       device     = Device::Create(instance, surface);
     SwapChain    swapChain  = SwapChain::Create(surface, device, window);
     ImageViews   imageViews = ImageViews::Create(device, swapChain);
-    Pipeline     pipeline   = Pipeline::Create(device, s_VertShader, s_FragShader);
+
+    Mesh::MeshData sphere = Mesh::GenerateSphere(64, 32);
+    Mesh::OptimizeMesh(sphere);
+    Mesh::GpuMesh mesh = Mesh::GpuMesh::Create(device, Mesh::QuantizeMesh(sphere));
+
+    PipelineConfig pipelineConfig;
+    pipelineConfig.vertexLayouts      = {Mesh::GpuMesh::GetVertexLayout()};
+    pipelineConfig.pushConstantRanges = {{VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(Mesh::MeshBounds)}};
+    pipelineConfig.colorFormat        = swapChain.GetVkImageFormat();
+    pipelineConfig.extent             = swapChain.GetVkExtent();
+
+    Pipeline pipeline = Pipeline::Create(device, s_VertShader, s_FragShader, pipelineConfig);
 
     while (!window.ShouldClose()) {
-        Glfw::PollEvents();
+        if (window.IsMinimized() || !window.IsFocused()) {
+            Glfw::WaitEventsTimeout(0.1);
+        } else {
+            Glfw::PollEvents();
+        }
     }
 }
@@ -0,0 +1,232 @@
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "FileIo/Archive.hpp"
+#include "FileIo/ArchiveWriter.hpp"
+#include "FileIo/File.hpp"
+
+namespace {
+    using namespace Pulsar;
+
+    constexpr std::string_view s_RawPath        = "data/raw.bin";
+    constexpr std::string_view s_CompressedPath = "data/text.txt";
+
+    // An archive with one incompressible entry, stored raw, and one that LZ4 shrinks.
+    class ArchiveTest : public testing::Test {
+    protected:
+        std::filesystem::path  m_Directory;
+        std::vector<std::byte> m_Raw;
+        std::vector<std::byte> m_Compressed;
+        std::vector<std::byte> m_Archive;
+
+        void SetUp() override {
+            m_Directory = std::filesystem::temp_directory_path() /
+                          ("PulsarTests-" + std::string(testing::UnitTest::GetInstance()->current_test_info()->name()));
+            std::filesystem::create_directories(m_Directory);
+
+            std::mt19937 random(7);
+            for (uint32_t i = 0; i < 300; i++) {
+                m_Raw.push_back(static_cast<std::byte>(random()));
+            }
+
+            for (uint32_t i = 0; i < 40; i++) {
+                for (const char character : std::string_view("pulsar archive ")) {
+                    m_Compressed.push_back(static_cast<std::byte>(character));
+                }
+            }
+
+            FileIo::ArchiveWriter writer = FileIo::ArchiveWriter::Create();
+            writer.Add(s_RawPath, m_Raw);
+            writer.Add(s_CompressedPath, m_Compressed);
+            writer.Write(GetPath());
+
+            m_Archive = FileIo::ReadFileBytes(GetPath());
+        }
+
+        void TearDown() override {
+            std::filesystem::remove_all(m_Directory);
+        }
+
+        [[nodiscard]] std::string GetPath() const {
+            return (m_Directory / "test.pak").string();
+        }
+
+        [[nodiscard]] FileIo::ArchiveHeader GetHeader() const {
+            FileIo::ArchiveHeader header;
+            std::memcpy(&header, m_Archive.data(), sizeof(header));
+
+            return header;
+        }
+
+        void SetHeader(const FileIo::ArchiveHeader &header) {
+            std::memcpy(m_Archive.data(), &header, sizeof(header));
+        }
+
+        // Offset of the index entry for path within m_Archive.
+        [[nodiscard]] size_t GetEntryOffset(const std::string_view path) const {
+            const FileIo::ArchiveHeader header = GetHeader();
+
+            for (uint32_t i = 0; i < header.entryCount; i++) {
+                const size_t offset = header.indexOffset + i * sizeof(FileIo::ArchiveEntry);
+
+                FileIo::ArchiveEntry entry;
+                std::memcpy(&entry, m_Archive.data() + offset, sizeof(entry));
+
+                if (entry.pathHash == FileIo::HashArchivePath(path)) {
+                    return offset;
+                }
+            }
+
+            throw std::runtime_error("Failed to find entry: " + std::string(path));
+        }
+
+        [[nodiscard]] FileIo::ArchiveEntry GetEntry(const std::string_view path) const {
+            FileIo::ArchiveEntry entry;
+            std::memcpy(&entry, m_Archive.data() + GetEntryOffset(path), sizeof(entry));
+
+            return entry;
+        }
+
+        void SetEntry(const std::string_view path, const FileIo::ArchiveEntry &entry) {
+            std::memcpy(m_Archive.data() + GetEntryOffset(path), &entry, sizeof(entry));
+        }
+
+        void WriteArchive(const size_t size) const {
+            std::ofstream file(GetPath(), std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char *>(m_Archive.data()), static_cast<std::streamsize>(size));
+        }
+
+        void ExpectOpenFails(const std::string_view message) const {
+            WriteArchive(m_Archive.size());
+
+            try {
+                (void)FileIo::Archive::Open(GetPath());
+                ADD_FAILURE() << "Expected \"" << message << "\"";
+            } catch (const std::runtime_error &error) {
+                EXPECT_EQ(error.what(), message);
+            }
+        }
+    };
+}
+
+TEST_F(ArchiveTest, ReadsBackEveryEntry) {
+    const FileIo::Archive archive = FileIo::Archive::Open(GetPath());
+
+    ASSERT_EQ(archive.GetEntries().size(), 2U);
+    EXPECT_EQ(archive.Read(s_RawPath), m_Raw);
+    EXPECT_EQ(archive.Read("./data\\text.txt"), m_Compressed);
+    EXPECT_FALSE(archive.Contains("data/missing.txt"));
+
+    const FileIo::ArchiveEntry *raw = archive.Find(s_RawPath);
+    ASSERT_NE(raw, nullptr);
+    ASSERT_EQ(raw->compression, FileIo::ArchiveCompression::None);
+
+    const std::optional<std::span<const std::byte>> view = archive.View(*raw);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_TRUE(std::equal(view->begin(), view->end(), m_Raw.begin(), m_Raw.end()));
+
+    const FileIo::ArchiveEntry *compressed = archive.Find(s_CompressedPath);
+    ASSERT_NE(compressed, nullptr);
+    EXPECT_EQ(compressed->compression, FileIo::ArchiveCompression::Lz4);
+    EXPECT_FALSE(archive.View(*compressed).has_value());
+}
+
+TEST_F(ArchiveTest, RejectsEveryTruncation) {
+    for (size_t size = 0; size < m_Archive.size(); size++) {
+        WriteArchive(size);
+        EXPECT_THROW((void)FileIo::Archive::Open(GetPath()), std::runtime_error) << "size " << size;
+    }
+}
+
+TEST_F(ArchiveTest, RejectsBadMagicAndVersion) {
+    FileIo::ArchiveHeader header = GetHeader();
+    header.magic[0]              = 'X';
+    SetHeader(header);
+    ExpectOpenFails("Failed to open archive: Invalid magic");
+
+    header.magic   = FileIo::g_ArchiveMagic;
+    header.version = FileIo::g_ArchiveVersion + 1;
+    SetHeader(header);
+    ExpectOpenFails("Failed to open archive: Unsupported version");
+}
+
+TEST_F(ArchiveTest, RejectsOverflowingIndex) {
+    const FileIo::ArchiveHeader original = GetHeader();
+    constexpr uint64_t          s_Max    = std::numeric_limits<uint64_t>::max();
+
+    // Each of these wraps around to a small end offset when added naively.
+    FileIo::ArchiveHeader header = original;
+    header.indexOffset           = s_Max - 15;
+    SetHeader(header);
+    ExpectOpenFails("Failed to open archive: Corrupt index");
+
+    header            = original;
+    header.entryCount = std::numeric_limits<uint32_t>::max();
+    SetHeader(header);
+    ExpectOpenFails("Failed to open archive: Corrupt index");
+
+    header                   = original;
+    header.stringTableOffset = s_Max - 1;
+    SetHeader(header);
+    ExpectOpenFails("Failed to open archive: Corrupt index");
+
+    header                 = original;
+    header.stringTableSize = s_Max;
+    SetHeader(header);
+    ExpectOpenFails("Failed to open archive: Corrupt index");
+
+    header             = original;
+    header.indexOffset = original.indexOffset + 1;
+    SetHeader(header);
+    ExpectOpenFails("Failed to open archive: Corrupt index");
+}
+
+TEST_F(ArchiveTest, RejectsOverflowingEntries) {
+    const FileIo::ArchiveEntry original = GetEntry(s_CompressedPath);
+    constexpr uint64_t         s_Max    = std::numeric_limits<uint64_t>::max();
+
+    FileIo::ArchiveEntry entry = original;
+    entry.offset               = s_Max - 7;
+    SetEntry(s_CompressedPath, entry);
+    ExpectOpenFails("Failed to open archive: Entry out of bounds");
+
+    entry            = original;
+    entry.storedSize = s_Max - original.offset + 1;
+    SetEntry(s_CompressedPath, entry);
+    ExpectOpenFails("Failed to open archive: Entry out of bounds");
+
+    entry            = original;
+    entry.storedSize = m_Archive.size();
+    SetEntry(s_CompressedPath, entry);
+    ExpectOpenFails("Failed to open archive: Entry out of bounds");
+
+    entry            = original;
+    entry.pathOffset = std::numeric_limits<uint32_t>::max();
+    SetEntry(s_CompressedPath, entry);
+    ExpectOpenFails("Failed to open archive: Entry out of bounds");
+
+    entry            = original;
+    entry.pathLength = original.pathLength + static_cast<uint32_t>(GetHeader().stringTableSize);
+    SetEntry(s_CompressedPath, entry);
+    ExpectOpenFails("Failed to open archive: Entry out of bounds");
+}
+
+TEST_F(ArchiveTest, RejectsRawSizeMismatch) {
+    // View would hand out bytes past the stored data.
+    FileIo::ArchiveEntry entry = GetEntry(s_RawPath);
+    entry.size                 = entry.storedSize + 16;
+    SetEntry(s_RawPath, entry);
+    ExpectOpenFails("Failed to open archive: Entry size mismatch");
+}
+
+TEST_F(ArchiveTest, RejectsCorruptLz4Data) {
+    // The stored range is valid, so Open succeeds and Read must catch it.
+    FileIo::ArchiveEntry entry = GetEntry(s_CompressedPath);
+    entry.size                 = entry.size + 1;
+    SetEntry(s_CompressedPath, entry);
+    WriteArchive(m_Archive.size());
+
+    const FileIo::Archive archive = FileIo::Archive::Open(GetPath());
+    EXPECT_THROW((void)archive.Read(s_CompressedPath), std::runtime_error);
+}
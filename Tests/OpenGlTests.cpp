@@ -0,0 +1,242 @@
+#include <gtest/gtest.h>
+
+#include "Glfw/Window.hpp"
+#include "OpenGl/DrawSubmitter.hpp"
+
+namespace {
+    using namespace Pulsar;
+
+    constexpr GLsizei  s_TargetSize = 64;
+    constexpr uint32_t s_GridSize   = 4;
+    constexpr GLsizei  s_CellSize   = s_TargetSize / static_cast<GLsizei>(s_GridSize);
+
+    // Places each object in its own grid cell and writes its instance data out as the color, so a pixel shows
+    // which object, mesh and program drew it. Mesh bounds come from the pool's buffer texture.
+    constexpr auto s_VertexShader = R"(
+#version 330 core
+
+layout(location = 0) in vec4  inPosition;
+layout(location = 3) in uvec2 inInstance;
+
+uniform samplerBuffer bounds;
+
+flat out uvec2 instance;
+
+void main() {
+    vec3 center   = texelFetch(bounds, int(inInstance.y) * 2).xyz;
+    vec3 extent   = texelFetch(bounds, int(inInstance.y) * 2 + 1).xyz;
+    vec2 position = inPosition.xy * extent.xy + center.xy;
+    vec2 cell     = vec2(inInstance.x % 4u, inInstance.x / 4u) * 0.25;
+
+    gl_Position = vec4((cell + (position * 0.5 + 0.5) * 0.25) * 2.0 - 1.0, 0.0, 1.0);
+    instance    = inInstance;
+}
+)";
+
+    constexpr auto s_FragmentShader = R"(
+#version 330 core
+
+flat in uvec2 instance;
+
+uniform float programTag;
+
+out vec4 outColor;
+
+void main() {
+    outColor = vec4(float(instance.x * 16u) / 255.0, float(instance.y * 128u) / 255.0, programTag, 1.0);
+}
+)";
+
+    GLuint CompileShader(const GLenum type, const char *source) {
+        const GLuint shader = glCreateShader(type);
+        glShaderSource(shader, 1, &source, nullptr);
+        glCompileShader(shader);
+
+        GLint status = GL_FALSE;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+
+        if (status != GL_TRUE) {
+            std::array<char, 1024> log{};
+            glGetShaderInfoLog(shader, static_cast<GLsizei>(log.size()), nullptr, log.data());
+            throw std::runtime_error("Failed to compile shader: " + std::string(log.data()));
+        }
+
+        return shader;
+    }
+
+    // A square spanning the bounds; extent scales it around the cell center.
+    Mesh::QuantizedMesh MakeSquare(const float extent) {
+        Mesh::QuantizedMesh mesh;
+
+        for (const int16_t y : {-32767, 32767}) {
+            for (const int16_t x : {-32767, 32767}) {
+                mesh.vertices.push_back({{x, y, 0, 0}, {0, 0}, {0, 0}});
+            }
+        }
+
+        mesh.indices      = {0, 1, 2, 2, 1, 3};
+        mesh.boundsExtent = {extent, extent, 1.0F};
+
+        return mesh;
+    }
+
+    // Needs a real OpenGL context; skips where no display or driver is available.
+    class OpenGlTest : public testing::Test {
+    protected:
+        std::optional<Glfw::Window>   m_Window;
+        std::optional<OpenGl::Device> m_Device;
+        std::array<GLuint, 2>         m_Programs{};
+        GLuint                        m_Framebuffer  = 0;
+        GLuint                        m_Renderbuffer = 0;
+
+        void SetUp() override {
+            Glfw::WindowConfig config;
+            config.width  = s_TargetSize;
+            config.height = s_TargetSize;
+            config.api    = GraphicsApi::OpenGl;
+
+            try {
+                m_Window = Glfw::Window::Create(config);
+            } catch (const std::runtime_error &error) {
+                GTEST_SKIP() << error.what();
+            }
+
+            m_Device = OpenGl::Device::Create(*m_Window);
+
+            const GLuint vertexShader   = CompileShader(GL_VERTEX_SHADER, s_VertexShader);
+            const GLuint fragmentShader = CompileShader(GL_FRAGMENT_SHADER, s_FragmentShader);
+
+            for (size_t i = 0; i < m_Programs.size(); i++) {
+                m_Programs[i] = glCreateProgram();
+                glAttachShader(m_Programs[i], vertexShader);
+                glAttachShader(m_Programs[i], fragmentShader);
+                glLinkProgram(m_Programs[i]);
+
+                m_Device->GetStateCache().UseProgram(m_Programs[i]);
+                glUniform1i(glGetUniformLocation(m_Programs[i], "bounds"), 0);
+                glUniform1f(glGetUniformLocation(m_Programs[i], "programTag"), static_cast<float>(i));
+            }
+
+            glDeleteShader(vertexShader);
+            glDeleteShader(fragmentShader);
+
+            glGenRenderbuffers(1, &m_Renderbuffer);
+            glBindRenderbuffer(GL_RENDERBUFFER, m_Renderbuffer);
+            glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, s_TargetSize, s_TargetSize);
+
+            glGenFramebuffers(1, &m_Framebuffer);
+            glBindFramebuffer(GL_FRAMEBUFFER, m_Framebuffer);
+            glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_Renderbuffer);
+
+            m_Device->GetStateCache().SetViewport(0, 0, s_TargetSize, s_TargetSize);
+        }
+
+        void TearDown() override {
+            if (!m_Device) {
+                return;
+            }
+
+            glDeleteFramebuffers(1, &m_Framebuffer);
+            glDeleteRenderbuffers(1, &m_Renderbuffer);
+
+            for (const GLuint program : m_Programs) {
+                glDeleteProgram(program);
+            }
+        }
+    };
+}
+
+TEST_F(OpenGlTest, DrawSubmitterDrawsEveryInstance) {
+    const OpenGl::DeviceCapabilities &capabilities = m_Device->GetCapabilities();
+    RecordProperty("Renderer", m_Device->GetRenderer());
+    RecordProperty("MultiDrawIndirect", capabilities.multiDrawIndirect ? "true" : "false");
+    RecordProperty("BaseInstance", capabilities.baseInstance ? "true" : "false");
+    RecordProperty("BufferStorage", capabilities.bufferStorage ? "true" : "false");
+
+    OpenGl::MeshPool pool = OpenGl::MeshPool::Create(*m_Device, 64, 64, 4);
+    pool.Add(MakeSquare(1.0F));
+    pool.Add(MakeSquare(0.5F));
+
+    OpenGl::DrawSubmitter submitter = OpenGl::DrawSubmitter::Create(*m_Device, 4096, 3);
+    EXPECT_EQ(submitter.GetStreamBuffer().IsPersistent(), capabilities.bufferStorage);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_BUFFER, pool.GetBoundsTexture());
+
+    Renderer::DrawList list;
+
+    // More frames than regions, alternating object counts, so every region is reused with different offsets.
+    for (uint32_t frame = 0; frame < 8; frame++) {
+        const uint32_t objectCount = frame % 2 == 0 ? s_GridSize * s_GridSize : 9;
+
+        // Two programs, two descriptor sets and two meshes, interleaved so batches hold several commands.
+        list.Clear();
+        for (uint32_t object = 0; object < objectCount; object++) {
+            list.Submit(object % 2, object / 8, object / 2 % 2, 0, object);
+        }
+
+        list.Build(pool.GetRanges());
+
+        uint32_t bindCount = 0;
+
+        submitter.BeginFrame();
+        glClearColor(0.0F, 0.0F, 0.0F, 0.0F);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        const Renderer::SubmitStatistics statistics = submitter.Record(list, pool, m_Programs, [&bindCount](uint32_t) {
+            bindCount++;
+        });
+
+        submitter.EndFrame();
+
+        ASSERT_EQ(glGetError(), static_cast<GLenum>(GL_NO_ERROR)) << "frame " << frame;
+        EXPECT_EQ(statistics.instances, objectCount);
+        EXPECT_EQ(bindCount, statistics.batches);
+        EXPECT_EQ(statistics.indirectCalls, capabilities.multiDrawIndirect ? statistics.batches : 0);
+
+        std::vector<uint8_t> pixels(static_cast<size_t>(s_TargetSize) * s_TargetSize * 4);
+        glReadPixels(0, 0, s_TargetSize, s_TargetSize, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+
+        const auto getPixel = [&pixels](const GLsizei x, const GLsizei y) {
+            const uint8_t *pixel = &pixels[(static_cast<size_t>(y) * s_TargetSize + x) * 4];
+            return std::array{pixel[0], pixel[1], pixel[2], pixel[3]};
+        };
+
+        for (uint32_t object = 0; object < s_GridSize * s_GridSize; object++) {
+            const GLsizei  x     = static_cast<GLsizei>(object % s_GridSize) * s_CellSize;
+            const GLsizei  y     = static_cast<GLsizei>(object / s_GridSize) * s_CellSize;
+            const uint32_t mesh  = object / 2 % 2;
+            const bool     drawn = object < objectCount;
+
+            const std::array<uint8_t, 4> expected = {
+                static_cast<uint8_t>(drawn ? object * 16 : 0), static_cast<uint8_t>(drawn ? mesh * 128 : 0),
+                static_cast<uint8_t>(drawn ? object % 2 * 255 : 0), static_cast<uint8_t>(drawn ? 255 : 0)
+            };
+
+            // The center shows whether the right instance was drawn; the corner, whether with the right mesh.
+            EXPECT_EQ(getPixel(x + s_CellSize / 2, y + s_CellSize / 2), expected)
+                << "frame " << frame << ", object " << object;
+            EXPECT_EQ(getPixel(x + 1, y + 1)[3], drawn && mesh == 0 ? 255 : 0)
+                << "frame " << frame << ", object " << object;
+        }
+    }
+}
+
+TEST_F(OpenGlTest, DrawSubmitterRejectsUnknownPrograms) {
+    OpenGl::MeshPool pool = OpenGl::MeshPool::Create(*m_Device, 64, 64, 4);
+    pool.Add(MakeSquare(1.0F));
+
+    OpenGl::DrawSubmitter submitter = OpenGl::DrawSubmitter::Create(*m_Device, 4096, 3);
+
+    Renderer::DrawList list;
+    list.Submit(static_cast<uint32_t>(m_Programs.size()), 0, 0, 0, 0);
+    list.Build(pool.GetRanges());
+
+    submitter.BeginFrame();
+    EXPECT_THROW((void)submitter.Record(list, pool, m_Programs), std::runtime_error);
+
+    // A caller retrying after the failure may end the frame twice; the region keeps only the newest fence.
+    submitter.EndFrame();
+    submitter.EndFrame();
+    EXPECT_EQ(glGetError(), static_cast<GLenum>(GL_NO_ERROR));
+}
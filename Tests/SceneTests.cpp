@@ -0,0 +1,276 @@
+#include <gtest/gtest.h>
+
+#include "Scene/Scene.hpp"
+#include "Scene/SceneWriter.hpp"
+
+namespace {
+    using namespace Pulsar;
+
+    // Validate requires 16-byte aligned data, as a mapping provides.
+    struct alignas(Scene::g_SceneAlignment) AlignedChunk {
+        std::array<std::byte, Scene::g_SceneAlignment> bytes;
+    };
+
+    class SceneBuffer {
+    public:
+        explicit SceneBuffer(const std::vector<std::byte> &data)
+            : m_Chunks((data.size() + sizeof(AlignedChunk) - 1) / sizeof(AlignedChunk)), m_Size(data.size()) {
+            if (!data.empty()) {
+                std::memcpy(m_Chunks.data(), data.data(), data.size());
+            }
+        }
+
+        [[nodiscard]] std::span<const std::byte> GetData() const {
+            return {reinterpret_cast<const std::byte *>(m_Chunks.data()), m_Size};
+        }
+
+    private:
+        std::vector<AlignedChunk> m_Chunks;
+        size_t                    m_Size;
+    };
+
+    // Three nodes in a chain, the middle one with a mesh renderer.
+    std::vector<std::byte> MakeScene() {
+        Scene::SceneWriter writer = Scene::SceneWriter::Create();
+
+        const uint32_t root  = writer.AddNode("Root", Math::Mat4::Identity());
+        const uint32_t child = writer.AddNode("Child", Math::Translate({1.0F, 2.0F, 3.0F}), root);
+        writer.AddNode("Leaf", Math::Scale({2.0F, 2.0F, 2.0F}), child);
+        writer.SetMeshRenderer(child, {4, 5, 6});
+
+        return writer.Serialize();
+    }
+
+    Scene::SceneHeader GetHeader(const std::vector<std::byte> &data) {
+        Scene::SceneHeader header;
+        std::memcpy(&header, data.data(), sizeof(header));
+
+        return header;
+    }
+
+    void SetHeader(std::vector<std::byte> &data, const Scene::SceneHeader &header) {
+        std::memcpy(data.data(), &header, sizeof(header));
+    }
+
+    size_t GetSectionOffset(const std::vector<std::byte> &data, const Scene::SceneSectionType type) {
+        for (uint32_t i = 0; i < GetHeader(data).sectionCount; i++) {
+            const size_t offset = sizeof(Scene::SceneHeader) + i * sizeof(Scene::SceneSection);
+
+            Scene::SceneSection section;
+            std::memcpy(&section, data.data() + offset, sizeof(section));
+
+            if (section.type == type) {
+                return offset;
+            }
+        }
+
+        throw std::runtime_error("Failed to find section");
+    }
+
+    Scene::SceneSection GetSection(const std::vector<std::byte> &data, const Scene::SceneSectionType type) {
+        Scene::SceneSection section;
+        std::memcpy(&section, data.data() + GetSectionOffset(data, type), sizeof(section));
+
+        return section;
+    }
+
+    void SetSection(std::vector<std::byte> &data, const Scene::SceneSection &section) {
+        std::memcpy(data.data() + GetSectionOffset(data, section.type), &section, sizeof(section));
+    }
+
+    // Records are patched through memcpy since the file bytes are not aligned for T.
+    template<typename T>
+    T GetRecord(const std::vector<std::byte> &data, const Scene::SceneSectionType type, const uint32_t index) {
+        const Scene::SceneSection section = GetSection(data, type);
+
+        T record;
+        std::memcpy(&record, data.data() + section.offset + static_cast<size_t>(index) * section.stride, sizeof(T));
+
+        return record;
+    }
+
+    template<typename T>
+    void SetRecord(std::vector<std::byte> &data, const Scene::SceneSectionType type, const uint32_t index,
+                   const T &record) {
+        const Scene::SceneSection section = GetSection(data, type);
+        std::memcpy(data.data() + section.offset + static_cast<size_t>(index) * section.stride, &record, sizeof(T));
+    }
+
+    void ExpectInvalid(const std::vector<std::byte> &data, const std::string_view message) {
+        const SceneBuffer buffer(data);
+
+        try {
+            Scene::Scene::Validate(buffer.GetData());
+            ADD_FAILURE() << "Expected \"" << message << "\"";
+        } catch (const std::runtime_error &error) {
+            EXPECT_EQ(error.what(), message);
+        }
+    }
+}
+
+TEST(Scene, OpensAndInstantiatesWrittenScene) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "PulsarTests-Scene.pscene";
+
+    {
+        const std::vector<std::byte> data = MakeScene();
+        std::ofstream                file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()));
+    }
+
+    const Scene::Scene scene = Scene::Scene::Open(path.string());
+    std::filesystem::remove(path);
+
+    ASSERT_EQ(scene.GetNodeCount(), 3U);
+    EXPECT_EQ(scene.GetName(scene.GetNodes()[1]), "Child");
+    EXPECT_EQ(scene.GetNodes()[0].parent, Scene::g_SceneNoParent);
+    EXPECT_EQ(scene.GetNodes()[2].parent, 1U);
+    EXPECT_EQ(scene.GetTransforms()[1], Math::Translate({1.0F, 2.0F, 3.0F}));
+
+    Ecs::World                     world;
+    const std::vector<Ecs::Entity> entities = scene.Instantiate(world);
+    ASSERT_EQ(entities.size(), 3U);
+
+    EXPECT_EQ(world.GetComponent<Renderer::MeshRenderer>(entities[0]), nullptr);
+    EXPECT_EQ(world.GetComponent<Renderer::WorldTransform>(entities[2])->matrix, Math::Scale({2.0F, 2.0F, 2.0F}));
+
+    const auto *meshRenderer = world.GetComponent<Renderer::MeshRenderer>(entities[1]);
+    ASSERT_NE(meshRenderer, nullptr);
+    EXPECT_EQ(meshRenderer->pipeline, 4U);
+    EXPECT_EQ(meshRenderer->descriptorSet, 5U);
+    EXPECT_EQ(meshRenderer->mesh, 6U);
+}
+
+TEST(Scene, RejectsEveryTruncation) {
+    const std::vector<std::byte> data = MakeScene();
+
+    uint64_t sectionsEnd = 0;
+    for (const auto type : {Scene::SceneSectionType::Nodes, Scene::SceneSectionType::Transforms,
+                            Scene::SceneSectionType::MeshRenderers, Scene::SceneSectionType::Strings}) {
+        const Scene::SceneSection section = GetSection(data, type);
+        sectionsEnd                       = std::max(sectionsEnd, section.offset + section.size);
+    }
+
+    for (size_t size = 0; size < data.size(); size++) {
+        std::vector<std::byte> truncated(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(size));
+        EXPECT_THROW(Scene::Scene::Validate(SceneBuffer(truncated).GetData()), std::runtime_error) << size;
+
+        // Also with the header patched to the new size, so the section checks have to catch it. Only the
+        // padding after the last section may go.
+        if (size >= sizeof(Scene::SceneHeader)) {
+            Scene::SceneHeader header = GetHeader(truncated);
+            header.fileSize           = size;
+            SetHeader(truncated, header);
+
+            if (size < sectionsEnd) {
+                EXPECT_THROW(Scene::Scene::Validate(SceneBuffer(truncated).GetData()), std::runtime_error) << size;
+            } else {
+                EXPECT_NO_THROW(Scene::Scene::Validate(SceneBuffer(truncated).GetData())) << size;
+            }
+        }
+    }
+}
+
+TEST(Scene, RejectsBadHeaders) {
+    const std::vector<std::byte> original = MakeScene();
+    std::vector<std::byte>       data     = original;
+
+    Scene::SceneHeader header = GetHeader(data);
+    header.magic[3]           = 'X';
+    SetHeader(data, header);
+    ExpectInvalid(data, "Failed to validate scene: Invalid magic");
+
+    header         = GetHeader(original);
+    header.version = Scene::g_SceneVersion + 1;
+    SetHeader(data, header);
+    ExpectInvalid(data, "Failed to validate scene: Unsupported version");
+
+    header              = GetHeader(original);
+    header.sectionCount = std::numeric_limits<uint32_t>::max();
+    SetHeader(data, header);
+    ExpectInvalid(data, "Failed to validate scene: Corrupt section table");
+}
+
+TEST(Scene, RejectsOverflowingSections) {
+    const std::vector<std::byte> original = MakeScene();
+    const Scene::SceneSection    nodes    = GetSection(original, Scene::SceneSectionType::Nodes);
+    constexpr uint64_t           s_Max    = std::numeric_limits<uint64_t>::max();
+
+    std::vector<std::byte> data    = original;
+    Scene::SceneSection    section = nodes;
+
+    // Aligned, so only the bounds check can reject it.
+    section.offset = s_Max - (Scene::g_SceneAlignment - 1);
+    SetSection(data, section);
+    ExpectInvalid(data, "Failed to validate scene: Section out of bounds");
+
+    // offset + size wraps around to zero.
+    section      = nodes;
+    section.size = s_Max - nodes.offset + 1;
+    SetSection(data, section);
+    ExpectInvalid(data, "Failed to validate scene: Section out of bounds");
+
+    section        = nodes;
+    section.offset = nodes.offset + 4;
+    SetSection(data, section);
+    ExpectInvalid(data, "Failed to validate scene: Section out of bounds");
+
+    // count * stride would wrap in 32 bits.
+    section        = nodes;
+    section.count  = std::numeric_limits<uint32_t>::max();
+    section.stride = 1U << 31;
+    SetSection(data, section);
+    ExpectInvalid(data, "Failed to validate scene: Corrupt section");
+
+    section        = nodes;
+    section.stride = sizeof(Scene::SceneNode) - 4;
+    SetSection(data, section);
+    ExpectInvalid(data, "Failed to validate scene: Corrupt section");
+
+    data         = original;
+    section      = GetSection(original, Scene::SceneSectionType::Transforms);
+    section.type = Scene::SceneSectionType::Nodes;
+    std::memcpy(data.data() + GetSectionOffset(original, Scene::SceneSectionType::Transforms), &section,
+                sizeof(section));
+    ExpectInvalid(data, "Failed to validate scene: Duplicate section");
+}
+
+TEST(Scene, RejectsBadRecords) {
+    const std::vector<std::byte> original = MakeScene();
+    std::vector<std::byte>       data     = original;
+
+    // nameOffset + nameLength wraps in 32 bits.
+    Scene::SceneNode node = GetRecord<Scene::SceneNode>(original, Scene::SceneSectionType::Nodes, 1);
+    node.nameOffset       = std::numeric_limits<uint32_t>::max();
+    SetRecord(data, Scene::SceneSectionType::Nodes, 1, node);
+    ExpectInvalid(data, "Failed to validate scene: Name out of bounds");
+
+    data        = original;
+    node        = GetRecord<Scene::SceneNode>(original, Scene::SceneSectionType::Nodes, 1);
+    node.parent = 2;
+    SetRecord(data, Scene::SceneSectionType::Nodes, 1, node);
+    ExpectInvalid(data, "Failed to validate scene: Parent after child");
+
+    data                              = original;
+    Scene::SceneMeshRenderer renderer = GetRecord<Scene::SceneMeshRenderer>(
+        original, Scene::SceneSectionType::MeshRenderers, 0);
+    renderer.node = 3;
+    SetRecord(data, Scene::SceneSectionType::MeshRenderers, 0, renderer);
+    ExpectInvalid(data, "Failed to validate scene: Mesh renderer node out of order");
+
+    data                           = original;
+    Scene::SceneSection transforms = GetSection(original, Scene::SceneSectionType::Transforms);
+    transforms.count--;
+    SetSection(data, transforms);
+    ExpectInvalid(data, "Failed to validate scene: Transform count mismatch");
+}
+
+TEST(Scene, SkipsUnknownSections) {
+    std::vector<std::byte> data = MakeScene();
+
+    Scene::SceneSection section = GetSection(data, Scene::SceneSectionType::MeshRenderers);
+    section.type                = static_cast<Scene::SceneSectionType>(100);
+    std::memcpy(data.data() + GetSectionOffset(data, Scene::SceneSectionType::MeshRenderers), &section,
+                sizeof(section));
+
+    EXPECT_NO_THROW(Scene::Scene::Validate(SceneBuffer(data).GetData()));
+}
@@ -0,0 +1,145 @@
+#include <numeric>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "Telemetry/Histogram.hpp"
+
+namespace {
+    using namespace Pulsar;
+
+    // Frame-time-like durations: log-normal around 2 ms with a long tail.
+    std::vector<uint64_t> MakeSamples(const uint32_t count) {
+        std::mt19937                        random(42);
+        std::lognormal_distribution<double> distribution(std::log(2'000'000.0), 0.6);
+
+        std::vector<uint64_t> samples(count);
+        for (uint64_t &sample : samples) {
+            sample = static_cast<uint64_t>(distribution(random));
+        }
+
+        return samples;
+    }
+}
+
+TEST(Histogram, BucketsTileTheRangeWithoutGaps) {
+    using Telemetry::Histogram;
+
+    for (uint32_t index = 0; index + 1 < Histogram::s_BucketCount; index++) {
+        ASSERT_EQ(Histogram::GetBucketHighest(index) + 1, Histogram::GetBucketLowest(index + 1)) << index;
+    }
+
+    for (uint64_t value = 0; value < Histogram::s_SubBucketCount; value++) {
+        EXPECT_EQ(Histogram::GetBucketLowest(Histogram::GetBucketIndex(value)), value);
+        EXPECT_EQ(Histogram::GetBucketHighest(Histogram::GetBucketIndex(value)), value);
+    }
+
+    // Every value lands in the bucket that covers it, and no bucket is wider than 1/64 of its lowest value.
+    std::mt19937_64 random(1);
+    for (uint32_t i = 0; i < 100000; i++) {
+        const uint64_t value = random() >> (random() % 64);
+        const uint32_t index = Histogram::GetBucketIndex(value);
+
+        ASSERT_LT(index, Histogram::s_BucketCount);
+
+        if (index + 1 < Histogram::s_BucketCount) {
+            const uint64_t lowest  = Histogram::GetBucketLowest(index);
+            const uint64_t highest = Histogram::GetBucketHighest(index);
+
+            ASSERT_LE(lowest, value);
+            ASSERT_GE(highest, value);
+            ASSERT_LE(highest - lowest, lowest / Histogram::s_HalfCount);
+        }
+    }
+
+    // Values past the top bucket saturate rather than index out of bounds.
+    EXPECT_EQ(Histogram::GetBucketIndex(std::numeric_limits<uint64_t>::max()), Histogram::s_BucketCount - 1);
+}
+
+TEST(Histogram, ExactForSmallValues) {
+    Telemetry::Histogram histogram;
+    for (uint64_t value = 1; value <= 100; value++) {
+        histogram.Record(value);
+    }
+
+    EXPECT_EQ(histogram.GetCount(), 100U);
+    EXPECT_EQ(histogram.GetMin(), 1U);
+    EXPECT_EQ(histogram.GetMax(), 100U);
+    EXPECT_DOUBLE_EQ(histogram.GetMean(), 50.5);
+
+    EXPECT_EQ(histogram.GetPercentile(0.0), 1U);
+    EXPECT_EQ(histogram.GetPercentile(50.0), 50U);
+    EXPECT_EQ(histogram.GetPercentile(90.0), 90U);
+    EXPECT_EQ(histogram.GetPercentile(99.0), 99U);
+    EXPECT_EQ(histogram.GetPercentile(99.5), 100U);
+    EXPECT_EQ(histogram.GetPercentile(100.0), 100U);
+    EXPECT_EQ(histogram.GetPercentile(250.0), 100U);
+    EXPECT_EQ(histogram.GetCountAbove(95), 5U);
+}
+
+TEST(Histogram, PercentilesMatchSortedSamples) {
+    using Telemetry::Histogram;
+
+    const std::vector<uint64_t> samples = MakeSamples(100000);
+
+    Histogram histogram;
+    for (const uint64_t sample : samples) {
+        histogram.Record(sample);
+    }
+
+    std::vector<uint64_t> sorted = samples;
+    std::sort(sorted.begin(), sorted.end());
+
+    // The nearest-rank percentile of the raw samples, reported as the top of its bucket.
+    for (const double percentile : {0.0, 1.0, 10.0, 50.0, 75.0, 90.0, 99.0, 99.9, 99.99, 100.0}) {
+        const auto     rank  = std::max<size_t>(1, static_cast<size_t>(std::ceil(percentile / 100.0 * sorted.size())));
+        const uint64_t exact = sorted[rank - 1];
+
+        EXPECT_EQ(histogram.GetPercentile(percentile), Histogram::GetBucketHighest(Histogram::GetBucketIndex(exact)))
+            << "p" << percentile;
+    }
+
+    EXPECT_EQ(histogram.GetMin(), Histogram::GetBucketLowest(Histogram::GetBucketIndex(sorted.front())));
+    EXPECT_EQ(histogram.GetMax(), Histogram::GetBucketHighest(Histogram::GetBucketIndex(sorted.back())));
+
+    const double mean = static_cast<double>(std::accumulate(sorted.begin(), sorted.end(), uint64_t{0})) /
+                        static_cast<double>(sorted.size());
+    EXPECT_DOUBLE_EQ(histogram.GetMean(), mean);
+
+    const uint64_t threshold = 4'000'000;
+    const auto     above     = std::count_if(sorted.begin(), sorted.end(), [threshold](const uint64_t sample) {
+        return Histogram::GetBucketIndex(sample) > Histogram::GetBucketIndex(threshold);
+    });
+    EXPECT_EQ(histogram.GetCountAbove(threshold), static_cast<uint64_t>(above));
+}
+
+TEST(Histogram, RemoveSlidesAWindow) {
+    const std::vector<uint64_t> samples  = MakeSamples(3000);
+    constexpr size_t            s_Window = 1000;
+
+    Telemetry::Histogram sliding;
+    for (size_t i = 0; i < samples.size(); i++) {
+        sliding.Record(samples[i]);
+
+        if (i >= s_Window) {
+            sliding.Remove(samples[i - s_Window]);
+        }
+    }
+
+    Telemetry::Histogram fresh;
+    for (size_t i = samples.size() - s_Window; i < samples.size(); i++) {
+        fresh.Record(samples[i]);
+    }
+
+    EXPECT_EQ(sliding.GetCount(), s_Window);
+    EXPECT_DOUBLE_EQ(sliding.GetMean(), fresh.GetMean());
+
+    for (const double percentile : {0.0, 50.0, 99.0, 100.0}) {
+        EXPECT_EQ(sliding.GetPercentile(percentile), fresh.GetPercentile(percentile));
+    }
+
+    sliding.Reset();
+    EXPECT_EQ(sliding.GetCount(), 0U);
+    EXPECT_EQ(sliding.GetPercentile(50.0), 0U);
+    EXPECT_EQ(sliding.GetMax(), 0U);
+}
@@ -0,0 +1,754 @@
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "FileIo/File.hpp"
+#include "Texture/BlockCompression.hpp"
+#include "Texture/MipChain.hpp"
+#include "Texture/TextureFile.hpp"
+
+// Every encoder is checked against the reference decoders below, written from the format specifications rather
+// than shared with the encoder, so a packing mistake on one side cannot cancel out on the other.
+namespace {
+    using namespace Pulsar;
+
+    // Decoders -------------------------------------------------------------------------------------------------------
+
+    class BitReader {
+    public:
+        explicit BitReader(const uint8_t *data) : m_Data(data) {}
+
+        uint32_t Read(const uint32_t count) {
+            uint32_t value = 0;
+            for (uint32_t i = 0; i < count; i++, m_Bit++) {
+                value |= static_cast<uint32_t>(m_Data[m_Bit / 8] >> (m_Bit % 8) & 1) << i;
+            }
+
+            return value;
+        }
+
+    private:
+        const uint8_t *m_Data;
+        uint32_t       m_Bit = 0;
+    };
+
+    using Block = std::array<uint8_t, 64>; // 4x4 RGBA8 pixels, row by row.
+
+    std::array<std::array<uint8_t, 4>, 4> DecodeBc1Palette(const uint8_t *block, const bool allowThreeColor) {
+        const auto color0 = static_cast<uint32_t>(block[0] | block[1] << 8);
+        const auto color1 = static_cast<uint32_t>(block[2] | block[3] << 8);
+
+        const auto expand = [](const uint32_t color) -> std::array<uint32_t, 3> {
+            const uint32_t red   = color >> 11 & 31;
+            const uint32_t green = color >> 5 & 63;
+            const uint32_t blue  = color & 31;
+            return {red << 3 | red >> 2, green << 2 | green >> 4, blue << 3 | blue >> 2};
+        };
+
+        const std::array<uint32_t, 3> a = expand(color0);
+        const std::array<uint32_t, 3> b = expand(color1);
+
+        std::array<std::array<uint8_t, 4>, 4> palette{};
+        for (uint32_t channel = 0; channel < 3; channel++) {
+            palette[0][channel] = static_cast<uint8_t>(a[channel]);
+            palette[1][channel] = static_cast<uint8_t>(b[channel]);
+
+            if (color0 > color1 || !allowThreeColor) {
+                palette[2][channel] = static_cast<uint8_t>((2 * a[channel] + b[channel]) / 3);
+                palette[3][channel] = static_cast<uint8_t>((a[channel] + 2 * b[channel]) / 3);
+            } else {
+                palette[2][channel] = static_cast<uint8_t>((a[channel] + b[channel]) / 2);
+            }
+        }
+
+        palette[0][3] = palette[1][3] = palette[2][3] = 255;
+        palette[3][3] = color0 > color1 || !allowThreeColor ? 255 : 0;
+
+        return palette;
+    }
+
+    void DecodeBc1(const uint8_t *block, Block &pixels, const bool allowThreeColor) {
+        const auto palette = DecodeBc1Palette(block, allowThreeColor);
+
+        for (uint32_t i = 0; i < 16; i++) {
+            const uint32_t index = block[4 + i / 4] >> (2 * (i % 4)) & 3;
+            std::copy_n(palette[index].begin(), allowThreeColor ? 4 : 3, pixels.begin() + i * 4);
+        }
+    }
+
+    void DecodeBc4(const uint8_t *block, Block &pixels, const uint32_t channel) {
+        const uint32_t value0 = block[0];
+        const uint32_t value1 = block[1];
+
+        std::array<uint32_t, 8> palette = {value0, value1};
+        for (uint32_t i = 1; i < 7; i++) {
+            palette[i + 1] = value0 > value1 ? ((7 - i) * value0 + i * value1) / 7 : 0;
+        }
+
+        if (value0 <= value1) {
+            for (uint32_t i = 1; i < 5; i++) {
+                palette[i + 1] = ((5 - i) * value0 + i * value1) / 5;
+            }
+
+            palette[6] = 0;
+            palette[7] = 255;
+        }
+
+        uint64_t indices = 0;
+        for (uint32_t i = 0; i < 6; i++) {
+            indices |= static_cast<uint64_t>(block[2 + i]) << (8 * i);
+        }
+
+        for (uint32_t i = 0; i < 16; i++) {
+            pixels[i * 4 + channel] = static_cast<uint8_t>(palette[indices >> (3 * i) & 7]);
+        }
+    }
+
+    struct Bc7Layout {
+        uint32_t subsets;
+        uint32_t partitionBits;
+        uint32_t rotationBits;
+        uint32_t selectorBits;
+        uint32_t colorBits;
+        uint32_t alphaBits;
+        uint32_t endpointPBits;
+        uint32_t sharedPBits;
+        uint32_t indexBits;
+        uint32_t secondaryIndexBits;
+    };
+
+    constexpr std::array<Bc7Layout, 8> s_Bc7Layouts = {{
+        {3, 4, 0, 0, 4, 0, 1, 0, 3, 0},
+        {2, 6, 0, 0, 6, 0, 0, 1, 3, 0},
+        {3, 6, 0, 0, 5, 0, 0, 0, 2, 0},
+        {2, 6, 0, 0, 7, 0, 1, 0, 2, 0},
+        {1, 0, 2, 1, 5, 6, 0, 0, 2, 3},
+        {1, 0, 2, 0, 7, 8, 0, 0, 2, 2},
+        {1, 0, 0, 0, 7, 7, 1, 0, 4, 0},
+        {2, 6, 0, 0, 5, 5, 1, 0, 2, 0}
+    }};
+
+    constexpr std::array<std::array<uint8_t, 16>, 64> s_Bc7Partitions2 = [] {
+        constexpr std::array<uint16_t, 64> masks = {
+            0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80, 0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8,
+            0xFF00, 0xFFF0, 0xF000, 0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE, 0x088C, 0x3110,
+            0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C, 0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696,
+            0xA55A, 0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660, 0x0272, 0x04E4, 0x4E40, 0x2720,
+            0xC936, 0x936C, 0x39C6, 0x639C, 0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22
+        };
+
+        std::array<std::array<uint8_t, 16>, 64> partitions{};
+        for (size_t partition = 0; partition < 64; partition++) {
+            for (size_t i = 0; i < 16; i++) {
+                partitions[partition][i] = static_cast<uint8_t>(masks[partition] >> i & 1);
+            }
+        }
+
+        return partitions;
+    }();
+
+    constexpr std::array<std::array<uint8_t, 16>, 64> s_Bc7Partitions3 = {{
+        {0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 1, 2, 2, 2, 2},
+        {0, 0, 0, 1, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 2, 1},
+        {0, 0, 0, 0, 2, 0, 0, 1, 2, 2, 1, 1, 2, 2, 1, 1},
+        {0, 2, 2, 2, 0, 0, 2, 2, 0, 0, 1, 1, 0, 1, 1, 1},
+        {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2},
+        {0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 2, 2, 0, 0, 2, 2},
+        {0, 0, 2, 2, 0, 0, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1},
+        {0, 0, 1, 1, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1},
+        {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2},
+        {0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2},
+        {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2},
+        {0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2},
+        {0, 1, 1, 2, 0, 1, 1, 2, 0, 1, 1, 2, 0, 1, 1, 2},
+        {0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 2, 2, 0, 1, 2, 2},
+        {0, 0, 1, 1, 0, 1, 1, 2, 1, 1, 2, 2, 1, 2, 2, 2},
+        {0, 0, 1, 1, 2, 0, 0, 1, 2, 2, 0, 0, 2, 2, 2, 0},
+        {0, 0, 0, 1, 0, 0, 1, 1, 0, 1, 1, 2, 1, 1, 2, 2},
+        {0, 1, 1, 1, 0, 0, 1, 1, 2, 0, 0, 1, 2, 2, 0, 0},
+        {0, 0, 0, 0, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2},
+        {0, 0, 2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 1, 1, 1, 1},
+        {0, 1, 1, 1, 0, 1, 1, 1, 0, 2, 2, 2, 0, 2, 2, 2},
+        {0, 0, 0, 1, 0, 0, 0, 1, 2, 2, 2, 1, 2, 2, 2, 1},
+        {0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 2, 2, 0, 1, 2, 2},
+        {0, 0, 0, 0, 1, 1, 0, 0, 2, 2, 1, 0, 2, 2, 1, 0},
+        {0, 1, 2, 2, 0, 1, 2, 2, 0, 0, 1, 1, 0, 0, 0, 0},
+        {0, 0, 1, 2, 0, 0, 1, 2, 1, 1, 2, 2, 2, 2, 2, 2},
+        {0, 1, 1, 0, 1, 2, 2, 1, 1, 2, 2, 1, 0, 1, 1, 0},
+        {0, 0, 0, 0, 0, 1, 1, 0, 1, 2, 2, 1, 1, 2, 2, 1},
+        {0, 0, 2, 2, 1, 1, 0, 2, 1, 1, 0, 2, 0, 0, 2, 2},
+        {0, 1, 1, 0, 0, 1, 1, 0, 2, 0, 0, 2, 2, 2, 2, 2},
+        {0, 0, 1, 1, 0, 1, 2, 2, 0, 1, 2, 2, 0, 0, 1, 1},
+        {0, 0, 0, 0, 2, 0, 0, 0, 2, 2, 1, 1, 2, 2, 2, 1},
+        {0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 2, 2, 2},
+        {0, 2, 2, 2, 0, 0, 2, 2, 0, 0, 1, 2, 0, 0, 1, 1},
+        {0, 0, 1, 1, 0, 0, 1, 2, 0, 0, 2, 2, 0, 2, 2, 2},
+        {0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 1, 2, 0},
+        {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 0, 0, 0, 0},
+        {0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0},
+        {0, 1, 2, 0, 2, 0, 1, 2, 1, 2, 0, 1, 0, 1, 2, 0},
+        {0, 0, 1, 1, 2, 2, 0, 0, 1, 1, 2, 2, 0, 0, 1, 1},
+        {0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 0, 0, 0, 0, 1, 1},
+        {0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2},
+        {0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 2, 1, 2, 1, 2, 1},
+        {0, 0, 2, 2, 1, 1, 2, 2, 0, 0, 2, 2, 1, 1, 2, 2},
+        {0, 0, 2, 2, 0, 0, 1, 1, 0, 0, 2, 2, 0, 0, 1, 1},
+        {0, 2, 2, 0, 1, 2, 2, 1, 0, 2, 2, 0, 1, 2, 2, 1},
+        {0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 0, 1, 0, 1},
+        {0, 0, 0, 0, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1},
+        {0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2},
+        {0, 2, 2, 2, 0, 1, 1, 1, 0, 2, 2, 2, 0, 1, 1, 1},
+        {0, 0, 0, 2, 1, 1, 1, 2, 0, 0, 0, 2, 1, 1, 1, 2},
+        {0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 1, 2, 2, 1, 1, 2},
+        {0, 2, 2, 2, 0, 1, 1, 1, 0, 1, 1, 1, 0, 2, 2, 2},
+        {0, 0, 0, 2, 1, 1, 1, 2, 1, 1, 1, 2, 0, 0, 0, 2},
+        {0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 2, 2},
+        {0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2, 2, 1, 1, 2},
+        {0, 1, 1, 0, 0, 1, 1, 0, 2, 2, 2, 2, 2, 2, 2, 2},
+        {0, 0, 2, 2, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 2, 2},
+        {0, 0, 2, 2, 1, 1, 2, 2, 1, 1, 2, 2, 0, 0, 2, 2},
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 2},
+        {0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 1},
+        {0, 2, 2, 2, 1, 2, 2, 2, 0, 2, 2, 2, 1, 2, 2, 2},
+        {0, 1, 0, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2},
+        {0, 1, 1, 1, 2, 0, 1, 1, 2, 2, 0, 1, 2, 2, 2, 0}
+    }};
+
+    constexpr std::array<uint8_t, 64> s_Bc7Anchors2 = {
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 2, 8, 2, 2, 8, 8, 15, 2, 8, 2, 2, 8, 8, 2, 2,
+        15, 15, 6, 8, 2, 8, 15, 15, 2, 8, 2, 2, 2, 15, 15, 6,
+        6, 2, 6, 8, 15, 15, 2, 2, 15, 15, 15, 15, 15, 2, 2, 15
+    };
+
+    constexpr std::array<uint8_t, 64> s_Bc7Anchors3Second = {
+        3, 3, 15, 15, 8, 3, 15, 15, 8, 8, 6, 6, 6, 5, 3, 3,
+        3, 3, 8, 15, 3, 3, 6, 10, 5, 8, 8, 6, 8, 5, 15, 15,
+        8, 15, 3, 5, 6, 10, 8, 15, 15, 3, 15, 5, 15, 15, 15, 15,
+        3, 15, 5, 5, 5, 8, 5, 10, 5, 10, 8, 13, 15, 12, 3, 3
+    };
+
+    constexpr std::array<uint8_t, 64> s_Bc7Anchors3Third = {
+        15, 8, 8, 3, 15, 15, 3, 8, 15, 15, 15, 15, 15, 15, 15, 8,
+        15, 8, 15, 3, 15, 8, 15, 8, 3, 15, 6, 10, 15, 15, 10, 8,
+        15, 3, 15, 10, 10, 8, 9, 10, 6, 15, 8, 15, 3, 6, 6, 8,
+        15, 3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 3, 15, 15, 8
+    };
+
+    uint32_t GetBc7Subset(const uint32_t subsets, const uint32_t partition, const uint32_t pixel) {
+        if (subsets == 1) {
+            return 0;
+        }
+
+        return subsets == 2 ? s_Bc7Partitions2[partition][pixel] : s_Bc7Partitions3[partition][pixel];
+    }
+
+    bool IsBc7Anchor(const uint32_t subsets, const uint32_t partition, const uint32_t pixel) {
+        if (pixel == 0) {
+            return true;
+        }
+
+        if (subsets == 2) {
+            return pixel == s_Bc7Anchors2[partition];
+        }
+
+        return subsets == 3 && (pixel == s_Bc7Anchors3Second[partition] || pixel == s_Bc7Anchors3Third[partition]);
+    }
+
+    uint32_t GetBc7Weight(const uint32_t bits, const uint32_t index) {
+        constexpr std::array<uint32_t, 4>  weights2 = {0, 21, 43, 64};
+        constexpr std::array<uint32_t, 8>  weights3 = {0, 9, 18, 27, 37, 46, 55, 64};
+        constexpr std::array<uint32_t, 16> weights4 = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+        return bits == 2 ? weights2[index] : bits == 3 ? weights3[index] : weights4[index];
+    }
+
+    struct Bc7Block {
+        uint32_t                                mode = 8; // 8 for the reserved encoding.
+        uint32_t                                partition = 0;
+        std::array<std::array<uint32_t, 4>, 6> endpoints{}; // Expanded to 8 bits.
+        std::array<uint32_t, 16>                indices{};
+        Block                                   pixels{};
+    };
+
+    Bc7Block DecodeBc7(const uint8_t *block) {
+        BitReader reader(block);
+        Bc7Block  decoded;
+
+        decoded.mode = 0;
+        while (decoded.mode < 8 && reader.Read(1) == 0) {
+            decoded.mode++;
+        }
+
+        if (decoded.mode == 8) {
+            return decoded;
+        }
+
+        const Bc7Layout &layout = s_Bc7Layouts[decoded.mode];
+        decoded.partition       = reader.Read(layout.partitionBits);
+
+        const uint32_t rotation  = reader.Read(layout.rotationBits);
+        const uint32_t selector  = reader.Read(layout.selectorBits);
+        const uint32_t endpoints = layout.subsets * 2;
+
+        std::array<std::array<uint32_t, 4>, 6> values{};
+        for (uint32_t channel = 0; channel < 4; channel++) {
+            const uint32_t bits = channel < 3 ? layout.colorBits : layout.alphaBits;
+            for (uint32_t endpoint = 0; endpoint < endpoints; endpoint++) {
+                values[endpoint][channel] = reader.Read(bits);
+            }
+        }
+
+        std::array<uint32_t, 6> pBits{};
+        for (uint32_t endpoint = 0; endpoint < endpoints && layout.endpointPBits != 0; endpoint++) {
+            pBits[endpoint] = reader.Read(1);
+        }
+
+        for (uint32_t subset = 0; subset < layout.subsets && layout.sharedPBits != 0; subset++) {
+            pBits[subset * 2] = pBits[subset * 2 + 1] = reader.Read(1);
+        }
+
+        const bool hasPBits = layout.endpointPBits != 0 || layout.sharedPBits != 0;
+
+        for (uint32_t endpoint = 0; endpoint < endpoints; endpoint++) {
+            for (uint32_t channel = 0; channel < 4; channel++) {
+                uint32_t bits  = channel < 3 ? layout.colorBits : layout.alphaBits;
+                uint32_t value = values[endpoint][channel];
+
+                if (bits == 0) {
+                    decoded.endpoints[endpoint][channel] = 255;
+                    continue;
+                }
+
+                if (hasPBits) {
+                    value = value << 1 | pBits[endpoint];
+                    bits++;
+                }
+
+                value <<= 8 - bits;
+                decoded.endpoints[endpoint][channel] = value | value >> bits;
+            }
+        }
+
+        std::array<uint32_t, 16> secondary{};
+        for (uint32_t i = 0; i < 16; i++) {
+            const bool anchor  = IsBc7Anchor(layout.subsets, decoded.partition, i);
+            decoded.indices[i] = reader.Read(layout.indexBits - (anchor ? 1 : 0));
+        }
+
+        for (uint32_t i = 0; i < 16 && layout.secondaryIndexBits != 0; i++) {
+            secondary[i] = reader.Read(layout.secondaryIndexBits - (i == 0 ? 1 : 0));
+        }
+
+        for (uint32_t i = 0; i < 16; i++) {
+            const uint32_t                 subset = GetBc7Subset(layout.subsets, decoded.partition, i);
+            const std::array<uint32_t, 4> &low    = decoded.endpoints[subset * 2];
+            const std::array<uint32_t, 4> &high   = decoded.endpoints[subset * 2 + 1];
+
+            uint32_t colorWeight = GetBc7Weight(layout.indexBits, decoded.indices[i]);
+            uint32_t alphaWeight = colorWeight;
+            if (layout.secondaryIndexBits != 0) {
+                alphaWeight = GetBc7Weight(layout.secondaryIndexBits, secondary[i]);
+                if (selector != 0) {
+                    std::swap(colorWeight, alphaWeight);
+                }
+            }
+
+            for (uint32_t channel = 0; channel < 4; channel++) {
+                const uint32_t weight = channel < 3 ? colorWeight : alphaWeight;
+                decoded.pixels[i * 4 + channel] = static_cast<uint8_t>(
+                    ((64 - weight) * low[channel] + weight * high[channel] + 32) >> 6);
+            }
+
+            if (rotation != 0) {
+                std::swap(decoded.pixels[i * 4 + rotation - 1], decoded.pixels[i * 4 + 3]);
+            }
+        }
+
+        return decoded;
+    }
+
+    // Helpers --------------------------------------------------------------------------------------------------------
+
+    // Smooth color and alpha ramps with a little noise, the content block compression is tuned for.
+    Texture::Image MakeTestImage(const uint32_t width, const uint32_t height, const bool opaque) {
+        std::mt19937 random(width * height);
+
+        Texture::Image image;
+        image.width  = width;
+        image.height = height;
+        image.pixels.resize(static_cast<size_t>(width) * height * 4);
+
+        for (uint32_t y = 0; y < height; y++) {
+            for (uint32_t x = 0; x < width; x++) {
+                const float u = static_cast<float>(x) / static_cast<float>(width);
+                const float v = static_cast<float>(y) / static_cast<float>(height);
+
+                const std::array<float, 4> values = {
+                    127.5F + 127.5F * std::sin(u * 3.0F + v * 2.0F), 255.0F * v,
+                    127.5F + 127.5F * std::cos(u * v * 4.0F), opaque ? 255.0F : 255.0F * u
+                };
+
+                for (uint32_t channel = 0; channel < 4; channel++) {
+                    const float noise = channel < 3 ? static_cast<float>(random() % 5) - 2.0F : 0.0F;
+                    image.pixels[(static_cast<size_t>(y) * width + x) * 4 + channel] = static_cast<uint8_t>(
+                        std::clamp(values[channel] + noise, 0.0F, 255.0F));
+                }
+            }
+        }
+
+        return image;
+    }
+
+    Block GetBlock(const Texture::Image &image, const uint32_t blockX, const uint32_t blockY) {
+        Block block;
+        for (uint32_t y = 0; y < 4; y++) {
+            std::memcpy(block.data() + y * 16,
+                        image.pixels.data() + ((static_cast<size_t>(blockY) * 4 + y) * image.width + blockX * 4) * 4,
+                        16);
+        }
+
+        return block;
+    }
+
+    // Peak signal-to-noise ratio over the channels set in channelMask.
+    double GetPsnr(const std::span<const uint8_t> a, const std::span<const uint8_t> b, const uint32_t channelMask) {
+        double   error = 0.0;
+        uint32_t count = 0;
+
+        for (size_t i = 0; i < a.size(); i++) {
+            if ((channelMask >> (i % 4) & 1) != 0) {
+                const double difference = static_cast<double>(a[i]) - static_cast<double>(b[i]);
+                error += difference * difference;
+                count++;
+            }
+        }
+
+        return error == 0.0 ? 99.0 : 10.0 * std::log10(255.0 * 255.0 * count / error);
+    }
+
+    struct FormatCase {
+        Texture::TextureFormat format;
+        uint32_t               channelMask;
+        bool                   opaque;
+        double                 minimumPsnr;
+    };
+
+    std::vector<uint8_t> DecodeImage(const Texture::CompressedImage &compressed, const Texture::TextureFormat format) {
+        const uint32_t blocksWide = (compressed.width + 3) / 4;
+        const uint32_t blocksHigh = (compressed.height + 3) / 4;
+        const uint32_t blockSize  = Texture::GetBlockSize(format);
+
+        std::vector<uint8_t> pixels(static_cast<size_t>(compressed.width) * compressed.height * 4);
+
+        for (uint32_t blockY = 0; blockY < blocksHigh; blockY++) {
+            for (uint32_t blockX = 0; blockX < blocksWide; blockX++) {
+                const uint8_t *block = compressed.blocks.data() + (blockY * blocksWide + blockX) * blockSize;
+
+                Block decoded{};
+                switch (format) {
+                case Texture::TextureFormat::Bc1Unorm:
+                    DecodeBc1(block, decoded, true);
+                    break;
+                case Texture::TextureFormat::Bc3Unorm:
+                    DecodeBc4(block, decoded, 3);
+                    DecodeBc1(block + 8, decoded, false);
+                    break;
+                case Texture::TextureFormat::Bc4Unorm:
+                    DecodeBc4(block, decoded, 0);
+                    break;
+                case Texture::TextureFormat::Bc5Unorm:
+                    DecodeBc4(block, decoded, 0);
+                    DecodeBc4(block + 8, decoded, 1);
+                    break;
+                default:
+                    decoded = DecodeBc7(block).pixels;
+                    break;
+                }
+
+                for (uint32_t y = 0; y < 4 && blockY * 4 + y < compressed.height; y++) {
+                    for (uint32_t x = 0; x < 4 && blockX * 4 + x < compressed.width; x++) {
+                        const size_t target = (static_cast<size_t>(blockY * 4 + y) * compressed.width + blockX * 4 +
+                                               x) * 4;
+                        std::memcpy(pixels.data() + target, decoded.data() + (y * 4 + x) * 4, 4);
+                    }
+                }
+            }
+        }
+
+        return pixels;
+    }
+}
+
+// Whole images -------------------------------------------------------------------------------------------------------
+
+TEST(BlockCompression, ImageRoundTripStaysAboveQualityFloor) {
+    // Floors sit 1-2 dB under what the Fast encoders reach today, so they catch regressions rather than noise.
+    constexpr std::array<FormatCase, 5> s_Cases = {{
+        {Texture::TextureFormat::Bc1Unorm, 0b0111, true, 32.0},
+        {Texture::TextureFormat::Bc3Unorm, 0b1111, false, 33.0},
+        {Texture::TextureFormat::Bc4Unorm, 0b0001, true, 42.0},
+        {Texture::TextureFormat::Bc5Unorm, 0b0011, true, 42.0},
+        {Texture::TextureFormat::Bc7Unorm, 0b1111, false, 33.0}
+    }};
+
+    for (const FormatCase &testCase : s_Cases) {
+        // 37x23 so the edge blocks repeat their last row and column.
+        const Texture::Image image = MakeTestImage(37, 23, testCase.opaque);
+
+        for (const auto quality : {Texture::CompressionQuality::Fast, Texture::CompressionQuality::Balanced,
+                                   Texture::CompressionQuality::High}) {
+            const Texture::CompressedImage compressed = Texture::CompressImage(image, testCase.format, quality);
+            ASSERT_EQ(compressed.blocks.size(), Texture::GetLevelSize(testCase.format, image.width, image.height));
+
+            const std::vector<uint8_t> decoded = DecodeImage(compressed, testCase.format);
+            EXPECT_GE(GetPsnr(image.pixels, decoded, testCase.channelMask), testCase.minimumPsnr)
+                << "format " << static_cast<int>(testCase.format) << ", quality " << static_cast<int>(quality);
+        }
+    }
+}
+
+TEST(BlockCompression, HigherQualityIsNeverWorse) {
+    const Texture::Image image = MakeTestImage(64, 64, false);
+
+    double previous = 0.0;
+    for (const auto quality : {Texture::CompressionQuality::Fast, Texture::CompressionQuality::Balanced,
+                               Texture::CompressionQuality::High}) {
+        const Texture::CompressedImage compressed = Texture::CompressImage(image, Texture::TextureFormat::Bc7Unorm,
+                                                                           quality);
+        const double psnr = GetPsnr(image.pixels, DecodeImage(compressed, Texture::TextureFormat::Bc7Unorm), 0b1111);
+
+        EXPECT_GE(psnr, previous - 0.05);
+        previous = psnr;
+    }
+}
+
+// BC7 modes ----------------------------------------------------------------------------------------------------------
+
+TEST(BlockCompression, Bc7EveryModeRoundTripsWithinBounds) {
+    struct ModeCase {
+        uint32_t mode;
+        double   minimumPsnr; // Over the channels the mode stores.
+    };
+
+    // About 2 dB under what each mode reaches today. Alpha does not follow the color ramps, which is what holds
+    // back the modes that share indices between them.
+    constexpr std::array<ModeCase, 7> s_Modes = {{
+        {0, 38.5}, {1, 40.0}, {2, 38.5}, {3, 38.0}, {5, 35.0}, {6, 32.5}, {7, 35.5}
+    }};
+
+    const Texture::Image opaque      = MakeTestImage(32, 32, true);
+    const Texture::Image translucent = MakeTestImage(32, 32, false);
+
+    for (const ModeCase &modeCase : s_Modes) {
+        // Modes 0-3 have no alpha and decode it as 255.
+        const Texture::Image &image = modeCase.mode < 4 ? opaque : translucent;
+
+        std::vector<uint8_t> source;
+        std::vector<uint8_t> decoded;
+
+        for (uint32_t blockY = 0; blockY < image.height / 4; blockY++) {
+            for (uint32_t blockX = 0; blockX < image.width / 4; blockX++) {
+                const Block pixels = GetBlock(image, blockX, blockY);
+
+                std::array<uint8_t, 16> block{};
+                Texture::Detail::EncodeBc7Block(pixels.data(), block.data(), modeCase.mode,
+                                                Texture::CompressionQuality::High);
+
+                const Bc7Block result = DecodeBc7(block.data());
+                ASSERT_EQ(result.mode, modeCase.mode);
+
+                source.insert(source.end(), pixels.begin(), pixels.end());
+                decoded.insert(decoded.end(), result.pixels.begin(), result.pixels.end());
+            }
+        }
+
+        EXPECT_GE(GetPsnr(source, decoded, 0b1111), modeCase.minimumPsnr) << "mode " << modeCase.mode;
+    }
+}
+
+TEST(BlockCompression, Bc7PartitionedModesSeparateFlatRegions) {
+    // Flat colors laid out exactly like one partition: the search must find a partition that keeps them apart,
+    // leaving only endpoint quantization error.
+    for (const uint32_t mode : {0U, 1U, 2U, 3U, 7U}) {
+        const uint32_t subsets = s_Bc7Layouts[mode].subsets;
+
+        // One quantization step of the endpoints, p-bit included.
+        const int tolerance = (256 >> (s_Bc7Layouts[mode].colorBits + (mode == 2 ? 0 : 1))) + 1;
+
+        for (const uint32_t partition : {3U, 13U, 17U, 40U}) {
+            if (mode == 0 && partition >= 16) {
+                continue;
+            }
+
+            constexpr std::array<std::array<uint8_t, 4>, 3> s_Colors = {{
+                {200, 30, 40, 255}, {20, 180, 60, 255}, {50, 70, 230, 255}
+            }};
+
+            Block pixels;
+            for (uint32_t i = 0; i < 16; i++) {
+                std::array<uint8_t, 4> color = s_Colors[GetBc7Subset(subsets, partition, i)];
+                if (mode == 7) {
+                    color[3] = static_cast<uint8_t>(GetBc7Subset(subsets, partition, i) == 0 ? 255 : 96);
+                }
+
+                std::copy(color.begin(), color.end(), pixels.begin() + i * 4);
+            }
+
+            std::array<uint8_t, 16> block{};
+            Texture::Detail::EncodeBc7Block(pixels.data(), block.data(), mode, Texture::CompressionQuality::High);
+
+            const Bc7Block result = DecodeBc7(block.data());
+            ASSERT_EQ(result.mode, mode);
+
+            for (uint32_t i = 0; i < 64; i++) {
+                EXPECT_NEAR(result.pixels[i], pixels[i], tolerance) << "mode " << mode << ", partition " << partition;
+            }
+        }
+    }
+}
+
+TEST(BlockCompression, Bc7Mode6Packing) {
+    // A ramp from black at pixel 15 to white at pixel 0.
+    Block pixels;
+    for (uint32_t i = 0; i < 16; i++) {
+        const auto value = static_cast<uint8_t>(255 - i * 17);
+        pixels[i * 4] = pixels[i * 4 + 1] = pixels[i * 4 + 2] = value;
+        pixels[i * 4 + 3]                                     = 255;
+    }
+
+    std::array<uint8_t, 16> block{};
+    Texture::Detail::EncodeBc7Block(pixels.data(), block.data(), 6, Texture::CompressionQuality::Balanced);
+
+    // Mode 6 is the bit pattern 1000000; the seven channel pairs, two p-bits and 63 index bits follow.
+    EXPECT_EQ(block[0] & 0x7F, 0x40);
+
+    BitReader reader(block.data());
+    reader.Read(7);
+
+    std::array<std::array<uint32_t, 4>, 2> endpoints{};
+    for (uint32_t channel = 0; channel < 4; channel++) {
+        endpoints[0][channel] = reader.Read(7);
+        endpoints[1][channel] = reader.Read(7);
+    }
+
+    const uint32_t pBit0 = reader.Read(1);
+    const uint32_t pBit1 = reader.Read(1);
+
+    for (uint32_t channel = 0; channel < 4; channel++) {
+        endpoints[0][channel] = endpoints[0][channel] << 1 | pBit0;
+        endpoints[1][channel] = endpoints[1][channel] << 1 | pBit1;
+    }
+
+    // Pixel 0 is the white end, so its index would have its top bit set; the encoder must have swapped the
+    // endpoints so the 3-bit anchor index still reaches it.
+    EXPECT_GT(endpoints[0][0], endpoints[1][0]);
+    EXPECT_GE(endpoints[0][3], 254U);
+    EXPECT_GE(endpoints[1][3], 254U);
+
+    std::array<uint32_t, 16> indices{};
+    for (uint32_t i = 0; i < 16; i++) {
+        indices[i] = reader.Read(i == 0 ? 3 : 4);
+    }
+
+    // Indices must grow along the ramp towards the black endpoint.
+    for (uint32_t i = 1; i < 16; i++) {
+        EXPECT_GE(indices[i], indices[i - 1]);
+    }
+
+    const Bc7Block result = DecodeBc7(block.data());
+    EXPECT_EQ(result.indices, indices);
+
+    for (uint32_t i = 0; i < 64; i++) {
+        EXPECT_NEAR(result.pixels[i], pixels[i], 4);
+    }
+}
+
+TEST(BlockCompression, Bc7AnchorsSwapEndpoints) {
+    // Every subset is a straight ramp falling away from its anchor, so each anchor index starts out at the far end
+    // with its top bit set, and the encoder has to swap that subset's endpoints to store it.
+    for (const uint32_t mode : {0U, 1U, 2U, 3U, 6U, 7U}) {
+        const uint32_t subsets   = s_Bc7Layouts[mode].subsets;
+        const uint32_t partition = subsets == 1 ? 0 : mode == 0 ? 13 : 17; // Mode 0 only has 16 partitions.
+
+        std::array<uint32_t, 3> ranks{};
+        for (uint32_t i = 0; i < 16; i++) {
+            if (IsBc7Anchor(subsets, partition, i)) {
+                ranks[GetBc7Subset(subsets, partition, i)]++;
+            }
+        }
+
+        Block pixels;
+        for (uint32_t i = 0; i < 16; i++) {
+            const uint32_t subset = GetBc7Subset(subsets, partition, i);
+            const uint32_t rank   = IsBc7Anchor(subsets, partition, i) ? 0 : ranks[subset]++;
+            const auto     value  = static_cast<uint8_t>(250 - rank * 20);
+
+            pixels[i * 4]     = value;
+            pixels[i * 4 + 1] = static_cast<uint8_t>(value / (subset + 1));
+            pixels[i * 4 + 2] = static_cast<uint8_t>(255 - value);
+            pixels[i * 4 + 3] = 255;
+        }
+
+        std::array<uint8_t, 16> block{};
+        Texture::Detail::EncodeBc7Block(pixels.data(), block.data(), mode, Texture::CompressionQuality::High);
+
+        const Bc7Block result = DecodeBc7(block.data());
+        ASSERT_EQ(result.mode, mode);
+
+        // A dropped top bit would leave the anchor near the dark end and misalign every index field after it.
+        for (uint32_t i = 0; i < 64; i++) {
+            EXPECT_NEAR(result.pixels[i], pixels[i], 24) << "mode " << mode << ", pixel " << i / 4;
+        }
+    }
+}
+
+TEST(TextureFile, RejectsLevelsOutsideTheMipChain) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "PulsarTests-Texture.ptex";
+
+    const std::vector<Texture::Image> levels = Texture::GenerateMipChain(MakeTestImage(8, 4, false),
+                                                                         Texture::TextureFormat::Rgba8Unorm);
+    Texture::WriteTextureFile(path.string(), levels, Texture::TextureFormat::Rgba8Unorm);
+
+    const std::vector<std::byte> original = FileIo::ReadFileBytes(path.string());
+    ASSERT_EQ(Texture::TextureFile::Open(path.string()).GetLevels().size(), 4U);
+
+    const auto expectOpenFails = [&path](const std::vector<std::byte> &data, const std::string_view message) {
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()));
+        }
+
+        try {
+            (void)Texture::TextureFile::Open(path.string());
+            ADD_FAILURE() << "Expected \"" << message << "\"";
+        } catch (const std::runtime_error &error) {
+            EXPECT_EQ(error.what(), message);
+        }
+    };
+
+    // Patches one field of the header or of a level record; the bytes after the header are not aligned for T.
+    const auto patch = [&original](const size_t offset, const uint32_t value) {
+        std::vector<std::byte> data = original;
+        std::memcpy(data.data() + offset, &value, sizeof(value));
+
+        return data;
+    };
+
+    const auto levelOffset = [](const uint32_t level) {
+        return sizeof(Texture::TextureHeader) + level * sizeof(Texture::TextureLevel);
+    };
+
+    // Level 2 claims more rows than the image has; the copy would write past it.
+    expectOpenFails(patch(levelOffset(2) + offsetof(Texture::TextureLevel, height), 2),
+                    "Failed to open texture: Level size mismatch");
+    expectOpenFails(patch(levelOffset(1) + offsetof(Texture::TextureLevel, width), 3),
+                    "Failed to open texture: Level size mismatch");
+
+    expectOpenFails(patch(offsetof(Texture::TextureHeader, width), 0), "Failed to open texture: Corrupt header");
+
+    // A fifth level still fits before the data, but an 8x4 image only has four.
+    expectOpenFails(patch(offsetof(Texture::TextureHeader, levelCount), 5), "Failed to open texture: Corrupt header");
+
+    std::filesystem::remove(path);
+}
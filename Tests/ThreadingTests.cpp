@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+
+#include "Threading/SpmcRing.hpp"
+#include "Threading/WorkStealingDeque.hpp"
+
+namespace {
+    using namespace Pulsar;
+
+    constexpr uint32_t s_ThiefCount = 4;
+
+    // How many times each item was taken, by whichever thread took it.
+    class TakenCounts {
+    public:
+        explicit TakenCounts(const uint32_t count) : m_Counts(count) {}
+
+        void Take(const uint32_t item) {
+            m_Counts[item].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void ExpectEachTakenOnce() const {
+            uint32_t missing    = 0;
+            uint32_t duplicated = 0;
+
+            for (const std::atomic<uint32_t> &count : m_Counts) {
+                const uint32_t value = count.load(std::memory_order_relaxed);
+                missing += value == 0 ? 1 : 0;
+                duplicated += value > 1 ? 1 : 0;
+            }
+
+            EXPECT_EQ(missing, 0U);
+            EXPECT_EQ(duplicated, 0U);
+        }
+
+    private:
+        std::vector<std::atomic<uint32_t>> m_Counts;
+    };
+}
+
+TEST(WorkStealingDeque, OwnerIsLifoAndThievesAreFifo) {
+    Threading::WorkStealingDeque<uint32_t> deque(4);
+
+    for (uint32_t i = 0; i < 4; i++) {
+        ASSERT_TRUE(deque.Push(i));
+    }
+
+    EXPECT_FALSE(deque.Push(4));
+    EXPECT_EQ(deque.Pop(), 3U);
+    EXPECT_EQ(deque.Steal(), 0U);
+    EXPECT_EQ(deque.Steal(), 1U);
+    EXPECT_EQ(deque.Pop(), 2U);
+    EXPECT_TRUE(deque.IsEmpty());
+    EXPECT_EQ(deque.Pop(), std::nullopt);
+    EXPECT_EQ(deque.Steal(), std::nullopt);
+
+    // Indices keep growing past the capacity; the buffer has to wrap.
+    for (uint32_t round = 0; round < 10; round++) {
+        ASSERT_TRUE(deque.Push(round));
+        ASSERT_TRUE(deque.Push(round + 100));
+        EXPECT_EQ(deque.Steal(), round);
+        EXPECT_EQ(deque.Pop(), round + 100);
+    }
+}
+
+TEST(WorkStealingDeque, StressEveryItemTakenOnce) {
+    // The owner pops every other item, so it keeps racing the thieves for the last one; the small capacity wraps
+    // the buffer many times and fills it whenever the thieves fall behind.
+    constexpr uint32_t s_ItemCount = 500000;
+
+    Threading::WorkStealingDeque<uint32_t> deque(64);
+    TakenCounts                            taken(s_ItemCount);
+    std::atomic<bool>                      done = false;
+
+    std::vector<std::thread> thieves;
+    for (uint32_t i = 0; i < s_ThiefCount; i++) {
+        thieves.emplace_back([&deque, &taken, &done] {
+            while (true) {
+                if (const std::optional<uint32_t> item = deque.Steal()) {
+                    taken.Take(*item);
+                } else if (done.load(std::memory_order_acquire) && deque.IsEmpty()) {
+                    return;
+                }
+            }
+        });
+    }
+
+    for (uint32_t item = 0; item < s_ItemCount; item++) {
+        while (!deque.Push(item)) {
+            if (const std::optional<uint32_t> popped = deque.Pop()) {
+                taken.Take(*popped);
+            }
+        }
+
+        if (item % 2 == 0) {
+            if (const std::optional<uint32_t> popped = deque.Pop()) {
+                taken.Take(*popped);
+            }
+        }
+    }
+
+    while (const std::optional<uint32_t> popped = deque.Pop()) {
+        taken.Take(*popped);
+    }
+
+    done.store(true, std::memory_order_release);
+    for (std::thread &thief : thieves) {
+        thief.join();
+    }
+
+    taken.ExpectEachTakenOnce();
+}
+
+TEST(SpmcRing, FifoWithinCapacity) {
+    Threading::SpmcRing<uint32_t> ring(3);
+    ASSERT_EQ(ring.GetCapacity(), 4U);
+
+    for (uint32_t i = 0; i < 4; i++) {
+        ASSERT_TRUE(ring.Push(i));
+    }
+
+    EXPECT_FALSE(ring.Push(4));
+
+    uint32_t item = 0;
+    ASSERT_TRUE(ring.Pop(item));
+    EXPECT_EQ(item, 0U);
+
+    // The released cell is reusable straight away.
+    EXPECT_TRUE(ring.Push(4));
+
+    std::array<uint32_t, 8> items{};
+    ASSERT_EQ(ring.PopBatch(items), 4U);
+    EXPECT_EQ(items[0], 1U);
+    EXPECT_EQ(items[3], 4U);
+    EXPECT_FALSE(ring.Pop(item));
+}
+
+TEST(SpmcRing, StressEveryItemTakenOnceInOrder) {
+    constexpr uint32_t s_ItemCount = 500000;
+
+    Threading::SpmcRing<uint32_t> ring(64);
+    TakenCounts                   taken(s_ItemCount);
+    std::atomic<bool>             done       = false;
+    std::atomic<uint32_t>         outOfOrder = 0;
+
+    // Consumers claim cells in ring order, so each one must see its own items in increasing order.
+    std::vector<std::thread> consumers;
+    for (uint32_t i = 0; i < s_ThiefCount; i++) {
+        consumers.emplace_back([&ring, &taken, &done, &outOfOrder, batched = i % 2 == 0] {
+            std::array<uint32_t, 8> items{};
+            int64_t                 last = -1;
+
+            while (true) {
+                // Read before popping: once the producer is done, an empty ring stays empty.
+                const bool   finished = done.load(std::memory_order_acquire);
+                const size_t count    = batched ? ring.PopBatch(items) : ring.Pop(items[0]) ? 1 : 0;
+
+                for (size_t j = 0; j < count; j++) {
+                    taken.Take(items[j]);
+
+                    if (static_cast<int64_t>(items[j]) <= last) {
+                        outOfOrder.fetch_add(1, std::memory_order_relaxed);
+                    }
+
+                    last = items[j];
+                }
+
+                if (count == 0) {
+                    if (finished) {
+                        return;
+                    }
+
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (uint32_t item = 0; item < s_ItemCount; item++) {
+        while (!ring.Push(item)) {
+            std::this_thread::yield();
+        }
+    }
+
+    done.store(true, std::memory_order_release);
+    for (std::thread &consumer : consumers) {
+        consumer.join();
+    }
+
+    taken.ExpectEachTakenOnce();
+    EXPECT_EQ(outOfOrder.load(), 0U);
+}
@@ -0,0 +1,40 @@
+#include <iostream>
+
+#include "FileIo/File.hpp"
+#include "Mesh/MeshFile.hpp"
+#include "Mesh/MeshProcessing.hpp"
+#include "Mesh/ObjParser.hpp"
+
+static void PrintStatistics(const char *label, const Pulsar::Mesh::MeshStatistics &statistics) {
+    std::cout << "[PS] " << label
+        << ": ACMR " << statistics.averageCacheMissRatio
+        << ", ATVR " << statistics.averageTransformedPerVertex
+        << ", overdraw " << statistics.overdraw
+        << ", overfetch " << statistics.overfetch
+        << ", " << statistics.vertexBytes + statistics.indexBytes << " bytes\n";
+}
+
+int main(const int argc, char **argv) {
+    using namespace Pulsar;
+
+    if (argc < 3) {
+        std::cerr << "Usage: PulsarMeshBaker <input obj> <output mesh>\n";
+        return 1;
+    }
+
+    try {
+        Mesh::MeshData mesh = Mesh::ParseObj(FileIo::ReadFile(argv[1]));
+        PrintStatistics("Source", Mesh::AnalyzeMesh(mesh));
+
+        Mesh::OptimizeMesh(mesh);
+        const Mesh::QuantizedMesh quantized = Mesh::QuantizeMesh(mesh);
+        PrintStatistics("Baked", Mesh::AnalyzeMesh(quantized));
+
+        Mesh::WriteMeshFile(argv[2], quantized);
+    } catch (const std::exception &exception) {
+        std::cerr << "[PS] " << exception.what() << '\n';
+        return 1;
+    }
+
+    return 0;
+}
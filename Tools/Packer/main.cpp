@@ -0,0 +1,29 @@
+#include <iostream>
+#include <string>
+
+#include "FileIo/ArchiveWriter.hpp"
+
+int main(const int argc, char **argv) {
+    using namespace Pulsar;
+
+    if (argc < 3) {
+        std::cerr << "Usage: PulsarPacker <input directory> <output archive> [--no-compress]\n";
+        return 1;
+    }
+
+    FileIo::ArchiveWriterConfig config;
+    if (argc > 3 && std::string(argv[3]) == "--no-compress") {
+        config.compress = false;
+    }
+
+    try {
+        FileIo::ArchiveWriter writer = FileIo::ArchiveWriter::Create(config);
+        writer.AddDirectory(argv[1]);
+        writer.Write(argv[2]);
+    } catch (const std::exception &exception) {
+        std::cerr << "[PS] " << exception.what() << '\n';
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include <iostream>
+#include <string>
+
+#include "FileIo/File.hpp"
+#include "Texture/BlockCompression.hpp"
+#include "Texture/Image.hpp"
+#include "Texture/MipChain.hpp"
+#include "Texture/TextureFile.hpp"
+
+namespace {
+    using namespace Pulsar;
+
+    constexpr auto s_Usage = "Usage: PulsarTextureBaker <input image> <output texture> [--linear] "
+                             "[--format rgba8|bc1|bc3|bc4|bc5|bc7] [--quality fast|balanced|high]\n";
+
+    // BC4 and BC5 hold linear data only, so linear is ignored for them.
+    bool ParseFormat(const std::string &name, const bool linear, Texture::TextureFormat &format) {
+        using enum Texture::TextureFormat;
+
+        if (name == "rgba8") {
+            format = linear ? Rgba8Unorm : Rgba8Srgb;
+        } else if (name == "bc1") {
+            format = linear ? Bc1Unorm : Bc1Srgb;
+        } else if (name == "bc3") {
+            format = linear ? Bc3Unorm : Bc3Srgb;
+        } else if (name == "bc4") {
+            format = Bc4Unorm;
+        } else if (name == "bc5") {
+            format = Bc5Unorm;
+        } else if (name == "bc7") {
+            format = linear ? Bc7Unorm : Bc7Srgb;
+        } else {
+            return false;
+        }
+
+        return true;
+    }
+
+    bool ParseQuality(const std::string &name, Texture::CompressionQuality &quality) {
+        if (name == "fast") {
+            quality = Texture::CompressionQuality::Fast;
+        } else if (name == "balanced") {
+            quality = Texture::CompressionQuality::Balanced;
+        } else if (name == "high") {
+            quality = Texture::CompressionQuality::High;
+        } else {
+            return false;
+        }
+
+        return true;
+    }
+}
+
+int main(const int argc, char **argv) {
+    if (argc < 3) {
+        std::cerr << s_Usage;
+        return 1;
+    }
+
+    bool                        linear     = false;
+    std::string                 formatName = "rgba8";
+    Texture::CompressionQuality quality    = Texture::CompressionQuality::Balanced;
+    std::string                 qualityName;
+
+    for (int i = 3; i < argc; i++) {
+        const std::string argument = argv[i];
+
+        if (argument == "--linear") {
+            linear = true;
+        } else if (argument == "--format" && i + 1 < argc) {
+            formatName = argv[++i];
+        } else if (argument == "--quality" && i + 1 < argc) {
+            qualityName = argv[++i];
+        } else {
+            std::cerr << s_Usage;
+            return 1;
+        }
+    }
+
+    Texture::TextureFormat format;
+    if (!ParseFormat(formatName, linear, format) || (!qualityName.empty() && !ParseQuality(qualityName, quality))) {
+        std::cerr << s_Usage;
+        return 1;
+    }
+
+    try {
+        Threading::JobSystem jobSystem = Threading::JobSystem::Create();
+
+        Texture::Image image = Texture::DecodeImage(FileIo::ReadFileBytes(argv[1]));
+        const std::vector<Texture::Image> levels = Texture::GenerateMipChain(std::move(image), format, &jobSystem);
+
+        if (Texture::IsBlockCompressed(format)) {
+            Texture::WriteTextureFile(argv[2], Texture::CompressMipChain(levels, format, quality, &jobSystem), format);
+        } else {
+            Texture::WriteTextureFile(argv[2], levels, format);
+        }
+    } catch (const std::exception &exception) {
+        std::cerr << "[PS] " << exception.what() << '\n';
+        return 1;
+    }
+
+    return 0;
+}